@@ -95,6 +95,22 @@
             2016.11.04 apriori miner object and interface introduced
             2017.05.30 optional output compression with zlib added
             2017.08.01 bug in calls to apriori_data() fixed (arg. order)
+            2026.10.14 option -W# added (parallel support counting)
+            2026.10.14 binary transaction bag files accepted as input
+            2026.10.14 incremental mode added (option -U#)
+            2026.10.14 binary output added (option -B#)
+            2026.10.14 asynchronous output added (option -O)
+            2026.10.14 benchmark records added (option -J#)
+            2026.10.14 top-k item sets with rising support (option -K#)
+            2026.10.14 radix sort of items and transactions used
+            2026.10.14 collapsing of duplicates while reading (-D)
+            2026.10.14 compressed transactions in memory (option -X)
+            2026.10.14 open addressing item map used for item base
+            2026.10.14 tree and output statistics in benchmark records
+            2026.10.14 time and node budgets added (options -L# and -Q#)
+            2026.10.14 flat/parallel transaction tree added (option -Y)
+            2026.10.14 item set index for queries added (option -E#)
+            2026.10.14 tree pruned with the top-k support bound (-K#)
 ------------------------------------------------------------------------
   Reference for the Apriori algorithm:
     R. Agrawal and R. Srikant.
@@ -134,6 +150,7 @@
 #endif
 #include "apriori.h"
 #ifdef APR_MAIN
+#include "isridx.h"
 #include "error.h"
 #endif
 #ifdef STORAGE
@@ -162,6 +179,7 @@
 #define E_AGGMODE   (-14)       /* invalid aggregation mode */
 #define E_STAT      (-16)       /* invalid test statistic */
 #define E_SIGLVL    (-17)       /* invalid significance level */
+#define E_INDEX     (-18)       /* item set index not possible */
 /* error codes -15 to -25 defined in tract.h */
 
 #ifndef QUIET                   /* if not quiet version, */
@@ -198,6 +216,15 @@ struct _apriori {               /* --- apriori miner --- */
   TATREE   *tatree;             /* transaction tree */
   ISTREE   *istree;             /* item set tree (for counting) */
   ITEM     *map;                /* identifier map for filtering */
+  int      cpus;                /* number of threads for counting */
+  BENCHREC *bench;              /* benchmark record (phase times) */
+  size_t   topk;                /* number of best item sets (0: all) */
+  double   tmax;                /* time budget in seconds (0: none) */
+  size_t   nmax;                /* budget of tree nodes (0: none) */
+  int      stop;                /* whether the budget is exhausted */
+  ITEM     zcov;                /* maximum size of complete levels */
+  ITEM     prune;               /* min. size for evaluation pruning */
+  int      order;               /* size order of item set output */
 };                              /* (apriori miner) */
 
 /*----------------------------------------------------------------------
@@ -224,7 +251,8 @@ static const char *errmsgs[] = {
   /* E_NOITEMS -15 */  "no (frequent) items found",
   /* E_STAT    -16 */  "invalid test statistic '%c'",
   /* E_SIGLVL  -17 */  "invalid significance level/p-value %g",
-  /*           -18 */  "unknown error"
+  /* E_INDEX   -18 */  "item set index needs target 's' and -m1 or -m0",
+  /*           -19 */  "unknown error"
 };
 #endif
 
@@ -242,6 +270,11 @@ static ISREPORT *report = NULL; /* item set reporter */
 static TABWRITE *twrite = NULL; /* table writer for pattern spectrum */
 static double   *border = NULL; /* support border for filtering */
 static APRIORI *apriori = NULL; /* apriori miner object */
+#ifndef APRIACC
+static TABAG    *incbag = NULL; /* transactions to append */
+static BENCHREC *bench  = NULL; /* benchmark record */
+static ISRIDX   *isxidx = NULL; /* item set index (for isridx) */
+#endif
 #endif
 
 /*----------------------------------------------------------------------
@@ -285,6 +318,15 @@ APRIORI* apriori_create (int target, double smin, double smax,
   apriori->tatree = NULL;
   apriori->istree = NULL;
   apriori->map    = NULL;
+  apriori->cpus   = 1;
+  apriori->bench  = NULL;
+  apriori->topk   = 0;
+  apriori->tmax   = 0;
+  apriori->nmax   = 0;
+  apriori->stop   = 0;
+  apriori->zcov   = zmax;
+  apriori->prune  = ITEM_MIN;
+  apriori->order  = 0;
   return apriori;               /* return the created apriori miner */
 }  /* apriori_create() */
 
@@ -317,10 +359,41 @@ void apriori_delete (APRIORI *apriori, int deldar)
 
 /*--------------------------------------------------------------------*/
 
+static void setsupp (APRIORI *apriori)
+{                               /* --- compute absolute support */
+  double smin;                  /* absolute minimum support */
+  SUPP   w;                     /* total transaction weight */
+
+  assert(apriori);              /* check the function argument */
+  w = tbg_wgt(apriori->tabag);  /* compute absolute minimum support */
+  smin = ceilsupp((apriori->smin < 0) ? -apriori->smin
+                : (apriori->smin/100.0) *(double)w *(1-DBL_EPSILON));
+  apriori->body = (SUPP)smin;   /* compute body and body&head support */
+  if ((apriori->target & ISR_RULES) && !(apriori->mode & APR_ORIGSUPP))
+    smin *= apriori->conf *(1-DBL_EPSILON);
+  apriori->supp = (SUPP)ceilsupp(smin);
+}  /* setsupp() */
+
+/*--------------------------------------------------------------------*/
+
+static ITEM maxsize (APRIORI *apriori)
+{                               /* --- get maximum extension size */
+  ITEM m, xmax;                 /* maximum transaction/set size */
+
+  assert(apriori);              /* check the function argument */
+  xmax = ((apriori->target & (ISR_CLOSED|ISR_MAXIMAL))
+      && !(apriori->target & ISR_RULES)
+      &&  (apriori->zmax   < ITEM_MAX))
+       ? apriori->zmax+1 : apriori->zmax;
+  m = tbg_max(apriori->tabag);  /* compute maximum extension size */
+  return (xmax > m) ? m : xmax; /* and limit it to transaction size */
+}  /* maxsize() */
+
+/*--------------------------------------------------------------------*/
+
 int apriori_data (APRIORI *apriori, TABAG *tabag, int mode, int sort)
 {                               /* --- prepare data for Apriori */
   ITEM    m;                    /* number of items */
-  double  smin;                 /* absolute minimum support */
   SUPP    w;                    /* total transaction weight */
   int     e;                    /* evaluation without flags */
   #ifndef QUIET                 /* if to print messages */
@@ -332,19 +405,17 @@ int apriori_data (APRIORI *apriori, TABAG *tabag, int mode, int sort)
   apriori->tabag = tabag;       /* note the transaction bag */
 
   /* --- compute data-specific parameters --- */
-  w = tbg_wgt(tabag);           /* compute absolute minimum support */
-  smin = ceilsupp((apriori->smin < 0) ? -apriori->smin
-                : (apriori->smin/100.0) *(double)w *(1-DBL_EPSILON));
-  apriori->body = (SUPP)smin;   /* compute body and body&head support */
-  if ((apriori->target & ISR_RULES) && !(apriori->mode & APR_ORIGSUPP))
-    smin *= apriori->conf *(1-DBL_EPSILON);
-  apriori->supp = (SUPP)ceilsupp(smin);
+  setsupp(apriori);             /* compute absolute minimum support */
 
   /* --- sort and recode items --- */
   if (!(mode & APR_NORECODE)) { /* if to sort and recode the items */
     CLOCK(t);                   /* start timer, print log message */
     XMSG(stderr, "filtering, sorting and recoding items ... ");
-    m = tbg_recode(tabag, apriori->supp, -1, -1, sort);
+    bnr_begin(apriori->bench, "recode");
+    w = (apriori->mode & APR_INCR) ? 0 : apriori->supp;
+    /* In incremental mode all items are kept (with fixed codes), */
+    /* because they may become frequent with new transactions. */
+    m = tbg_recode(tabag, w, -1, -1, sort);
     if (m < 0) return E_NOMEM;  /* recode items and transactions */
     if (m < 1) return E_NOITEMS;/* and check the number of items */
     XMSG(stderr, "[%"ITEM_FMT" item(s)]", m);
@@ -354,17 +425,21 @@ int apriori_data (APRIORI *apriori, TABAG *tabag, int mode, int sort)
   /* --- sort and reduce transactions --- */
   CLOCK(t);                     /* start timer, print log message */
   XMSG(stderr, "sorting and reducing transactions ... ");
+  bnr_begin(apriori->bench, "reduce");
   e = apriori->eval & ~APR_INVBXS;
   if (!(mode & APR_NOFILTER)    /* filter transactions if possible */
+  &&  !(apriori->mode & APR_INCR)
   &&  !(apriori->target & ISR_RULES)
   &&  ((e <= RE_NONE) || (e >= RE_FNCNT)))
     tbg_filter(tabag, apriori->zmin, NULL, 0);
   if (!(mode & APR_NOSORT)) {   /* if to sort items and transactions, */
-    tbg_itsort(tabag, +1, 0);   /* sort items in transactions and */
-    tbg_sort(tabag, +1, 0);     /* sort the trans. lexicographically */
+    tbg_setcpus(tabag, apriori->cpus);  /* (radix sort if possible) */
+    tbg_itsort(tabag, +1, TA_RADIX);    /* sort items in transactions */
+    tbg_sort  (tabag, +1, TA_RADIX);    /* and the transactions */
     if (!(mode & APR_NOREDUCE)) /* if to combine equal transactions, */
       tbg_reduce(tabag, 0);     /* reduce transactions to unique ones */
   }                             /* (need sorting for reduction) */
+  bnr_end(apriori->bench);      /* end the reduction phase */
   #ifndef QUIET                 /* if to print messages */
   n = tbg_cnt(tabag);           /* get the number of transactions */
   w = tbg_wgt(tabag);           /* and the transaction weight */
@@ -372,9 +447,31 @@ int apriori_data (APRIORI *apriori, TABAG *tabag, int mode, int sort)
   if (w != (SUPP)n) { XMSG(stderr, "/%"SUPP_FMT, w); }
   XMSG(stderr, " transaction(s)] done [%.2fs].\n", SEC_SINCE(t));
   #endif
+
+  /* --- compress the transactions --- */
+  if ((mode & APR_COMPRESS)     /* if to compress the transactions */
+  &&  !(apriori->mode & (APR_TATREE|APR_INCR))) {
+    CLOCK(t);                   /* start timer, print log message */
+    XMSG(stderr, "compressing transactions ... ");
+    if (tbg_compress(tabag) < 0) return E_NOMEM;
+    XMSG(stderr, "[%"SIZE_FMT" byte(s)]", tbg_zipsize(tabag));
+    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* (tree and appending need trans.) */
   return 0;                     /* return 'ok' */
 }  /* apriori_data() */
 
+/* As for fpgrowth, all state of a search is held in the APRIORI    */
+/* object, its item set tree and the item set reporter attached to  */
+/* it, so that several miners may run concurrently in one process,  */
+/* provided each of them has its own APRIORI and ISREPORT objects.  */
+/* A transaction bag prepared by one miner may be given to others   */
+/* with APR_NORECODE|APR_NOFILTER|APR_NOSORT (without               */
+/* APR_COMPRESS), which leaves it untouched. However,               */
+/* apriori_mine() filters the transaction bag in place if no        */
+/* transaction tree is used and item filtering is requested (filter */
+/* != 0), and apriori_update() adds transactions to it. In these    */
+/* cases each miner needs its own copy (see tbg_clone()).           */
+
 /*--------------------------------------------------------------------*/
 
 int apriori_report (APRIORI *apriori, ISREPORT *report)
@@ -393,6 +490,9 @@ int apriori_report (APRIORI *apriori, ISREPORT *report)
   if (apriori->mode & APR_ZLIB) /* if the compression flag is set, */
     mrep |= ISR_ZLIB;           /* transfer it to the report mode */
   #endif
+  if (apriori->mode & APR_BINARY) mrep |= ISR_BINARY;
+  if (apriori->mode & APR_DELTA)  mrep |= ISR_DELTA;
+  if (apriori->mode & APR_ASYNC)  mrep |= ISR_ASYNC;
 
   /* --- configure item set reporter --- */
   w = tbg_wgt(apriori->tabag);  /* set support and size range */
@@ -407,31 +507,180 @@ int apriori_report (APRIORI *apriori, ISREPORT *report)
   if ((isr_prefmt(report, (TID)apriori->supp, n)      != 0)
   ||  (isr_settarg(report, apriori->target, mrep, -1) != 0))
     return E_NOMEM;             /* set pre-format and target type */
+  if ((apriori->topk > 0)       /* if to find the best item sets, */
+  &&  (isr_settopk(report, apriori->topk) != 0))
+    return E_NOMEM;             /* create a top-k collector */
   return 0;                     /* return 'ok' */
 }  /* apriori_report() */
 
 /*--------------------------------------------------------------------*/
 
+void apriori_setcpus (APRIORI *apriori, int cpus)
+{                               /* --- set number of threads */
+  assert(apriori);              /* check the function argument */
+  apriori->cpus = cpus;         /* note the number of threads */
+}  /* apriori_setcpus() */      /* (<= 0: use all processors) */
+
+/*--------------------------------------------------------------------*/
+
+void apriori_setbench (APRIORI *apriori, BENCHREC *bench)
+{                               /* --- set benchmark record */
+  assert(apriori);              /* check the function argument */
+  apriori->bench = bench;       /* note the benchmark record */
+}  /* apriori_setbench() */     /* (NULL: no benchmarking) */
+
+/*--------------------------------------------------------------------*/
+
+void apriori_settopk (APRIORI *apriori, size_t k)
+{                               /* --- set number of best item sets */
+  assert(apriori);              /* check the function argument */
+  apriori->topk = ((apriori->target & (ISR_MAXIMAL|ISR_RULES))
+               ||  (apriori->mode   & APR_INCR)) ? 0 : k;
+}  /* apriori_settopk() */      /* (0: report all item sets) */
+
+/* The best item sets are collected by the item set reporter (see   */
+/* isr_settopk()), which raises its minimum support as soon as k    */
+/* item sets have been collected. In addition, apriori_mine()       */
+/* raises the minimum support of the item set tree to the k-th      */
+/* largest support of the (reportable) item sets counted so far     */
+/* before it adds a new level, so that candidates that cannot be    */
+/* among the best are never created. This is only done if all       */
+/* frequent item sets are reported without any further filtering    */
+/* (no closed item sets or generators, no evaluation measure, no    */
+/* border), since otherwise the counted item sets need not be       */
+/* reported. Maximal item sets and association rules are excluded   */
+/* (as in fpgrowth), and so is the incremental mode, in which the   */
+/* item sets are reported repeatedly with the same reporter.        */
+
+/*--------------------------------------------------------------------*/
+
+void apriori_setbudget (APRIORI *apriori, double secs, size_t nodes)
+{                               /* --- set the search budget */
+  assert(apriori);              /* check the function argument */
+  if (apriori->mode & APR_INCR){/* no budget in incremental mode */
+    secs = 0; nodes = 0; }      /* (tree is rebuilt on updates) */
+  apriori->tmax = (secs > 0) ? secs : 0;
+  apriori->nmax = nodes;        /* note the time budget (in seconds) */
+}  /* apriori_setbudget() */    /* and the budget of tree nodes */
+
+/*--------------------------------------------------------------------*/
+
+ITEM apriori_covered (APRIORI *apriori)
+{                               /* --- get the covered set size */
+  assert(apriori);              /* check the function argument */
+  return apriori->zcov;         /* return the max. size up to which */
+}  /* apriori_covered() */      /* all item sets have been found */
+
+/* The search budget is checked before a new level is added to the  */
+/* item set tree: if the wall clock time since the start of the     */
+/* search exceeds the time budget or the item set tree has more     */
+/* nodes than the node budget, no further levels are added, the     */
+/* item sets found so far are reported and apriori_mine() returns 1 */
+/* (instead of 0) to indicate a partial result. Since the levels    */
+/* are processed completely, the result is complete for all item    */
+/* sets up to the size returned by apriori_covered(). For closed    */
+/* and maximal item sets the last level cannot be filtered (as the  */
+/* next level is missing) and thus is not reported.                 */
+
+/*--------------------------------------------------------------------*/
+
+static int output (APRIORI *apriori)
+{                               /* --- report found item sets */
+  ITEM    prune;                /* min. size for evaluation pruning */
+  #ifndef QUIET                 /* if to print messages */
+  clock_t t;                    /* timer for measurements */
+  #endif                        /* (only needed for messages) */
+
+  assert(apriori && apriori->istree); /* check the function argument */
+  prune = apriori->prune;       /* get the evaluation pruning size */
+
+  /* --- filter found item sets --- */
+  if ((prune >  ITEM_MIN)       /* if to filter with evaluation */
+  &&  (prune <= 0)) {           /* (backward and weak forward) */
+    CLOCK(t);                   /* start the timer for filtering */
+    XMSG(stderr, "filtering with evaluation ... ");
+    bnr_begin(apriori->bench, "filter");
+    ist_filter(apriori->istree, prune);
+    XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* mark non-qualifying sets */
+  #ifdef APR_ABORT              /* if to check for interrupt */
+  if (sig_aborted()) { cleanup(apriori); return -1; }
+  #endif                        /* abort the function if requested */
+  if (apriori->target & (ISR_CLOSED|ISR_MAXIMAL|ISR_GENERAS)) {
+    CLOCK(t);                   /* start the timer for filtering */
+    XMSG(stderr, "filtering for %s item sets ... ",
+         (apriori->target & ISR_GENERAS) ? "generator" :
+         (apriori->target & ISR_MAXIMAL) ? "maximal" : "closed");
+    bnr_begin(apriori->bench, "filter");
+    ist_clomax(apriori->istree, /* filter closed/maximal/generators */
+               apriori->target | ((prune > ITEM_MIN) ? IST_SAFE : 0));
+    XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
+  }
+  #ifdef APR_ABORT              /* if to check for interrupt */
+  if (sig_aborted()) { cleanup(apriori); return -1; }
+  #endif                        /* abort the function if requested */
+
+  /* --- report item sets/association rules --- */
+  CLOCK(t);                     /* start the output timer */
+  XMSG(stderr, "writing %s ... ", isr_name(apriori->report));
+  bnr_begin(apriori->bench, "report");
+  ist_init(apriori->istree, apriori->order);
+  if (ist_report(apriori->istree, apriori->report, apriori->target) < 0)
+    return cleanup(apriori);    /* report item sets/association rules */
+  if ((apriori->topk > 0)       /* if only the best item sets */
+  &&  (isr_reptopk(apriori->report) < 0))   /* were collected, */
+    return cleanup(apriori);    /* report them now */
+  bnr_end(apriori->bench);      /* end the reporting phase */
+  XMSG(stderr, "[%"SIZE_FMT" %s(s)]", isr_repcnt(apriori->report),
+               (apriori->target == ISR_RULES) ? "rule" : "set");
+  XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  #ifdef BENCH                  /* if benchmark version, */
+  ist_stats(apriori->istree);   /* show the search statistics */
+  #endif                        /* (especially memory usage) */
+  if (apriori->mode & APR_INCR) /* if in incremental mode, */
+    ist_clear(apriori->istree); /* only clear the filter markers */
+  else                          /* otherwise clean up */
+    cleanup(apriori);           /* the allocated memory */
+  return 0;                     /* return 'ok' */
+}  /* output() */
+
+/*--------------------------------------------------------------------*/
+
 int apriori_mine (APRIORI *apriori, ITEM prune, double filter,int order)
 {                               /* --- apriori algorithm */
-  ITEM    m, i, k;              /* number of items, loop variables */
-  ITEM    size;                 /* number of items in set/rule */
-  ITEM    xmax;                 /* maximum size for extensions */
-  int     e, mode;              /* evaluation without flags, mode */
-  clock_t t, tt, tc, x;         /* timers for measurements */
+  ITEM     m, i, k;             /* number of items, loop variables */
+  ITEM     size;                /* number of items in set/rule */
+  ITEM     xmax;                /* maximum size for extensions */
+  int      e, mode;             /* evaluation without flags, mode */
+  int      z;                   /* flag for compressed transactions */
+  SUPP     smin;                /* support bound for top-k mode */
+  size_t   topk;                /* number of best item sets */
+  double   tend;                /* deadline for the search */
+  clock_t  t, tt, tc, x;        /* timers for measurements */
+  ISTSTATS sts;                 /* statistics of the item set tree */
 
   assert(apriori);              /* check the function arguments */
   e = apriori->eval & ~APR_INVBXS; /* check and adapt evaluation */
   if (e <= RE_NONE) prune = ITEM_MIN;
+  if (apriori->mode & APR_INCR){/* if in incremental mode */
+    apriori->mode &= ~APR_POST; /* keep the infrequent item sets, */
+    filter = 0;                 /* do not filter items in the data */
+    if (prune > 0) prune = 0;   /* and replace forward pruning */
+  }                             /* by backward pruning */
+  apriori->prune = prune;       /* note the output parameters */
+  apriori->order = order;       /* for function output() */
 
   /* --- create transaction tree --- */
   tt = 0;                       /* init. the tree construction time */
   if (apriori->mode & APR_TATREE) { /* if to use a transaction tree */
     t = clock();                /* start the timer for construction */
     XMSG(stderr, "building transaction tree ... ");
-    apriori->tatree = tat_create(apriori->tabag);
+    bnr_begin(apriori->bench, "build");
+    apriori->tatree = tat_createx(apriori->tabag,
+                        (apriori->mode & APR_TATFLAT) ? TAT_FLAT : 0);
     if (!apriori->tatree)       /* create a transaction tree */
       return E_NOMEM;           /* as a compressed representation */
+    bnr_int(apriori->bench, "nodes", (double)tat_size(apriori->tatree));
     XMSG(stderr, "[%"SIZE_FMT" node(s)]", tat_size(apriori->tatree));
     XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
     tt = clock() -t;            /* note the time for the construction */
@@ -442,22 +691,25 @@ int apriori_mine (APRIORI *apriori, ITEM prune, double filter,int order)
   ||  ((e > RE_NONE) && (e < RE_FNCNT)) || order)
     apriori->mode &= ~IST_PERFECT; /* remove perfect ext. pruning */
   t = clock(); tc = 0;          /* start the timer for the search */
+  bnr_begin(apriori->bench, "mine");
+  tend = (apriori->tmax > 0) ? bnr_wall() +apriori->tmax : 0;
+  apriori->stop = 0;            /* compute the deadline of the search */
   mode = apriori->mode & ~(IST_PARTIAL|IST_REVERSE);
   apriori->istree = ist_create(tbg_base(apriori->tabag), mode,
                          apriori->supp, apriori->body, apriori->conf);
   if (!apriori->istree) return cleanup(apriori);
-  xmax = ((apriori->target & (ISR_CLOSED|ISR_MAXIMAL))
-      && !(apriori->target & ISR_RULES)
-      &&  (apriori->zmax   < ITEM_MAX))
-       ? apriori->zmax+1 : apriori->zmax;
-  m = tbg_max(apriori->tabag);  /* compute maximum extension size */
-  if (xmax > m) xmax = m;       /* and limit it to transaction size */
+  ist_setcpus(apriori->istree, apriori->cpus);
+  xmax = maxsize(apriori);      /* get maximum extension size */
   if (e == APR_LDRATIO)         /* set additional evaluation measure */
        isr_seteval(apriori->report, isr_logrto, NULL,
                    +1, apriori->thresh);
   else ist_seteval(apriori->istree, apriori->eval, apriori->agg,
                    apriori->thresh, prune);
 
+  topk = ((apriori->target & (ISR_CLOSED|ISR_GENERAS))
+       || (e > RE_NONE) || (isr_bdrcnt(apriori->report) > 0))
+       ? 0 : apriori->topk;     /* get bound for pruning with top-k */
+
   /* --- check item subsets --- */
   XMSG(stderr, "checking subsets of size 1");
   m = tbg_itemcnt(apriori->tabag); /* create an item map for pruning */
@@ -470,11 +722,24 @@ int apriori_mine (APRIORI *apriori, ITEM prune, double filter,int order)
     size = ist_height(apriori->istree);
     if (size >= xmax)           /* get the current item set size and */
       break;                    /* abort if maximal size is reached */
+    if (topk > 0) {             /* if to find only the best sets */
+      smin = ist_kthsupp(apriori->istree, isr_zmin(apriori->report),
+                         isr_zmax(apriori->report),
+                         (SUPP)isr_smax(apriori->report), topk);
+      if (smin > ist_smin(apriori->istree)) /* raise min. support */
+        ist_setsmin(apriori->istree, smin, smin);
+    }                           /* to the k-th best support so far */
     if ((filter != 0)           /* if to filter w.r.t. item usage */
     && ((i = ist_check(apriori->istree, (int*)apriori->map)) <= size))
       break;                    /* check which items are still used */
     if (apriori->mode & APR_POST)    /* if a-posteriori pruning, */
       ist_prune(apriori->istree);    /* prune infrequent item sets */
+    if ((tend > 0) && (bnr_wall() >= tend)) {
+      apriori->stop = 1; break; }    /* check the time budget */
+    if (apriori->nmax > 0) {    /* if there is a node budget */
+      ist_getstats(apriori->istree, -1, &sts);
+      if (sts.nodes > apriori->nmax) { apriori->stop = 1; break; }
+    }                           /* check the size of the tree */
     k = ist_addlvl(apriori->istree); /* add a level to the tree */
     if (k < 0) return cleanup(apriori);
     if (k > 0) break;           /* if no level was added, abort */
@@ -488,68 +753,118 @@ int apriori_mine (APRIORI *apriori, ITEM prune, double filter,int order)
         if (tat_filter(apriori->tatree, size+1, (int*)apriori->map, 0))
           return cleanup(apriori); }   /* filter the transaction tree */
       else {                    /* if there is only a transaction bag */
+        z = tbg_iszip(apriori->tabag);    /* expand compressed trans. */
+        if (z && (tbg_expand(apriori->tabag) != 0))
+          return cleanup(apriori);        /* for the filtering */
         tbg_filter(apriori->tabag, size+1, (int*)apriori->map, 0);
         tbg_sort  (apriori->tabag, 0, 0); /* remove unnecessary items */
         tbg_reduce(apriori->tabag, 0);    /* and trans. and reduce */
-      }                                   /* trans. to unique ones */
+        if (z && (tbg_compress(apriori->tabag) != 0))
+          return cleanup(apriori);        /* trans. to unique ones */
+      }                                   /* and compress them again */
       tt = clock() -x;          /* note the filter/rebuild time */
     }
     size += 1;                  /* increment the item set size */
     XMSG(stderr, " %"ITEM_FMT, size);          /* and print it */
     x = clock();                /* start the timer for counting */
-    if (apriori->tatree) ist_countx(apriori->istree, apriori->tatree);
-    else                 ist_countb(apriori->istree, apriori->tabag);
-    ist_commit(apriori->istree);/* count the transaction tree/bag */
+    if ((apriori->tatree)       /* count the transaction tree/bag */
+    ?   (ist_countx(apriori->istree, apriori->tatree) != 0)
+    :   (ist_countb(apriori->istree, apriori->tabag)  != 0))
+      return cleanup(apriori);  /* and check for an error */
+    ist_commit(apriori->istree);/* and commit the counters */
     tc = clock() -x;            /* compute the new counting time */
   }
   free(apriori->map);           /* delete the filter map */
   apriori->map = NULL;          /* and the transaction tree */
-  if (apriori->tatree && !(apriori->mode & APR_NOCLEAN)) {
+  if (apriori->tatree && (!(apriori->mode & APR_NOCLEAN)
+  ||                       (apriori->mode & APR_INCR))) {
     tat_delete(apriori->tatree, 0); apriori->tatree = NULL; }
+  bnr_end(apriori->bench);      /* end the mining phase */
+  bnr_int(apriori->bench, "levels", ist_height(apriori->istree));
+  apriori->zcov = apriori->zmax;/* get the covered item set size */
+  if (apriori->stop) {          /* if the search budget is exhausted */
+    apriori->zcov = ist_height(apriori->istree);
+    if (apriori->target & (ISR_CLOSED|ISR_MAXIMAL))
+      apriori->zcov -= 1;       /* last level cannot be filtered */
+    if (apriori->zcov < apriori->zmax)
+      isr_setsize(apriori->report, isr_zmin(apriori->report),
+                  apriori->zcov);
+    XMSG(stderr, " (stopped)"); /* report only the complete levels */
+  }                             /* and note the search stop */
+  if (apriori->bench) {         /* if to write a benchmark record */
+    ist_getstats(apriori->istree, -1, &sts);
+    bnr_int(apriori->bench, "istnodes", (double)sts.nodes);
+    bnr_int(apriori->bench, "istmem",   (double)sts.mem);
+  }                             /* note the size of the tree */
   XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
   #ifdef APR_ABORT              /* if to check for interrupt */
   if (sig_aborted()) { cleanup(apriori); return -1; }
   #endif                        /* abort the function if requested */
+  if (apriori->mode & APR_INCR) /* in incremental mode keep the tree */
+    return 0;                   /* and report with apriori_update() */
+  k = output(apriori);          /* report the found item sets */
+  return (k < 0) ? k : apriori->stop;
+}  /* apriori_mine() */         /* return whether result is partial */
 
-  /* --- filter found item sets --- */
-  if ((prune >  ITEM_MIN)       /* if to filter with evaluation */
-  &&  (prune <= 0)) {           /* (backward and weak forward) */
-    CLOCK(t);                   /* start the timer for filtering */
-    XMSG(stderr, "filtering with evaluation ... ");
-    ist_filter(apriori->istree, prune);
-    XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
-  }                             /* mark non-qualifying sets */
-  #ifdef APR_ABORT              /* if to check for interrupt */
-  if (sig_aborted()) { cleanup(apriori); return -1; }
-  #endif                        /* abort the function if requested */
-  if (apriori->target & (ISR_CLOSED|ISR_MAXIMAL|ISR_GENERAS)) {
-    CLOCK(t);                   /* start the timer for filtering */
-    XMSG(stderr, "filtering for %s item sets ... ",
-         (apriori->target & ISR_GENERAS) ? "generator" :
-         (apriori->target & ISR_MAXIMAL) ? "maximal" : "closed");
-    ist_clomax(apriori->istree, /* filter closed/maximal/generators */
-               apriori->target | ((prune > ITEM_MIN) ? IST_SAFE : 0));
-    XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
-  }
-  #ifdef APR_ABORT              /* if to check for interrupt */
-  if (sig_aborted()) { cleanup(apriori); return -1; }
-  #endif                        /* abort the function if requested */
+/*--------------------------------------------------------------------*/
 
-  /* --- report item sets/association rules --- */
-  CLOCK(t);                     /* start the output timer */
-  XMSG(stderr, "writing %s ... ", isr_name(apriori->report));
-  ist_init(apriori->istree, order); /* initialize the extraction */
-  if (ist_report(apriori->istree, apriori->report, apriori->target) < 0)
-    return cleanup(apriori);    /* report item sets/association rules */
-  XMSG(stderr, "[%"SIZE_FMT" %s(s)]", isr_repcnt(apriori->report),
-               (apriori->target == ISR_RULES) ? "rule" : "set");
-  XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
-  #ifdef BENCH                  /* if benchmark version, */
-  ist_stats(apriori->istree);   /* show the search statistics */
-  #endif                        /* (especially memory usage) */
-  cleanup(apriori);             /* clean up the allocated memory */
-  return 0;                     /* return 'ok' */
-}  /* apriori_mine() */
+int apriori_update (APRIORI *apriori, TABAG *tabag)
+{                               /* --- update with new transactions */
+  TID     i, n;                 /* loop variable, num. of transactions */
+  int     k;                    /* number of rebuilt tree levels */
+  SUPP    w;                    /* total transaction weight */
+  double  smax;                 /* absolute maximum support */
+  TRACT   *c;                   /* copy of a new transaction */
+  #ifndef QUIET                 /* if to print messages */
+  clock_t t;                    /* timer for measurements */
+  #endif                        /* (only needed for messages) */
+
+  assert(apriori                /* check the function arguments */
+  &&     apriori->istree && (apriori->mode & APR_INCR));
+  if (tabag && ((n = tbg_cnt(tabag)) > 0)) {
+    CLOCK(t);                   /* start timer, print log message */
+    XMSG(stderr, "counting new transactions ... ");
+    bnr_begin(apriori->bench, "update");
+    tbg_itsort(tabag, +1, TA_RADIX); /* sort items in new trans. */
+    for (i = 0; i < n; i++) {   /* traverse the new transactions */
+      c = ta_clone(tbg_tract(tabag, i));
+      if (!c) return cleanup(apriori);
+      if (tbg_add(apriori->tabag, c) != 0) {
+        ta_delete(c); return cleanup(apriori); }
+    }                           /* append copies to the mined bag */
+    setsupp(apriori);           /* recompute the minimum support */
+    ist_setsmin(apriori->istree, apriori->supp, apriori->body);
+    for (i = 0; i < n; i++)     /* count the new transactions */
+      ist_countt(apriori->istree, tbg_tract(tabag, i));
+    XMSG(stderr, "[%"TID_FMT" transaction(s)]", n);
+    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+    CLOCK(t);                   /* start timer, print log message */
+    XMSG(stderr, "updating item set tree ... ");
+    k = ist_update(apriori->istree, apriori->tabag, maxsize(apriori));
+    if (k < 0) return cleanup(apriori);
+    bnr_end(apriori->bench);    /* end the update phase */
+    XMSG(stderr, "[%d level(s) rebuilt]", k);
+    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+    w = tbg_wgt(apriori->tabag);/* get the new total weight */
+    isr_setsmt(apriori->report, (RSUPP) w);
+    isr_setwgt(apriori->report, (double)w);
+    smax = (apriori->smax < 0) ? -apriori->smax
+         : (apriori->smax/100.0) *(double)w *(1-DBL_EPSILON);
+    isr_setsupp(apriori->report, (RSUPP)apriori->supp,
+                (RSUPP)floorsupp(smax));
+  }                             /* adapt the reporter's support range */
+  return output(apriori);       /* report the updated item sets */
+}  /* apriori_update() */
+
+/* In incremental mode (APR_INCR) apriori_mine() only builds the item */
+/* set tree and keeps it (together with the transaction bag and the  */
+/* item base). Each call of apriori_update() appends the transactions */
+/* of the given bag (which must use the same item base), counts them */
+/* into the existing tree, rebuilds only the tree levels above the   */
+/* smallest item set that crossed the minimum support border, and    */
+/* reports the item sets for the enlarged transaction bag. Items that */
+/* are new in the appended transactions are ignored. With a null bag */
+/* the current item sets are reported without any update.            */
 
 /*----------------------------------------------------------------------
   Main Functions
@@ -710,10 +1025,19 @@ static int setbdr (ISREPORT *report, SUPP w, ITEM zmin,
 
 #ifndef NDEBUG                  /* if debug version */
   #undef  CLEANUP               /* clean up memory and close files */
+  #ifdef APRIACC                /* objects of the standard version */
+  #define CLEANSTD              /* that are not needed for accretion */
+  #else
+  #define CLEANSTD \
+  if (incbag)  tbg_delete(incbag, 0);      \
+  if (bench)   bnr_delete(bench);          \
+  if (isxidx)  isx_delete(isxidx);
+  #endif
   #define CLEANUP \
   if (apriori) apriori_delete(apriori, 0); \
   if (twrite)  twr_delete(twrite, 1);      \
   if (report)  isr_delete(report, 0);      \
+  CLEANSTD                                 \
   if (tabag)   tbg_delete(tabag,  0);      \
   if (tread)   trd_delete(tread,  1);      \
   if (ibase)   ib_delete (ibase);          \
@@ -917,7 +1241,7 @@ int main (int argc, char *argv[])
   MSG(stderr, "\n");            /* terminate the startup message */
 
   /* --- read item selection --- */
-  ibase = ib_create(0, 0);      /* create an item base */
+  ibase = ib_create(IB_OPENADR, 0);  /* create an item base */
   if (!ibase) error(E_NOMEM);   /* to manage the items */
   tread = trd_create();         /* create a transaction reader */
   if (!tread) error(E_NOMEM);   /* and configure the characters */
@@ -938,11 +1262,17 @@ int main (int argc, char *argv[])
   tabag = tbg_create(ibase);    /* create a transaction bag */
   if (!tabag) error(E_NOMEM);   /* to store the transactions */
   CLOCK(t);                     /* start timer, open input file */
-  if (trd_open(tread, NULL, fn_inp) != 0)
-    error(E_FOPEN, trd_name(tread));
-  MSG(stderr, "reading %s ... ", trd_name(tread));
-  k = tbg_read(tabag, tread, mtar);
-  if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  if (tbg_isbin(fn_inp)) {      /* if a binary transaction bag file */
+    MSG(stderr, "loading %s ... ", fn_inp);
+    k = tbg_load(tabag, fn_inp);/* map the prepared transactions */
+    if (k < 0) error(k, fn_inp); }
+  else {                        /* if a transaction text file */
+    if (trd_open(tread, NULL, fn_inp) != 0)
+      error(E_FOPEN, trd_name(tread));
+    MSG(stderr, "reading %s ... ", trd_name(tread));
+    k = tbg_read(tabag, tread, mtar);
+    if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  }                             /* read the transaction database */
   trd_delete(tread, 1);         /* read the transaction database, */
   tread = NULL;                 /* then delete the table reader */
   m = ib_cnt(ibase);            /* get the number of items, */
@@ -1018,6 +1348,9 @@ int main (int argc, char *argv[])
   CCHAR   *fn_out  = NULL;      /* name of the output file */
   CCHAR   *fn_sel  = NULL;      /* name of item selection file */
   CCHAR   *fn_psp  = NULL;      /* name of pattern spectrum file */
+  CCHAR   *fn_inc  = NULL;      /* name of file with new transactions */
+  CCHAR   *fn_idx  = NULL;      /* name of item set index file */
+  CCHAR   *fn_bnr  = NULL;      /* name of benchmark record file */
   CCHAR   *recseps = NULL;      /* record  separators */
   CCHAR   *fldseps = NULL;      /* field   separators */
   CCHAR   *blanks  = NULL;      /* blank   characters */
@@ -1044,9 +1377,16 @@ int main (int argc, char *argv[])
   double  filter   = 0.01;      /* item usage filtering parameter */
   int     order    = 0;         /* size order item set/rule output */
   int     mtar     = 0;         /* mode for transaction reading */
+  int     dmode    = 0;         /* mode for data preparation */
   int     scan     = 0;         /* flag for scanable item output */
   int     bdrcnt   = 0;         /* number of support values in border */
   int     stats    = 0;         /* flag for item set statistics */
+  int     cpus     = 1;         /* number of threads for counting */
+  long    topk     = 0;         /* number of best item sets */
+  double  tmax     = 0;         /* time budget for the search */
+  double  nmax     = 0;         /* budget of item set tree nodes */
+  int     bin      = 0;         /* binary output mode */
+  char    code[2]  = "x";       /* buffer for option codes */
   PATSPEC *psp;                 /* collected pattern spectrum */
   ITEM    m;                    /* number of items */
   TID     n;                    /* number of transactions */
@@ -1108,6 +1448,22 @@ int main (int argc, char *argv[])
                     "(default: prune)\n");
     printf("-y       a-posteriori pruning of infrequent item sets\n");
     printf("-T       do not organize transactions as a prefix tree\n");
+    printf("-Y       store the prefix tree in one memory block\n");
+    printf("-X       compress transactions in memory "
+                    "(only together with -T)\n");
+    printf("-W#      number of threads for support counting   "
+                    "(default: %d)\n", cpus);
+    printf("         (<= 0: use all processors)\n");
+    printf("-K#      report only the # item sets with highest "
+                    "support (default: all)\n");
+    printf("         (raises the minimum support while counting; "
+                    "not for -tm, -tr)\n");
+    printf("-L#      time budget for the search (in seconds)  "
+                    "(default: no limit)\n");
+    printf("-Q#      budget of item set tree nodes            "
+                    "(default: no limit)\n");
+    printf("         (if exceeded, no further levels are added; "
+                    "partial result)\n");
     printf("-F#:#..  support border for filtering item sets   "
                     "(default: none)\n");
     printf("         (list of minimum support values, "
@@ -1116,6 +1472,13 @@ int main (int argc, char *argv[])
                     "as given with option -m#)\n");
     printf("-R#      read item selection/appearance indicators\n");
     printf("-P#      write a pattern spectrum to a file\n");
+    printf("-E#      write an item set index to a file (for isridx)\n");
+    printf("         (only for target s and minimum size 0 or 1)\n");
+    printf("-U#      read transactions to append to the input "
+                    "(incremental update)\n");
+    printf("-J#      append a benchmark record (JSON) to a file\n");
+    printf("         (phase times, peak memory etc.; "
+                    "\"-\": standard output)\n");
     printf("-Z       print item set statistics "
                     "(number of item sets per size)\n");
     printf("-N       do not pre-format some integer numbers   "
@@ -1126,6 +1489,12 @@ int main (int argc, char *argv[])
     printf("-z       compress output with zlib (deflate)      "
                     "(default: plain text)\n");
     #endif                      /* print compression option */
+    printf("-B#      write binary output (for isrdec)         "
+                    "(default: %d)\n", bin);
+    printf("         (0: text, 1: binary, 2: binary with "
+                     "delta-encoded items)\n");
+    printf("-O       write output in a separate thread        "
+                    "(default: synchronous)\n");
     printf("-h#      record header  for output                "
                     "(default: \"%s\")\n", hdr);
     printf("-k#      item separator for output                "
@@ -1139,6 +1508,7 @@ int main (int argc, char *argv[])
     printf("         (< 0: descending, > 0: ascending order)\n");
     printf("-w       integer transaction weight in last field "
                     "(default: only items)\n");
+    printf("-D       collapse duplicate transactions while reading\n");
     printf("-r#      record/transaction separators            "
                     "(default: \"\\n\")\n");
     printf("-f#      field /item        separators            "
@@ -1155,7 +1525,7 @@ int main (int argc, char *argv[])
     return 0;                   /* print a usage message */
   }                             /* and abort the program */
   #endif  /* #ifndef QUIET */
-  /* free option characters: l [A-Z]\[CFINPRSTZ] */
+  /* free option characters: l [A-Z]\[BCDEFIJKNOPRSTUWXZ] */
 
   /* --- evaluate arguments --- */
   for (i = 1; i < argc; i++) {  /* traverse the arguments */
@@ -1182,21 +1552,33 @@ int main (int argc, char *argv[])
           case 'x': mode  &= ~APR_PERFECT;           break;
           case 'y': mode  |=  APR_POST;              break;
           case 'T': mode  &= ~APR_TATREE;            break;
+          case 'Y': mode  |=  APR_TATFLAT;           break;
+          case 'X': dmode |=  APR_COMPRESS;          break;
+          case 'W': cpus   = (int) strtol(s, &s, 0); break;
+          case 'K': topk   =       strtol(s, &s, 0); break;
+          case 'L': tmax   =       strtod(s, &s);    break;
+          case 'Q': nmax   =       strtod(s, &s);    break;
           case 'F': bdrcnt = getbdr(s, &s, &border); break;
           case 'R': optarg = &fn_sel;                break;
           case 'P': optarg = &fn_psp;                break;
+          case 'E': optarg = &fn_idx;                break;
+          case 'U': optarg = &fn_inc;                break;
+          case 'J': optarg = &fn_bnr;                break;
           case 'Z': stats  = 1;                      break;
           case 'N': mode  &= ~APR_PREFMT;            break;
           case 'g': scan   = 1;                      break;
           #ifdef USE_ZLIB       /* if optional output compression */
           case 'z': mode  |= APR_ZLIB;               break;
           #endif                /* set the compression flag */
+          case 'B': bin    = (int) strtol(s, &s, 0); break;
+          case 'O': mode  |= APR_ASYNC;              break;
           case 'h': optarg = &hdr;                   break;
           case 'k': optarg = &sep;                   break;
           case 'I': optarg = &imp;                   break;
           case 'v': optarg = &info;                  break;
           case 'j': order  = (int) strtol(s, &s, 0); break;
           case 'w': mtar  |= TA_WEIGHT;              break;
+          case 'D': mtar  |= TA_COLLAPSE;            break;
           case 'r': optarg = &recseps;               break;
           case 'f': optarg = &fldseps;               break;
           case 'b': optarg = &blanks;                break;
@@ -1221,8 +1603,22 @@ int main (int argc, char *argv[])
   if (bdrcnt < 0)   error(E_NOMEM);
   if ((conf  < 0) || (conf > 100))
     error(E_CONF, conf);        /* check the minimum confidence */
+  if (bin > 0) mode |= APR_BINARY; /* set the binary output flags */
+  if (bin > 1) mode |= APR_DELTA;  /* (plain or delta-encoded) */
   if ((!fn_inp || !*fn_inp) && (fn_sel && !*fn_sel))
     error(E_STDIN);             /* stdin must not be used twice */
+  if ((fn_inc && !*fn_inc)      /* check new transactions as well */
+  &&  ((!fn_inp || !*fn_inp) || (fn_sel && !*fn_sel)))
+    error(E_STDIN);             /* stdin must not be used twice */
+  if (fn_bnr) {                 /* if to write a benchmark record */
+    bench = bnr_create();       /* create a benchmark record */
+    if (!bench) error(E_NOMEM); /* and note the parameters */
+    bnr_str(bench, "prog", "apriori");
+    bnr_str(bench, "algo", (mode & APR_TATREE) ? "tatree" : "tabag");
+    code[0] = (char)target; bnr_str(bench, "target", code);
+    bnr_dbl(bench, "smin",    smin);
+    bnr_int(bench, "threads", cpus);
+  }                             /* (before the codes are translated) */
   switch (target) {             /* check and translate target type */
     case 's': target = ISR_ALL;              break;
     case 'f': target = ISR_FREQUENT;         break;
@@ -1271,16 +1667,19 @@ int main (int argc, char *argv[])
     filter = 0;                 /* check and adapt the filter option */
   if (target & ISR_RULES)       /* if to find association rules, */
     fn_psp = NULL;              /* no pattern spectrum possible */
+  if (fn_idx && ((target != ISR_ALL) || (zmin > 1)))
+    error(E_INDEX);             /* an index needs all frequent sets */
   if (info == dflt) {           /* if default info. format is used, */
     if (target != ISR_RULES)    /* set default according to target */
          info = (smin < 0) ? " (%a)"     : " (%S)";
     else info = (smin < 0) ? " (%b, %C)" : " (%X, %C)";
   }                             /* select absolute/relative support */
   mode |= APR_VERBOSE|APR_NOCLEAN;
+  if (fn_inc) mode |= APR_INCR; /* set incremental mode if requested */
   MSG(stderr, "\n");            /* terminate the startup message */
 
   /* --- read item selection/appearance indicators --- */
-  ibase = ib_create(0, 0);      /* create an item base */
+  ibase = ib_create(IB_OPENADR, 0);  /* create an item base */
   if (!ibase) error(E_NOMEM);   /* to manage the items */
   tread = trd_create();         /* create a transaction reader */
   if (!tread) error(E_NOMEM);   /* and configure the characters */
@@ -1303,16 +1702,27 @@ int main (int argc, char *argv[])
   tabag = tbg_create(ibase);    /* create a transaction bag */
   if (!tabag) error(E_NOMEM);   /* to store the transactions */
   CLOCK(t);                     /* start timer, open input file */
-  if (trd_open(tread, NULL, fn_inp) != 0)
-    error(E_FOPEN, trd_name(tread));
-  MSG(stderr, "reading %s ... ", trd_name(tread));
-  k = tbg_read(tabag, tread, mtar);
-  if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  bnr_begin(bench, "read");     /* start the reading phase */
+  if (tbg_isbin(fn_inp)) {      /* if a binary transaction bag file */
+    MSG(stderr, "loading %s ... ", fn_inp);
+    k = tbg_load(tabag, fn_inp);/* map the prepared transactions */
+    if (k < 0) error(k, fn_inp); }
+  else {                        /* if a transaction text file */
+    if (trd_open(tread, NULL, fn_inp) != 0)
+      error(E_FOPEN, trd_name(tread));
+    MSG(stderr, "reading %s ... ", trd_name(tread));
+    k = tbg_read(tabag, tread, mtar);
+    if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  }                             /* read the transaction database */
   trd_delete(tread, 1);         /* read the transaction database, */
   tread = NULL;                 /* then delete the table reader */
+  bnr_end(bench);               /* end the reading phase */
   m = ib_cnt(ibase);            /* get the number of items, */
   n = tbg_cnt(tabag);           /* the number of transactions, */
   w = tbg_wgt(tabag);           /* the total transaction weight */
+  bnr_int(bench, "items",        m);
+  bnr_int(bench, "transactions", n);
+  bnr_int(bench, "extent", (double)tbg_extent(tabag));
   MSG(stderr, "[%"ITEM_FMT" item(s), %"TID_FMT, m, n);
   if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
   MSG(stderr, " transaction(s)] done [%.2fs].", SEC_SINCE(t));
@@ -1324,7 +1734,13 @@ int main (int argc, char *argv[])
   apriori = apriori_create(target, smin, smax, conf, zmin, zmax,
                            eval, agg, thresh, algo, mode);
   if (!apriori) error(E_NOMEM); /* create an Apriori miner */
-  k = apriori_data(apriori, tabag, 0, sort);
+  apriori_setcpus(apriori, cpus);  /* set the number of threads */
+  apriori_setbench(apriori, bench);/* and the benchmark record */
+  if (topk > 0)                 /* and the number of best sets */
+    apriori_settopk(apriori, (size_t)topk);
+  if ((tmax > 0) || (nmax > 0)) /* and the search budget */
+    apriori_setbudget(apriori, tmax, (nmax > 0) ? (size_t)nmax : 0);
+  k = apriori_data(apriori, tabag, dmode, sort);
   if (k) error(k);              /* prepare data for Apriori */
   report = isr_create(ibase);   /* create an item set reporter */
   if (!report) error(E_NOMEM);  /* and configure it */
@@ -1334,6 +1750,11 @@ int main (int argc, char *argv[])
     error(E_NOMEM);             /* set the support border (if any) */
   if (fn_psp && (isr_addpsp(report, NULL) < 0))
     error(E_NOMEM);             /* set a pattern spectrum if req. */
+  if (fn_idx) {                 /* if to write an item set index, */
+    isxidx = isx_create(ibase); /* create an item set index */
+    if (!isxidx) error(E_NOMEM);/* and collect the reported sets */
+    isr_setrepo(report, isx_add, isxidx);
+  }
   if (isr_setfmt(report, scan, hdr, sep, imp, info) != 0)
     error(E_NOMEM);             /* set the output format strings */
   k = isr_open(report, NULL, fn_out);
@@ -1341,11 +1762,48 @@ int main (int argc, char *argv[])
   if (isr_setup(report) < 0)    /* open the output file and */
     error(E_NOMEM);             /* set up the item set reporter */
   k = apriori_mine(apriori, prune, filter, order);
-  if (k) error(k);              /* find frequent item sets */
+  if (k < 0) error(k);          /* find frequent item sets */
+  bnr_int(bench, "complete", (k > 0) ? 0 : 1);
+  if (k > 0) {                  /* if the search budget is exhausted */
+    MSG(stderr, "search stopped (budget exhausted); ");
+    MSG(stderr, "complete up to size %"ITEM_FMT"\n",
+                apriori_covered(apriori));
+  }                             /* print the covered set size */
+
+  /* --- append new transactions --- */
+  if (fn_inc) {                 /* if new transactions are given */
+    incbag = tbg_create(ibase); /* create a transaction bag */
+    if (!incbag) error(E_NOMEM);/* for the new transactions */
+    CLOCK(t);                   /* start timer, open input file */
+    if (tbg_isbin(fn_inc)) {    /* if a binary transaction bag file */
+      MSG(stderr, "loading %s ... ", fn_inc);
+      k = tbg_load(incbag, fn_inc);  /* map the transactions */
+      if (k < 0) error(k, fn_inc); }
+    else {                      /* if a transaction text file */
+      tread = trd_create();     /* create a transaction reader */
+      if (!tread) error(E_NOMEM);
+      trd_allchs(tread, recseps, fldseps, blanks, "", comment);
+      if (trd_open(tread, NULL, fn_inc) != 0)
+        error(E_FOPEN, trd_name(tread));
+      MSG(stderr, "reading %s ... ", trd_name(tread));
+      k = tbg_read(incbag, tread, mtar);
+      if (k < 0) error(-k, tbg_errmsg(incbag, NULL, 0));
+      trd_delete(tread, 1);     /* read the new transactions, */
+      tread = NULL;             /* then delete the table reader */
+    }
+    MSG(stderr, "[%"TID_FMT" transaction(s)]", tbg_cnt(incbag));
+    MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+    k = apriori_update(apriori, incbag);
+    if (k) error(k);            /* update and report item sets */
+  }
   if (stats)                    /* print item set statistics */
     isr_prstats(report, stdout, 0);
+  bnr_begin(bench, "close");    /* start the closing phase */
   if (isr_close(report) != 0)   /* close item set output file */
     error(E_FWRITE, isr_name(report));
+  bnr_end(bench);               /* end the closing phase */
+  bnr_int(bench, "sets", (double)isr_repcnt(report));
+  bnr_int(bench, "outbytes", (double)isr_nbytes(report));
 
   /* --- write pattern spectrum --- */
   if (fn_psp) {                 /* if to write a pattern spectrum */
@@ -1364,6 +1822,20 @@ int main (int argc, char *argv[])
     MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
   }                             /* write a log message */
 
+  /* --- write item set index --- */
+  if (fn_idx) {                 /* if to write an item set index */
+    CLOCK(t);                   /* start timer, print log message */
+    MSG(stderr, "writing %s ... ", fn_idx);
+    k = isx_save(isxidx, fn_idx);  /* build the prefix tree */
+    if (k) error(k, fn_idx);    /* and write it to the index file */
+    MSG(stderr, "[%"SIZE_FMT" set(s)]", isx_setcnt(isxidx));
+    MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* write a log message */
+
+  /* --- write benchmark record --- */
+  if (bench && (bnr_append(bench, fn_bnr) != 0))
+    error(E_FWRITE, fn_bnr);    /* append the benchmark record */
+
   /* --- clean up --- */
   CLEANUP;                      /* clean up memory and close files */
   SHOWMEM;                      /* show (final) memory usage */
@@ -9,12 +9,22 @@
             2014.08.28 functions apr_data() and apr_report() added
             2016.11.04 apriori miner object and interface introduced
             2017.05.30 optional output compression with zlib added
+            2026.10.14 function apriori_setcpus() added
+            2026.10.14 incremental mode and apriori_update() added
+            2026.10.14 binary output modes added (APR_BINARY/APR_DELTA)
+            2026.10.14 asynchronous output mode added (APR_ASYNC)
+            2026.10.14 function apriori_setbench() added
+            2026.10.14 function apriori_settopk() added (best item sets)
+            2026.10.14 data preparation mode APR_COMPRESS added
+            2026.10.14 functions apriori_setbudget()/_covered() added
+            2026.10.14 flat transaction tree mode APR_TATFLAT added
 ----------------------------------------------------------------------*/
 #ifndef __APRIORI__
 #define __APRIORI__
 #include "report.h"
 #include "ruleval.h"
 #include "istree.h"
+#include "bench.h"
 
 /*----------------------------------------------------------------------
   Preprocessor Definitions
@@ -32,6 +42,7 @@
 #define APR_NOFILTER  0x0002    /* do not filter transactions by size */
 #define APR_NOSORT    0x0004    /* do not sort items and transactions */
 #define APR_NOREDUCE  0x0008    /* do not reduce transactions */
+#define APR_COMPRESS  0x0010    /* compress transactions in memory */
 
 /* --- evaluation measures --- */
 /* most measure definitions in ruleval.h */
@@ -50,14 +61,19 @@
 #define APR_AUTO      0         /* automatic algorithm choice (dummy) */
 
 /* --- operation modes --- */
+#define APR_DELTA     0x0040    /* delta-encode binary output */
 #define APR_ORIGSUPP  0x0080    /* use original support definition */
 #define APR_PERFECT   IST_PERFECT  /* perfect extension pruning */
 #define APR_TATREE    0x0200    /* use transaction tree */
 #define APR_POST      0x0400    /* use a-posteriori pruning */
+#define APR_INCR      IST_INCR  /* incremental mode (keep tree) */
 #define APR_PREFMT    0x1000    /* pre-format integer numbers */
 #ifdef USE_ZLIB                 /* if optional output compression */
 #define APR_ZLIB      0x4000    /* flag for output compression */
 #endif
+#define APR_BINARY    0x2000    /* flag for binary output */
+#define APR_ASYNC   0x10000    /* write output in a separate thread */
+#define APR_TATFLAT 0x20000    /* flat layout of transaction tree */
 #define APR_DEFAULT   (APR_PERFECT|APR_TATREE)
 #ifdef NDEBUG
 #define APR_NOCLEAN   0x8000    /* do not clean up memory */
@@ -83,6 +99,13 @@ extern void     apriori_delete (APRIORI *apriori, int deldar);
 extern int      apriori_data   (APRIORI *apriori, TABAG *tabag,
                                 int mode, int sort);
 extern int      apriori_report (APRIORI *apriori, ISREPORT *report);
+extern void     apriori_setcpus(APRIORI *apriori, int cpus);
+extern void     apriori_setbench(APRIORI *apriori, BENCHREC *bench);
+extern void     apriori_settopk(APRIORI *apriori, size_t k);
+extern void     apriori_setbudget(APRIORI *apriori, double secs,
+                                  size_t nodes);
+extern ITEM     apriori_covered(APRIORI *apriori);
 extern int      apriori_mine   (APRIORI *apriori, ITEM prune,
                                 double filter, int order);
+extern int      apriori_update (APRIORI *apriori, TABAG *tabag);
 #endif
@@ -9,6 +9,8 @@
 #           2011.10.18 special program version apriacc added
 #           2013.10.19 modules tabread and patspec added
 #           2016.04.20 completed dependencies on header files
+#           2026.10.14 module bench added (benchmark records)
+#           2026.10.14 module isridx added (item set index)
 #-----------------------------------------------------------------------
 THISDIR  = ..\..\apriori\src
 UTILDIR  = ..\..\util\src
@@ -30,13 +32,15 @@ HDRS_1   = $(UTILDIR)\fntypes.h    $(UTILDIR)\arrays.h    \
            $(TRACTDIR)\tract.h     $(TRACTDIR)\report.h
 HDRS     = $(HDRS_1)               $(UTILDIR)\error.h     \
            $(UTILDIR)\tabread.h    $(UTILDIR)\tabwrite.h  \
-           $(TRACTDIR)\patspec.h   istree.h
+           $(TRACTDIR)\patspec.h   $(UTILDIR)\bench.h     \
+           $(TRACTDIR)\isridx.h    istree.h
 OBJS     = $(UTILDIR)\arrays.obj   $(UTILDIR)\idmap.obj   \
            $(UTILDIR)\escape.obj   $(UTILDIR)\tabread.obj \
            $(UTILDIR)\tabwrite.obj $(UTILDIR)\scform.obj  \
            $(MATHDIR)\gamma.obj    $(MATHDIR)\chi2.obj    \
            $(MATHDIR)\ruleval.obj  $(TRACTDIR)\tatree.obj \
            $(TRACTDIR)\patspec.obj $(TRACTDIR)\report.obj \
+           $(TRACTDIR)\isridx.obj  $(UTILDIR)\bench.obj   \
            isttat.obj
 PRGS     = apriori.exe apriacc.exe
 
@@ -100,6 +104,10 @@ $(UTILDIR)\scform.obj:
 	cd $(UTILDIR)
 	$(MAKE) /f util.mak scform.obj   ADDFLAGS="$(ADDFLAGS)"
 	cd $(THISDIR)
+$(UTILDIR)\bench.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak bench.obj    ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
 $(MATHDIR)\gamma.obj:
 	cd $(MATHDIR)
 	$(MAKE) /f math.mak gamma.obj    ADDFLAGS="$(ADDFLAGS)"
@@ -124,6 +132,10 @@ $(TRACTDIR)\report.obj:
 	cd $(TRACTDIR)
 	$(MAKE) /f tract.mak report.obj  ADDFLAGS="$(ADDFLAGS)"
 	cd $(THISDIR)
+$(TRACTDIR)\isridx.obj:
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak isridx.obj  ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
 
 #-----------------------------------------------------------------------
 # Install
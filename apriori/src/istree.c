@@ -91,6 +91,17 @@
             2014.11.14 bug in function evaluate() fixed (negative index)
             2015.02.25 bug in function r4set() fixed (ITEMOF(node))
             2016.11.19 bug in function ist_filter() fixed (path length)
+            2026.10.14 parallel counting with private counters added
+            2026.10.14 incremental mode and ist_update() added
+            2026.10.14 tree nodes allocated from per level arenas
+            2026.10.14 transaction bags traversed with iterators
+            2026.10.14 rule evaluator with factorial table and memo used
+            2026.10.14 rules of an item set evaluated in one batch
+            2026.10.14 function ist_getstats() added (tree statistics)
+            2026.10.14 parallel rule reporting with cloned reporters
+            2026.10.14 item pairs counted with a triangular array
+            2026.10.14 narrow leaves of transaction trees supported
+            2026.10.14 function ist_kthsupp() added (top-k pruning)
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -98,6 +109,12 @@
 #include <float.h>
 #include <math.h>
 #include <assert.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
 #include "istree.h"
 #include "chi2.h"
 #include "gamma.h"
@@ -121,6 +138,10 @@
   Preprocessor Definitions
 ----------------------------------------------------------------------*/
 #define LN_2        0.69314718055994530942  /* ln(2) */
+#define BS_ARENA    (64*1024)   /* initial size of an arena block */
+#define BS_ARMAX    (16*1024*1024)  /* maximal size of an arena block */
+#define ARALIGN(z)  (((z) +15) & ~(size_t)15)  /* align a memory size */
+#define TRI_MAX     (16*1024*1024)  /* max. size of triangular array */
 #define HDONLY      ITEM_MIN    /* flag for head only item in path */
 #define ITEMOF(n)   ((ITEM)((n)->item & ~HDONLY))
 #define ISHDONLY(n) ((n)->item < 0)
@@ -153,6 +174,12 @@
 #undef int                      /* remove preprocessor definitions */
 #undef long                     /* needed for the type checking */
 #undef double
+/* The counters always have the full width of SUPP, even if the total */
+/* weight of the transactions (tbg_wgt()) fits into 16 bits. Narrow   */
+/* counters would need a second variant of every function that uses  */
+/* the counter arrays (counting with the private counters of threads, */
+/* pruning, adding levels, ist_setsmin() and reporting), because the  */
+/* item and child arrays of a node are located behind its counters.   */
 #define CHILDCNT(n) ((n)->chcnt & ~ITEM_MIN)
 #define ITEMAT(n,i) (((n)->offset >= 0) ? (n)->offset +(i) \
                       : ((ITEM*)((n)->cnts +(n)->size))[i])
@@ -167,10 +194,139 @@
 /* Note that not all 64 bit architectures need pointers to be aligned */
 /* to addresses divisible by 8. Use ALIGN8 only if this is the case.  */
 
+#if defined __GNUC__ && !defined IST_NOPREFETCH
+#define PREFETCH(p) __builtin_prefetch(p)
+#else                           /* if to prefetch tree nodes */
+#define PREFETCH(p) ((void)0)   /* (only supported by GNU C) */
+#endif
+
+/* --- thread definitions --- */
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#define THREAD       HANDLE     /* threads identified by handles */
+#define THREAD_OK    0          /* return value is DWORD */
+#define WORKERDEF(n,p)  DWORD WINAPI n (LPVOID p)
+#else                           /* if Linux/Unix system */
+#define THREAD       pthread_t  /* use the POSIX thread type */
+#define THREAD_OK    NULL       /* return value is void* */
+#define WORKERDEF(n,p)  void*        n (void* p)
+#endif                          /* definition of a worker function */
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef struct {                /* --- thread worker data --- */
+  ISTREE       *ist;            /* item set tree to count into */
+  const TABAG  *bag;            /* transaction bag to count */
+  #ifdef TATREEFN               /* if transaction tree functions */
+  const TATREE *tree;           /* transaction tree to count */
+  #endif
+  TID          beg, end;        /* range of transactions to count */
+  TBGITER      *iter;           /* iterator for the transaction bag */
+  int          id;              /* index of the worker thread */
+  int          cnt;             /* number of worker threads */
+  SUPP         *pc;             /* private counters of the thread */
+  ITEM         *buf;            /* buffer for narrow leaf items */
+} WORKDATA;                     /* (thread worker data) */
+
+typedef struct {                /* --- rule reporting worker data --- */
+  ISTREE       ist;             /* copy with private buffers */
+  ISREPORT     *rep;            /* private item set reporter */
+  ITEM         beg, end;        /* range of root items to process */
+  int          err;             /* error status of the worker */
+} RULEWORK;                     /* (rule reporting worker data) */
+
 /*----------------------------------------------------------------------
   Auxiliary Functions
 ----------------------------------------------------------------------*/
 
+static int cpucnt (void)
+{                               /* --- get the number of processors */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  SYSTEM_INFO sysinfo;          /* system information structure */
+  GetSystemInfo(&sysinfo);      /* get system information */
+  return (int)sysinfo.dwNumberOfProcessors;
+  #elif defined _SC_NPROCESSORS_ONLN
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+  #else                         /* if no direct function available */
+  return 1;                     /* use only one processor */
+  #endif
+}  /* cpucnt() */
+
+/*--------------------------------------------------------------------*/
+
+static size_t* pcidx (ISTNODE *node)
+{                               /* --- get private counter index */
+  size_t *p;                    /* to access the counter index */
+
+  assert(node);                 /* check the function argument */
+  p = (size_t*)((ITEM*)(node->cnts +node->size)
+              + ((node->offset < 0) ? node->size : 0));
+  ALIGN(p);                     /* skip counters and identifier map */
+  return p;                     /* and return the index location */
+}  /* pcidx() */
+
+/* If multiple threads are used for counting, the nodes of a new    */
+/* level are created with an additional field behind the counters   */
+/* (and the identifier map), which holds the index of the node's    */
+/* counters in the private counter arrays of the threads. This field */
+/* is removed again when child pointers are added to the node.      */
+
+/*--------------------------------------------------------------------*/
+
+static void* ar_alloc (ISTREE *ist, ITEM lvl, size_t z)
+{                               /* --- allocate memory for a node */
+  ISTBLK *blk;                  /* arena block to allocate from */
+  size_t n;                     /* size of a new arena block */
+  char   *p;                    /* allocated memory */
+
+  assert(ist && (lvl >= 0));    /* check the function arguments */
+  z   = ARALIGN(z);             /* align the requested size */
+  blk = ist->arena[lvl];        /* get the current block of the level */
+  if (!blk || (blk->used +z > blk->size)) {
+    n = (blk) ? blk->size +blk->size : BS_ARENA;
+    if (n > BS_ARMAX) n = BS_ARMAX; /* double the block size */
+    if (n < z)        n = z;    /* (up to a maximum), but make sure */
+    blk = (ISTBLK*)malloc(ARALIGN(sizeof(ISTBLK)) +n);
+    if (!blk) return NULL;      /* allocate a new arena block */
+    blk->succ = ist->arena[lvl];/* and add it at the head */
+    blk->size = n;              /* of the block list of the level */
+    blk->used = 0;              /* (block is still empty) */
+    ist->arena[lvl] = blk;
+    #ifdef BENCH                /* if benchmark version, */
+    ist->arsz += n;             /* sum the arena sizes */
+    #endif
+  }
+  p = (char*)blk +ARALIGN(sizeof(ISTBLK)) +blk->used;
+  blk->used += z;               /* get the next free memory */
+  return (void*)p;              /* and return it */
+}  /* ar_alloc() */
+
+/*--------------------------------------------------------------------*/
+
+static void ar_free (ISTREE *ist, ISTBLK *blk)
+{                               /* --- free a list of arena blocks */
+  ISTBLK *t;                    /* buffer for deallocation */
+
+  assert(ist);                  /* check the function argument */
+  while (blk) {                 /* traverse the arena blocks */
+    #ifdef BENCH                /* if benchmark version, */
+    ist->arsz -= blk->size;     /* update the arena sizes */
+    #endif
+    t = blk; blk = blk->succ; free(t);
+  }                             /* delete the arena blocks */
+}  /* ar_free() */
+
+/* The nodes of each tree level are allocated from a separate arena */
+/* (a list of large memory blocks), so that the nodes of a level lie */
+/* close together and in the order in which they are created, which */
+/* is the order in which they are visited by the counting functions. */
+/* A single node is never freed. The memory of a node that is moved */
+/* or removed is reclaimed only if the whole arena is freed, which   */
+/* happens in ist_addlvl(), which copies the nodes of the deepest    */
+/* level into a new arena when their child pointers are added.       */
+
+/*--------------------------------------------------------------------*/
+
 static ITEM search (ITEM id, ISTNODE **chn, ITEM n)
 {                               /* --- find a child node (index) */
   ITEM l, r, m;                 /* left, right, and middle index */
@@ -209,6 +365,39 @@ static ITEM bisect (ITEM id, ISTNODE **chn, ITEM n)
 #endif
 /*--------------------------------------------------------------------*/
 
+static size_t ndsize (ISTNODE *node)
+{                               /* --- get size of node (w/o children) */
+  size_t z;                     /* size of counter and map arrays */
+
+  assert(node);                 /* check the function argument */
+  z = (size_t)(node->size-1) *sizeof(SUPP);
+  if (node->offset < 0)         /* if an identifier map is used, */
+    z += (size_t)node->size *sizeof(ITEM);     /* add the map size */
+  return z +sizeof(ISTNODE);    /* return the size of the node */
+}  /* ndsize() */
+
+/*--------------------------------------------------------------------*/
+
+static ISTNODE** chnptr (ISTNODE *node)
+{                               /* --- get pointer in parent node */
+  ISTNODE *par;                 /* parent of the node */
+  ISTNODE **chn;                /* child node array of the parent */
+
+  assert(node);                 /* check the function argument */
+  par = node->parent;           /* get the parent node */
+  if (!par) return NULL;        /* the root node has no parent */
+  if (par->offset >= 0) {       /* if a pure array is used */
+    chn = (ISTNODE**)(par->cnts +par->size);
+    ALIGN(chn);                 /* get the child node array */
+    return chn +(ITEMOF(node) -ITEMOF(chn[0]));
+  }                             /* compute the child pointer index */
+  chn = (ISTNODE**)((ITEM*)(par->cnts +par->size) +par->size);
+  ALIGN(chn);                   /* get the child node array */
+  return chn +search(ITEMOF(node), chn, CHILDCNT(par));
+}  /* chnptr() */               /* find the child node pointer */
+
+/*--------------------------------------------------------------------*/
+
 static SUPP getsupp (ISTNODE *node, ITEM *items, ITEM n)
 {                               /* --- get support of an item set */
   ITEM    i, k;                 /* array indices, number of children */
@@ -278,49 +467,32 @@ static void makelvls (ISTREE *ist)
   ist->valid = -1;              /* levels/successors are now valid */
 }  /* makelvls() */
 
-/*--------------------------------------------------------------------*/
-
-static void delete (ISTNODE *node)
-{                               /* --- recursively delete a subtree */
-  ITEM    i, n;                 /* loop variable, number of children */
-  ISTNODE **chn;                /* child node array */
-
-  assert(node);                 /* check the function argument */
-  n = CHILDCNT(node);           /* get the number of children */
-  if (n > 0) {                  /* if there are children */
-    if (node->offset >= 0)      /* if a pure array is used */
-      chn = (ISTNODE**)(node->cnts +node->size);
-    else                        /* if an item map is used */
-      chn = (ISTNODE**)((ITEM*)(node->cnts +node->size) +node->size);
-    ALIGN(chn);                 /* get the child node array */
-    for (i = 0; i < n; i++)     /* recursively delete the children */
-      if (chn[i]) delete(chn[i]);
-  }
-  free(node);                   /* delete the node */
-}  /* delete() */
 
 /*----------------------------------------------------------------------
   Counting Functions
 ----------------------------------------------------------------------*/
 
 static void count (ISTNODE *node,
-                   const ITEM *items, ITEM n, SUPP wgt, ITEM min)
+                   const ITEM *items, ITEM n, SUPP wgt, ITEM min,
+                   SUPP *pc)
 {                               /* --- count transaction recursively */
   ITEM    i, k, o;              /* array index, offset, map size */
   ITEM    *map;                 /* item identifier map */
+  SUPP    *cnts;                /* counter array to update */
   ISTNODE **chn;                /* array of child nodes */
 
   assert(node                   /* check the function arguments */
   &&    (n >= 0) && (items || (n <= 0)));
   if (node->offset >= 0) {      /* if a pure array is used */
     if (node->chcnt == 0) {     /* if this is a new node (leaf) */
-      o = node->offset;         /* get the index offset */
+      cnts = (pc) ? pc +*pcidx(node) : node->cnts;
+      o = node->offset;         /* get the counters and the offset */
       while ((n > 0) && (*items < o)) {
         n--; items++; }         /* skip items before first counter */
       while (--n >= 0) {        /* traverse the transaction's items */
         i = *items++ -o;        /* compute the counter array index */
         if (i >= node->size) return;
-        INC(node->cnts[i],wgt); /* if the corresp. counter exists, */
+        INC(cnts[i], wgt);      /* if the corresp. counter exists, */
       } }                       /* add the transaction weight to it */
     else if (node->chcnt > 0) { /* if there are child nodes */
       chn = (ISTNODE**)(node->cnts +node->size);
@@ -331,13 +503,16 @@ static void count (ISTNODE *node,
       for (--min; --n >= min;){ /* traverse the transaction's items */
         i = *items++ -o;        /* compute the child array index */
         if (i >= node->chcnt) return;
-        if (chn[i]) count(chn[i], items, n, wgt, min);
+        if ((n > min) && (*items -o < node->chcnt))
+          PREFETCH(chn[*items -o]);  /* prefetch the next child */
+        if (chn[i]) count(chn[i], items, n, wgt, min, pc);
       }                         /* if the corresp. child node exists, */
     } }                         /* count the transaction recursively */
   else {                        /* if an identifer map is used */
     if (node->chcnt == 0) {     /* if this is a new node (leaf) */
       map = (ITEM*)(node->cnts +(k = node->size));
       o   = map[0];             /* get the identifier map */
+      cnts = (pc) ? pc +*pcidx(node) : node->cnts;
       while ((n > 0) && (*items < o)) {
         n--; items++; }         /* skip items before first counter */
       o   = map[k-1];           /* get the last item with a counter */
@@ -345,10 +520,10 @@ static void count (ISTNODE *node,
         if (*items > o) return; /* if beyond last item, abort */
         #ifdef IST_BSEARCH      /* if to use a binary search */
         i = ia_bsearch(*items, map, (size_t)k);
-        if (i >= 0)           INC(node->cnts[i], wgt);
+        if (i >= 0)           INC(cnts[i], wgt);
         #else                   /* if to use a linear search */
         while (map[i] < *items) i++;
-        if (map[i] == *items) INC(node->cnts[i], wgt);
+        if (map[i] == *items) INC(cnts[i], wgt);
         #endif                  /* if the corresp. counter exists, */
       } }                       /* add the transaction weight to it */
     else if (node->chcnt > 0) { /* if there are child nodes */
@@ -367,21 +542,87 @@ static void count (ISTNODE *node,
         #else                   /* if to use a linear search */
         while (ITEMOF(*chn) < *items) chn++;
         #endif                  /* find the child node index */
-        if (ITEMOF(*chn) == *items++) count(*chn, items, n, wgt, min);
+        if (ITEMOF(*chn) == *items++)
+          count(*chn, items, n, wgt, min, pc);
       }                         /* if the corresp. child node exists, */
     }                           /* count the transaction recursively */
   }
 }  /* count() */
 
+/*--------------------------------------------------------------------*/
+
+static void countinc (ISTREE *ist, ISTNODE *node,
+                      const ITEM *items, ITEM n, SUPP wgt, ITEM lvl)
+{                               /* --- count trans. into all levels */
+  ITEM       i, k, o;           /* array index, offset, map size */
+  ITEM       m;                 /* number of remaining items */
+  ITEM       *map;              /* item identifier map */
+  const ITEM *p;                /* to traverse the items */
+  SUPP       s;                 /* counter value before increment */
+  ISTNODE    **chn;             /* array of child nodes */
+
+  assert(ist && node            /* check the function arguments */
+  &&    (n >= 0) && (items || (n <= 0)));
+  k   = node->size;             /* get the number of counters */
+  o   = node->offset;           /* and the item offset */
+  map = (o < 0) ? (ITEM*)(node->cnts +k) : NULL;
+  for (p = items, m = n; --m >= 0; p++) {
+    if (map) {                  /* if an identifier map is used */
+      if (*p > map[k-1]) break; /* check for the last item and */
+      i = ia_bsearch(*p, map, (size_t)k);
+      if (i < 0) continue; }    /* search for the item's counter */
+    else {                      /* if a pure array is used */
+      i = *p -o;                /* compute the counter array index */
+      if (i <  0) continue;     /* skip items before first counter */
+      if (i >= k) break;        /* and abort after the last one */
+    }
+    s = node->cnts[i];          /* note the old counter value */
+    INC(node->cnts[i], wgt);    /* and add the transaction weight */
+    if ((lvl < ist->xlvl)       /* if the set crossed the border */
+    && (((s < ist->smin) && (node->cnts[i] >= ist->smin))
+    ||  ((s < ist->body) && (node->cnts[i] >= ist->body))))
+      ist->xlvl = lvl;          /* note the size of the item set */
+  }                             /* (smallest newly frequent set) */
+  k = CHILDCNT(node);           /* get the number of children */
+  if (k <= 0) return;           /* (skip flags are ignored) */
+  if (o >= 0) {                 /* if a pure array is used */
+    chn = (ISTNODE**)(node->cnts +node->size);
+    ALIGN(chn);                 /* get the child node array and */
+    o   = ITEMOF(chn[0]);       /* the item of the first child */
+    while (--n > 0) {           /* traverse the transaction's items */
+      i = *items++ -o;          /* compute the child array index */
+      if (i <  0) continue;     /* skip items before the first child */
+      if (i >= k) return;       /* and abort after the last one */
+      if (chn[i]) countinc(ist, chn[i], items, n, wgt, lvl+1);
+    } }                         /* count the transaction recursively */
+  else {                        /* if an identifer map is used */
+    chn = (ISTNODE**)((ITEM*)(node->cnts +node->size) +node->size);
+    ALIGN(chn);                 /* get the child node array */
+    while (--n > 0) {           /* traverse the transaction's items */
+      i = search(*items++, chn, k);
+      if (i >= 0) countinc(ist, chn[i], items, n, wgt, lvl+1);
+    }                           /* if the corresp. child node exists, */
+  }                             /* count the transaction recursively */
+}  /* countinc() */
+
+/* In incremental mode (IST_INCR) a transaction is counted into all  */
+/* levels of the tree, so that the counters of all item sets remain */
+/* consistent when transactions are appended. The size of the       */
+/* smallest item set that crossed the minimum support (or body)     */
+/* border is noted, because only from this level on the tree has to */
+/* be rebuilt (see ist_update()).                                    */
+
 /*--------------------------------------------------------------------*/
 #ifdef TATREEFN
 #ifdef TATCOMPACT
 
-static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
+static void countx (ISTNODE *node, const TANODE *tan, ITEM min,
+                    SUPP *pc)
 {                               /* --- count trans. tree recursively */
   ITEM    i, k, o, n;           /* array indices, loop variables */
   ITEM    item;                 /* buffer for an item */
   ITEM    *map;                 /* item identifier map */
+  SUPP    *cnts;                /* counter array to update */
   ISTNODE **chn;                /* child node array */
   TANODE  *cld;                 /* child node in transaction tree */
 
@@ -390,18 +631,19 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
   k = n & ~ITEM_MIN;            /* if the transactions are too short, */
   if (k < min) return;          /* abort the recursion */
   if (n <= 0) {                 /* if this is a leaf node */
-    if (n < 0) count(node, tan_suffix(tan), k, tan_wgt(tan), min);
+    if (n < 0) count(node, tan_suffix(tan), k, tan_wgt(tan), min, pc);
     return;                     /* count the transaction suffix */
   }                             /* and abort the function */
   for (cld = tan_children(tan); cld; cld = tan_sibling(cld))
-    countx(node, cld, min);     /* count the transactions recursively */
+    countx(node, cld, min, pc); /* count the transactions recursively */
   if (node->offset >= 0) {      /* if a pure array is used */
     if (node->chcnt == 0) {     /* if this is a new node (leaf) */
-      o = node->offset;         /* get the index offset */
+      cnts = (pc) ? pc +*pcidx(node) : node->cnts;
+      o = node->offset;         /* get the counters and the offset */
       for (cld = tan_children(tan); cld; cld = tan_sibling(cld)) {
         i = tan_item(cld) -o;   /* traverse the child items */
         if (i < 0) return;      /* if before first item, abort */
-        if (i < node->size) INC(node->cnts[i], tan_wgt(cld));
+        if (i < node->size) INC(cnts[i], tan_wgt(cld));
       } }                       /* otherwise add the trans. weight */
     else if (node->chcnt > 0) { /* if there are child nodes */
       chn = (ISTNODE**)(node->cnts +node->size);
@@ -411,22 +653,23 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
       for (cld = tan_children(tan); cld; cld = tan_sibling(cld)) {
         i = tan_item(cld) -o;   /* traverse the child items */
         if  (i < 0) return;     /* if before first item, abort */
-        if ((i < node->chcnt) && chn[i]) countx(chn[i], cld, min);
+        if ((i < node->chcnt) && chn[i]) countx(chn[i], cld, min, pc);
       }                         /* if the corresp. child node exists, */
     } }                         /* count the trans. tree recursively */
   else {                        /* if an identifer map is used */
     if (node->chcnt == 0) {     /* if this is a new node (leaf) */
       map = (ITEM*)(node->cnts +(k = node->size));
       o   = map[0];             /* get the item identifier map */
+      cnts = (pc) ? pc +*pcidx(node) : node->cnts;
       for (cld = tan_children(tan); cld; cld = tan_sibling(cld)) {
         item = tan_item(cld);   /* traverse the child items */
         if (item < o) return;   /* if before the first item, return */
         #ifdef IST_BSEARCH      /* if to use a binary search */
         i = ia_bsearch(item, map, (size_t)k);
-        if (i >= 0) { k = i; INC(node->cnts[k], tan_wgt(cld)); }
+        if (i >= 0) { k = i; INC(cnts[k], tan_wgt(cld)); }
         #else                   /* if to use a linear search */
         while (map[--k] > item);
-        if (map[k] == item)  INC(node->cnts[k], tan_wgt(cld));
+        if (map[k] == item)  INC(cnts[k], tan_wgt(cld));
         else k++;               /* if the corresp. counter exists, */
         #endif                  /* add the transaction weight to it, */
       } }                       /* otherwise adapt the map index */
@@ -441,10 +684,10 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
         if (item < o) return;   /* if before the first item, abort */
         #ifdef IST_BSEARCH      /* if to use a binary search */
         i = bisect(item, chn, k);
-        if (i < k)              countx(chn[k = i], cld, min);
+        if (i < k)              countx(chn[k = i], cld, min, pc);
         #else                   /* if to use a linear search */
         while (ITEMOF(chn[--k]) > item);
-        if (ITEMOF(chn[k]) == item) countx(chn[k], cld, min);
+        if (ITEMOF(chn[k]) == item) countx(chn[k], cld, min, pc);
         else k++;               /* if the corresp. counter exists, */
         #endif                  /* count the transaction recursively, */
       }                         /* otherwise adapt the child index */
@@ -452,14 +695,52 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
   }
 }  /* countx() */
 
+/*--------------------------------------------------------------------*/
+
+static void countxp (ISTNODE *node, const TANODE *tan, ITEM min,
+                     SUPP *pc, int id, int cnt)
+{                               /* --- count part of a trans. tree */
+  ITEM    i, o, n;              /* array indices, loop variables */
+  int     x;                    /* index of transaction tree child */
+  ISTNODE **chn;                /* child node array */
+  TANODE  *cld;                 /* child node in transaction tree */
+
+  assert(node && tan            /* check the function arguments */
+  &&    (node->offset >= 0)     /* (this function is called only */
+  &&    (id >= 0) && (id < cnt));  /* for the root node) */
+  n = tan_max(tan);             /* get the maximum tansaction length */
+  if ((n & ~ITEM_MIN) < min)    /* if the transactions are too short */
+    return;                     /* or no child nodes exist, abort */
+  if ((n <= 0) || (node->chcnt <= 0)) {
+    if ((n < 0) && (id == 0))   /* count a leaf in the first thread */
+      countx(node, tan, min, pc);
+    return;                     /* (cannot be split) */
+  }                             /* and abort the function */
+  x = 0;                        /* count the subtrees of the children */
+  for (cld = tan_children(tan); cld; cld = tan_sibling(cld))
+    if (x++ % cnt == id) countx(node, cld, min, pc);
+  chn = (ISTNODE**)(node->cnts +node->size);
+  ALIGN(chn);                   /* get the child node array and */
+  o   = ITEMOF(chn[0]);         /* the item of the first child */
+  --min; x = 0;                 /* traverse the child nodes */
+  for (cld = tan_children(tan); cld; cld = tan_sibling(cld)) {
+    if (x++ % cnt != id) continue;
+    i = tan_item(cld) -o;       /* traverse the assigned child items */
+    if  (i < 0) return;         /* if before first item, abort */
+    if ((i < node->chcnt) && chn[i]) countx(chn[i], cld, min, pc);
+  }                             /* if the corresp. child node exists, */
+}  /* countxp() */              /* count the trans. tree recursively */
+
 /*--------------------------------------------------------------------*/
 #else  /* #ifdef TATCOMPACT */
 
-static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
+static void countx (ISTNODE *node, const TANODE *tan, ITEM min,
+                    SUPP *pc, ITEM *buf)
 {                               /* --- count trans. tree recursively */
   ITEM    i, k, o, n;           /* array indices, loop variables */
   ITEM    item;                 /* buffer for an item */
   ITEM    *map;                 /* item identifier map */
+  SUPP    *cnts;                /* counter array to update */
   ISTNODE **chn;                /* child node array */
 
   assert(node && tan);          /* check the function arguments */
@@ -467,19 +748,22 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
     return;                     /* abort the recursion */
   n = tan_size(tan);            /* get the number of children */
   if (n <= 0) {                 /* if there are no children */
-    if (n < 0) count(node, tan_items(tan), -n, tan_wgt(tan), min);
-    return;                     /* count the normal transaction */
-  }                             /* and abort the function */
+    if (n < 0)                  /* count the normal transaction */
+      count(node, (buf) ? tan_widen(tan, buf) : tan_items(tan),
+            -n, tan_wgt(tan), min, pc);
+    return;                     /* (widen the items of a narrow */
+  }                             /* leaf) and abort the function */
   while (--n >= 0)              /* count the transactions recursively */
-    countx(node, tan_child(tan, n), min);
+    countx(node, tan_child(tan, n), min, pc, buf);
   if (node->offset >= 0) {      /* if a pure array is used */
     if (node->chcnt == 0) {     /* if this is a new node (leaf) */
-      o = node->offset;         /* get the index offset */
+      cnts = (pc) ? pc +*pcidx(node) : node->cnts;
+      o = node->offset;         /* get the counters and the offset */
       for (n = tan_size(tan); --n >= 0; ) {
         i = tan_item(tan, n)-o; /* traverse the node's items */
         if (i < 0) return;      /* if before the first item, abort */
         if (i < node->size)     /* if the corresp. counter exists */
-          INC(node->cnts[i], tan_wgt(tan_child(tan, n)));
+          INC(cnts[i], tan_wgt(tan_child(tan, n)));
       } }                       /* add the transaction weight to it */
     else if (node->chcnt > 0) { /* if there are child nodes */
       chn = (ISTNODE**)(node->cnts +node->size);
@@ -489,24 +773,25 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
         i = tan_item(tan, n)-o; /* traverse the node's items */
         if (i < 0) return;      /* if before the first item, abort */
         if ((i < node->chcnt) && chn[i])
-          countx(chn[i], tan_child(tan, n), min);
+          countx(chn[i], tan_child(tan, n), min, pc, buf);
       }                         /* if the corresp. child node exists, */
     } }                         /* count the trans. tree recursively */
   else {                        /* if an identifer map is used */
     if (node->chcnt == 0) {     /* if this is a new node (leaf) */
       map = (ITEM*)(node->cnts +(k = node->size));
       o   = map[0];             /* get the item identifier map */
+      cnts = (pc) ? pc +*pcidx(node) : node->cnts;
       for (n = tan_size(tan); --n >= 0; ) {
         item = tan_item(tan,n); /* traverse the node's items */
         if (item < o) return;   /* if before the first item, abort */
         #ifdef IST_BSEARCH      /* if to use a binary search */
         i = ia_bsearch(item, map, (size_t)k);
         if (i >= 0) { k = i;    /* if counter exists, add trans. wgt. */
-          INC(node->cnts[k], tan_wgt(tan_child(tan, n))); }
+          INC(cnts[k], tan_wgt(tan_child(tan, n))); }
         #else                   /* if to use a linear search */
         while (map[--k] > item);
         if (map[k] == item)     /* if the corresp. counter exists */
-          INC(node->cnts[k], tan_wgt(tan_child(tan, n)));
+          INC(cnts[k], tan_wgt(tan_child(tan, n)));
         else k++;               /* add the transaction weight to it, */
         #endif                  /* otherwise adapt the map index */
       } }
@@ -520,11 +805,11 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
         if (item < o) return;   /* if before the first item, abort */
         #ifdef IST_BSEARCH      /* if to use a binary search */
         i = search(item, chn, k);
-        if (i >= 0) countx(chn[k = i], tan_child(tan, n), min);
+        if (i >= 0) countx(chn[k = i], tan_child(tan, n), min, pc, buf);
         #else                   /* if to use a linear search */
         while (ITEMOF(chn[--k]) > item);
         if (ITEMOF(chn[k]) == item)
-          countx(chn[k], tan_child(tan, n), min);
+          countx(chn[k], tan_child(tan, n), min, pc, buf);
         else k++;               /* if the corresp. counter exists, */
         #endif                  /* count the transaction recursively, */
       }                         /* otherwise adapt the child index */
@@ -532,6 +817,39 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
   }
 }  /* countx() */
 
+/*--------------------------------------------------------------------*/
+
+static void countxp (ISTNODE *node, const TANODE *tan, ITEM min,
+                     SUPP *pc, ITEM *buf, int id, int cnt)
+{                               /* --- count part of a trans. tree */
+  ITEM    i, o, n;              /* array indices, loop variables */
+  ISTNODE **chn;                /* child node array */
+
+  assert(node && tan            /* check the function arguments */
+  &&    (node->offset >= 0)     /* (this function is called only */
+  &&    (id >= 0) && (id < cnt));  /* for the root node) */
+  if (tan_max(tan) < min)       /* if the transactions are too short, */
+    return;                     /* abort the recursion */
+  n = tan_size(tan);            /* get the number of children */
+  if ((n <= 0) || (node->chcnt <= 0)) {
+    if ((n < 0) && (id == 0))   /* count a leaf in the first thread */
+      countx(node, tan, min, pc, buf);
+    return;                     /* (cannot be split) */
+  }                             /* and abort the function */
+  while (--n >= 0)              /* count the subtrees of the children */
+    if (n % cnt == id) countx(node, tan_child(tan, n), min, pc, buf);
+  chn = (ISTNODE**)(node->cnts +node->size);
+  ALIGN(chn);                   /* get the child node array and */
+  o   = ITEMOF(chn[0]);         /* the item of the first child */
+  for (--min, n = tan_size(tan); --n >= 0; ) {
+    if (n % cnt != id) continue;
+    i = tan_item(tan, n)-o;     /* traverse the assigned node items */
+    if (i < 0) return;          /* if before the first item, abort */
+    if ((i < node->chcnt) && chn[i])
+      countx(chn[i], tan_child(tan, n), min, pc, buf);
+  }                             /* if the corresp. child node exists, */
+}  /* countxp() */              /* count the trans. tree recursively */
+
 #endif  /* #ifdef TATCOMPACT .. #else .. */
 #endif  /* #ifdef TATREEFN */
 /*----------------------------------------------------------------------
@@ -540,15 +858,14 @@ static void countx (ISTNODE *node, const TANODE *tan, ITEM min)
 
 static double evaluate (ISTREE *ist, ISTNODE *node, ITEM index)
 {                               /* --- aggregate rule evaluations */
-  ITEM      n;                  /* loop variable, buffer */
+  ITEM      i, k, n;            /* loop variables, buffer */
   ITEM      item;               /* current (head) item */
   SUPP      base;               /* total transaction weight */
   SUPP      supp;               /* support of item set */
   SUPP      body, head;         /* support of rule body and head */
   ITEM      *path;              /* path to follow for body support */
   ISTNODE   *curr;              /* to traverse the nodes on the path */
-  RULEVALFN *refn;              /* rule evaluation function */
-  double    val, agg;           /* (aggregated) value of measure */
+  double    val, agg = 0;       /* (aggregated) value of measure */
 
   assert(ist && node);          /* check the function arguments */
   if (ist->eval <= IST_NONE)    /* if no evaluation measure is given, */
@@ -568,27 +885,35 @@ static double evaluate (ISTREE *ist, ISTNODE *node, ITEM index)
     path = (ITEM*)(curr->cnts +(n = curr->size));
     body = COUNT(curr->cnts[ia_bsearch(ITEMOF(node), path, (size_t)n)]);
   }                             /* find index and get body support */
-  refn = re_function(ist->eval);/* get the evaluation function */
-  agg  = (!ist->invbxs          /* compute the first measure value */
-      || ((double)supp *(double)base > (double)head *(double)body))
-       ? refn(supp, body, head, base) : (ist->dir < 0) ? 1 : 0;
   if (ist->agg <= IST_FIRST)    /* if to return the first value, */
-    return agg;                 /* return the computed value */
+    return (!ist->invbxs        /* compute and return it directly */
+        || ((double)supp *(double)base > (double)head *(double)body))
+         ? re_eval(&ist->rev, supp, body, head, base)
+         : (ist->dir < 0) ? 1 : 0;
+  ist->rbody[0] = body;         /* note the supports of the rule */
+  ist->rhead[0] = head; k = 1;  /* with the first head item */
   path = ist->buf +ist->height; /* initialize the path/item array */
   *--path = item; n = 1;        /* for the support retrieval */
   item = ITEMOF(node);          /* get the next head item */
   for ( ; curr; curr = curr->parent) {
-    head = COUNT(ist->lvls[0]->cnts[item]);
-    body = COUNT(getsupp(curr, path, n));
-    val  = (!ist->invbxs        /* compute next measure value */
-        || ((double)supp *(double)base > (double)head *(double)body))
-         ? refn(supp, body, head, base) : (ist->dir < 0) ? 1 : 0;
-    if      (ist->agg == IST_MIN) { if (val < agg) agg = val; }
-    else if (ist->agg == IST_MAX) { if (val > agg) agg = val; }
-    else agg += val;            /* compute the rule evaluation */
-    *--path = item; n += 1;     /* and aggregate it by min/max/sum */
+    ist->rhead[k]   = COUNT(ist->lvls[0]->cnts[item]);
+    ist->rbody[k++] = COUNT(getsupp(curr, path, n));
+    *--path = item; n += 1;     /* collect the rule supports */
     item = ITEMOF(curr);        /* then extend the path/item array */
   }                             /* (store the head item) */
+  for (i = 0; i < k; i++) ist->rsupp[i] = supp;
+  re_evalv(&ist->rev, ist->rsupp, ist->rbody, ist->rhead, base,
+           ist->rvals, (size_t)k); /* evaluate all rules at once */
+  for (i = 0; i < k; i++) {     /* traverse the rule evaluations */
+    val = (!ist->invbxs         /* get the next measure value */
+       || ((double)supp *(double)base
+         > (double)ist->rhead[i] *(double)ist->rbody[i]))
+        ? ist->rvals[i] : (ist->dir < 0) ? 1 : 0;
+    if      (i == 0)              agg = val;
+    else if (ist->agg == IST_MIN) { if (val < agg) agg = val; }
+    else if (ist->agg == IST_MAX) { if (val > agg) agg = val; }
+    else agg += val;            /* aggregate the rule evaluations */
+  }                             /* by minimum, maximum or sum */
   if (ist->agg == IST_AVG)      /* if to average the evaluations, */
     agg /= (double)n;           /* divide by the number of items */
   return agg;                   /* return the measure aggregate */
@@ -619,13 +944,30 @@ ISTREE* ist_create (ITEMBASE *base, int mode,
   ist->map  = (ITEM*)    malloc((size_t)(n+1) *sizeof(ITEM));
   if (!ist->map)  { free(ist->buf);
                     free(ist->lvls); free(ist); return NULL; }
-  ist->lvls[0] = ist->curr =    /* allocate a root node */
-  root = (ISTNODE*)calloc(1,            sizeof(ISTNODE)
-                        +(size_t)(n-1) *sizeof(SUPP));
-  if (!root)      { free(ist->map); free(ist->buf);
+  ist->arena = (ISTBLK**)calloc((size_t)(n+1),  sizeof(ISTBLK*));
+  if (!ist->arena){ free(ist->map); free(ist->buf);
                     free(ist->lvls); free(ist); return NULL; }
+  ist->rvals = (double*)malloc((size_t)(n+1) *(sizeof(double)
+                              +3*sizeof(SUPP) +sizeof(ITEM)));
+  if (!ist->rvals){ free(ist->arena); free(ist->map); free(ist->buf);
+                    free(ist->lvls);  free(ist); return NULL; }
+  ist->rsupp = (SUPP*)(ist->rvals +n+1);
+  ist->rbody = ist->rsupp +n+1; /* organize the buffers */
+  ist->rhead = ist->rbody +n+1; /* for the batch evaluation */
+  ist->ritem = (ITEM*)(ist->rhead +n+1);
+  #ifdef BENCH                  /* if benchmark version, */
+  ist->arsz = 0;                /* init. the arena size */
+  #endif                        /* (needed by ar_alloc()) */
+  ist->lvls[0] = ist->curr =    /* allocate a root node */
+  root = (ISTNODE*)ar_alloc(ist, 0, sizeof(ISTNODE)
+                                   +(size_t)(n-1) *sizeof(SUPP));
+  if (!root)      { free(ist->rvals);
+                    free(ist->arena); free(ist->map); free(ist->buf);
+                    free(ist->lvls);  free(ist); return NULL; }
 
   /* --- initialize structures --- */
+  if (mode & IST_INCR)          /* perfect extensions may be lost */
+    mode &= ~IST_PERFECT;       /* by appending transactions */
   ist->base   = base;           /* copy parameters to the structure */
   ist->mode   = mode;
   ist->wgt    = ib_getwgt(base);
@@ -641,12 +983,17 @@ ISTREE* ist_create (ITEMBASE *base, int mode,
   /* number, which can lead to missing rules. To prevent this, the   */
   /* confidence is made smaller by the largest possible factor < 1.  */
   ist->depth  = 1;
+  ist->cpus   = 1;              /* count with a single thread */
+  ist->pcnts  = NULL;           /* (no private counters needed) */
+  ist->pcsz   = 0;
+  ist->xlvl   = ITEM_MAX;       /* no set has crossed the border */
   #ifdef BENCH                  /* if benchmark version */
   ist->ndcnt  = 1; ist->ndprn = ist->mapsz = 0;
   ist->sccnt  = ist->scnec = n; ist->scprn = 0;
   ist->cpcnt  = ist->cpnec =    ist->cpprn = 0;
   #endif                        /* initialize the benchmark variables */
   ist_setsize(ist, 1, ITEM_MAX);
+  re_init(&ist->rev, RE_NONE, INFINITY);
   ist_seteval(ist, IST_NONE, IST_NONE, 1, ITEM_MAX);
   ist_init(ist, 0);             /* initialize the extraction vars. */
   root->parent = root->succ  = NULL;
@@ -661,21 +1008,19 @@ ISTREE* ist_create (ITEMBASE *base, int mode,
 
 void ist_delete (ISTREE *ist)
 {                               /* --- delete an item set tree */
-  ITEM    h;                    /* loop variable */
-  ISTNODE *node, *t;            /* to traverse the nodes */
+  ITEM h;                       /* loop variable */
 
   assert(ist);                  /* check the function argument */
-  if (!ist->valid)              /* if levels are not valid */
-    delete(ist->lvls[0]);       /* use recursive deletion */
-  else {                        /* if levels are valid */
-    for (h = ist->height; --h >= 0; ) {
-      for (node = ist->lvls[h]; node; ) {
-        t = node; node = node->succ; free(t); }
-    }                           /* delete all nodes */
-  }                             /* by traversing the levels */
+  for (h = ist->height; --h >= 0; )
+    ar_free(ist, ist->arena[h]);/* delete the node arenas */
+  free(ist->arena);             /* of all tree levels */
+  if (ist->pcnts)               /* delete the private counters */
+    free(ist->pcnts);           /* (if there are any) */
   free(ist->lvls);              /* delete the level array, */
   free(ist->map);               /* the identifier map, */
   free(ist->buf);               /* the path buffer, */
+  re_exit(&ist->rev);           /* the rule evaluator, */
+  free(ist->rvals);             /* the evaluation buffers */
   free(ist);                    /* and the tree body */
 }  /* ist_delete() */
 
@@ -685,8 +1030,11 @@ void ist_count (ISTREE *ist, const ITEM *items, ITEM n, SUPP wgt)
 {                               /* --- count a transaction */
   assert(ist                    /* check the function arguments */
   &&    (n >= 0) && (items || (n <= 0)));
-  if (n >= ist->height)         /* recursively count the transaction */
-    count(ist->lvls[0], items, n, wgt, ist->height);
+  if (ist->mode & IST_INCR) {   /* if in incremental mode, */
+    INC(ist->wgt, wgt);         /* sum the transaction weight */
+    countinc(ist, ist->lvls[0], items, n, wgt, 1); }
+  else if (n >= ist->height)    /* recursively count the transaction */
+    count(ist->lvls[0], items, n, wgt, ist->height, NULL);
 }  /* ist_count() */
 
 /*--------------------------------------------------------------------*/
@@ -697,37 +1045,315 @@ void ist_countt (ISTREE *ist, const TRACT *t)
 
   assert(ist && t);             /* check the function arguments */
   k = ta_size(t);               /* get the transaction size and */
-  if (k >= ist->height)         /* count the transaction recursively */
-    count(ist->lvls[0], ta_items(t), k, ta_wgt(t), ist->height);
+  if (ist->mode & IST_INCR) {   /* if in incremental mode, */
+    INC(ist->wgt, ta_wgt(t));   /* sum the transaction weight */
+    countinc(ist, ist->lvls[0], ta_items(t), k, ta_wgt(t), 1); }
+  else if (k >= ist->height)    /* count the transaction recursively */
+    count(ist->lvls[0], ta_items(t), k, ta_wgt(t), ist->height, NULL);
 }  /* ist_countt() */
 
 /*--------------------------------------------------------------------*/
 
-void ist_countb (ISTREE *ist, const TABAG *bag)
+void ist_setcpus (ISTREE *ist, int cpus)
+{                               /* --- set number of threads */
+  assert(ist                    /* check the function argument */
+  &&    (ist->height <= 1));    /* (only before levels are added) */
+  if (cpus <= 0) cpus = cpucnt();
+  ist->cpus = (cpus > 1) ? cpus : 1;
+}  /* ist_setcpus() */          /* note the number of threads */
+
+/*--------------------------------------------------------------------*/
+
+static int pcinit (ISTREE *ist)
+{                               /* --- init. private counters */
+  ISTNODE *node;                /* to traverse the nodes */
+  size_t  n;                    /* number of counters per thread */
+
+  assert(ist);                  /* check the function argument */
+  if (ist->pcnts) return 0;     /* check for existing counters */
+  if (!ist->valid)              /* if the levels are not valid, */
+    makelvls(ist);              /* set the successor pointers */
+  n = 0;                        /* traverse the new level */
+  for (node = ist->lvls[ist->height-1]; node; node = node->succ) {
+    *pcidx(node) = n; n += (size_t)node->size; }
+  ist->pcsz  = n;               /* note the counter array indices */
+  ist->pcnts = (SUPP*)calloc((size_t)(ist->cpus-1) *n, sizeof(SUPP));
+  return (ist->pcnts) ? 0 : -1; /* allocate the private counters */
+}  /* pcinit() */
+
+/*--------------------------------------------------------------------*/
+
+static void pcsum (ISTREE *ist)
+{                               /* --- sum private counters */
+  int     k;                    /* loop variable for threads */
+  ITEM    i;                    /* loop variable for counters */
+  ISTNODE *node;                /* to traverse the nodes */
+  SUPP    *pc;                  /* to traverse the private counters */
+
+  assert(ist);                  /* check the function argument */
+  if (!ist->pcnts) return;      /* check for private counters */
+  for (node = ist->lvls[ist->height-1]; node; node = node->succ) {
+    for (k = 0; k < ist->cpus-1; k++) {
+      pc = ist->pcnts +(size_t)k *ist->pcsz +*pcidx(node);
+      for (i = 0; i < node->size; i++)
+        INC(node->cnts[i], pc[i]);
+    }                           /* add the private counters */
+  }                             /* of all threads to the counters */
+  free(ist->pcnts);             /* of the nodes and delete */
+  ist->pcnts = NULL;            /* the private counter arrays */
+  ist->pcsz  = 0;
+}  /* pcsum() */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(cntwork, p)
+{                               /* --- worker for parallel counting */
+  WORKDATA *w = p;              /* type the argument pointer */
+  ISTREE   *ist;                /* item set tree to count into */
+  TID      i;                   /* loop variable */
+  ITEM     k;                   /* number of items */
+  TRACT    *t;                  /* to traverse the transactions */
+
+  assert(p);                    /* check the function argument */
+  ist = w->ist;                 /* get the item set tree */
+  #ifdef TATREEFN               /* if transaction tree functions */
+  if (w->tree) {                /* if to count a transaction tree */
+    #ifdef TATCOMPACT           /* if compact transaction tree */
+    countxp(ist->lvls[0], tat_root(w->tree), ist->height,
+            w->pc, w->id, w->cnt);
+    #else                       /* if the tree may have narrow leaves */
+    countxp(ist->lvls[0], tat_root(w->tree), ist->height,
+            w->pc, w->buf, w->id, w->cnt);
+    #endif
+    return THREAD_OK;           /* count the sibling subset */
+  }                             /* that is assigned to this thread */
+  #endif
+  tbi_seek(w->iter, w->beg);    /* go to the first transaction */
+  for (i = w->beg; i < w->end; i++) {
+    t = tbi_next(w->iter);      /* traverse the transactions */
+    k = ta_size(t);             /* get the transaction size and */
+    if (k >= ist->height)       /* count the transaction recursively */
+      count(ist->lvls[0], ta_items(t), k, ta_wgt(t), ist->height, w->pc);
+  }                             /* (in the assigned range) */
+  return THREAD_OK;             /* return a dummy result */
+}  /* cntwork() */
+
+/*--------------------------------------------------------------------*/
+
+static int parcnt (ISTREE *ist, const TABAG *bag, const void *tree,
+                   ITEM *buf, size_t z)
+{                               /* --- count with multiple threads */
+  int      c, i, k;             /* number of threads, loop variables */
+  TID      n;                   /* number of transactions */
+  WORKDATA *w;                  /* data for the worker threads */
+  THREAD   *threads;            /* thread handles */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  DWORD    thid;                /* dummy for storing the thread id */
+  #endif                        /* (not really needed here) */
+
+  assert(ist && (bag || tree)); /* check the function arguments */
+  if (pcinit(ist) != 0)         /* create the private counters */
+    return -1;                  /* of the worker threads */
+  c = ist->cpus;                /* get the number of threads */
+  threads = (THREAD*)malloc((size_t)c *sizeof(THREAD));
+  if (!threads) return -1;      /* create the thread handles */
+  w = (WORKDATA*)malloc((size_t)c *sizeof(WORKDATA));
+  if (!w) { free(threads); return -1; }
+  n = (bag) ? tbg_cnt(bag) : 0; /* get the number of transactions */
+  for (i = 0; i < c; i++) {     /* traverse the threads */
+    w[i].ist  = ist;            /* note the item set tree */
+    w[i].bag  = bag;            /* and the transaction bag/tree */
+    #ifdef TATREEFN             /* if transaction tree functions */
+    w[i].tree = (const TATREE*)tree;
+    #endif
+    w[i].beg  = (TID)(((double)n *(double) i)    /(double)c);
+    w[i].end  = (TID)(((double)n *(double)(i+1)) /(double)c);
+    w[i].id   = i;              /* compute the transaction range */
+    w[i].cnt  = c;              /* and note the thread index */
+    w[i].pc   = (i > 0) ? ist->pcnts +(size_t)(i-1) *ist->pcsz : NULL;
+    w[i].buf  = (buf) ? buf +(size_t)i *z : NULL;
+    w[i].iter = NULL;           /* the first thread counts directly */
+    if (bag && !(w[i].iter = tbi_create(bag))) break;
+  }                             /* create an iterator per thread */
+  if (i < c) {                  /* if an iterator is missing */
+    while (--i >= 0) tbi_delete(w[i].iter);
+    free(w); free(threads); return -1;
+  }                             /* delete the created iterators */
+  for (i = 1; i < c; i++) {     /* traverse the additional threads */
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    threads[i] = CreateThread(NULL, 0, cntwork, w+i, 0, &thid);
+    if (!threads[i]) break;     /* create a thread for each worker */
+    #else                       /* if Linux/Unix system */
+    if (pthread_create(threads+i, NULL, cntwork, w+i) != 0)
+      break;                    /* create a thread for each worker */
+    #endif                      /* (count in parallel) */
+  }
+  for (k = i; k < c; k++)       /* if not all threads were created, */
+    cntwork(w+k);               /* count the parts of the missing ones */
+  cntwork(w);                   /* count in the calling thread */
+  for (k = i; --k > 0; ) {      /* wait for threads to finish */
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    WaitForSingleObject(threads[k], INFINITE);
+    CloseHandle(threads[k]);    /* wait for the thread to finish */
+    #else                       /* if Linux/Unix system */
+    pthread_join(threads[k], NULL);
+    #endif                      /* (join threads with this one) */
+  }
+  for (k = 0; k < c; k++)       /* delete the iterators */
+    if (w[k].iter) tbi_delete(w[k].iter);
+  free(w); free(threads);       /* delete worker data and handles */
+  return 0;                     /* return 'ok' */
+}  /* parcnt() */
+
+/*--------------------------------------------------------------------*/
+#ifndef IST_NOTRIANG
+
+static int tricnt (ISTREE *ist, const TABAG *bag)
+{                               /* --- count pairs in a triangle */
+  ITEM       i, k, n, m;        /* loop variables, number of items */
+  ITEM       *idx;              /* dense indices of the used items */
+  ITEM       *buf;              /* buffer for a recoded transaction */
+  const ITEM *s;                /* to traverse the transaction items */
+  size_t     *rows;             /* row offsets in triangular array */
+  size_t     z, c, r;           /* array size, number of counters */
+  SUPP       *tri;              /* triangular counter array */
+  SUPP       w;                 /* weight of a transaction */
+  ISTNODE    *node;             /* to traverse the nodes */
+  TRACT      *t;                /* to traverse the transactions */
+  TBGITER    *iter;             /* to traverse the transactions */
+
+  assert(ist && bag && (ist->height == 2));
+  if (!ist->valid)              /* if the levels are not valid, */
+    makelvls(ist);              /* set the successor pointers */
+  m   = ist->lvls[0]->size;     /* get the number of items */
+  idx = (ITEM*)malloc((size_t)(m+tbg_max(bag)) *sizeof(ITEM));
+  if (!idx) return 1;           /* create an item index map */
+  for (i = 0; i < m; i++) idx[i] = -1;
+  for (c = 0, node = ist->lvls[1]; node; node = node->succ) {
+    idx[ITEMOF(node)] = 0;      /* traverse the level 2 nodes */
+    for (i = 0; i < node->size; i++)
+      idx[ITEMAT(node, i)] = 0; /* mark the items of the nodes */
+    c += (size_t)node->size;    /* and their counters and sum */
+  }                             /* the number of counters */
+  for (n = i = 0; i < m; i++)   /* recode the used items */
+    if (idx[i] >= 0) idx[i] = n++;
+  z = (size_t)n *(size_t)(n-1) /2;
+  if ((n < 2) || (z > TRI_MAX) || (z > c+c)) {
+    free(idx); return 1; }      /* check the size of the array */
+  rows = (size_t*)malloc((size_t)n *sizeof(size_t));
+  if (!rows) { free(idx); return 1; }
+  tri  = (SUPP*)calloc(z, sizeof(SUPP));
+  if (!tri)  { free(rows); free(idx); return 1; }
+  for (i = 0; i < n; i++)       /* compute the row offsets */
+    rows[i] = (size_t)i *(size_t)(n+n-i-3) /2 -1;
+  buf  = idx +m;                /* get the transaction buffer */
+  iter = tbi_create(bag);       /* create a transaction iterator */
+  if (!iter) { free(tri); free(rows); free(idx); return -1; }
+  while ((t = tbi_next(iter)) != NULL) {
+    s = ta_items(t);            /* traverse the transactions */
+    for (n = 0, k = ta_size(t); --k >= 0; s++) {
+      if (*s >= m) break;       /* skip items added after creation */
+      if ((*s >= 0) && (idx[*s] >= 0)) buf[n++] = idx[*s];
+    }                           /* recode the transaction items */
+    w = ta_wgt(t);              /* get the transaction weight */
+    for (i = 0; i < n-1; i++) { /* traverse the pairs of items */
+      r = rows[buf[i]];         /* get the row of the first item */
+      for (k = i+1; k < n; k++) tri[r +(size_t)buf[k]] += w;
+    }                           /* add the transaction weight */
+  }                             /* to the counters of the pairs */
+  tbi_delete(iter);             /* delete the transaction iterator */
+  for (node = ist->lvls[1]; node; node = node->succ) {
+    r = rows[idx[ITEMOF(node)]];/* traverse the level 2 nodes */
+    for (i = 0; i < node->size; i++) {
+      assert(idx[ITEMAT(node, i)] > idx[ITEMOF(node)]);
+      INC(node->cnts[i], tri[r +(size_t)idx[ITEMAT(node, i)]]);
+    }                           /* copy the pair supports */
+  }                             /* to the counters of the nodes */
+  free(tri); free(rows); free(idx);
+  return 0;                     /* return 'ok' */
+}  /* tricnt() */
+
+/* The supports of the item pairs (second tree level) are counted  */
+/* with a flat triangular array that is indexed with the recoded   */
+/* items of the pairs. The items that occur in the level 2 nodes   */
+/* are mapped to dense indices (in the item order, so that the     */
+/* second item of a pair always has the larger index), and each    */
+/* transaction is recoded into a buffer. The inner loop then adds  */
+/* the transaction weight to one row of the array without any      */
+/* search or test, and the pair supports are finally copied to the */
+/* counters of the tree nodes (item maps are resolved only once).  */
+/* If the array would be too large or much larger than the total   */
+/* number of counters of the level 2 nodes (sparse pairs), or if   */
+/* memory cannot be allocated, the normal counting is used.        */
+
+#endif
+/*--------------------------------------------------------------------*/
+
+int ist_countb (ISTREE *ist, const TABAG *bag)
 {                               /* --- count a transaction bag */
-  TID   i;                      /* loop variable */
-  ITEM  k;                      /* number of items */
-  TRACT *t;                     /* to traverse the transactions */
+  ITEM    k;                    /* number of items */
+  TRACT   *t;                   /* to traverse the transactions */
+  TBGITER *iter;                /* to traverse the transactions */
+  #ifndef IST_NOTRIANG          /* if to count pairs in a triangle */
+  int     r;                    /* result of pair counting */
+  #endif
 
   assert(ist && bag);           /* check the function arguments */
   if (tbg_max(bag) < ist->height)
-    return;                     /* check for suff. long transactions */
-  for (i = tbg_cnt(bag); --i >= 0; ) {
-    t = tbg_tract(bag, i);      /* traverse the transactions */
-    k = ta_size(t);             /* get the transaction size and */
+    return 0;                   /* check for suff. long transactions */
+  #ifndef IST_NOTRIANG          /* if to count pairs in a triangle */
+  if ((ist->height == 2) && (ist->cpus <= 1)
+  && !(ist->mode & IST_REVERSE)
+  &&  ((r = tricnt(ist, bag)) <= 0))
+    return r;                   /* try to count pairs in an array */
+  #endif
+  if ((ist->cpus > 1) && (ist->height > 1)
+  &&  (tbg_cnt(bag) >= (TID)ist->cpus)
+  &&  (parcnt(ist, bag, NULL, NULL, 0) == 0))
+    return 0;                   /* try to count with multiple threads */
+  iter = tbi_create(bag);       /* create a transaction iterator */
+  if (!iter) return -1;         /* (bag may be compressed) */
+  while ((t = tbi_next(iter)) != NULL) {
+    k = ta_size(t);             /* traverse the transactions */
     if (k >= ist->height)       /* count the transaction recursively */
-      count(ist->lvls[0], ta_items(t), k, ta_wgt(t), ist->height);
-  }
+      count(ist->lvls[0], ta_items(t), k, ta_wgt(t), ist->height, NULL);
+  }                             /* (get the transaction size first) */
+  tbi_delete(iter);             /* delete the transaction iterator */
+  return 0;                     /* return 'ok' */
 }  /* ist_countb() */
 
 /*--------------------------------------------------------------------*/
 #ifdef TATREEFN
 
-void ist_countx (ISTREE *ist, const TATREE *tree)
+int ist_countx (ISTREE *ist, const TATREE *tree)
 {                               /* --- count transaction in tree */
+  ITEM   *buf = NULL;           /* buffers for narrow leaf items */
+  size_t z    = 0;              /* size of a buffer (per thread) */
+
   assert(ist && tree);          /* check the function arguments */
-  countx(ist->lvls[0], tat_root(tree), ist->height);
-}  /* ist_countx() */           /* recursively count the trans. tree */
+  #ifndef TATCOMPACT            /* if the tree may have narrow leaves */
+  if (tat_narrow(tree)) {       /* if the leaf items are narrow */
+    z   = (size_t)tan_max(tat_root(tree)) +1;
+    buf = (ITEM*)malloc((size_t)ist->cpus *z *sizeof(ITEM));
+    if (!buf) return -1;        /* create a buffer per thread */
+  }                             /* for widening the leaf items */
+  #endif
+  if ((ist->cpus > 1) && (ist->height > 1)
+  &&  (parcnt(ist, NULL, tree, buf, z) == 0)) {
+    free(buf); return 0; }      /* try to count with multiple threads */
+  #ifdef TATCOMPACT             /* if compact transaction tree */
+  countx(ist->lvls[0], tat_root(tree), ist->height, NULL);
+  #else                         /* if the tree may have narrow leaves */
+  countx(ist->lvls[0], tat_root(tree), ist->height, NULL, buf);
+  #endif                        /* recursively count the trans. tree */
+  free(buf);                    /* delete the item buffers */
+  return 0;                     /* return 'ok' */
+}  /* ist_countx() */
+
+/* If the leaves of the transaction tree store their items with 16  */
+/* bits (see tat_narrow()), the items of a leaf are widened into a  */
+/* buffer before they are counted, so that the normal counting      */
+/* function count() can be used. Each thread needs its own buffer.  */
 
 #endif
 /*--------------------------------------------------------------------*/
@@ -738,8 +1364,10 @@ void ist_commit (ISTREE *ist)
   ISTNODE *node;                /* to traverse the nodes */
 
   assert(ist);                  /* check the function argument */
+  pcsum(ist);                   /* sum the private thread counters */
   if ((ist->eval   <= IST_NONE) /* if not to prune with evaluation */
-  ||  (ist->height <  ist->prune))
+  ||  (ist->height <  ist->prune)
+  ||  (ist->mode   &  IST_INCR))/* or if in incremental mode, */
     return;                     /* abort the function */
   if (!ist->valid)              /* if the levels are not valid, */
     makelvls(ist);              /* set the successor pointers */
@@ -750,6 +1378,14 @@ void ist_commit (ISTREE *ist)
         SETSKIP(node->cnts[i]); /* mark sets that do not qualify */
 }  /* ist_commit() */
 
+/* With multiple threads the transactions (or the children of the  */
+/* root of the transaction tree) are split into as many parts, one  */
+/* per thread. The first part is counted by the calling thread into */
+/* the counters of the item set tree, all other parts are counted   */
+/* into private counter arrays, which are added to the counters of  */
+/* the item set tree by ist_commit(). Hence ist_commit() must be    */
+/* called after counting, before the counters are accessed.         */
+
 /*--------------------------------------------------------------------*/
 
 static int used (ISTNODE *node, int *marks, SUPP supp)
@@ -818,7 +1454,8 @@ void ist_prune (ISTREE *ist)
   ISTNODE **chn;                /* child node array */
 
   assert(ist);                  /* check the function argument */
-  if (ist->height <= 1)         /* if there is only the root node, */
+  if ((ist->height <= 1)        /* if there is only the root node, */
+  ||  (ist->mode & IST_INCR))   /* or the border has to be kept, */
     return;                     /* there is nothing to prune */
   if (!ist->valid)              /* if the levels are not valid, */
     makelvls(ist);              /* set the successor pointers */
@@ -899,7 +1536,7 @@ void ist_prune (ISTREE *ist)
   for (np = ist->lvls +ist->height-1; *np; ) {
     node = *np;                 /* traverse the deepest level again */
     if (node->size > 0) { np = &node->succ; continue; }
-    *np = node->succ; free(node); /* remove empty nodes */
+    *np = node->succ;           /* remove empty nodes */
     #ifdef BENCH                /* if benchmark version */
     ist->ndcnt--; ist->ndprn++; /* update the number nodes */
     #endif                      /* and of pruned nodes */
@@ -908,7 +1545,8 @@ void ist_prune (ISTREE *ist)
 
 /*--------------------------------------------------------------------*/
 
-static ISTNODE* child (ISTREE *ist, ISTNODE *node, ITEM index, SUPP pex)
+static ISTNODE* child (ISTREE *ist, ISTNODE *node, ITEM lvl,
+                       ITEM index, SUPP pex)
 {                               /* --- create child node (extend set) */
   ITEM    i, k, n, m, e;        /* loop variables, counters */
   ISTNODE *curr;                /* to traverse the path to the root */
@@ -918,6 +1556,7 @@ static ISTNODE* child (ISTREE *ist, ISTNODE *node, ITEM index, SUPP pex)
   int     hdonly;               /* whether head only item on path */
   int     app;                  /* appearance flags of an item */
   SUPP    supp;                 /* support of an item set */
+  size_t  z;                    /* size of the node to create */
 
   assert(ist && node            /* check the function arguments */
   &&    (index >= 0) && (index < node->size));
@@ -986,9 +1625,12 @@ static ISTNODE* child (ISTREE *ist, ISTNODE *node, ITEM index, SUPP pex)
   #endif
 
   /* --- create child --- */
-  curr = (ISTNODE*)malloc(sizeof(ISTNODE) +(size_t)(n-1) *sizeof(SUPP)
-                                          +(size_t) k    *sizeof(ITEM));
-  if (!curr) return (ISTNODE*)-1;      /* create a child node */
+  z = sizeof(ISTNODE) +(size_t)(n-1) *sizeof(SUPP)
+                      +(size_t) k    *sizeof(ITEM);
+  if (ist->cpus > 1)            /* if to count with multiple threads, */
+    z += PAD(z) +sizeof(size_t);/* add a private counter index */
+  curr = (ISTNODE*)ar_alloc(ist, lvl+1, z);
+  if (!curr) return (ISTNODE*)-1;  /* create a child node */
   if (hdonly) item |= HDONLY;   /* set the head only flag and */
   curr->item  = item;           /* initialize the item identifier */
   curr->chcnt = 0;              /* there are no children yet */
@@ -1045,13 +1687,13 @@ only items is determined from the nodes 'hdonly' flag and the
 appearance flags of the items.
 ----------------------------------------------------------------------*/
 
-static ISTNODE** children (ISTREE *ist, ISTNODE **np, ISTNODE **end)
+static ISTNODE** children (ISTREE *ist, ISTNODE **np, ISTNODE **end,
+                           ITEM lvl)
 {                               /* --- create children of a node */
   ITEM    i, n;                 /* loop variable, node counter */
   size_t  z;                    /* size of counter and map arrays */
   SUPP    pex;                  /* support for a perfect extension */
   ISTNODE *node;                /* node to get children */
-  ISTNODE *par;                 /* parent of current node */
   ISTNODE *cur;                 /* current node in new level (child) */
   ISTNODE **frst;               /* first child of current node */
   ISTNODE *last;                /* last  child of current node */
@@ -1065,8 +1707,8 @@ static ISTNODE** children (ISTREE *ist, ISTNODE **np, ISTNODE **end)
   else pex = getsupp(node->parent, &node->item, 1);
   pex = COUNT(pex);             /* get support for perfect extension */
   for (i = n = 0; i < node->size; i++) {
-    cur = child(ist,node,i,pex);/* traverse the counter array */
-    if (!cur) continue;         /* create a child node if necessary */
+    cur = child(ist, node, lvl, i, pex);
+    if (!cur) continue;         /* traverse the counter array and */
     if (cur == (void*)-1) { *end = NULL; return NULL; }
     *end = last = cur;          /* add node at the end of the list */
     end  = &cur->succ; n++;     /* that contains the new level */
@@ -1077,33 +1719,15 @@ static ISTNODE** children (ISTREE *ist, ISTNODE **np, ISTNODE **end)
   #ifdef BENCH                  /* if benchmark version, */
   ist->cpnec += n;              /* sum the number of */
   #endif                        /* necessary child pointers */
-  chn = np; par = node->parent; /* get the parent node */
-  if (par) {                    /* if there is a parent node */
-    if (par->offset >= 0) {     /* if a pure array is used */
-      chn = (ISTNODE**)(par->cnts +par->size);
-      ALIGN(chn);               /* get the child node array */
-      chn += ITEMOF(node) -ITEMOF(chn[0]); }
-    else {                      /* if an identifier map is used */
-      chn = (ISTNODE**)((ITEM*)(par->cnts +par->size) +par->size);
-      ALIGN(chn);               /* get the child node array */
-      chn += search(ITEMOF(node), chn, CHILDCNT(par));
-    }                           /* find the child node pointer */
-  }                             /* in the parent node */
-  /* The location of the child pointer in the parent node must be  */
-  /* retrieved here, because ITEMOF(chn[0]) (for a pure array) may */
-  /* access already freed memory after the node has been resized,  */
-  /* since it may be that node = chn[0] and then chn[0] may become */
-  /* by the reallocation of the node to add the child pointers.    */
-  if (node->offset >= 0) {      /* if a pure counter array is used */
-    z = (size_t)(node->size-1) *sizeof(SUPP);
-    n = ITEMOF(last) -ITEMOF(*frst) +1; } /* pure child array */
-  else {                        /* if an identifier map is used */
-    z = (size_t)(node->size-1) *sizeof(SUPP)
-      + (size_t) node->size    *sizeof(ITEM);
-  }                             /* add a compact child array */
-  z += sizeof(ISTNODE);         /* add the node size */
-  node = (ISTNODE*)realloc(node, z+PAD(z) +(size_t)n*sizeof(ISTNODE*));
-  if (!node) return NULL;       /* add a child array to the node */
+  chn = chnptr(node);           /* get the pointer to the node */
+  if (!chn) chn = np;           /* in the parent node (if any) */
+  z = ndsize(node);             /* get the size of the node */
+  if (node->offset >= 0)        /* if a pure counter array is used */
+    n = ITEMOF(last) -ITEMOF(*frst) +1;   /* pure child array */
+  cur = (ISTNODE*)ar_alloc(ist, lvl, z+PAD(z)
+                           +(size_t)n *sizeof(ISTNODE*));
+  if (!cur) return NULL;        /* create a copy of the node */
+  node = (ISTNODE*)memcpy(cur, node, z); /* with a child array */
   *np = *chn = node;            /* update the node pointer and */
   node->chcnt = n;              /* note the number of children */
   #ifdef BENCH                  /* if benchmark version, */
@@ -1152,34 +1776,75 @@ static int needed (ISTNODE *node)
 
 /*--------------------------------------------------------------------*/
 
-static void cleanup (ISTREE *ist)
+static void cleanup (ISTREE *ist, ISTBLK *old)
 {                               /* --- clean up on error */
-  ISTNODE *node, *t;            /* to traverse the nodes */
+  ITEM    h;                    /* index of the deepest level */
+  ISTBLK  **blk;                /* to traverse the arena blocks */
+  ISTNODE *node;                /* to traverse the nodes */
 
   assert(ist);                  /* check the function argument */
-  for (node = ist->lvls[ist->height]; node; ) {
-    t = node; node = node->succ; free(t); }
-  ist->lvls[ist->height] = NULL;/* delete all created nodes */
-  for (node = ist->lvls[ist->height-1]; node; node = node->succ)
+  h = ist->height;              /* get the index of the new level */
+  ar_free(ist, ist->arena[h]);  /* delete all created nodes */
+  ist->arena[h] = NULL; ist->lvls[h] = NULL;
+  for (node = ist->lvls[h-1]; node; node = node->succ)
     node->chcnt = 0;            /* clear the child node counters */
-}  /* cleanup() */              /* of the deepest nodes in the tree */
+  for (blk = ist->arena +h-1; *blk; blk = &(*blk)->succ)
+    ;                           /* of the deepest nodes in the tree */
+  *blk = old;                   /* keep the old arena, since some */
+}  /* cleanup() */              /* nodes may not have been copied */
+
+/*--------------------------------------------------------------------*/
+
+static int relocate (ISTREE *ist, ITEM lvl)
+{                               /* --- copy childless nodes */
+  size_t  z;                    /* size of a node */
+  ISTNODE **np;                 /* to traverse the nodes */
+  ISTNODE *node;                /* copy of a node */
+  ISTNODE **chn;                /* pointer to node in parent node */
+
+  assert(ist && (lvl >= 0));    /* check the function arguments */
+  for (np = ist->lvls +lvl; *np; np = &(*np)->succ) {
+    if (CHILDCNT(*np) > 0)      /* skip nodes with children, */
+      continue;                 /* which were copied by children() */
+    chn  = chnptr(*np);         /* get the pointer in the parent */
+    z    = ndsize(*np);         /* and the size of the node */
+    node = (ISTNODE*)ar_alloc(ist, lvl, z+PAD(z) +sizeof(size_t));
+    if (!node) return -1;       /* create a copy of the node */
+    memcpy(node, *np, z);       /* (with a private counter index) */
+    if (chn) *chn = node;       /* replace the node in the parent */
+    *np = node;                 /* and in the level list */
+  }
+  return 0;                     /* return 'ok' */
+}  /* relocate() */
 
 /*--------------------------------------------------------------------*/
 
 int ist_addlvl (ISTREE *ist)
 {                               /* --- add a level to item set tree */
+  ITEM    h;                    /* index of the deepest level */
+  ISTBLK  *old;                 /* old arena of the deepest level */
   ISTNODE **np;                 /* to traverse the nodes */
   ISTNODE **end;                /* end of node list of new level */
 
   assert(ist);                  /* check the function arguments */
   if (!ist->valid)              /* if the levels are not valid, */
     makelvls(ist);              /* set the successor pointers */
+  h    = ist->height -1;        /* get the index of the deepest level */
+  old  = ist->arena[h];         /* and detach its arena, so that its */
+  ist->arena[h] = NULL;         /* nodes are copied into a new one */
   end  = ist->lvls +ist->height;
   *end = NULL;                  /* start a new tree level */
-  for (np = ist->lvls +ist->height -1; *np; np = &(*np)->succ) {
-    end = children(ist,np,end); /* traverse the node level list */
-    if (!end) { cleanup(ist); return -1; }
+  for (np = ist->lvls +h; *np; np = &(*np)->succ) {
+    end = children(ist, np, end, h);
+    if (!end) { cleanup(ist, old); return -1; }
   }                             /* create children and update node */
+  if (relocate(ist, h) != 0) {  /* copy the remaining nodes */
+    cleanup(ist, old); return -1; }
+  ar_free(ist, old);            /* delete the old arena */
+  if (ist->depth > h) {         /* if the current node was copied, */
+    ist->curr  = ist->lvls[0];  /* go back to the root node */
+    ist->depth = 1;             /* (the old node has been deleted) */
+  }
   if (!ist->lvls[ist->height])  /* if no child has been added, */
     return 1;                   /* abort the function, otherwise */
   ist->height += 1;             /* increment the level counter */
@@ -1189,6 +1854,156 @@ int ist_addlvl (ISTREE *ist)
 
 /*--------------------------------------------------------------------*/
 
+void ist_setsmin (ISTREE *ist, SUPP smin, SUPP body)
+{                               /* --- set new minimum support */
+  ITEM    h, i;                 /* loop variables */
+  SUPP    s;                    /* support of an item set */
+  ISTNODE *node;                /* to traverse the nodes */
+
+  assert(ist);                  /* check the function argument */
+  if (smin <= 0)    smin = 1;   /* check and adapt */
+  if (body <  smin) body = smin;/* the support thresholds */
+  if ((ist->mode & IST_INCR)    /* if in incremental mode and */
+  &&  ((smin < ist->smin) || (body < ist->body))) {/* lower support, */
+    if (!ist->valid)            /* if the levels are not valid, */
+      makelvls(ist);            /* set the successor pointers */
+    for (h = 0; (h < ist->height) && (h+1 < ist->xlvl); h++) {
+      for (node = ist->lvls[h]; node; node = node->succ) {
+        for (i = node->size; --i >= 0; ) {
+          s = node->cnts[i];    /* traverse the item sets */
+          if (((s >= smin) && (s < ist->smin))
+          ||  ((s >= body) && (s < ist->body)))
+            break;              /* find the smallest item set */
+        }                       /* that is now frequent, */
+        if (i >= 0) { ist->xlvl = h+1; break; }
+      }                         /* but was not before, and */
+    }                           /* note its size for ist_update() */
+  }
+  ist->smin = smin;             /* store the new */
+  ist->body = body;             /* support thresholds */
+}  /* ist_setsmin() */
+
+/*--------------------------------------------------------------------*/
+
+SUPP ist_kthsupp (ISTREE *ist, ITEM zmin, ITEM zmax, SUPP smax,
+                  size_t k)
+{                               /* --- get k-th largest support */
+  ITEM    h, i;                 /* loop variables */
+  size_t  n = 0, c, p;          /* number of supports, heap indices */
+  SUPP    s, *heap;             /* support of an item set, min-heap */
+  ISTNODE *node;                /* to traverse the nodes */
+
+  assert(ist && (k > 0));       /* check the function arguments */
+  if (zmin < 1)           zmin = 1;  /* adapt the size range */
+  if (zmax > ist->height) zmax = ist->height;
+  if (zmin > zmax) return 0;    /* check for an empty range */
+  heap = (SUPP*)malloc(k *sizeof(SUPP));
+  if (!heap) return 0;          /* create a heap for the supports */
+  if (!ist->valid)              /* if the levels are not valid, */
+    makelvls(ist);              /* set the successor pointers */
+  for (h = zmin-1; h < zmax; h++) {
+    for (node = ist->lvls[h]; node; node = node->succ) {
+      for (i = node->size; --i >= 0; ) {
+        s = COUNT(node->cnts[i]);
+        if ((s < ist->smin) || (s > smax))
+          continue;             /* skip item sets not reported */
+        if (n < k) {            /* if the heap is not yet full */
+          for (c = n++; c > 0; c = p) {
+            p = (c-1) >> 1;     /* traverse the parent elements */
+            if (heap[p] <= s) break;
+            heap[c] = heap[p];  /* while the heap condition does */
+          }                     /* not hold, move the parent down */
+          heap[c] = s; continue;/* store the new support */
+        }
+        if (s <= heap[0]) continue;   /* check against the smallest */
+        for (p = 0; (c = p+p+1) < k; p = c) {
+          if ((c+1 < k) && (heap[c+1] < heap[c])) c++;
+          if (s <= heap[c]) break;    /* sift the new support down */
+          heap[p] = heap[c];    /* (move the smaller child up) */
+        }
+        heap[p] = s;            /* store the new support */
+      }                         /* (replace the smallest support) */
+    }
+  }
+  s = (n < k) ? 0 : heap[0];    /* get the k-th largest support */
+  free(heap);                   /* delete the heap */
+  return s;                     /* and return the support */
+}  /* ist_kthsupp() */
+
+/* ist_kthsupp() returns the k-th largest support of the frequent   */
+/* item sets with sizes between zmin and zmax and a support of at   */
+/* most smax that are currently in the tree (that is, of the levels */
+/* that have been counted so far), or 0 if there are fewer than k   */
+/* such item sets (or the heap cannot be allocated). Since the      */
+/* final result contains all these item sets, the k best item sets  */
+/* cannot have a support less than this value, so it can be used to */
+/* raise the minimum support with ist_setsmin() before the next     */
+/* level is added (top-k mode).                                     */
+
+/*--------------------------------------------------------------------*/
+
+static void trim (ISTREE *ist, ITEM height)
+{                               /* --- remove deeper tree levels */
+  ITEM    h, n;                 /* loop variables */
+  ISTNODE *node;                /* to traverse the nodes */
+
+  assert(ist && (height > 0) && (height <= ist->height));
+  if (!ist->valid)              /* if the levels are not valid, */
+    makelvls(ist);              /* set the successor pointers */
+  for (h = 0; h < height; h++) {
+    for (node = ist->lvls[h]; node; node = node->succ) {
+      n = CHILDCNT(node);       /* traverse the remaining levels */
+      if (n <= 0) continue;     /* skip childless nodes */
+      if (h < height-1) {       /* clear the skip flags above */
+        node->chcnt = n; continue; }  /* the new deepest level */
+      node->chcnt = 0;          /* mark the nodes of the deepest */
+    }                           /* level as leaves (new nodes) */
+  }                             /* in order to extend them again */
+  for (h = height; h < ist->height; h++) {
+    ar_free(ist, ist->arena[h]);/* delete the nodes */
+    ist->arena[h] = NULL;       /* of the removed levels */
+    ist->lvls [h] = NULL;       /* (child subtrees of the nodes */
+  }                             /* of the new deepest level) */
+  ist->height = height;         /* set the new tree height */
+}  /* trim() */
+
+/*--------------------------------------------------------------------*/
+
+int ist_update (ISTREE *ist, const TABAG *bag, ITEM zmax)
+{                               /* --- update tree after appending */
+  ITEM h;                       /* size of smallest new set */
+  int  r, k;                    /* result, number of added levels */
+
+  assert(ist && bag             /* check the function arguments */
+  &&    (ist->mode & IST_INCR));
+  h = ist->xlvl;                /* get the smallest new frequent set */
+  ist->xlvl = ITEM_MAX;         /* and clear the border marker */
+  if (h >= ist->height+1)       /* if no set crossed the border, */
+    return 0;                   /* the tree need not be changed */
+  if (h < ist->height)          /* remove the levels that have */
+    trim(ist, h);               /* to be rebuilt from scratch */
+  for (k = 0; ist->height < zmax; k++) {
+    r = ist_addlvl(ist);        /* add a level to the tree */
+    if (r < 0) return -1;       /* and check for an error */
+    if (r > 0) break;           /* if no level was added, abort */
+    if (ist_countb(ist, bag) != 0) return -1;
+    ist_commit(ist);            /* count the new level on the */
+  }                             /* (complete) transaction bag */
+  return k;                     /* return the number of new levels */
+}  /* ist_update() */
+
+/* In incremental mode the tree keeps all counters that were created */
+/* (including those of infrequent sets, i.e. the negative border).   */
+/* Appended transactions are counted into all levels with the normal */
+/* counting functions ist_count() and ist_countt(). Afterwards tree   */
+/* levels need to be rebuilt only from the smallest item set on that */
+/* became frequent (or satisfies the rule body support) and whose    */
+/* extensions were therefore not created or counted so far. These    */
+/* levels are counted on the complete transaction bag, which must    */
+/* hold the old as well as the appended transactions.                */
+
+/*--------------------------------------------------------------------*/
+
 void ist_root (ISTREE *ist)
 {                               /* --- go to the root node */
   assert(ist);                  /* check the function argument */
@@ -1332,7 +2147,7 @@ int ist_addchn (ISTREE *ist)
   assert(ist && ist->curr);     /* check the function argument */
   if (CHILDCNT(ist->curr) > 0)  /* if there are children already, */
     return 1;                   /* abort the function */
-  end = children(ist, &ist->curr, end);
+  end = children(ist, &ist->curr, end, ist->depth-1);
   if (!end) return -1;          /* add children to the current node */
   if (ist->depth <= 1)          /* if currently at the root node, */
     ist->lvls[0] = ist->curr;   /* update the root node */
@@ -1683,6 +2498,9 @@ void ist_seteval (ISTREE *ist, int eval, int agg,
   ist->dir    = re_dir(ist->eval);
   ist->thresh = ist->dir*thresh;/* note the evaluation parameters */
   ist->prune  = (prune <= 0) ? ITEM_MAX : (prune > 1) ? prune : 2;
+  re_exit(&ist->rev);           /* reinitialize the rule evaluator */
+  re_init(&ist->rev, ist->eval, /* abort p-value sums early */
+          ((ist->dir < 0) && (ist->agg < IST_AVG)) ? thresh : INFINITY);
 }  /* ist_seteval() */
 
 /*--------------------------------------------------------------------*/
@@ -1868,7 +2686,8 @@ ITEM ist_rule (ISTREE *ist, ITEM *rule,
       val = 0; break; }         /* abort the loop (select the rule) */
     val = (!ist->invbxs         /* compute add. evaluation measure */
        || ((double)supp *(double)base > (double)head *(double)body))
-        ? refn(supp, body, head, base) : (ist->dir < 0) ? 1 : 0;
+        ? re_eval(&ist->rev, supp, body, head, base)
+        : (ist->dir < 0) ? 1 : 0;
     if (ist->dir *val >= ist->thresh)
       break;                    /* if the evaluation is high enough, */
   }  /* while (1) */            /* abort the loop (select the rule) */
@@ -1978,7 +2797,7 @@ static int isets (ISTREE *ist, ISREPORT *rep, ISTNODE *node, SUPP supp)
 
 static int r4set (ISTREE *ist, ISREPORT *rep, ISTNODE *node, ITEM index)
 {                               /* --- report rules for an item set */
-  ITEM       i;                 /* loop variable */
+  ITEM       i, k;              /* loop variable, number of rules */
   ITEM       item;              /* head item of the current rule */
   int        app;               /* appearance flag of head item */
   ISTNODE    *parent;           /* parent of the item set node */
@@ -1986,14 +2805,10 @@ static int r4set (ISTREE *ist, ISREPORT *rep, ISTNODE *node, ITEM index)
   SUPP       base;              /* base support (number of trans.) */
   SUPP       supp;              /* support of set  (body & head) */
   SUPP       body;              /* support of body (antecedent) */
-  SUPP       head;              /* support of head (consequent) */
   double     val;               /* value of evaluation measure */
-  RULEVALFN  *refn;             /* rule evaluation function */
 
   assert(ist                    /* check the function arguments */
   &&     rep && node && (index >= 0));
-  refn = ((ist->eval > RE_NONE) && (ist->eval < RE_FNCNT))
-       ? re_function(ist->eval) : (RULEVALFN*)0;
   base = COUNT(ist->wgt);       /* get base and item set support */
   supp = COUNT(node->cnts[index]);
   item = (node->offset >= 0) ? node->offset +index
@@ -2011,23 +2826,14 @@ static int r4set (ISTREE *ist, ISREPORT *rep, ISTNODE *node, ITEM index)
     i    = ia_bsearch(ITEMOF(node), map, (size_t)n);
     body = COUNT(parent->cnts[i]);
   }                             /* find array index and get support */
-  do {                          /* check and report the first rule */
-    if (!(app & APP_HEAD))      /* check whether the current item */
-      break;                    /* can occur as a rule head */
-    if ((body < ist->body)      /* check the body support */
-    ||  ((double)supp < (double)body *ist->conf))
-      break;                    /* check the rule confidence */
-    head = COUNT(ist->lvls[0]->cnts[item]);
-    if (!refn) val = 0;         /* if no add. eval. measure given, */
-    else {                      /* clear the evaluation, otherwise */
-      val = (!ist->invbxs       /* compute add. evaluation measure */
-         || ((double)supp *(double)base > (double)head *(double)body))
-          ? refn(supp, body, head, base) : (ist->dir < 0) ? 1 : 0;
-      if (ist->dir *val < ist->thresh)
-        break;                  /* check whether the evaluation */
-    }                           /* reaches or exceed the threshold */
-    if (isr_reprule(rep, item, body, head, val) != 0) return -1;
-  } while (0);                  /* report the current rule */
+  k = 0;                        /* collect the candidate rules */
+  if ((app & APP_HEAD)          /* check whether the current item */
+  &&  (body >= ist->body)       /* can occur as a rule head and */
+  &&  ((double)supp >= (double)body *ist->conf)) {
+    ist->ritem[k]   = item;     /* check body support and confidence */
+    ist->rhead[k]   = COUNT(ist->lvls[0]->cnts[item]);
+    ist->rbody[k++] = body;     /* note the first rule */
+  }
   ist->path = ist->buf +ist->height;
   *--ist->path = item; n = 1;   /* store head item on the path */
   for ( ; parent; node = parent, parent = node->parent) {
@@ -2039,23 +2845,35 @@ static int r4set (ISTREE *ist, ISREPORT *rep, ISTNODE *node, ITEM index)
     if ((body < ist->body)      /* check the body support */
     ||  ((double)supp < (double)body *ist->conf))
       continue;                 /* check the rule confidence */
-    head = COUNT(ist->lvls[0]->cnts[item]);
-    if (!refn) val = 0;         /* if no add. eval. measure given, */
+    ist->ritem[k]   = item;     /* note the head item and */
+    ist->rhead[k]   = COUNT(ist->lvls[0]->cnts[item]);
+    ist->rbody[k++] = body;     /* the supports of the rule */
+  }
+  if ((ist->eval > RE_NONE) && (k > 0)) {
+    for (i = 0; i < k; i++) ist->rsupp[i] = supp;
+    re_evalv(&ist->rev, ist->rsupp, ist->rbody, ist->rhead, base,
+             ist->rvals, (size_t)k);
+  }                             /* evaluate all rules at once */
+  for (i = 0; i < k; i++) {     /* traverse the candidate rules */
+    if (ist->eval <= RE_NONE) val = 0;  /* if no add. measure given, */
     else {                      /* clear the evaluation, otherwise */
-      val = (!ist->invbxs       /* compute add. evaluation measure */
-         || ((double)supp *(double)base > (double)head *(double)body))
-          ? refn(supp, body, head, base) : (ist->dir < 0) ? 1 : 0;
+      val = (!ist->invbxs       /* get the add. evaluation measure */
+         || ((double)supp *(double)base
+           > (double)ist->rhead[i] *(double)ist->rbody[i]))
+          ? ist->rvals[i] : (ist->dir < 0) ? 1 : 0;
       if (ist->dir *val < ist->thresh)
         continue;               /* check whether the evaluation */
     }                           /* reaches or exceed the threshold */
-    if (isr_reprule(rep, item, body, head, val) != 0) return -1;
+    if (isr_reprule(rep, ist->ritem[i], ist->rbody[i], ist->rhead[i],
+                    val) != 0) return -1;
   }                             /* report the current rule */
   return 0;                     /* return 'ok' */
 }  /* r4set() */
 
 /*--------------------------------------------------------------------*/
 
-static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node)
+static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node,
+                  ITEM beg, ITEM end)
 {                               /* --- recursive rule reporting */
   ITEM    i, k, c;              /* loop variables, buffers */
   ITEM    off;                  /* item offset */
@@ -2069,7 +2887,7 @@ static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node)
     ALIGN(chn);                 /* get the child node array */
     c   = CHILDCNT(node);       /* and the number of children */
     off = (c > 0) ? ITEMOF(chn[0]) : 0;
-    for (i = 0; i < node->size; i++) {
+    for (i = beg; i < end; i++) {
       supp = COUNT(node->cnts[i]);
       if (supp < ist->smin)     /* traverse the node's items and */
         continue;               /* check against minimum support */
@@ -2077,8 +2895,8 @@ static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node)
       isr_add(rep, k, supp);    /* add the item to the reporter */
       k -= off;                 /* compute the child node index */
       if ((k >= 0)              /* if the corresp. child node exists, */
-      &&  (k <  c) && chn[k])   /* recursively report the subtree, */
-        rules(ist, rep, chn[k]);/* then report rules for item set */
+      &&  (k <  c) && chn[k]    /* recursively report the subtree, */
+      &&  (rules(ist, rep, chn[k], 0, chn[k]->size) < 0)) return -1;
       if (r4set(ist, rep, node, i) < 0) return -1;
       isr_remove(rep, 1);       /* remove the last item */
     } }                         /* from the current item set */
@@ -2087,7 +2905,7 @@ static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node)
     chn = (ISTNODE**)(map +k);  /* get the item id map */
     c   = CHILDCNT(node);       /* and the child node array  */
     c   = (c > 0) ? ITEMOF(chn[c-1]) : -1;
-    for (i = 0; i < node->size; i++) {
+    for (i = beg; i < end; i++) {
       supp = COUNT(node->cnts[i]);
       if (supp < ist->smin)     /* traverse the node's items and */
         continue;               /* check against minimum support */
@@ -2096,9 +2914,9 @@ static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node)
       supp = node->cnts[i];     /* get the item support (with flag) */
       if (k <= c) {             /* if there may be a child node, */
         while (ITEMOF(*chn) < k) chn++;  /* skip preceding items */
-        if (k == ITEMOF(*chn))  /* if the corresp. child node exists, */
-          rules(ist, rep, *chn);/* recursively report the subtree, */
-      }                         /* then report rules for item set */
+        if ((k == ITEMOF(*chn)) /* if the corresp. child node exists, */
+        &&  (rules(ist, rep, *chn, 0, (*chn)->size) < 0)) return -1;
+      }                         /* recursively report the subtree, */
       if (r4set(ist, rep, node, i) < 0) return -1;
       isr_remove(rep, 1);       /* remove the last item */
     }                           /* from the current item set */
@@ -2108,6 +2926,143 @@ static int rules (ISTREE *ist, ISREPORT *rep, ISTNODE *node)
 
 /*--------------------------------------------------------------------*/
 
+static double rcost (ISTNODE *node)
+{                               /* --- estimate rule reporting costs */
+  ITEM    i, c;                 /* loop variable, number of children */
+  double  sum;                  /* sum of the subtree costs */
+  ISTNODE **chn;                /* child node array */
+
+  assert(node);                 /* check the function argument */
+  sum = (double)node->size;     /* count the item sets of the node */
+  c   = CHILDCNT(node);         /* get the number of children */
+  if (c <= 0) return sum;       /* and the child node array */
+  if (node->offset >= 0) {      /* if a pure array is used */
+    chn = (ISTNODE**)(node->cnts +node->size); ALIGN(chn); }
+  else                          /* if an identifier map is used */
+    chn = (ISTNODE**)((ITEM*)(node->cnts +node->size) +node->size);
+  for (i = 0; i < c; i++)       /* traverse the child nodes */
+    if (chn[i]) sum += rcost(chn[i]);
+  return sum;                   /* return the sum of the costs */
+}  /* rcost() */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(rulework, p)
+{                               /* --- worker for rule reporting */
+  RULEWORK *w = p;              /* type the argument pointer */
+
+  assert(p);                    /* check the function argument */
+  w->err = rules(&w->ist, w->rep, w->ist.lvls[0], w->beg, w->end);
+  return THREAD_OK;             /* report rules of assigned items */
+}  /* rulework() */
+
+/*--------------------------------------------------------------------*/
+
+static int parrules (ISTREE *ist, ISREPORT *rep)
+{                               /* --- report rules in parallel */
+  int      r = 0;               /* error status */
+  int      c, n, x;             /* number of threads, loop variables */
+  ITEM     i, k, off;           /* loop variable, child index/offset */
+  double   sum, acc;            /* sum and accumulated costs */
+  double   *est;                /* estimated costs of the subtrees */
+  ISTNODE  *root;               /* root node of the tree */
+  ISTNODE  **chn;               /* child node array of the root */
+  RULEWORK *w;                  /* data for the worker threads */
+  THREAD   *threads;            /* thread handles */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  DWORD    thid;                /* dummy for storing the thread id */
+  #endif                        /* (not really needed here) */
+
+  assert(ist && rep);           /* check the function arguments */
+  root = ist->lvls[0];          /* get the root node */
+  c    = ist->cpus;             /* and the number of threads */
+  if (c > root->size) c = (int)root->size;
+  if ((c <= 1) || (root->offset < 0))
+    return rules(ist, rep, root, 0, root->size);
+  est = (double*)malloc((size_t)root->size *sizeof(double));
+  if (!est) return -1;          /* create a cost array */
+  chn = (ISTNODE**)(root->cnts +root->size); ALIGN(chn);
+  k   = CHILDCNT(root);         /* get the child node array */
+  off = (k > 0) ? ITEMOF(chn[0]) : 0;
+  for (sum = 0, i = 0; i < root->size; i++) {
+    est[i] = 1;                 /* traverse the root items */
+    if ((i-off >= 0) && (i-off < k) && chn[i-off])
+      est[i] += rcost(chn[i-off]);
+    sum += est[i];              /* estimate the costs by the sizes */
+  }                             /* of the subtrees of the items */
+  threads = (THREAD*)calloc((size_t)c, sizeof(THREAD));
+  if (!threads) { free(est); return -1; }
+  w = (RULEWORK*)calloc((size_t)c, sizeof(RULEWORK));
+  if (!w) { free(threads); free(est); return -1; }
+  for (acc = 0, i = 0, n = 0; n < c; n++) {
+    w[n].beg = i;               /* traverse the workers */
+    while ((i < root->size)     /* and collect root items */
+    &&     ((n >= c-1) || (acc < sum *(double)(n+1) /(double)c)))
+      acc += est[i++];          /* until the cost share is reached */
+    w[n].end = i;               /* (contiguous ranges of items, */
+  }                             /* to keep the sequential order) */
+  for (n = 0; n < c; n++) {     /* traverse the threads */
+    w[n].ist       = *ist;      /* copy the item set tree */
+    w[n].ist.cpus  = 1;         /* and create private buffers, */
+    w[n].ist.pcnts = NULL;      /* rule evaluator and reporter */
+    w[n].ist.map   = NULL;
+    w[n].ist.buf   = (ITEM*)malloc((size_t)(ist->height+1)
+                                   *sizeof(ITEM));
+    w[n].ist.rvals = (double*)malloc((size_t)(ist->height+1)
+                   *(sizeof(double) +3*sizeof(SUPP) +sizeof(ITEM)));
+    re_init(&w[n].ist.rev, ist->rev.id, ist->rev.lim);
+    w[n].err       = -1;        /* default: thread was not started */
+    if (!w[n].ist.buf || !w[n].ist.rvals) break;
+    w[n].ist.rsupp = (SUPP*)(w[n].ist.rvals +ist->height+1);
+    w[n].ist.rbody = w[n].ist.rsupp +ist->height+1;
+    w[n].ist.rhead = w[n].ist.rbody +ist->height+1;
+    w[n].ist.ritem = (ITEM*)(w[n].ist.rhead +ist->height+1);
+    w[n].rep = isr_clone(rep);  /* organize the evaluation buffers */
+    if (!w[n].rep) break;       /* and create a private reporter */
+    w[n].err = 0;               /* clear the error indicator */
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    threads[n] = CreateThread(NULL, 0, rulework, w+n, 0, &thid);
+    if (!threads[n]) { w[n].err = -1; break; }
+    #else                       /* if Linux/Unix system */
+    if (pthread_create(threads+n, NULL, rulework, w+n) != 0) {
+      w[n].err = -1; break; }   /* create a thread for each worker */
+    #endif                      /* to report the rules in parallel */
+  }
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  WaitForMultipleObjects((DWORD)n, threads, TRUE, INFINITE);
+  for (x = n; --x >= 0; )       /* wait for threads to finish, */
+    CloseHandle(threads[x]);    /* then close all thread handles */
+  #else                         /* if Linux/Unix system */
+  for (x = n; --x >= 0; )       /* wait for threads to finish */
+    pthread_join(threads[x], NULL);
+  #endif                        /* (join threads with this one) */
+  if (n < c) r = -1;            /* check whether all threads started */
+  for (x = 0; x < n; x++)       /* join the error indicators */
+    r |= w[x].err;              /* of the finished threads */
+  for (x = 0; x < n; x++)       /* merge the results of the workers */
+    if ((r >= 0) && (isr_merge(rep, w[x].rep) < 0)) r = -1;
+  for (x = c; --x >= 0; ) {     /* traverse the worker data */
+    if (w[x].rep)       isr_delete(w[x].rep, 0);
+    if (w[x].ist.buf)   free(w[x].ist.buf);
+    if (w[x].ist.rvals) free(w[x].ist.rvals);
+    re_exit(&w[x].ist.rev);     /* (and the rule evaluators) */
+  }                             /* delete the private objects */
+  free(w); free(threads);       /* delete worker data, thread handles */
+  free(est);                    /* and the subtree cost estimates */
+  return r;                     /* return the error status */
+}  /* parrules() */
+
+/* The items of the root node are split into contiguous ranges of   */
+/* roughly equal estimated costs (number of item sets in the        */
+/* subtrees), each of which is processed by one worker thread. The  */
+/* item set tree is only read while rules are reported, so the      */
+/* workers share it, but need private path and evaluation buffers,  */
+/* rule evaluators and item set reporters. Since the reporters are  */
+/* merged in the order of the item ranges, the output is identical  */
+/* to the output of a sequential run.                               */
+
+/*--------------------------------------------------------------------*/
+
 int ist_report (ISTREE *ist, ISREPORT *rep, int target)
 {                               /* --- extended item set reporting */
   int    r = 0;                 /* result of function call */
@@ -2118,7 +3073,9 @@ int ist_report (ISTREE *ist, ISREPORT *rep, int target)
   assert(ist && rep);           /* check the function arguments */
   if (target & ISR_RULES) {     /* if to report association rules */
     if (!ist->order)            /* if no size order is requested */
-      r = rules(ist, rep, ist->lvls[0]);
+      r = ((ist->cpus > 1) && !rep->rulefn)
+        ? parrules(ist, rep)    /* report rules in parallel */
+        : rules(ist, rep, ist->lvls[0], 0, ist->lvls[0]->size);
     else {                      /* if a size order is requested */
       while (1) {               /* extract assoc. rules from tree */
         k = ist_rule(ist, ist->map, &supp, &body, &head, &val);
@@ -2161,6 +3118,38 @@ double ist_evalx (ISREPORT *rep, void *data)
   return evaluate(ist, ist->node, ist->index);
 }  /* ist_evalx() */
 
+/*--------------------------------------------------------------------*/
+
+void ist_getstats (ISTREE *ist, ITEM lvl, ISTSTATS *sts)
+{                               /* --- get tree statistics */
+  ITEM    i, k;                 /* loop variable, end of levels */
+  ISTNODE *node;                /* to traverse the tree nodes */
+  ISTBLK  *blk;                 /* to traverse the arena blocks */
+
+  assert(ist && sts);           /* check the function arguments */
+  if (!ist->valid)              /* if the levels are not valid, */
+    makelvls(ist);              /* set the successor pointers */
+  sts->height = ist->height;    /* note the tree height */
+  sts->nodes  = sts->cnts = sts->mem = 0;
+  if      (lvl <  0)           { i = 0;   k = ist->height; }
+  else if (lvl < ist->height)  { i = lvl; k = lvl+1; }
+  else return;                  /* get the range of levels */
+  for ( ; i < k; i++) {         /* traverse the requested levels */
+    for (node = ist->lvls[i]; node; node = node->succ) {
+      sts->nodes += 1; sts->cnts += (size_t)node->size; }
+    for (blk = ist->arena[i]; blk; blk = blk->succ)
+      sts->mem += blk->size;    /* count nodes and counters and */
+  }                             /* sum the sizes of arena blocks */
+}  /* ist_getstats() */
+
+/* The statistics are computed on demand by traversing the levels  */
+/* of the tree, so that collecting them causes no costs during the */
+/* search and no special (benchmark) version is needed. A negative */
+/* level yields the statistics of the whole tree. The function may */
+/* be called from an item set reporting callback (see the function */
+/* isr_setrepo()) or between the counting passes of apriori, but   */
+/* not while ist_countb() counts with several threads.             */
+
 /*--------------------------------------------------------------------*/
 #ifdef BENCH
 
@@ -2176,6 +3165,7 @@ void ist_stats (ISTREE *ist)
   printf("number of child pointers   : %"SIZE_FMT"\n", ist->cpcnt);
   printf("necessary child pointers   : %"SIZE_FMT"\n", ist->cpnec);
   printf("pruned    child pointers   : %"SIZE_FMT"\n", ist->cpprn);
+  printf("bytes in node arenas       : %"SIZE_FMT"\n", ist->arsz);
 }  /* ist_stats() */
 
 #endif
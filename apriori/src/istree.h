@@ -43,6 +43,15 @@
             2014.08.01 minimum improvement of evaluation measure removed
             2014.08.14 function ist_addchn() and related functions added
             2014.08.21 parameter 'body' added to function ist_create()
+            2026.10.14 parallel counting with private counters added
+            2026.10.14 incremental mode and ist_update() added
+            2026.10.14 tree nodes allocated from per level arenas
+            2026.10.14 function ist_countb() returns an error indicator
+            2026.10.14 rule evaluator (tables and memo) added to tree
+            2026.10.14 buffers for batch evaluation of rules added
+            2026.10.14 function ist_getstats() added (tree statistics)
+            2026.10.14 function ist_countx() returns an error indicator
+            2026.10.14 function ist_kthsupp() added (top-k pruning)
 ----------------------------------------------------------------------*/
 #ifndef __ISTREE__
 #define __ISTREE__
@@ -58,6 +67,7 @@
 #define IST_PERFECT 0x0100      /* prune with perfect extensions */
 #define IST_PARTIAL 0x0200      /* do only partial subset checks */
 #define IST_REVERSE 0x0400      /* reverse item order */
+#define IST_INCR    0x0800      /* incremental mode (keep border) */
 
 /* --- additional evaluation measures --- */
 /* evaluation measure definitions in ruleval.h */
@@ -90,12 +100,19 @@ typedef struct istnode {        /* --- item set tree node --- */
   SUPP           cnts[1];       /* counter array (weights) */
 } ISTNODE;                      /* (item set tree node) */
 
+typedef struct istblk {         /* --- arena block for tree nodes --- */
+  struct istblk *succ;          /* successor block (older block) */
+  size_t        size;           /* size of the block (in bytes) */
+  size_t        used;           /* number of used bytes */
+} ISTBLK;                       /* (arena block) */
+
 typedef struct {                /* --- item set tree --- */
   ITEMBASE *base;               /* underlying item base */
   int      mode;                /* search mode (e.g. support def.) */
   SUPP     wgt;                 /* total weight of transactions */
   ITEM     height;              /* tree height (number of levels) */
   ISTNODE  **lvls;              /* first node of each level */
+  ISTBLK   **arena;             /* node memory blocks of each level */
   int      valid;               /* whether levels are valid */
   SUPP     smin;                /* minimum support of an item set */
   SUPP     body;                /* minimum support of a rule body */
@@ -105,6 +122,12 @@ typedef struct {                /* --- item set tree --- */
   int      invbxs;              /* invalidate eval. below expectation */
   double   dir;                 /* direction of evaluation measure */
   double   thresh;              /* evaluation measure threshold */
+  REVAL    rev;                 /* rule evaluator (tables and memo) */
+  double   *rvals;              /* buffer for rule evaluations */
+  SUPP     *rsupp;              /* buffer for rule supports */
+  SUPP     *rbody;              /* buffer for rule body supports */
+  SUPP     *rhead;              /* buffer for rule head supports */
+  ITEM     *ritem;              /* buffer for rule head items */
   ISTNODE  *curr;               /* current node for traversal */
   ITEM     depth;               /* depth of current node */
   ITEM     size;                /* current size of an item set */
@@ -120,6 +143,10 @@ typedef struct {                /* --- item set tree --- */
   ITEM     *path;               /* current path / (partial) item set */
   int      hdonly;              /* head only item in current set */
   ITEM     *map;                /* to create identifier maps */
+  int      cpus;                /* number of threads for counting */
+  SUPP     *pcnts;              /* private counters of the threads */
+  size_t   pcsz;                /* number of counters per thread */
+  ITEM     xlvl;                /* smallest set that crossed border */
 #ifdef BENCH                    /* if benchmark version */
   size_t   ndcnt;               /* number of item set tree nodes */
   size_t   ndprn;               /* number of pruned tree nodes */
@@ -130,9 +157,17 @@ typedef struct {                /* --- item set tree --- */
   size_t   cpcnt;               /* number of created child pointers */
   size_t   cpnec;               /* number of necessary child pointers */
   size_t   cpprn;               /* number of pruned child pointers */
+  size_t   arsz;                /* number of bytes in node arenas */
 #endif
 } ISTREE;                       /* (item set tree) */
 
+typedef struct {                /* --- item set tree statistics --- */
+  ITEM     height;              /* tree height (number of levels) */
+  size_t   nodes;               /* number of tree nodes */
+  size_t   cnts;                /* number of support counters */
+  size_t   mem;                 /* bytes in node memory arenas */
+} ISTSTATS;                     /* (item set tree statistics) */
+
 /*----------------------------------------------------------------------
   Functions
 ----------------------------------------------------------------------*/
@@ -141,18 +176,25 @@ extern ISTREE*   ist_create  (ITEMBASE *base, int mode,
 extern void      ist_delete  (ISTREE *ist);
 extern ITEMBASE* ist_base    (ISTREE *ist);
 extern ITEM      ist_itemcnt (ISTREE *ist);
+extern void      ist_setcpus (ISTREE *ist, int cpus);
+extern int       ist_getcpus (ISTREE *ist);
 
 extern void      ist_count   (ISTREE *ist,
                               const ITEM *items, ITEM n, SUPP wgt);
 extern void      ist_countt  (ISTREE *ist, const TRACT  *tract);
-extern void      ist_countb  (ISTREE *ist, const TABAG  *bag);
+extern int       ist_countb  (ISTREE *ist, const TABAG  *bag);
 #ifdef TATREEFN
-extern void      ist_countx  (ISTREE *ist, const TATREE *tree);
+extern int       ist_countx  (ISTREE *ist, const TATREE *tree);
 #endif
 extern void      ist_commit  (ISTREE *ist);
 extern ITEM      ist_check   (ISTREE *ist, int *marks);
 extern void      ist_prune   (ISTREE *ist);
 extern int       ist_addlvl  (ISTREE *ist);
+extern void      ist_setsmin (ISTREE *ist, SUPP smin, SUPP body);
+extern SUPP      ist_kthsupp (ISTREE *ist, ITEM zmin, ITEM zmax,
+                              SUPP smax, size_t k);
+extern int       ist_update  (ISTREE *ist, const TABAG *bag,
+                              ITEM zmax);
 
 extern ITEM      ist_zmin    (ISTREE *ist);
 extern ITEM      ist_zmax    (ISTREE *ist);
@@ -189,6 +231,7 @@ extern int       ist_report  (ISTREE *ist, ISREPORT *rep, int target);
 
 extern double    ist_eval    (ISTREE *ist);
 extern double    ist_evalx   (ISREPORT *rep, void *data);
+extern void      ist_getstats(ISTREE *ist, ITEM lvl, ISTSTATS *sts);
 
 #ifdef BENCH
 extern void      ist_stats   (ISTREE *ist);
@@ -205,10 +248,12 @@ extern void      ist_show    (ISTREE *ist);
 #define ist_zmin(t)       ((t)->zmin)
 #define ist_zmax(t)       ((t)->zmax)
 #define ist_height(t)     ((t)->height)
+#define ist_smin(t)       ((t)->smin)
 #define ist_getwgt(t)     ((t)->wgt & ~SUPP_MIN)
 #define ist_setwgt(t,n)   ((t)->wgt = (n))
 #define ist_incwgt(t,n)   ((t)->wgt = ((t)->wgt & ~SUPP_MIN) +(n))
 #define ist_depth(t)      ((t)->depth)
 #define ist_xable(t,n)    ((t)->depth+(n) <= (t)->zmax)
+#define ist_getcpus(t)    ((t)->cpus)
 
 #endif
@@ -0,0 +1,49 @@
+#-----------------------------------------------------------------------
+# File    : bench.mak
+# Contents: build synthetic data generator (on Windows systems)
+# History : 2026.10.14 file created
+#-----------------------------------------------------------------------
+THISDIR  = ..\..\bench\src
+UTILDIR  = ..\..\util\src
+
+CC       = cl.exe
+DEFS     = /D WIN32 /D NDEBUG /D _CONSOLE /D _CRT_SECURE_NO_WARNINGS
+CFLAGS   = /nologo /W3 /O2 /GS- $(DEFS) /c $(ADDFLAGS)
+INCS     = /I $(UTILDIR)
+
+LD       = link.exe
+LDFLAGS  = /nologo /subsystem:console /incremental:no
+LIBS     = 
+
+HDRS     = $(UTILDIR)\error.h
+OBJS     = tagen.obj
+PRGS     = tagen.exe
+
+#-----------------------------------------------------------------------
+# Build Program
+#-----------------------------------------------------------------------
+all:          $(PRGS)
+
+tagen.exe:    $(OBJS) bench.mak
+	$(LD) $(LDFLAGS) $(OBJS) $(LIBS) /out:$@
+
+#-----------------------------------------------------------------------
+# Main Programs
+#-----------------------------------------------------------------------
+tagen.obj:    $(HDRS) tagen.c bench.mak
+	$(CC) $(CFLAGS) $(INCS) tagen.c /Fo$@
+
+#-----------------------------------------------------------------------
+# Install
+#-----------------------------------------------------------------------
+install:
+	-@copy $(PRGS) ..\..\..\bin
+
+#-----------------------------------------------------------------------
+# Clean up
+#-----------------------------------------------------------------------
+localclean:
+	-@erase /Q *~ *.obj *.idb *.pch $(PRGS)
+
+clean:
+	$(MAKE) /f bench.mak localclean
@@ -0,0 +1,348 @@
+/*----------------------------------------------------------------------
+  File    : tagen.c
+  Contents: generate synthetic transaction databases (for benchmarks)
+  History : 2026.10.14 file created
+------------------------------------------------------------------------
+  The generator follows the ideas of the IBM Quest market basket data
+  generator (but is much simpler): item frequencies follow a Zipf
+  distribution, transaction lengths a Poisson distribution, and an
+  optional set of (potentially frequent) patterns is embedded into
+  the transactions, each pattern with a random corruption.
+    R. Agrawal and R. Srikant.
+    Fast Algorithms for Mining Association Rules.
+    Proc. 20th Int. Conf. on Very Large Databases
+    (VLDB 1994, Santiago de Chile), 487-499.
+    Morgan Kaufmann, San Mateo, CA, USA 1994
+----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <assert.h>
+#include "error.h"
+#ifdef STORAGE
+#include "storage.h"
+#endif
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define PRGNAME     "tagen"
+#define DESCRIPTION "generate synthetic transaction databases"
+#define VERSION     "version 1.0 (2026.10.14)"
+
+/* --- error codes --- */
+#define E_NONE        0         /* no error */
+#define E_NOMEM     (-1)        /* not enough memory */
+#define E_FOPEN     (-2)        /* cannot open file */
+#define E_FREAD     (-3)        /* read error on file */
+#define E_FWRITE    (-4)        /* write error on file */
+#define E_OPTION    (-5)        /* unknown option */
+#define E_OPTARG    (-6)        /* missing option argument */
+#define E_ARGCNT    (-7)        /* too few/many arguments */
+#define E_PARAM     (-8)        /* invalid parameter value */
+
+#ifndef QUIET                   /* if not quiet version, */
+#define MSG         fprintf     /* print messages */
+#define CLOCK(t)    ((t) = clock())
+#else                           /* if quiet version, */
+#define MSG(...)    ((void)0)   /* suppress messages */
+#define CLOCK(t)    ((void)0)
+#endif
+
+#define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef unsigned long long RSTATE;  /* state of random generator */
+
+typedef struct {                /* --- embedded pattern --- */
+  int      cnt;                 /* number of items */
+  double   crpt;                /* corruption level (drop prob.) */
+  int      *items;              /* items of the pattern */
+} PATTERN;                      /* (embedded pattern) */
+
+/*----------------------------------------------------------------------
+  Constants
+----------------------------------------------------------------------*/
+#ifndef QUIET
+/* --- error messages --- */
+static const char *errmsgs[] = {
+  /* E_NONE      0 */  "no error",
+  /* E_NOMEM    -1 */  "not enough memory",
+  /* E_FOPEN    -2 */  "cannot open file %s",
+  /* E_FREAD    -3 */  "read error on file %s",
+  /* E_FWRITE   -4 */  "write error on file %s",
+  /* E_OPTION   -5 */  "unknown option -%c",
+  /* E_OPTARG   -6 */  "missing option argument",
+  /* E_ARGCNT   -7 */  "wrong number of arguments",
+  /* E_PARAM    -8 */  "invalid parameter value -%c",
+  /*            -9 */  "unknown error"
+};
+#endif
+
+/*----------------------------------------------------------------------
+  Global Variables
+----------------------------------------------------------------------*/
+#ifndef QUIET
+static const char *prgname;     /* program name for error messages */
+#endif
+static FILE    *out   = NULL;   /* output file */
+static double  *cdf   = NULL;   /* cumulative item distribution */
+static PATTERN *pats  = NULL;   /* embedded patterns */
+static double  *pcdf  = NULL;   /* cumulative pattern distribution */
+static int     *items = NULL;   /* item buffer for a transaction */
+static int     patcnt = 0;      /* number of embedded patterns */
+
+/*----------------------------------------------------------------------
+  Random Number Functions
+----------------------------------------------------------------------*/
+
+static double rnd (RSTATE *s)
+{                               /* --- uniform random number in [0,1) */
+  RSTATE z;                     /* buffer for computations */
+
+  z  = (*s += 0x9e3779b97f4a7c15ULL);
+  z  = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z  = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z ^= (z >> 31);               /* splitmix64 generator */
+  return (double)(z >> 11) *(1.0/9007199254740992.0);
+}  /* rnd() */                  /* use the upper 53 bits */
+
+/*--------------------------------------------------------------------*/
+
+static int poisson (RSTATE *s, double mean)
+{                               /* --- Poisson distributed number */
+  int    k;                     /* number of events */
+  double t;                     /* sum of inter-arrival times */
+
+  for (k = 0, t = 0; 1; k++) {  /* sum exponential inter-arrival */
+    t -= log(1.0 -rnd(s));      /* times until the mean is exceeded */
+    if (t > mean) return k;     /* (this avoids the underflow of */
+  }                             /* exp(-mean) for large means) */
+}  /* poisson() */
+
+/*--------------------------------------------------------------------*/
+
+static int sample (RSTATE *s, const double *cdf, int n)
+{                               /* --- sample from a distribution */
+  int    l, r, m;               /* binary search indices */
+  double u;                     /* uniform random number */
+
+  u = rnd(s) *cdf[n-1];         /* draw a random number and */
+  for (l = 0, r = n-1; l < r; ) {   /* find its position in the */
+    m = (l+r) >> 1;             /* cumulative distribution */
+    if (cdf[m] > u) r = m; else l = m+1;
+  }
+  return l;                     /* return the sampled index */
+}  /* sample() */
+
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+
+static void cleanup (void)
+{                               /* --- clean up memory */
+  int i;                        /* loop variable */
+
+  if (pats) {                   /* if there are embedded patterns */
+    for (i = 0; i < patcnt; i++) if (pats[i].items) free(pats[i].items);
+    free(pats); pats = NULL;    /* delete the item arrays */
+  }                             /* and the pattern array */
+  if (pcdf)  { free(pcdf);  pcdf  = NULL; }
+  if (cdf)   { free(cdf);   cdf   = NULL; }
+  if (items) { free(items); items = NULL; }
+  if (out && (out != stdout)) { fclose(out); out = NULL; }
+}  /* cleanup() */
+
+/*--------------------------------------------------------------------*/
+
+#undef  CLEANUP                 /* clean up memory and close files */
+#define CLEANUP cleanup();
+
+GENERROR(error, exit)           /* generic error reporting function */
+
+/*--------------------------------------------------------------------*/
+
+int main (int argc, char *argv[])
+{                               /* --- main function */
+  int        i, k = 0;          /* loop variables, counters */
+  int        j, n, m;           /* item indices, transaction length */
+  char       *s;                /* to traverse the options */
+  const char **optarg = NULL;   /* option argument */
+  const char *fn_out  = NULL;   /* name of the output file */
+  long       tacnt    = 10000;  /* number of transactions */
+  int        itcnt    = 1000;   /* number of items */
+  double     len      = 10;     /* average transaction length */
+  double     dens     = 0;      /* density (fraction of items) */
+  double     zipf     = 1.0;    /* exponent of Zipf distribution */
+  double     plen     = 4;      /* average pattern length */
+  double     pfrac    = 0.5;    /* fraction of pattern items */
+  double     crpt     = 0.25;   /* mean corruption level of patterns */
+  long       seed     = 1;      /* seed for random number generator */
+  long       t;                 /* loop variable for transactions */
+  int        *stamp;            /* stamps for duplicate elimination */
+  PATTERN    *p;                /* to traverse the patterns */
+  RSTATE     rs;                /* state of random number generator */
+  #ifndef QUIET                 /* if not quiet version */
+  clock_t    c;                 /* timer for measurements */
+
+  prgname = argv[0];            /* get program name for error msgs. */
+
+  /* --- print usage message --- */
+  if (argc > 1) {               /* if arguments are given */
+    fprintf(stderr, "%s - %s\n", argv[0], DESCRIPTION);
+    fprintf(stderr, VERSION); } /* print a startup message */
+  else {                        /* if no argument is given */
+    printf("usage: %s [options] [outfile]\n", argv[0]);
+    printf("%s\n", DESCRIPTION);
+    printf("%s\n", VERSION);
+    printf("-t#      number of transactions                   "
+                    "(default: %ld)\n", tacnt);
+    printf("-i#      number of items                          "
+                    "(default: %d)\n", itcnt);
+    printf("-l#      average transaction length               "
+                    "(default: %g)\n", len);
+    printf("-d#      density (fraction of items per trans.)   "
+                    "(default: use -l#)\n");
+    printf("-z#      exponent of Zipf item distribution       "
+                    "(default: %g)\n", zipf);
+    printf("         (0: uniform item distribution)\n");
+    printf("-p#      number of embedded patterns              "
+                    "(default: %d)\n", patcnt);
+    printf("-q#      average length of embedded patterns      "
+                    "(default: %g)\n", plen);
+    printf("-f#      fraction of items taken from patterns    "
+                    "(default: %g)\n", pfrac);
+    printf("-c#      mean corruption level of patterns        "
+                    "(default: %g)\n", crpt);
+    printf("-s#      seed for random number generator         "
+                    "(default: %ld)\n", seed);
+    printf("outfile  file to write transactions to            "
+                    "[optional]\n");
+    return 0;                   /* print a usage message */
+  }                             /* and abort the program */
+  #endif  /* #ifndef QUIET */
+
+  /* --- evaluate arguments --- */
+  for (i = 1; i < argc; i++) {  /* traverse the arguments */
+    s = argv[i];                /* get an option argument */
+    if (optarg) { *optarg = s; optarg = NULL; continue; }
+    if ((*s == '-') && *++s) {  /* -- if argument is an option */
+      while (*s) {              /* traverse the options */
+        switch (*s++) {         /* evaluate the options */
+          case 't': tacnt  =       strtol(s, &s, 0); break;
+          case 'i': itcnt  = (int) strtol(s, &s, 0); break;
+          case 'l': len    =       strtod(s, &s);    break;
+          case 'd': dens   =       strtod(s, &s);    break;
+          case 'z': zipf   =       strtod(s, &s);    break;
+          case 'p': patcnt = (int) strtol(s, &s, 0); break;
+          case 'q': plen   =       strtod(s, &s);    break;
+          case 'f': pfrac  =       strtod(s, &s);    break;
+          case 'c': crpt   =       strtod(s, &s);    break;
+          case 's': seed   =       strtol(s, &s, 0); break;
+          default : error(E_OPTION, *--s);           break;
+        }                       /* set the option variables */
+        if (optarg && *s) { *optarg = s; optarg = NULL; break; }
+      } }                       /* get an option argument */
+    else {                      /* -- if argument is no option */
+      switch (k++) {            /* evaluate non-options */
+        case  0: fn_out = s;      break;
+        default: error(E_ARGCNT); break;
+      }                         /* note filenames */
+    }
+  }
+  if (optarg)      error(E_OPTARG);  /* check option arguments */
+  if (tacnt  <  0) error(E_PARAM, 't');
+  if (itcnt  <= 0) error(E_PARAM, 'i');
+  if (dens   >  0) len = dens *itcnt;
+  if (len    <= 0) error(E_PARAM, (dens > 0) ? 'd' : 'l');
+  if (zipf   <  0) error(E_PARAM, 'z');
+  if (patcnt <  0) error(E_PARAM, 'p');
+  if (plen   <= 0) error(E_PARAM, 'q');
+  if ((pfrac < 0) || (pfrac > 1)) error(E_PARAM, 'f');
+  if ((crpt  < 0) || (crpt  > 1)) error(E_PARAM, 'c');
+  MSG(stderr, "\n");            /* terminate the startup message */
+  rs = (RSTATE)seed;            /* initialize the random generator */
+
+  /* --- create item distribution --- */
+  CLOCK(c);                     /* start timer, print log message */
+  cdf   = (double*)malloc((size_t)itcnt *sizeof(double));
+  items = (int*)   malloc((size_t)itcnt *2 *sizeof(int));
+  if (!cdf || !items) error(E_NOMEM);
+  stamp = items +itcnt;         /* create the item arrays */
+  for (i = 0; i < itcnt; i++) { /* compute the cumulative */
+    cdf[i] = pow((double)(i+1), -zipf);    /* distribution */
+    if (i > 0) cdf[i] += cdf[i-1];
+    stamp[i] = -1;              /* clear the item stamps */
+  }                             /* (Zipf distribution) */
+
+  /* --- create embedded patterns --- */
+  if (patcnt > 0) {             /* if to embed patterns */
+    pats = (PATTERN*)calloc((size_t)patcnt, sizeof(PATTERN));
+    pcdf = (double*) malloc((size_t)patcnt *sizeof(double));
+    if (!pats || !pcdf) error(E_NOMEM);
+    for (i = 0; i < patcnt; i++) {
+      p = pats +i;              /* traverse the patterns */
+      n = poisson(&rs, plen-1) +1;
+      if (n > itcnt) n = itcnt; /* draw the pattern length */
+      p->items = (int*)malloc((size_t)n *sizeof(int));
+      if (!p->items) error(E_NOMEM);
+      for (m = 0; m < n; ) {    /* sample the pattern items */
+        j = sample(&rs, cdf, itcnt);
+        if (stamp[j] == i) continue;
+        stamp[j] = i; p->items[m++] = j;
+      }                         /* (avoid duplicate items) */
+      p->cnt  = n;              /* draw the corruption level */
+      p->crpt = crpt *(0.5 +rnd(&rs));
+      if (p->crpt > 1) p->crpt = 1;
+      pcdf[i] = -log(1.0 -rnd(&rs));
+      if (i > 0) pcdf[i] += pcdf[i-1];
+    }                           /* draw an exponentially distributed */
+    for (i = 0; i < itcnt; i++) /* pattern weight and clear the */
+      stamp[i] = -1;            /* stamps of the items again */
+  }
+
+  /* --- generate transactions --- */
+  if (fn_out && *fn_out)        /* open the output file */
+       out = fopen(fn_out, "w");
+  else out = stdout, fn_out = "<stdout>";
+  if (!out) error(E_FOPEN, fn_out);
+  MSG(stderr, "writing %s ... ", fn_out);
+  for (t = 0; t < tacnt; t++) { /* traverse the transactions */
+    n = poisson(&rs, len-1) +1; /* draw the transaction length */
+    if (n > itcnt) n = itcnt;   /* (at least one item) */
+    m = 0;                      /* initialize the item counter */
+    if (patcnt > 0) {           /* if there are patterns */
+      k = (int)(pfrac *n +0.5); /* get number of pattern items */
+      while (m < k) {           /* while pattern items are missing */
+        p = pats +sample(&rs, pcdf, patcnt);
+        for (i = 0; (i < p->cnt) && (m < n); i++) {
+          j = p->items[i];      /* traverse the pattern items */
+          if ((stamp[j] == (int)t) || (rnd(&rs) < p->crpt))
+            continue;           /* skip duplicates and drop items */
+          stamp[j] = (int)t; items[m++] = j;
+        }                       /* collect the pattern items */
+        if (rnd(&rs) < 0.5) break;
+      }                         /* (possibly fewer pattern items) */
+    }
+    while (m < n) {             /* fill with independent items */
+      j = sample(&rs, cdf, itcnt);
+      if (stamp[j] == (int)t) continue;
+      stamp[j] = (int)t; items[m++] = j;
+    }                           /* (avoid duplicate items) */
+    for (i = 0; i < m; i++)     /* write the transaction */
+      fprintf(out, (i > 0) ? " %d" : "%d", items[i]);
+    fputc('\n', out);           /* terminate the transaction */
+  }
+  if (fflush(out) != 0) error(E_FWRITE, fn_out);
+  MSG(stderr, "[%ld transaction(s)] done [%.2fs].\n",
+              tacnt, SEC_SINCE(c));
+
+  /* --- clean up --- */
+  CLEANUP;                      /* clean up memory and close files */
+  SHOWMEM;                      /* show (final) memory usage */
+  return 0;                     /* return 'ok' */
+}  /* main() */
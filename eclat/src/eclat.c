@@ -0,0 +1,975 @@
+/*----------------------------------------------------------------------
+  File    : eclat.c
+  Contents: eclat algorithm for finding frequent item sets
+  History : 2026.10.14 file created from apriori.c
+            2026.10.14 tid bitset and diffset variants added
+            2026.10.14 closed/maximal check with tid bitsets added
+            2026.10.14 binary output added (option -B#)
+            2026.10.14 asynchronous output added (option -O)
+            2026.10.14 open addressing item map used for item base
+            2026.10.14 version 1.0 (copyright years kept from apriori.c)
+------------------------------------------------------------------------
+  References for the Eclat algorithm:
+    M.J. Zaki, S. Parthasarathy, M. Ogihara, and W. Li.
+    New Algorithms for Fast Discovery of Association Rules.
+    Proc. 3rd Int. Conf. on Knowledge Discovery and Data Mining
+    (KDD 1997, Newport Beach, CA), 283-296.
+    AAAI Press, Menlo Park, CA, USA 1997
+    M.J. Zaki and K. Gouda.
+    Fast Vertical Mining Using Diffsets.
+    Proc. 9th ACM SIGKDD Int. Conf. on Knowledge Discovery
+    and Data Mining (KDD 2003, Washington, DC), 326-335.
+    ACM Press, New York, NY, USA 2003
+----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+#include <assert.h>
+#ifndef ISR_PATSPEC
+#define ISR_PATSPEC
+#endif
+#ifdef  ECL_MAIN
+#ifndef PSP_REPORT
+#define PSP_REPORT
+#endif
+#ifndef TA_READ
+#define TA_READ
+#endif
+#endif
+#ifndef TAVERTFN
+#define TAVERTFN
+#endif
+#include "eclat.h"
+#ifdef ECL_MAIN
+#include "error.h"
+#endif
+#ifdef STORAGE
+#include "storage.h"
+#endif
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define PRGNAME     "eclat"
+#define DESCRIPTION "find frequent item sets with the eclat algorithm"
+#define VERSION     "version 1.0 (2026.10.14)         " \
+                    "(c) 1996-2017   Christian Borgelt"
+
+/* --- error codes --- */
+/* error codes   0 to  -4 defined in tract.h */
+#define E_STDIN      (-5)       /* double assignment of stdin */
+#define E_OPTION     (-6)       /* unknown option */
+#define E_OPTARG     (-7)       /* missing option argument */
+#define E_ARGCNT     (-8)       /* too few/many arguments */
+#define E_TARGET     (-9)       /* invalid target type */
+#define E_SIZE      (-10)       /* invalid set size */
+#define E_SUPPORT   (-11)       /* invalid support */
+#define E_VARIANT   (-12)       /* invalid algorithm variant */
+/* error codes -15 to -25 defined in tract.h */
+
+#ifndef QUIET                   /* if not quiet version, */
+#define MSG         fprintf     /* print messages */
+#define XMSG        if (eclat->mode & ECL_VERBOSE) fprintf
+#define CLOCK(t)    ((t) = clock())
+#else                           /* if quiet version, */
+#define MSG(...)    ((void)0)   /* suppress messages */
+#define XMSG(...)   ((void)0)
+#define CLOCK(t)    ((void)0)
+#endif
+
+#define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef struct {                /* --- tid bitset list element --- */
+  ITEM     item;                /* item to add to the prefix */
+  SUPP     supp;                /* support of the extended prefix */
+  TIDBLK   *bits;               /* tid bitset of the extended prefix */
+} TBLIST;                       /* (tid bitset list element) */
+
+typedef struct {                /* --- diffset list element --- */
+  ITEM     item;                /* item to add to the prefix */
+  SUPP     supp;                /* support of the extended prefix */
+  TID      cnt;                 /* number of tids in the diffset */
+  TID      *tids;               /* tids of prefix but not extension */
+} TDLIST;                       /* (diffset list element) */
+
+struct _eclat {                 /* --- eclat miner --- */
+  int      target;              /* target type (e.g. closed/maximal) */
+  double   smin;                /* minimum support of an item set */
+  double   smax;                /* maximum support of an item set */
+  SUPP     supp;                /* minimum support of an item set */
+  ITEM     zmin;                /* minimum size of an item set */
+  ITEM     zmax;                /* maximum size of an item set */
+  int      algo;                /* variant of eclat algorithm */
+  int      mode;                /* search mode (e.g. pruning) */
+  TABAG    *tabag;              /* transaction bag/multiset */
+  ISREPORT *report;             /* item set reporter */
+  TAVERT   *vert;               /* vertical representation */
+  TIDBLK   *cover;              /* buffer for a reconstructed cover */
+  TIDBLK   *base;               /* cover of the last bitset prefix */
+  TDLIST   **path;              /* diffsets from the bitset prefix */
+  ITEM     depth;               /* number of diffsets on the path */
+};                              /* (eclat miner) */
+
+/*----------------------------------------------------------------------
+  Constants
+----------------------------------------------------------------------*/
+#if !defined QUIET && defined ECL_MAIN
+/* --- error messages --- */
+static const char *errmsgs[] = {
+  /* E_NONE      0 */  "no error",
+  /* E_NOMEM    -1 */  "not enough memory",
+  /* E_FOPEN    -2 */  "cannot open file %s",
+  /* E_FREAD    -3 */  "read error on file %s",
+  /* E_FWRITE   -4 */  "write error on file %s",
+  /* E_STDIN    -5 */  "double assignment of standard input",
+  /* E_OPTION   -6 */  "unknown option -%c",
+  /* E_OPTARG   -7 */  "missing option argument",
+  /* E_ARGCNT   -8 */  "wrong number of arguments",
+  /* E_TARGET   -9 */  "invalid target type '%c'",
+  /* E_SIZE    -10 */  "invalid item set size %"ITEM_FMT,
+  /* E_SUPPORT -11 */  "invalid minimum support %g",
+  /* E_VARIANT -12 */  "invalid eclat variant '%c'",
+  /*           -13 */  NULL,
+  /*           -14 */  NULL,
+  /* E_NOITEMS -15 */  "no (frequent) items found",
+  /*           -16 */  "unknown error"
+};
+#endif
+
+/*----------------------------------------------------------------------
+  Global Variables
+----------------------------------------------------------------------*/
+#ifdef ECL_MAIN
+#ifndef QUIET
+static CCHAR    *prgname;       /* program name for error messages */
+#endif
+static TABREAD  *tread  = NULL; /* table/transaction reader */
+static ITEMBASE *ibase  = NULL; /* item base */
+static TABAG    *tabag  = NULL; /* transaction bag/multiset */
+static ISREPORT *report = NULL; /* item set reporter */
+static TABWRITE *twrite = NULL; /* table writer for pattern spectrum */
+static double   *border = NULL; /* support border for filtering */
+static ECLAT    *eclat  = NULL; /* eclat miner object */
+#endif
+
+/*----------------------------------------------------------------------
+  Auxiliary Functions
+----------------------------------------------------------------------*/
+
+static TID tid_diff (TID *dst, const TID *a, TID n, const TID *b, TID m)
+{                               /* --- difference of tid lists */
+  TID *d = dst;                 /* to traverse the destination */
+
+  assert(dst                    /* check the function arguments */
+  &&    (a || (n <= 0)) && (b || (m <= 0)));
+  while ((n > 0) && (m > 0)) {  /* while both lists are not empty */
+    if      (*a < *b) { *d++ = *a++; n--; }
+    else if (*a > *b) {   b++;       m--; }
+    else              { a++; n--; b++; m--; }
+  }                             /* copy the tids that are only in a */
+  while (--n >= 0) *d++ = *a++; /* copy the remaining tids of a */
+  return (TID)(d-dst);          /* return the number of tids */
+}  /* tid_diff() */
+
+/*--------------------------------------------------------------------*/
+
+static int isclomax (ECLAT *eclat, const TIDBLK *cover, ITEM tail)
+{                               /* --- check for closed/maximal set */
+  ITEM   i, n;                  /* loop variable, number of items */
+  SUPP   s;                     /* support of the current item set */
+  TAVERT *vert;                 /* vertical representation */
+
+  assert(eclat && cover);       /* check the function arguments */
+  if ((eclat->target & ISR_MAXIMAL) && (tail > 0))
+    return 0;                   /* frequent extensions in the tail */
+  vert = eclat->vert;           /* get the vertical representation */
+  s    = (SUPP)isr_supp(eclat->report);
+  n    = tav_itemcnt(vert);     /* get support and number of items */
+  for (i = 0; i < n; i++) {     /* traverse the unused items */
+    if (isr_uses(eclat->report, i)) continue;
+    if (eclat->target & ISR_MAXIMAL) {
+      if ((tav_supp(vert, i) >= eclat->supp)
+      &&  (tav_andwgt(vert, cover, tav_bits(vert, i)) >= eclat->supp))
+        return 0; }             /* check for a frequent superset */
+    else {                      /* if to check for a closed set */
+      if ((tav_supp(vert, i) >= s)
+      &&  tav_subset(vert, cover, tav_bits(vert, i)))
+        return 0;               /* check for a superset */
+    }                           /* with the same support */
+  }
+  return 1;                     /* return that the set qualifies */
+}  /* isclomax() */
+
+/* Since the reporter has to be used without an internal filter, the */
+/* closed or maximal item sets are identified directly on the tid    */
+/* bitsets: a set is not closed if the cover of some unused item is  */
+/* a superset of its cover, and it is not maximal if the cover of    */
+/* some unused item intersects its cover in enough transactions.     */
+
+/*----------------------------------------------------------------------
+  Eclat Algorithm
+----------------------------------------------------------------------*/
+
+ECLAT* eclat_create (int target, double smin, double smax,
+                     ITEM zmin, ITEM zmax, int algo, int mode)
+{                               /* --- create an eclat miner */
+  ECLAT *eclat;                 /* created eclat miner */
+
+  /* --- make parameters consistent --- */
+  if      (target & ECL_MAXIMAL) target = ISR_MAXIMAL;
+  else if (target & ECL_CLOSED)  target = ISR_CLOSED;
+  else                           target = ISR_FREQUENT;
+  if ((algo < ECL_BITS) || (algo > ECL_AUTO))
+    algo = ECL_AUTO;            /* check the algorithm variant */
+
+  /* --- create an eclat miner --- */
+  eclat = (ECLAT*)malloc(sizeof(ECLAT));
+  if (!eclat) return NULL;      /* create an eclat miner */
+  eclat->target = target;       /* store all parameters */
+  eclat->smin   = smin;
+  eclat->smax   = smax;
+  eclat->supp   = 1;
+  eclat->zmin   = zmin;
+  eclat->zmax   = zmax;
+  eclat->algo   = algo;
+  eclat->mode   = mode;
+  eclat->tabag  = NULL;
+  eclat->report = NULL;
+  eclat->vert   = NULL;
+  eclat->cover  = NULL;
+  eclat->base   = NULL;
+  eclat->path   = NULL;
+  eclat->depth  = 0;
+  return eclat;                 /* return the created eclat miner */
+}  /* eclat_create() */
+
+/*--------------------------------------------------------------------*/
+
+static int cleanup (ECLAT *eclat)
+{                               /* --- clean up on error */
+  if (eclat->mode & ECL_NOCLEAN)
+    return E_NOMEM;             /* if not to clean up memory, abort */
+  if (eclat->path) {            /* free the diffset path */
+    free(eclat->path);        eclat->path  = NULL; }
+  if (eclat->cover) {           /* free the cover buffer */
+    free(eclat->cover);       eclat->cover = NULL; }
+  if (eclat->vert) {            /* free the vertical representation */
+    tav_delete(eclat->vert, 0); eclat->vert = NULL; }
+  return E_NOMEM;               /* return an error indicator */
+}  /* cleanup() */
+
+/*--------------------------------------------------------------------*/
+
+void eclat_delete (ECLAT *eclat, int deldar)
+{                               /* --- delete an eclat miner */
+  cleanup(eclat);               /* clean up temporary data */
+  if (deldar) {                 /* if to delete data and reporter */
+    if (eclat->report) isr_delete(eclat->report, 0);
+    if (eclat->tabag)  tbg_delete(eclat->tabag,  1);
+  }                             /* delete if existing */
+  free(eclat);                  /* delete the base structure */
+}  /* eclat_delete() */
+
+/*--------------------------------------------------------------------*/
+
+int eclat_data (ECLAT *eclat, TABAG *tabag, int mode, int sort)
+{                               /* --- prepare data for eclat */
+  ITEM    m;                    /* number of items */
+  double  smin;                 /* absolute minimum support */
+  #ifndef QUIET                 /* if to print messages */
+  TID     n;                    /* number of transactions */
+  SUPP    w;                    /* total transaction weight */
+  clock_t t;                    /* timer for measurements */
+  #endif                        /* (only needed for messages) */
+
+  assert(eclat && tabag);       /* check the function arguments */
+  eclat->tabag = tabag;         /* note the transaction bag */
+
+  /* --- compute data-specific parameters --- */
+  smin = ceilsupp((eclat->smin < 0) ? -eclat->smin
+       : (eclat->smin/100.0) *(double)tbg_wgt(tabag) *(1-DBL_EPSILON));
+  eclat->supp = (SUPP)smin;     /* compute absolute minimum support */
+
+  /* --- sort and recode items --- */
+  if (!(mode & ECL_NORECODE)) { /* if to sort and recode the items */
+    CLOCK(t);                   /* start timer, print log message */
+    XMSG(stderr, "filtering, sorting and recoding items ... ");
+    m = tbg_recode(tabag, eclat->supp, -1, -1, sort);
+    if (m < 0) return E_NOMEM;  /* recode items and transactions */
+    if (m < 1) return E_NOITEMS;/* and check the number of items */
+    XMSG(stderr, "[%"ITEM_FMT" item(s)]", m);
+    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* print a log message */
+
+  /* --- filter transactions --- */
+  if (!(mode & ECL_NOFILTER)) { /* if to filter transactions */
+    CLOCK(t);                   /* start timer, print log message */
+    XMSG(stderr, "filtering transactions ... ");
+    tbg_filter(tabag, eclat->zmin, NULL, 0);
+    #ifndef QUIET               /* if to print messages */
+    n = tbg_cnt(tabag);         /* get the number of transactions */
+    w = tbg_wgt(tabag);         /* and the transaction weight */
+    XMSG(stderr, "[%"TID_FMT, n);
+    if (w != (SUPP)n) { XMSG(stderr, "/%"SUPP_FMT, w); }
+    XMSG(stderr, " transaction(s)] done [%.2fs].\n", SEC_SINCE(t));
+    #endif                      /* remove too short transactions */
+  }  /* Transactions are not combined, so that all weights stay 1 */
+  return 0;                     /* and supports are bit counts. */
+}  /* eclat_data() */
+
+/*--------------------------------------------------------------------*/
+
+int eclat_report (ECLAT *eclat, ISREPORT *report)
+{                               /* --- prepare reporter for eclat */
+  TID    n;                     /* number of transactions */
+  SUPP   w;                     /* total transaction weight */
+  double smax;                  /* absolute maximum support */
+  int    mrep;                  /* mode for item set reporter */
+
+  assert(eclat && report);      /* check the function arguments */
+  eclat->report = report;       /* note the item set reporter */
+
+  /* --- get reporting mode --- */
+  mrep = ISR_NOFILTER;          /* closed/maximal check in the miner */
+  #ifdef USE_ZLIB               /* if optional output compression */
+  if (eclat->mode & ECL_ZLIB)   /* if the compression flag is set, */
+    mrep |= ISR_ZLIB;           /* transfer it to the report mode */
+  #endif
+  if (eclat->mode & ECL_BINARY) mrep |= ISR_BINARY;
+  if (eclat->mode & ECL_DELTA)  mrep |= ISR_DELTA;
+  if (eclat->mode & ECL_ASYNC)  mrep |= ISR_ASYNC;
+
+  /* --- configure item set reporter --- */
+  w = tbg_wgt(eclat->tabag);    /* set support and size range */
+  smax = (eclat->smax < 0) ? -eclat->smax
+       : (eclat->smax/100.0) *(double)w *(1-DBL_EPSILON);
+  isr_setsupp(report, (RSUPP)eclat->supp, (RSUPP)floorsupp(smax));
+  isr_setsize(report, eclat->zmin, eclat->zmax);
+  n = (eclat->mode & ECL_PREFMT)/* get range of nums. to preformat */
+    ? (TID)ib_maxfrq(tbg_base(eclat->tabag)) : -1;
+  if ((isr_prefmt(report, (TID)eclat->supp, n)      != 0)
+  ||  (isr_settarg(report, eclat->target, mrep, -1) != 0))
+    return E_NOMEM;             /* set pre-format and target type */
+  return 0;                     /* return 'ok' */
+}  /* eclat_report() */
+
+/*--------------------------------------------------------------------*/
+
+static int rec_diff (ECLAT *eclat, TDLIST *list, ITEM k)
+{                               /* --- eclat recursion with diffsets */
+  int    r;                     /* error status */
+  ITEM   i, j, n, m;            /* loop variables, number of items */
+  SUPP   s, pex;                /* support, perfect extension support */
+  size_t z;                     /* size of the diffset buffer */
+  TID    c, *d;                 /* to traverse the diffset buffer */
+  TDLIST *l, *proj = NULL;      /* current element, projection */
+  ISREPORT *rep;                /* item set reporter */
+
+  assert(eclat && list && (k > 0)); /* check the function arguments */
+  rep = eclat->report;          /* get the item set reporter */
+  if ((k > 1)                   /* if there is more than one item */
+  &&  isr_xable(rep, 2)) {      /* and another item can be added */
+    for (z = 0, i = 0; i < k-1; i++)
+      z += (size_t)list[i].cnt; /* d(PXY) is a subset of d(PY) */
+    proj = (TDLIST*)malloc((size_t)(k-1) *sizeof(TDLIST)
+                          +z *sizeof(TID));
+    if (!proj) return -1;       /* allocate the projection and */
+  }                             /* a buffer for the diffsets */
+  for (r = 0, i = 0; i < k; i++) {
+    l = list +i;                /* traverse the list elements */
+    r = isr_add(rep, l->item, (RSUPP)l->supp);
+    if (r <  0) break;          /* add current item to the reporter */
+    if (r == 0) continue;       /* check if item needs processing */
+    eclat->path[eclat->depth++] = l;
+    m = (i > 0) ? -1 : 0;       /* note the diffset for the cover */
+    if (proj && (i > 0)) {      /* if another item can be added */
+      pex = (eclat->mode & ECL_PERFECT) ? l->supp : SUPP_MAX;
+      d   = (TID*)(proj +k-1);  /* get perfect extension support */
+      for (j = n = 0; j < i; j++) {
+        c = tid_diff(d, list[j].tids, list[j].cnt, l->tids, l->cnt);
+        s = l->supp -tav_tidwgt(eclat->vert, d, c);
+        if (s <  eclat->supp) continue; /* skip infrequent items */
+        if (s >= pex) {         /* collect perfect extensions */
+          isr_addpex(rep, list[j].item); continue; }
+        proj[n].item = list[j].item;
+        proj[n].supp = s;       /* d(PXY) = d(PY) - d(PX) */
+        proj[n].cnt  = c;       /* supp(PXY) = supp(PX) -w(d(PXY)) */
+        proj[n].tids = d; d += c; n++;
+      }                         /* store the extension diffset */
+      m = n;                    /* note the number of tail items */
+      if (n > 0) r = rec_diff(eclat, proj, n);
+      if (r < 0) break;         /* find freq. item sets recursively */
+    }
+    if (eclat->target & (ISR_CLOSED|ISR_MAXIMAL)) {
+      memcpy(eclat->cover, eclat->base,
+             tav_blkcnt(eclat->vert) *sizeof(TIDBLK));
+      for (j = 0; j < eclat->depth; j++)
+        tav_clear(eclat->vert, eclat->cover,
+                  eclat->path[j]->tids, eclat->path[j]->cnt);
+      r = isclomax(eclat, eclat->cover, m);
+    }                           /* reconstruct the cover and check */
+    else r = 1;                 /* for a closed/maximal item set */
+    if (r > 0) r = isr_report(rep);
+    if (r < 0) break;           /* report the current item set */
+    isr_remove(rep, 1);         /* remove the current item */
+    eclat->depth--;             /* from the item set reporter */
+  }                             /* and its diffset from the path */
+  if (proj) free(proj);         /* delete the created projection */
+  return r;                     /* return the error status */
+}  /* rec_diff() */
+
+/*--------------------------------------------------------------------*/
+
+static int usediffs (ECLAT *eclat, SUPP prev, SUPP supp)
+{                               /* --- check for switch to diffsets */
+  if (eclat->algo == ECL_BITS)  return 0;
+  if (eclat->algo == ECL_DIFFS) return 1;
+  return ((double)(prev-supp) *(double)(8*sizeof(TID))
+       <  (double)tav_tracnt(eclat->vert));
+}  /* usediffs() */
+
+/* In automatic mode the search switches to diffsets as soon as the  */
+/* diffset of an item set (relative to its prefix) needs fewer bits  */
+/* than a tid bitset, which happens deep in the search on dense data. */
+
+/*--------------------------------------------------------------------*/
+
+static int rec_bits (ECLAT *eclat, TBLIST *list, ITEM k, SUPP prev)
+{                               /* --- eclat recursion with bitsets */
+  int    r;                     /* error status */
+  ITEM   i, j, n, m;            /* loop variables, number of items */
+  SUPP   s, pex;                /* support, perfect extension support */
+  size_t b, z;                  /* number of blocks, buffer size */
+  TID    c, x;                  /* number of tids, max. per diffset */
+  TID    *d;                    /* buffer for the diffsets */
+  size_t *offs;                 /* offsets of the diffsets */
+  TIDBLK *bits;                 /* to traverse the bitset buffer */
+  TBLIST *l, *proj = NULL;      /* current element, projection */
+  TDLIST *diff = NULL;          /* projection with diffsets */
+  ISREPORT *rep;                /* item set reporter */
+  TAVERT   *vert;               /* vertical representation */
+
+  assert(eclat && list && (k > 0)); /* check the function arguments */
+  rep  = eclat->report;         /* get the item set reporter */
+  vert = eclat->vert;           /* and the vertical representation */
+  b    = tav_blkcnt(vert);      /* get the number of bitset blocks */
+  if ((k > 1)                   /* if there is more than one item */
+  &&  isr_xable(rep, 2)) {      /* and another item can be added */
+    proj = (TBLIST*)malloc((size_t)(k-1) *(sizeof(TBLIST)
+                          +sizeof(TDLIST) +sizeof(size_t))
+                          +(size_t)(k-1) *b *sizeof(TIDBLK));
+    if (!proj) return -1;       /* allocate both kinds of projection */
+    diff = (TDLIST*)(proj +k-1);/* and a buffer for the bitsets */
+  }                             /* (diffsets are allocated per item) */
+  for (r = 0, i = 0; i < k; i++) {
+    l = list +i;                /* traverse the list elements */
+    r = isr_add(rep, l->item, (RSUPP)l->supp);
+    if (r <  0) break;          /* add current item to the reporter */
+    if (r == 0) continue;       /* check if item needs processing */
+    m = (i > 0) ? -1 : 0;       /* init. the number of tail items */
+    pex = (eclat->mode & ECL_PERFECT) ? l->supp : SUPP_MAX;
+    if (proj && (i > 0) && !usediffs(eclat, prev, l->supp)) {
+      bits = (TIDBLK*)((size_t*)(diff +k-1) +k-1);
+      for (j = n = 0; j < i; j++) {
+        s = tav_and(vert, bits, l->bits, list[j].bits);
+        if (s <  eclat->supp) continue; /* skip infrequent items */
+        if (s >= pex) {         /* collect perfect extensions */
+          isr_addpex(rep, list[j].item); continue; }
+        proj[n].item = list[j].item;
+        proj[n].supp = s;       /* t(PXY) = t(PX) & t(PY) */
+        proj[n].bits = bits; bits += b; n++;
+      }                         /* store the extension bitset */
+      m = n;                    /* note the number of tail items */
+      if (n > 0) r = rec_bits(eclat, proj, n, l->supp);
+      if (r < 0) break; }       /* find freq. item sets recursively */
+    else if (proj && (i > 0)) { /* if to switch to diffsets */
+      offs = (size_t*)(diff +k-1);
+      x = tav_cnt(vert, l->bits);  /* get the size of the cover */
+      z = (size_t)x *(size_t)((i < 16) ? i : 16);
+      d = (TID*)malloc(z *sizeof(TID));
+      if (!d) { r = -1; break; }/* allocate a diffset buffer */
+      for (c = 0, j = n = 0; j < i; j++) {
+        if ((size_t)c +(size_t)x > z) {
+          z += (z > (size_t)x) ? z : (size_t)x;
+          bits = (TIDBLK*)realloc(d, z *sizeof(TID));
+          if (!bits) break;     /* enlarge the diffset buffer */
+          d = (TID*)bits;       /* (reuse the variable 'bits') */
+        }
+        diff[n].cnt = tav_diff(vert, d+c, l->bits, list[j].bits, &s);
+        s = l->supp -s;         /* d(PXY) = t(PX) - t(PY) */
+        if (s <  eclat->supp) continue; /* skip infrequent items */
+        if (s >= pex) {         /* collect perfect extensions */
+          isr_addpex(rep, list[j].item); continue; }
+        diff[n].item = list[j].item;
+        diff[n].supp = s;       /* note the item and the support */
+        offs[n++] = (size_t)c;  /* and the offset of the diffset */
+        c += diff[n-1].cnt;     /* in the diffset buffer */
+      }
+      if (j < i) { free(d); r = -1; break; }
+      for (j = 0; j < n; j++)   /* set the diffset pointers */
+        diff[j].tids = d +offs[j];
+      m = n;                    /* note the number of tail items */
+      eclat->base  = l->bits;   /* note the cover of the prefix */
+      eclat->depth = 0;         /* and start a new diffset path */
+      if (n > 0) r = rec_diff(eclat, diff, n);
+      free(d);                  /* find freq. item sets recursively */
+      if (r < 0) break;         /* and delete the diffset buffer */
+    }
+    r = (eclat->target & (ISR_CLOSED|ISR_MAXIMAL))
+      ? isclomax(eclat, l->bits, m) : 1;
+    if (r > 0) r = isr_report(rep);
+    if (r < 0) break;           /* report the current item set */
+    isr_remove(rep, 1);         /* remove the current item */
+  }                             /* from the item set reporter */
+  if (proj) free(proj);         /* delete the created projection */
+  return r;                     /* return the error status */
+}  /* rec_bits() */
+
+/*--------------------------------------------------------------------*/
+
+int eclat_mine (ECLAT *eclat)
+{                               /* --- eclat algorithm */
+  int     r;                    /* result of recursion/error status */
+  ITEM    i, k, m;              /* loop variable, number of items */
+  SUPP    w, pex;               /* total weight, perfect ext. support */
+  TID     t;                    /* loop variable for transactions */
+  TBLIST  *list;                /* list of items with their bitsets */
+  clock_t c;                    /* timer for measurements */
+
+  assert(eclat);                /* check the function argument */
+
+  /* --- create vertical representation --- */
+  c = clock();                  /* start the timer for construction */
+  XMSG(stderr, "building tid bitsets ... ");
+  eclat->vert = tav_create(eclat->tabag);
+  if (!eclat->vert) return E_NOMEM;
+  XMSG(stderr, "[%"SIZE_FMT" block(s) per item]",
+               tav_blkcnt(eclat->vert));
+  XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(c));
+
+  /* --- find frequent item sets --- */
+  c = clock();                  /* start the timer for the search */
+  XMSG(stderr, "writing %s ... ", isr_name(eclat->report));
+  m = tav_itemcnt(eclat->vert); /* get the number of items */
+  eclat->cover = (TIDBLK*)malloc((tav_blkcnt(eclat->vert)+1)
+                                 *sizeof(TIDBLK));
+  eclat->path  = (TDLIST**)malloc((size_t)(m+1) *sizeof(TDLIST*));
+  list = (TBLIST*)malloc((size_t)(m+1) *sizeof(TBLIST));
+  if (!eclat->cover || !eclat->path || !list) {
+    if (list) free(list);       /* check for successful allocation */
+    return cleanup(eclat);      /* and clean up on failure */
+  }
+  w   = tbg_wgt(eclat->tabag);  /* get the total transaction weight */
+  pex = (eclat->mode & ECL_PERFECT) ? w : SUPP_MAX;
+  for (i = k = 0; i < m; i++) { /* traverse the items */
+    if (tav_supp(eclat->vert, i) <  eclat->supp) continue;
+    if (tav_supp(eclat->vert, i) >= pex) {
+      isr_addpex(eclat->report, i); continue; }
+    list[k].item = i;           /* collect the frequent items */
+    list[k].supp = tav_supp(eclat->vert, i);
+    list[k].bits = tav_bits(eclat->vert, i); k++;
+  }                             /* (perfect extensions of empty set) */
+  r = (k > 0) ? rec_bits(eclat, list, k, w) : 0;
+  free(list);                   /* find freq. item sets recursively */
+  if (r >= 0) {                 /* if the search was successful */
+    if (eclat->target & (ISR_CLOSED|ISR_MAXIMAL)) {
+      memset(eclat->cover, 0, tav_blkcnt(eclat->vert) *sizeof(TIDBLK));
+      for (t = 0; t < tav_tracnt(eclat->vert); t++)
+        eclat->cover[(size_t)t/(8*sizeof(TIDBLK))]
+          |= (TIDBLK)1 << ((size_t)t%(8*sizeof(TIDBLK)));
+      r = isclomax(eclat, eclat->cover, k);
+    }                           /* check the empty set and */
+    else r = 1;                 /* report it (if it qualifies) */
+    if (r > 0) r = isr_report(eclat->report);
+  }
+  if (r < 0) return cleanup(eclat);
+  XMSG(stderr, "[%"SIZE_FMT" set(s)]", isr_repcnt(eclat->report));
+  XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(c));
+  cleanup(eclat);               /* clean up the allocated memory */
+  return 0;                     /* return 'ok' */
+}  /* eclat_mine() */
+
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+#ifdef ECL_MAIN
+
+static void help (void)
+{                               /* --- print add. option information */
+  #ifndef QUIET
+  fprintf(stderr, "\n");        /* terminate startup message */
+  printf("eclat algorithm variants (option -A#)\n");
+  printf("  b   tid bitsets (intersection and bit count)\n");
+  printf("  d   diffsets (tid bitsets only on the first level)\n");
+  printf("  a   automatic switch from tid bitsets to diffsets "
+                 "(default)\n");
+  printf("\n");
+  printf("information output format characters (option -v#)\n");
+  printf("  %%%%  a percent sign\n");
+  printf("  %%i  number of items (item set size)\n");
+  printf("  %%a  absolute item set  support\n");
+  printf("  %%s  relative item set  support as a fraction\n");
+  printf("  %%S  relative item set  support as a percentage\n");
+  printf("  %%Q  total transaction weight (database size)\n");
+  printf("All format characters can be preceded by the number\n");
+  printf("of significant digits to be printed (at most 32 digits),\n");
+  printf("even though this value is ignored for integer numbers.\n");
+  #endif                        /* print help information */
+  exit(0);                      /* abort the program */
+}  /* help() */
+
+/*--------------------------------------------------------------------*/
+
+static ITEM getbdr (char *s, char **end, double **border)
+{                               /* --- get the support border */
+  ITEM   i, k;                  /* loop variables */
+  double *b;                    /* support border */
+
+  assert(s && end && border);   /* check the function arguments */
+  for (i = k = 0; s[i]; i++)    /* traverse the string and */
+    if (s[i] == ':') k++;       /* count the number separators */
+  *border = b = (double*)malloc((size_t)++k *sizeof(double));
+  if (!b) return -1;            /* allocate a support border */
+  for (i = 0; i < k; i++) {     /* traverse the parameters */
+    b[i] = strtod(s, end);      /* get the next parameter and */
+    if (*end == s) break;       /* check for an empty parameter */
+    s = *end; if (*s++ != ':') break;
+  }                             /* check for a colon */
+  if (++i < k)                  /* shrink support array if possible */
+    *border = (double*)realloc(b, (size_t)i *sizeof(double));
+  return i;                     /* return number of support values */
+}  /* getbdr() */
+
+/*--------------------------------------------------------------------*/
+
+static int setbdr (ISREPORT *report, SUPP w, ITEM zmin,
+                   double **border, ITEM n)
+{                               /* --- set the support border */
+  double s;                     /* to traverse the support values */
+
+  assert(report                 /* check the function arguments */
+  &&    (w > 0) && (zmin >= 0) && border && (*border || (n <= 0)));
+  while (--n >= 0) {            /* traverse the support values */
+    s = (*border)[n];           /* transform to absolute count */
+    s = ceilsupp((s >= 0) ? s/100.0 *(double)w *(1-DBL_EPSILON) : -s);
+    if (isr_setbdr(report, n+zmin, (RSUPP)s) < 0) return -1;
+  }                             /* set support in item set reporter */
+  if (*border) { free(*border); *border = NULL; }
+  return 0;                     /* return 'ok' */
+}  /* setbdr() */
+
+/*--------------------------------------------------------------------*/
+
+#ifndef NDEBUG                  /* if debug version */
+  #undef  CLEANUP               /* clean up memory and close files */
+  #define CLEANUP \
+  if (eclat)  eclat_delete(eclat, 0); \
+  if (twrite) twr_delete(twrite, 1);  \
+  if (report) isr_delete(report, 0);  \
+  if (tabag)  tbg_delete(tabag,  0);  \
+  if (tread)  trd_delete(tread,  1);  \
+  if (ibase)  ib_delete (ibase);      \
+  if (border) free(border);
+#endif
+
+GENERROR(error, exit)           /* generic error reporting function */
+
+/*--------------------------------------------------------------------*/
+
+int main (int argc, char *argv[])
+{                               /* --- main function */
+  int     i, k = 0;             /* loop variables, counters */
+  char    *s;                   /* to traverse the options */
+  CCHAR   **optarg = NULL;      /* option argument */
+  CCHAR   *fn_inp  = NULL;      /* name of the input  file */
+  CCHAR   *fn_out  = NULL;      /* name of the output file */
+  CCHAR   *fn_sel  = NULL;      /* name of item selection file */
+  CCHAR   *fn_psp  = NULL;      /* name of pattern spectrum file */
+  CCHAR   *recseps = NULL;      /* record  separators */
+  CCHAR   *fldseps = NULL;      /* field   separators */
+  CCHAR   *blanks  = NULL;      /* blank   characters */
+  CCHAR   *comment = NULL;      /* comment characters */
+  CCHAR   *hdr     = "";        /* record header  for output */
+  CCHAR   *sep     = " ";       /* item separator for output */
+  CCHAR   *dflt    = " (%S)";   /* default format for check */
+  CCHAR   *info    = dflt;      /* format for information output */
+  int     target   = 's';       /* target type (e.g. closed/maximal) */
+  ITEM    zmin     = 1;         /* minimum item set size */
+  ITEM    zmax     = ITEM_MAX;  /* maximum item set size */
+  double  smin     = 10;        /* minimum support of an item set */
+  double  smax     = 100;       /* maximum support of an item set */
+  int     sort     = 2;         /* flag for item sorting and recoding */
+  int     algo     = 'a';       /* variant of eclat algorithm */
+  int     mode     = ECL_DEFAULT|ECL_PREFMT;     /* search mode */
+  int     mtar     = 0;         /* mode for transaction reading */
+  int     scan     = 0;         /* flag for scanable item output */
+  int     bdrcnt   = 0;         /* number of support values in border */
+  int     stats    = 0;         /* flag for item set statistics */
+  int     bin      = 0;         /* binary output mode */
+  PATSPEC *psp;                 /* collected pattern spectrum */
+  ITEM    m;                    /* number of items */
+  TID     n;                    /* number of transactions */
+  SUPP    w;                    /* total transaction weight */
+  #ifndef QUIET                 /* if not quiet version */
+  clock_t t;                    /* timer for measurements */
+
+  prgname = argv[0];            /* get program name for error msgs. */
+
+  /* --- print usage message --- */
+  if (argc > 1) {               /* if arguments are given */
+    fprintf(stderr, "%s - %s\n", argv[0], DESCRIPTION);
+    fprintf(stderr, VERSION); } /* print a startup message */
+  else {                        /* if no arguments are given */
+    printf("usage: %s [options] infile [outfile]\n", argv[0]);
+    printf("%s\n", DESCRIPTION);
+    printf("%s\n", VERSION);
+    printf("-t#      target type                              "
+                    "(default: %c)\n", target);
+    printf("         (s: frequent, c: closed, m: maximal item sets)\n");
+    printf("-m#      minimum number of items per item set     "
+                    "(default: %"ITEM_FMT")\n", zmin);
+    printf("-n#      maximum number of items per item set     "
+                    "(default: no limit)\n");
+    printf("-s#      minimum support of an item set           "
+                    "(default: %g%%)\n", smin);
+    printf("-S#      maximum support of an item set           "
+                    "(default: %g%%)\n", smax);
+    printf("         (positive: percentage, "
+                     "negative: absolute number)\n");
+    printf("-q#      sort items w.r.t. their frequency        "
+                    "(default: %d)\n", sort);
+    printf("         (1: ascending, -1: descending, 0: do not sort,\n"
+           "          2: ascending, -2: descending w.r.t. "
+                    "transaction size sum)\n");
+    printf("-A#      variant of the eclat algorithm           "
+                    "(default: %c)\n", algo);
+    printf("-x       do not prune with perfect extensions     "
+                    "(default: prune)\n");
+    printf("-F#:#..  support border for filtering item sets   "
+                    "(default: none)\n");
+    printf("         (list of minimum support values, "
+                    "one per item set size,\n");
+    printf("         starting at the minimum size, "
+                    "as given with option -m#)\n");
+    printf("-R#      read item selection from a file\n");
+    printf("-P#      write a pattern spectrum to a file\n");
+    printf("-Z       print item set statistics "
+                    "(number of item sets per size)\n");
+    printf("-N       do not pre-format some integer numbers   "
+                    "(default: do)\n");
+    printf("-g       write item names in scanable form "
+                    "(quote certain characters)\n");
+    #ifdef USE_ZLIB             /* if optional output compression */
+    printf("-z       compress output with zlib (deflate)      "
+                    "(default: plain text)\n");
+    #endif                      /* print compression option */
+    printf("-B#      write binary output (for isrdec)         "
+                    "(default: %d)\n", bin);
+    printf("         (0: text, 1: binary, 2: binary with "
+                     "delta-encoded items)\n");
+    printf("-O       write output in a separate thread        "
+                    "(default: synchronous)\n");
+    printf("-h#      record header  for output                "
+                    "(default: \"%s\")\n", hdr);
+    printf("-k#      item separator for output                "
+                    "(default: \"%s\")\n", sep);
+    printf("-v#      output format for item set information   "
+                    "(default: \"%s\")\n", info);
+    printf("-w       integer transaction weight in last field "
+                    "(default: only items)\n");
+    printf("-r#      record/transaction separators            "
+                    "(default: \"\\n\")\n");
+    printf("-f#      field /item        separators            "
+                    "(default: \" \\t,\")\n");
+    printf("-b#      blank   characters                       "
+                    "(default: \" \\t\\r\")\n");
+    printf("-C#      comment characters                       "
+                    "(default: \"#\")\n");
+    printf("-!       print additional option information\n");
+    printf("infile   file to read transactions from           "
+                    "[required]\n");
+    printf("outfile  file to write frequent item sets to      "
+                    "[optional]\n");
+    return 0;                   /* print a usage message */
+  }                             /* and abort the program */
+  #endif  /* #ifndef QUIET */
+  /* free option characters: acdeijlopuy [A-Z]\[ABCFNOPRSZ] */
+
+  /* --- evaluate arguments --- */
+  for (i = 1; i < argc; i++) {  /* traverse the arguments */
+    s = argv[i];                /* get an option argument */
+    if (optarg) { *optarg = s; optarg = NULL; continue; }
+    if ((*s == '-') && *++s) {  /* -- if argument is an option */
+      while (*s) {              /* traverse the options */
+        switch (*s++) {         /* evaluate the options */
+          case '!': help();                          break;
+          case 't': target = (*s) ? *s++ : 's';      break;
+          case 'm': zmin   = (ITEM)strtol(s, &s, 0); break;
+          case 'n': zmax   = (ITEM)strtol(s, &s, 0); break;
+          case 's': smin   =       strtod(s, &s);    break;
+          case 'S': smax   =       strtod(s, &s);    break;
+          case 'q': sort   = (int) strtol(s, &s, 0); break;
+          case 'A': algo   = (*s) ? *s++ : 'a';      break;
+          case 'x': mode  &= ~ECL_PERFECT;           break;
+          case 'F': bdrcnt = getbdr(s, &s, &border); break;
+          case 'R': optarg = &fn_sel;                break;
+          case 'P': optarg = &fn_psp;                break;
+          case 'Z': stats  = 1;                      break;
+          case 'N': mode  &= ~ECL_PREFMT;            break;
+          case 'g': scan   = 1;                      break;
+          #ifdef USE_ZLIB       /* if optional output compression */
+          case 'z': mode  |= ECL_ZLIB;               break;
+          #endif                /* set the compression flag */
+          case 'B': bin    = (int) strtol(s, &s, 0); break;
+          case 'O': mode  |= ECL_ASYNC;              break;
+          case 'h': optarg = &hdr;                   break;
+          case 'k': optarg = &sep;                   break;
+          case 'v': optarg = &info;                  break;
+          case 'w': mtar  |= TA_WEIGHT;              break;
+          case 'r': optarg = &recseps;               break;
+          case 'f': optarg = &fldseps;               break;
+          case 'b': optarg = &blanks;                break;
+          case 'C': optarg = &comment;               break;
+          default : error(E_OPTION, *--s);           break;
+        }                       /* set the option variables */
+        if (optarg && *s) { *optarg = s; optarg = NULL; break; }
+      } }                       /* get an option argument */
+    else {                      /* -- if argument is no option */
+      switch (k++) {            /* evaluate non-options */
+        case  0: fn_inp = s;      break;
+        case  1: fn_out = s;      break;
+        default: error(E_ARGCNT); break;
+      }                         /* note filenames */
+    }
+  }
+  if (optarg)       error(E_OPTARG);     /* check option arguments */
+  if (k      < 1)   error(E_ARGCNT);     /* and number of arguments */
+  if (zmin   < 0)   error(E_SIZE, zmin); /* check the size limits */
+  if (zmax   < 0)   error(E_SIZE, zmax); /* and the minimum support */
+  if (smin   > 100) error(E_SUPPORT, smin);
+  if (bdrcnt < 0)   error(E_NOMEM);
+  if (bin > 0) mode |= ECL_BINARY; /* set the binary output flags */
+  if (bin > 1) mode |= ECL_DELTA;  /* (plain or delta-encoded) */
+  if ((!fn_inp || !*fn_inp) && (fn_sel && !*fn_sel))
+    error(E_STDIN);             /* stdin must not be used twice */
+  switch (target) {             /* check and translate target type */
+    case 's': target = ISR_ALL;              break;
+    case 'f': target = ISR_FREQUENT;         break;
+    case 'c': target = ISR_CLOSED;           break;
+    case 'm': target = ISR_MAXIMAL;          break;
+    default : error(E_TARGET, (char)target); break;
+  }                             /* (get target type code) */
+  switch (algo) {               /* check and translate alg. variant */
+    case 'b': algo = ECL_BITS;               break;
+    case 'd': algo = ECL_DIFFS;              break;
+    case 'a': algo = ECL_AUTO;               break;
+    default : error(E_VARIANT, (char)algo);  break;
+  }                             /* (get eclat algorithm code) */
+  if (info == dflt)             /* if default info. format is used, */
+    info = (smin < 0) ? " (%a)" : " (%S)";   /* set default format */
+  mode |= ECL_VERBOSE|ECL_NOCLEAN;
+  MSG(stderr, "\n");            /* terminate the startup message */
+
+  /* --- read item selection --- */
+  ibase = ib_create(IB_OPENADR, 0);  /* create an item base */
+  if (!ibase) error(E_NOMEM);   /* to manage the items */
+  tread = trd_create();         /* create a transaction reader */
+  if (!tread) error(E_NOMEM);   /* and configure the characters */
+  trd_allchs(tread, recseps, fldseps, blanks, "", comment);
+  if (fn_sel) {                 /* if an item selection is given */
+    CLOCK(t);                   /* start timer, open input file */
+    if (trd_open(tread, NULL, fn_sel) != 0)
+      error(E_FOPEN, trd_name(tread));
+    MSG(stderr, "reading %s ... ", trd_name(tread));
+    m = ib_readsel(ibase,tread);/* read the given item selection */
+    if (m < 0) error((int)-m, ib_errmsg(ibase, NULL, 0));
+    trd_close(tread);           /* close the input file */
+    MSG(stderr, "[%"ITEM_FMT" item(s)]", ib_cnt(ibase));
+    MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* print a log message */
+
+  /* --- read transaction database --- */
+  tabag = tbg_create(ibase);    /* create a transaction bag */
+  if (!tabag) error(E_NOMEM);   /* to store the transactions */
+  CLOCK(t);                     /* start timer, open input file */
+  if (tbg_isbin(fn_inp)) {      /* if a binary transaction bag file */
+    MSG(stderr, "loading %s ... ", fn_inp);
+    k = tbg_load(tabag, fn_inp);/* map the prepared transactions */
+    if (k < 0) error(k, fn_inp); }
+  else {                        /* if a transaction text file */
+    if (trd_open(tread, NULL, fn_inp) != 0)
+      error(E_FOPEN, trd_name(tread));
+    MSG(stderr, "reading %s ... ", trd_name(tread));
+    k = tbg_read(tabag, tread, mtar);
+    if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  }                             /* read the transaction database */
+  trd_delete(tread, 1);         /* read the transaction database, */
+  tread = NULL;                 /* then delete the table reader */
+  m = ib_cnt(ibase);            /* get the number of items, */
+  n = tbg_cnt(tabag);           /* the number of transactions, */
+  w = tbg_wgt(tabag);           /* the total transaction weight */
+  MSG(stderr, "[%"ITEM_FMT" item(s), %"TID_FMT, m, n);
+  if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
+  MSG(stderr, " transaction(s)] done [%.2fs].", SEC_SINCE(t));
+  if ((m <= 0) || (n <= 0))     /* check for at least one item */
+    error(E_NOITEMS);           /* and at least one transaction */
+  MSG(stderr, "\n");            /* terminate the log message */
+
+  /* --- find frequent item sets --- */
+  eclat = eclat_create(target, smin, smax, zmin, zmax, algo, mode);
+  if (!eclat) error(E_NOMEM);   /* create an eclat miner */
+  k = eclat_data(eclat, tabag, 0, sort);
+  if (k) error(k);              /* prepare data for eclat */
+  report = isr_create(ibase);   /* create an item set reporter */
+  if (!report) error(E_NOMEM);  /* and configure it */
+  k = eclat_report(eclat, report);
+  if (k) error(k);              /* prepare reporter for eclat */
+  if (setbdr(report, w, zmin, &border, bdrcnt) != 0)
+    error(E_NOMEM);             /* set the support border (if any) */
+  if (fn_psp && (isr_addpsp(report, NULL) < 0))
+    error(E_NOMEM);             /* set a pattern spectrum if req. */
+  if (isr_setfmt(report, scan, hdr, sep, NULL, info) != 0)
+    error(E_NOMEM);             /* set the output format strings */
+  k = isr_open(report, NULL, fn_out);
+  if (k) error(k, isr_name(report));
+  if (isr_setup(report) < 0)    /* open the output file and */
+    error(E_NOMEM);             /* set up the item set reporter */
+  k = eclat_mine(eclat);        /* find frequent item sets */
+  if (k) error(k);              /* and check for an error */
+  if (stats)                    /* print item set statistics */
+    isr_prstats(report, stdout, 0);
+  if (isr_close(report) != 0)   /* close item set output file */
+    error(E_FWRITE, isr_name(report));
+
+  /* --- write pattern spectrum --- */
+  if (fn_psp) {                 /* if to write a pattern spectrum */
+    CLOCK(t);                   /* start timer, create table write */
+    psp    = isr_getpsp(report);/* get the pattern spectrum */
+    twrite = twr_create();      /* create a table writer and */
+    if (!twrite) error(E_NOMEM);/* open the output file */
+    if (twr_open(twrite, NULL, fn_psp) != 0)
+      error(E_FOPEN,  twr_name(twrite));
+    MSG(stderr, "writing %s ... ", twr_name(twrite));
+    if (psp_report(psp, twrite, 1.0) != 0)
+      error(E_FWRITE, twr_name(twrite));
+    twr_delete(twrite, 1);      /* write the pattern spectrum */
+    twrite = NULL;              /* and delete the table writer */
+    MSG(stderr, "[%"SIZE_FMT" signature(s)]", psp_sigcnt(psp));
+    MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* write a log message */
+
+  /* --- clean up --- */
+  CLEANUP;                      /* clean up memory and close files */
+  SHOWMEM;                      /* show (final) memory usage */
+  return 0;                     /* return 'ok' */
+}  /* main() */
+
+#endif  /* #ifdef ECL_MAIN ... */
@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------
+  File    : eclat.h
+  Contents: eclat algorithm for finding frequent item sets
+  History : 2026.10.14 file created from apriori.h
+            2026.10.14 tid bitset and diffset variants added
+            2026.10.14 binary output modes added (ECL_BINARY/ECL_DELTA)
+            2026.10.14 asynchronous output mode added (ECL_ASYNC)
+----------------------------------------------------------------------*/
+#ifndef __ECLAT__
+#define __ECLAT__
+#include "report.h"
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+/* --- target pattern types --- */
+#define ECL_FREQ      ISR_FREQUENT  /* frequent item sets */
+#define ECL_FREQUENT  ISR_FREQUENT  /* frequent item sets */
+#define ECL_CLOSED    ISR_CLOSED    /* closed  frequent item sets */
+#define ECL_MAXIMAL   ISR_MAXIMAL   /* maximal frequent item sets */
+
+/* --- data preparation modes --- */
+#define ECL_NORECODE  0x0001    /* do not sort and recode items */
+#define ECL_NOFILTER  0x0002    /* do not filter transactions by size */
+
+/* --- algorithm variants --- */
+#define ECL_BITS      0         /* tid bitsets (and + bit count) */
+#define ECL_DIFFS     1         /* diffsets below the first level */
+#define ECL_AUTO      2         /* automatic switch to diffsets */
+
+/* --- operation modes --- */
+#define ECL_PERFECT   0x0020    /* perfect extension pruning */
+#define ECL_DELTA     0x0040    /* delta-encode binary output */
+#define ECL_PREFMT    0x1000    /* pre-format integer numbers */
+#ifdef USE_ZLIB                 /* if optional output compression */
+#define ECL_ZLIB      0x4000    /* flag for output compression */
+#endif
+#define ECL_BINARY    0x2000    /* flag for binary output */
+#define ECL_ASYNC   0x10000    /* write output in a separate thread */
+#define ECL_DEFAULT   ECL_PERFECT
+#ifdef NDEBUG
+#define ECL_NOCLEAN   0x8000    /* do not clean up memory */
+#else                           /* in function eclat_mine() */
+#define ECL_NOCLEAN   0         /* in debug version */
+#endif                          /* always clean up memory */
+#define ECL_VERBOSE   INT_MIN   /* verbose message output */
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef struct _eclat           /* eclat miner */
+ECLAT;                          /* (opaque structure) */
+
+/*----------------------------------------------------------------------
+  Functions
+----------------------------------------------------------------------*/
+extern ECLAT*   eclat_create   (int target, double smin, double smax,
+                                ITEM zmin, ITEM zmax,
+                                int algo, int mode);
+extern void     eclat_delete   (ECLAT *eclat, int deldar);
+extern int      eclat_data     (ECLAT *eclat, TABAG *tabag,
+                                int mode, int sort);
+extern int      eclat_report   (ECLAT *eclat, ISREPORT *report);
+extern int      eclat_mine     (ECLAT *eclat);
+#endif
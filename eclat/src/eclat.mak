@@ -0,0 +1,121 @@
+#-----------------------------------------------------------------------
+# File    : eclat.mak
+# Contents: build eclat program (on Windows systems)
+# History : 2026.10.14 file created from apriori.mak
+#-----------------------------------------------------------------------
+THISDIR  = ..\..\eclat\src
+UTILDIR  = ..\..\util\src
+MATHDIR  = ..\..\math\src
+TRACTDIR = ..\..\tract\src
+
+CC       = cl.exe
+DEFS     = /D WIN32 /D NDEBUG /D _CONSOLE /D _CRT_SECURE_NO_WARNINGS
+CFLAGS   = /nologo /W3 /O2 /GS- $(DEFS) /c $(ADDFLAGS)
+INCS     = /I $(UTILDIR) /I $(MATHDIR) /I $(TRACTDIR)
+
+LD       = link.exe
+LDFLAGS  = /nologo /subsystem:console /incremental:no
+LIBS     = 
+
+HDRS     = $(UTILDIR)\fntypes.h    $(UTILDIR)\arrays.h    \
+           $(UTILDIR)\symtab.h     $(UTILDIR)\error.h     \
+           $(UTILDIR)\tabread.h    $(UTILDIR)\tabwrite.h  \
+           $(MATHDIR)\ruleval.h    $(TRACTDIR)\tract.h    \
+           $(TRACTDIR)\patspec.h   $(TRACTDIR)\report.h   \
+           eclat.h
+OBJS     = $(UTILDIR)\arrays.obj   $(UTILDIR)\idmap.obj   \
+           $(UTILDIR)\escape.obj   $(UTILDIR)\tabread.obj \
+           $(UTILDIR)\tabwrite.obj $(UTILDIR)\scform.obj  \
+           $(MATHDIR)\gamma.obj    $(MATHDIR)\chi2.obj    \
+           $(MATHDIR)\ruleval.obj  $(TRACTDIR)\tavert.obj \
+           $(TRACTDIR)\patspec.obj $(TRACTDIR)\report.obj
+PRGS     = eclat.exe
+
+#-----------------------------------------------------------------------
+# Build Programs
+#-----------------------------------------------------------------------
+all:          $(PRGS)
+
+eclat.exe:    $(OBJS) eclat.obj
+	$(LD) $(LDFLAGS) $(OBJS) $(LIBS) eclat.obj /out:$@
+
+#-----------------------------------------------------------------------
+# Main Programs
+#-----------------------------------------------------------------------
+eclat.obj:    $(HDRS)
+eclat.obj:    eclat.h eclat.c eclat.mak
+	$(CC) $(CFLAGS) $(INCS) /D ECL_MAIN eclat.c /Fo$@
+
+#-----------------------------------------------------------------------
+# External Modules
+#-----------------------------------------------------------------------
+$(UTILDIR)\arrays.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak arrays.obj   ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(UTILDIR)\idmap.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak idmap.obj    ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(UTILDIR)\escape.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak escape.obj   ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(UTILDIR)\tabread.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak tabread.obj  ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(UTILDIR)\tabwrite.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak tabwrite.obj ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(UTILDIR)\scform.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak scform.obj   ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(MATHDIR)\gamma.obj:
+	cd $(MATHDIR)
+	$(MAKE) /f math.mak gamma.obj    ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(MATHDIR)\chi2.obj:
+	cd $(MATHDIR)
+	$(MAKE) /f math.mak chi2.obj     ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(MATHDIR)\ruleval.obj:
+	cd $(MATHDIR)
+	$(MAKE) /f math.mak ruleval.obj  ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(TRACTDIR)\tavert.obj:
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak tavert.obj  ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(TRACTDIR)\patspec.obj:
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak patspec.obj ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+$(TRACTDIR)\report.obj:
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak report.obj  ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
+
+#-----------------------------------------------------------------------
+# Install
+#-----------------------------------------------------------------------
+install:
+	-@copy eclat.exe ..\..\..\bin
+
+#-----------------------------------------------------------------------
+# Clean up
+#-----------------------------------------------------------------------
+localclean:
+	-@erase /Q *~ *.obj *.idb *.pch $(PRGS)
+
+clean:
+	$(MAKE) /f eclat.mak localclean
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak localclean
+	cd $(MATHDIR)
+	$(MAKE) /f math.mak clean
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak clean
+	cd $(THISDIR)
@@ -4,6 +4,12 @@
   Author  : Christian Borgelt
   History : 2015.08.28 file created
             2016.11.20 fpgrowth miner object and interface introduced
+            2026.10.14 dynamic distribution of surrogates to threads
+            2026.10.14 binary transaction bag files accepted as input
+            2026.10.14 seeding per surrogate data set, shards and merging
+            2026.10.14 open addressing item map used for item base
+            2026.10.14 surrogate buffers reused instead of recreated
+            2026.10.14 chains of pair swaps over several surrogates
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -72,6 +78,12 @@
 #define WORKERDEF(n,p)  void*        n (void* p)
 #endif                          /* definition of a worker function */
 
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#define ATOMIC_INC(p)   InterlockedIncrement(p)
+#else                           /* if Linux/Unix system (gcc) */
+#define ATOMIC_INC(p)   __sync_add_and_fetch(p, 1)
+#endif                          /* atomic increment (returns new value) */
+
 /* --- error codes --- */
 /* error codes   0 to  -4 defined in tract.h */
 #define E_STDIN      (-5)       /* double assignment of stdin */
@@ -87,6 +99,7 @@
 /* error codes -15 to -26 defined in tract.h and train.h */
 #define E_NOTABLE   (-27)       /* transaction bag is not a table */
 #define E_ABORTED   (-28)       /* processing aborted by user */
+#define E_SHARD     (-29)       /* invalid shard of surrogates */
 
 #ifndef QUIET                   /* if not quiet version, */
 #define MSG         fprintf     /* print messages */
@@ -126,7 +139,8 @@ static const char *errmsgs[] = {
   /*    -22 to -26 */  NULL, NULL, NULL, NULL, NULL,
   /* E_NOTABLE -27 */  "transactions are not table-derived",
   /* E_ABORTED -28 */  "processing aborted by user",
-  /*           -28 */  "unknown error"
+  /* E_SHARD   -29 */  "invalid shard %ld of %ld shard(s)",
+  /*           -30 */  "unknown error"
 };
 #endif
 
@@ -139,10 +153,14 @@ typedef struct {                /* --- thread worker data --- */
   TABAG     *tabag;             /* transaction bag to analyze */
   TABAG     *tasur;             /* buffer for surrogate data set */
   TBGSURRFN *surrfn;            /* surrogate data generator function */
+  int       copy;               /* whether to copy data for surrfn */
   long      cnt;                /* number of surrogate data sets */
-  RNG       *rng;               /* random number generator */
+  long      beg;                /* index of first surrogate data set */
+  long      chn;                /* number of data sets per chain */
+  long      seed;               /* seed for random numbers */
   ISREPORT  *report;            /* item set reporter (one per thread) */
   int       err;                /* error indicator */
+  volatile long *next;          /* number of started   chains */
   volatile long *done;          /* number of completed data sets */
   PRGREPFN  *repfn;             /* progress reporting function */
   void      *data;              /* progress reporting function data */
@@ -204,52 +222,109 @@ static int cpucnt (void)
 static WORKERDEF(worker, p)
 {                               /* --- worker function for a thread */
   WORKDATA *w = p;              /* type the argument pointer */
-  long     i;                   /* loop variable for data sets */
+  long     i, k, n;             /* indices of data sets and chains */
+  long     end, m;              /* end of data sets, number of chains */
+  RNG      *rng;                /* random number generator */
+  TABAG    *tasur;              /* generated surrogate data set */
 
   assert(p);                    /* check the function argument */
-  for (i = 1; i <= w->cnt; i++){/* generate cnt surrogate data sets */
-    w->tasur = w->surrfn(w->tabag, w->rng, w->tasur);
-    #ifdef FPG_ABORT            /* if a signal handler is present */
-    if (sig_aborted()) break;   /* check for an abort interrupt */
-    #endif
-    w->err |= fpg_data(w->fpgrowth, w->tasur, FPG_SURR, 0);
-    if (w->err < 0)    break;   /* prepare the transactions */
-    #ifdef FPG_ABORT            /* if a signal handler is present */
-    if (sig_aborted()) break;   /* check for an abort interrupt */
-    #endif
-    w->err |= fpg_mine(w->fpgrowth, ITEM_MIN, 0);
-    if (w->err < 0)    break;   /* execute the fpgrowth algorithm */
+  end = w->beg +w->cnt;         /* get the end of the data sets */
+  m   = (end-1)/w->chn -w->beg/w->chn +1;   /* and number of chains */
+  while ((k = ATOMIC_INC(w->next)) <= m) {
+    i = (w->beg/w->chn +k-1) *w->chn;  /* get the data sets */
+    n = i +w->chn;              /* of the chain and */
+    if (i < w->beg) i = w->beg; /* limit them to the shard */
+    if (n > end)    n = end;
+    rng = rng_create((unsigned int)(w->seed +i));
+    if (!rng) { w->err = -1; break; }
+    if (w->tasur && !tbg_reuse(w->tasur, w->tabag, w->copy)) {
+      tbg_delete(w->tasur, 0); w->tasur = NULL; }
+    for ( ; i < n; i++) {       /* traverse the data sets of chain */
+      tasur = w->surrfn(w->tabag, rng, w->tasur);
+      if (!tasur) { w->err = -1; break; }
+      w->tasur = tasur;         /* generate a surrogate data set */
+      #ifdef FPG_ABORT          /* (reuse the buffer if possible) */
+      if (sig_aborted()) break; /* check for an abort interrupt */
+      #endif
+      w->err |= fpg_data(w->fpgrowth, w->tasur, FPG_SURR, 0);
+      if (w->err < 0)    break; /* prepare the transactions */
+      #ifdef FPG_ABORT          /* if a signal handler is present */
+      if (sig_aborted()) break; /* check for an abort interrupt */
+      #endif
+      w->err |= fpg_mine(w->fpgrowth, ITEM_MIN, 0);
+      if (w->err < 0)    break; /* execute the fpgrowth algorithm */
+      #ifdef FPG_ABORT          /* if a signal handler is present */
+      if (sig_aborted()) break; /* check for an abort interrupt */
+      #endif
+      k = ATOMIC_INC(w->done);  /* count the surrogate data set */
+      if (w->repfn) w->repfn(k, w->data);
+    }                           /* report the progress */
+    rng_delete(rng);            /* delete the random number generator */
+    if (w->err < 0) break;      /* check for an error */
     #ifdef FPG_ABORT            /* if a signal handler is present */
     if (sig_aborted()) break;   /* check for an abort interrupt */
     #endif
-    w->done[0]++;               /* count the surrogate data set */
-    if (w->repfn) w->repfn(w->done[0], w->data);
-  }                             /* report the progress */
-  return THREAD_OK;             /* return a dummy result */
+  }
+  if (w->err < 0) *w->next = w->cnt;
+  return THREAD_OK;             /* on error stop the other threads */
 }  /* worker() */
 
+/* Instead of assigning a fixed number of surrogate data sets to    */
+/* each thread, the threads draw chains of data sets from a shared  */
+/* counter until all chains have been started. Hence no thread      */
+/* idles while others still work on a larger share of the data      */
+/* sets, which may differ considerably in the time they need. A     */
+/* chain consists of a single data set for all surrogate methods    */
+/* except pair swaps, for which it consists of FPG_SWAPCHN data     */
+/* sets: tbg_swap() starts from the original data with a burn-in of */
+/* 2*extent swaps and then continues the Markov chain with extent/2 */
+/* swaps for each further data set of the chain. Restarting from    */
+/* the original data for every data set would need about four times */
+/* as many swaps, while a single chain per thread would make the    */
+/* result depend on the number of threads. Each chain is generated  */
+/* with a random number generator that is seeded with the seed plus */
+/* the index of its first data set. Chains start at multiples of    */
+/* the chain length (and at the first data set beg). Hence the      */
+/* result does not depend on the number of threads or on which      */
+/* thread processes a chain, and the data sets can be split into    */
+/* shards (given by the index beg of the first data set), for       */
+/* example, to distribute the work over several machines: if the    */
+/* shard boundaries are multiples of the chain length (as fpgpsp    */
+/* chooses them), the sum of the spectra of the shards is identical */
+/* to the spectrum of a single run. Each thread generates its       */
+/* surrogate data sets into one buffer, which tbg_reuse() resets to */
+/* a clone of the original data at the start of each chain, so that */
+/* the transactions are not allocated anew every time, but the      */
+/* surrogate is still the same as one generated into a new clone    */
+/* (which keeps the result independent of the threads). In the same */
+/* way the fpgrowth miner keeps the memory system of its tree and   */
+/* the item set reporter (with the pattern spectrum) from one data  */
+/* set to the next.                                                 */
+
 /*--------------------------------------------------------------------*/
 
 PATSPEC* fpg_genpsp (TABAG *tabag, int target, double supp,
                      ITEM zmin, ITEM zmax, int algo, int mode,
-                     size_t cnt, int surr, long seed,
+                     size_t cnt, size_t beg, int surr, long seed,
                      int cpus, PRGREPFN *rep, void* data)
 {                               /* --- generate a pattern spectrum */
   PATSPEC   *psp = NULL;        /* created pattern spectrum */
   int       r;                  /* result of function call */
-  TABAG     *tasur, *s;         /* surrogate data set */
+  TABAG     *tasur, *x;         /* surrogate data set */
   TBGSURRFN *surrfn;            /* surrogate data generation function */
+  int       copy;               /* whether to copy data for surrfn */
+  long      chn;                /* number of data sets per chain */
   RNG       *rng;               /* random number generator */
   ISREPORT  *report;            /* item set reporter */
   FPGROWTH  *fpgrowth;          /* fpgrowth miner */
   THREAD    *threads;           /* thread handles */
   WORKDATA  *w;                 /* data for worker thread */
-  long      c, x;               /* number of data sets per thread */
   long      i;                  /* loop variable for data sets */
   int       k, n;               /* loop variables for threads */
   #ifdef _WIN32                 /* if Microsoft Windows system */
   DWORD     thid;               /* dummy for storing the thread id */
   #endif                        /* (not really needed here) */
+  volatile long next = 0;       /* number of started   surrogates */
   volatile long done = 0;       /* number of completed surrogates */
 
   assert(tabag                  /* check the function arguments */
@@ -265,16 +340,17 @@ PATSPEC* fpg_genpsp (TABAG *tabag, int target, double supp,
   if (r) { fpg_delete(fpgrowth, 0); return NULL; }  /* transactions */
 
   /* --- generate pattern spectrum --- */
+  chn = (surr == FPG_SWAP) ? FPG_SWAPCHN : 1;
+  i   = (long)(beg+cnt-1)/chn -(long)beg/chn +1;
   if (cpus <= 0) cpus = cpucnt();
-  if ((cpus > 1) && (cnt > 1)){ /* if to use multi-threading */
+  if ((cpus > 1) && (i > 1)) {  /* if to use multi-threading */
     threads = calloc((size_t)cpus, sizeof(THREAD));
     if (!threads) return NULL;  /* create array of thread handles */
     w = calloc((size_t)cpus, sizeof(WORKDATA));
     if (!w) { free(threads); return NULL; }
-    c = ((long)cnt+cpus-1)/cpus;/* number of data sets per thread */
+    if ((long)cpus > i)         /* do not create more threads */
+      cpus = (int)i;            /* than there are chains */
     for (n = 0; n < cpus; n++){ /* traverse the cpus/threads */
-      x = (long)cnt -n*c;       /* get the number of data sets and */
-      if (x <= 0) break;        /* check whether thread is needed */
       if (!fpgrowth) {          /* if no miner for this thread */
         fpgrowth = fpg_create(target, supp, 100.0, 100.0, zmin, zmax,
                               RE_NONE, FPG_NONE, 0.0, algo, mode);
@@ -284,14 +360,18 @@ PATSPEC* fpg_genpsp (TABAG *tabag, int target, double supp,
       w[n].tabag    = tabag;    /* note transactions and a clone */
       w[n].tasur    = tbg_clone(tabag);
       w[n].surrfn   = sur_tab[surr];
-      w[n].cnt      = (x < c) ? x : c;
-      w[n].rng      = rng_create((unsigned int)(seed+n));
+      w[n].copy     = (surr == FPG_IDENTITY) || (surr == FPG_SWAP);
+      w[n].cnt      = (long)cnt;
+      w[n].beg      = (long)beg;
+      w[n].chn      = chn;      /* note the chain length */
+      w[n].seed     = seed;     /* note the seed for random numbers */
       w[n].report   = isr_create(tbg_base(tabag));
-      w[n].err      = 0;        /* create random number generator */
-      w[n].done     = &done;    /* and an item set reporter */
+      w[n].err      = 0;        /* create an item set reporter */
+      w[n].next     = &next;
+      w[n].done     = &done;
       w[n].repfn    = rep;
       w[n].data     = data;
-      if (!w[n].fpgrowth || !w[n].tasur || !w[n].rng || !w[n].report) {
+      if (!w[n].fpgrowth || !w[n].tasur || !w[n].report) {
         w[n].err = -1; break; } /* check for successful creation */
       if ((fpg_data  (w[n].fpgrowth, w[n].tasur,
                       FPG_NORECODE|FPG_NOREDUCE, 0) != 0)
@@ -328,7 +408,6 @@ PATSPEC* fpg_genpsp (TABAG *tabag, int target, double supp,
     for (k = n; --k >= 0; ) {   /* traverse the worker data */
       if (w[k].fpgrowth) fpg_delete(w[k].fpgrowth, 0);
       if (w[k].tasur)    tbg_delete(w[k].tasur, 0);
-      if (w[k].rng)      rng_delete(w[k].rng);
       if (w[k].report)   isr_delete(w[k].report, 0);
     }                           /* delete the data structures */
     free(w);                    /* delete array of worker data */
@@ -340,28 +419,35 @@ PATSPEC* fpg_genpsp (TABAG *tabag, int target, double supp,
     ||  (isr_addpsp(report, NULL)     < 0)
     ||  (isr_setup (report) != 0)) {
       isr_delete(report, 0); fpg_delete(fpgrowth, 0); return NULL; }
-    rng = rng_create((unsigned int)seed);
-    if (!rng) {                 /* create a random number generator */
-      isr_delete(report, 0); return NULL; }
     surrfn = sur_tab[surr];     /* get the surrogate data function */
+    copy   = (surr == FPG_IDENTITY) || (surr == FPG_SWAP);
     tasur  = NULL; r = 0;       /* init. surrogate and return code */
-    for (i = 1; i <= (long)cnt; i++) {
-      s = surrfn(tabag, rng, tasur);
-      if (!s) { r = -1; break;} /* generate a surrogate data set */
-      r = fpg_data(fpgrowth, tasur = s, FPG_SURR, 0);
+    rng    = NULL;              /* and random number generator */
+    for (i = (long)beg; i < (long)(beg+cnt); i++) {
+      if ((i % chn == 0) || (i == (long)beg)) { /* if new chain */
+        if (rng) rng_delete(rng);
+        rng = rng_create((unsigned int)(seed +i));
+        if (!rng) { r = -1; break; }
+        if (tasur && !tbg_reuse(tasur, tabag, copy)) {
+          tbg_delete(tasur, 0); tasur = NULL; }
+      }                         /* (restart from the original data) */
+      x = surrfn(tabag, rng, tasur);
+      if (!x) { r = -1; break; }/* generate a surrogate data set */
+      tasur = x;                /* (reuse the buffer if possible) */
+      r = fpg_data(fpgrowth, tasur, FPG_SURR, 0);
       if (r < 0) break;         /* prepare the data set */
       r = fpg_mine(fpgrowth, 0, 0);
       if (r < 0) break;         /* execute the FP-growth algorithm */
-      if (rep) rep(i, data);    /* report the progress and */
+      if (rep) rep(i-(long)beg+1, data);  /* report the progress */
       #ifdef CCN_ABORT          /* if a signal handler is present */
       if (sig_aborted()) break; /* check for an interrupt */
       #endif
     }
+    if (rng) rng_delete(rng);   /* delete the random number generator */
     psp = isr_rempsp(report,0); /* get the created pattern spectrum */
     if (tasur) tbg_delete(tasur, 0);
     fpg_delete(fpgrowth, 0);    /* delete the data objects */
-    rng_delete(rng);            /* (fpgrowth miner, */
-    isr_delete(report, 0);      /* random number generator, */
+    isr_delete(report, 0);      /* (fpgrowth miner */
   }                             /* and item set reporter) */
 
   /* --- clean up --- */
@@ -463,7 +549,7 @@ GENERROR(error, exit)           /* generic error reporting function */
 
 int main (int argc, char *argv[])
 {                               /* --- main function */
-  int     i, k = 0;             /* loop variables, counters */
+  int     i, k = 0, r;          /* loop variables, counters */
   char    *s;                   /* to traverse the options */
   CCHAR   **optarg = NULL;      /* option argument */
   CCHAR   *fn_inp  = NULL;      /* name of input  file */
@@ -487,6 +573,14 @@ int main (int argc, char *argv[])
   double  alpha    = 0.5;       /* probability dispersion factor */
   long    smpls    = 1000;      /* number of item set samples */
   long    seed     = 0;         /* seed for random numbers */
+  long    shard    = 0;         /* index of shard to generate */
+  long    shards   = 1;         /* number of shards of surrogates */
+  size_t  beg      = 0;         /* index of first surrogate data set */
+  size_t  end;                  /* index after last surrogate data set */
+  long    chn;                  /* number of data sets per chain */
+  size_t  tot      = 0;         /* number of data sets (merging) */
+  int     binary   = 0;         /* flag for binary spectrum output */
+  int     merge    = 0;         /* flag for merging pattern spectra */
   int     cpus     = 0;         /* number of cpus to use */
   long    done     = 0;         /* number of completed data sets */
   int     decbdr   = 0;         /* flag for printing the border */
@@ -544,11 +638,19 @@ int main (int argc, char *argv[])
                     "(default: %ld)\n", smpls);
     printf("-S#      seed for random numbers                  "
                     "(default: time)\n");
+    printf("-k#      index of the shard to generate (0-based) "
+                    "(default: %ld)\n", shard);
+    printf("-K#      number of shards of the surrogates       "
+                    "(default: %ld)\n", shards);
+    printf("         (all shards need the same seed, option -S#)\n");
     printf("-Z#      number of cpus/processor cores to use    "
                     "(default: %d)\n", cpus);
     printf("         (a value <= 0 means all cpus "
                     "reported as available)\n");
     printf("-D       print induced decision border\n");
+    printf("-B       write pattern spectrum as a binary file\n");
+    printf("-M       merge binary pattern spectrum files\n");
+    printf("         (all arguments except the last are input files)\n");
     printf("-R#      read an item selection from a file       "
                     "(default: use all items)\n");
     printf("-r#      record/transaction separators            "
@@ -591,8 +693,12 @@ int main (int argc, char *argv[])
           case 'e': alpha  =       strtod(s, &s);    break;
           case 'z': smpls  =       strtol(s, &s, 0); break;
           case 'S': seed   =       strtol(s, &s, 0); break;
+          case 'k': shard  =       strtol(s, &s, 0); break;
+          case 'K': shards =       strtol(s, &s, 0); break;
           case 'Z': cpus   =  (int)strtol(s, &s, 0); break;
           case 'D': decbdr = -1;                     break;
+          case 'B': binary = -1;                     break;
+          case 'M': merge  = -1;                     break;
           case 'R': optarg = &fn_sel;                break;
           case 'r': optarg = &recseps;               break;
           case 'f': optarg = &fldseps;               break;
@@ -602,16 +708,14 @@ int main (int argc, char *argv[])
         }                       /* set option variables */
         if (optarg && *s) { *optarg = s; optarg = NULL; break; }
       } }                       /* get option argument */
-    else {                      /* -- if argument is no option */
-      switch (k++) {            /* evaluate non-options */
-        case  0: fn_inp = s;      break;
-        case  1: fn_psp = s;      break;
-        default: error(E_ARGCNT); break;
-      }                         /* note filenames */
-    }
-  }
+    else                        /* -- if argument is no option */
+      argv[++k] = s;            /* collect the file names */
+  }                             /* (at the front of the vector) */
   if (optarg) error(E_OPTARG);  /* check (option) arguments */
-  if (k < 2)  error(E_ARGCNT);  /* and number of arguments */
+  if ((k < 2) || (!merge && (k > 2)))
+    error(E_ARGCNT);            /* check the number of arguments */
+  fn_inp = argv[1];             /* and get the names of the */
+  fn_psp = argv[k];             /* input and output files */
   if (zmin < 0)   error(E_SIZE, zmin); /* check the size limits */
   if (zmax < 0)   error(E_SIZE, zmax); /* and the minimum support */
   if (supp > 100) error(E_SUPPORT, supp);
@@ -641,83 +745,117 @@ int main (int argc, char *argv[])
     default : error(E_SURR, (char)surr);     break;
   }                             /* (get surrogate method code) */
   if (surr == FPG_IDENTITY) cnt = 1;
+  chn = (surr == FPG_SWAP) ? FPG_SWAPCHN : 1;
+  if ((shards <= 0) || (shard < 0) || (shard >= shards)
+  ||  ((shards > 1) && ((surr < 0) || (shards > cnt/chn))))
+    error(E_SHARD, shard, shards);
+  beg = (size_t) shard    *(size_t)cnt /(size_t)shards /(size_t)chn;
+  end = (size_t)(shard+1) *(size_t)cnt /(size_t)shards /(size_t)chn;
+  beg *= (size_t)chn;           /* compute the shard boundaries */
+  end  = (shard+1 < shards) ? end *(size_t)chn : (size_t)cnt;
+  cnt  = (long)(end -beg);      /* (align them to chains of swaps) */
   MSG(stderr, "\n");            /* terminate the startup message */
 
-  /* --- read item selection/appearance indicators --- */
-  ibase = ib_create(0, 0);      /* create an item base */
-  if (!ibase) error(E_NOMEM);   /* to manage the items */
-  tread = trd_create();         /* create a transaction reader */
-  if (!tread) error(E_NOMEM);   /* and configure the characters */
-  trd_allchs(tread, recseps, fldseps, blanks, "", comment);
-  if (fn_sel) {                 /* if an item selection is given */
+  if (merge) {                  /* if to merge pattern spectra */
+    /* --- load and merge pattern spectra --- */
+    for (i = 1; i < k; i++) {   /* traverse the input files */
+      CLOCK(t);                 /* start timer, print log message */
+      MSG(stderr, "loading %s ... ", argv[i]);
+      r = psp_load(&psp, argv[i], &tot);
+      if (r < 0) error(r, argv[i]);
+      MSG(stderr, "[%"SIZE_FMT" signature(s)]", psp_sigcnt(psp));
+      MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+    }                           /* load and sum the spectra */
+    cnt = (long)tot;            /* get the number of data sets */
+    z   = psp_sigcnt(psp); }    /* and the number of signatures */
+  else {                        /* if to generate a pattern spectrum */
+    /* --- read item selection/appearance indicators --- */
+    ibase = ib_create(IB_OPENADR, 0);  /* create an item base */
+    if (!ibase) error(E_NOMEM); /* to manage the items */
+    tread = trd_create();       /* create a transaction reader */
+    if (!tread) error(E_NOMEM); /* and configure the characters */
+    trd_allchs(tread, recseps, fldseps, blanks, "", comment);
+    if (fn_sel) {               /* if an item selection is given */
+      CLOCK(t);                 /* start timer, open input file */
+      if (trd_open(tread, NULL, fn_sel) != 0)
+        error(E_FOPEN, trd_name(tread));
+      MSG(stderr, "reading %s ... ", trd_name(tread));
+      m = (target == ISR_RULES) /* read the item appearances */
+        ? ib_readapp(ibase, tread) : ib_readsel(ibase, tread);
+      if (m < 0) error((int)-m, ib_errmsg(ibase, NULL, 0));
+      trd_close(tread);         /* close the input file */
+      MSG(stderr, "[%"ITEM_FMT" item(s)]", ib_cnt(ibase));
+      MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+    }                           /* print a log message */
+
+    /* --- read transaction database --- */
+    tabag = tbg_create(ibase);  /* create a transaction bag */
+    if (!tabag) error(E_NOMEM); /* to store the transactions */
     CLOCK(t);                   /* start timer, open input file */
-    if (trd_open(tread, NULL, fn_sel) != 0)
-      error(E_FOPEN, trd_name(tread));
-    MSG(stderr, "reading %s ... ", trd_name(tread));
-    m = (target == ISR_RULES)   /* depending on the target type */
-      ? ib_readapp(ibase,tread) /* read the item appearances */
-      : ib_readsel(ibase,tread);/* or a simple item selection */
-    if (m < 0) error((int)-m, ib_errmsg(ibase, NULL, 0));
-    trd_close(tread);           /* close the input file */
-    MSG(stderr, "[%"ITEM_FMT" item(s)]", ib_cnt(ibase));
+    if (tbg_isbin(fn_inp)) {    /* if a binary transaction bag file */
+      MSG(stderr, "loading %s ... ", fn_inp);
+      k = tbg_load(tabag, fn_inp);
+      if (k < 0) error(k, fn_inp); }
+    else {                      /* if a transaction text file */
+      if (trd_open(tread, NULL, fn_inp) != 0)
+        error(E_FOPEN, trd_name(tread));
+      MSG(stderr, "reading %s ... ", trd_name(tread));
+      k = tbg_read(tabag, tread, mtar);
+      if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+    }                           /* read the transaction database */
+    trd_delete(tread, 1);       /* read the transaction database, */
+    tread = NULL;               /* then delete the table reader */
+    m = ib_cnt(ibase);          /* get the number of items, */
+    n = tbg_cnt(tabag);         /* the number of transactions, */
+    w = tbg_wgt(tabag);         /* the total transaction weight */
+    MSG(stderr, "[%"ITEM_FMT" item(s), %"TID_FMT, m, n);
+    if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
+    MSG(stderr, " transaction(s)] done [%.2fs].", SEC_SINCE(t));
+    if ((m <= 0) || (n <= 0))   /* check for at least one item */
+      error(E_NOITEMS);         /* and at least one transaction */
+    if ((surr == FPG_SHUFFLE) && !tbg_istab(tabag))
+      error(E_NOTABLE);         /* check for tabular data */
+    MSG(stderr, "\n");          /* terminate the log message */
+
+    /* --- estimate/generate pattern spectrum --- */
+    CLOCK(t);                   /* start timer, print log message */
+    if (surr < 0) {             /* if to estimate a pattern spectrum */
+      MSG(stderr, "estimating pattern spectrum ... ");
+      psp = fpg_estpsp(tabag, target, supp, zmin, zmax,
+                       (size_t)cnt, alpha, (size_t)smpls, seed); }
+    else {                      /* if to generate a pattern spectrum */
+      MSG(stderr, "generating pattern spectrum ... ");
+      psp = fpg_genpsp(tabag, target, supp, zmin, zmax,
+                       algo, mode, (size_t)cnt, beg, surr, seed,
+                       cpus, repfn, &done);
+    }                           /* (create a pattern spectrum) */
+    #ifdef FPG_ABORT            /* if a signal handler is present */
+    if (!psp) error((sig_aborted()) ? E_ABORTED : E_NOMEM);
+    #else                       /* check for abort or error */
+    if (!psp) error(E_NOMEM);   /* if no signal handler is present */
+    #endif                      /* it must be out of memory */
+    z = psp_sigcnt(psp);        /* get the number of signatures */
+    MSG(stderr, "[%"SIZE_FMT" signature(s)]", z);
     MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
-  }                             /* print a log message */
-
-  /* --- read transaction database --- */
-  tabag = tbg_create(ibase);    /* create a transaction bag */
-  if (!tabag) error(E_NOMEM);   /* to store the transactions */
-  CLOCK(t);                     /* start timer, open input file */
-  if (trd_open(tread, NULL, fn_inp) != 0)
-    error(E_FOPEN, trd_name(tread));
-  MSG(stderr, "reading %s ... ", trd_name(tread));
-  k = tbg_read(tabag, tread, mtar);
-  if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
-  trd_delete(tread, 1);         /* read the transaction database, */
-  tread = NULL;                 /* then delete the table reader */
-  m = ib_cnt(ibase);            /* get the number of items, */
-  n = tbg_cnt(tabag);           /* the number of transactions, */
-  w = tbg_wgt(tabag);           /* the total transaction weight */
-  MSG(stderr, "[%"ITEM_FMT" item(s), %"TID_FMT, m, n);
-  if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
-  MSG(stderr, " transaction(s)] done [%.2fs].", SEC_SINCE(t));
-  if ((m <= 0) || (n <= 0))     /* check for at least one item */
-    error(E_NOITEMS);           /* and at least one transaction */
-  if ((surr == FPG_SHUFFLE) && !tbg_istab(tabag))
-    error(E_NOTABLE);           /* check for tabular data */
-  MSG(stderr, "\n");            /* terminate the log message */
-
-  /* --- estimate/generate pattern spectrum --- */
-  CLOCK(t);                     /* start timer, print log message */
-  if (surr < 0) {               /* if to estimate a pattern spectrum */
-    MSG(stderr, "estimating pattern spectrum ... ");
-    psp = fpg_estpsp(tabag, target, supp, zmin, zmax,
-                     (size_t)cnt, alpha, (size_t)smpls, seed); }
-  else {                        /* if to generate a pattern spectrum */
-    MSG(stderr, "generating pattern spectrum ... ");
-    psp = fpg_genpsp(tabag, target, supp, zmin, zmax,
-                     algo, mode, (size_t)cnt, surr, seed,
-                     cpus, repfn, &done);
-  }                             /* (create a pattern spectrum) */
-  #ifdef FPG_ABORT              /* if a signal handler is present */
-  if (!psp) error((sig_aborted()) ? E_ABORTED : E_NOMEM);
-  #else                         /* check for abort or error */
-  if (!psp) error(E_NOMEM);     /* if no signal handler is present */
-  #endif                        /* it must be out of memory */
-  z = psp_sigcnt(psp);          /* get the number of signatures */
-  MSG(stderr, "[%"SIZE_FMT" signature(s)]", z);
-  MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }
 
   /* --- write pattern spectrum --- */
   CLOCK(t);                     /* start timer, print log message */
-  twrite = twr_create();        /* create a table writer and */
-  if (!twrite) error(E_NOMEM);  /* open the output file */
-  if (twr_open(twrite, NULL, fn_psp) != 0)
-    error(E_FOPEN,  twr_name(twrite));
-  MSG(stderr, "writing %s ... ", twr_name(twrite));
-  if (psp_report(psp, twrite, 1.0/(double)cnt) != 0)
-    error(E_FWRITE, twr_name(twrite));
-  twr_delete(twrite, 1);        /* write the pattern spectrum */
-  twrite = NULL;                /* and delete the table writer */
+  if (binary) {                 /* if to write a binary file */
+    MSG(stderr, "writing %s ... ", fn_psp);
+    r = psp_save(psp, fn_psp, (size_t)cnt);
+    if (r < 0) error(r, fn_psp); }
+  else {                        /* if to write a text file */
+    twrite = twr_create();      /* create a table writer and */
+    if (!twrite) error(E_NOMEM);/* open the output file */
+    if (twr_open(twrite, NULL, fn_psp) != 0)
+      error(E_FOPEN,  twr_name(twrite));
+    MSG(stderr, "writing %s ... ", twr_name(twrite));
+    if (psp_report(psp, twrite, 1.0/(double)cnt) != 0)
+      error(E_FWRITE, twr_name(twrite));
+    twr_delete(twrite, 1);      /* write the pattern spectrum */
+    twrite = NULL;              /* and delete the table writer */
+  }
   MSG(stderr, "[%"SIZE_FMT" signature(s)]", z);
   MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
 
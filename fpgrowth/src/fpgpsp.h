@@ -3,6 +3,8 @@
   Contents: generate or estimate a pattern spectrum (FP-growth)
   Author  : Christian Borgelt
   History : 2015.08.28 file created
+            2026.10.14 index of first surrogate data set added
+            2026.10.14 chain length of pair swaps added (FPG_SWAPCHN)
 ----------------------------------------------------------------------*/
 #ifndef __FPGPSP__
 #define __FPGPSP__
@@ -17,6 +19,8 @@
 #define FPG_SWAP        2       /* permutation by pair swaps */
 #define FPG_SHUFFLE     3       /* shuffle table-derived data */
 
+#define FPG_SWAPCHN    16       /* data sets per chain of pair swaps */
+
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
@@ -28,7 +32,7 @@ typedef void PRGREPFN (long cnt, void *data);
 ----------------------------------------------------------------------*/
 extern PATSPEC* fpg_genpsp (TABAG *tabag, int target, double supp,
                             ITEM zmin, ITEM zmax, int algo, int mode,
-                            size_t cnt, int surr, long seed,
+                            size_t cnt, size_t beg, int surr, long seed,
                             int cpus, PRGREPFN *rep, void* data);
 
 extern PATSPEC* fpg_estpsp (TABAG *tabag, int target, double supp,
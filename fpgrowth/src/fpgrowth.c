@@ -66,6 +66,24 @@
             2016.09.26 head union tail (HUT) pruning fixed (bug, fim16)
             2016.11.20 fpgrowth miner object and interface introduced
             2017.05.30 optional output compression with zlib added
+            2026.10.14 parallel processing of the top level added
+            2026.10.14 binary transaction bag files accepted as input
+            2026.10.14 32/64-items machine for complex trees added
+            2026.10.14 binary output added (option -B#)
+            2026.10.14 asynchronous output added (option -O)
+            2026.10.14 memory budget with disk projections added (-M#)
+            2026.10.14 benchmark records added (option -J#)
+            2026.10.14 automatic choice of the variant (option -Aa)
+            2026.10.14 top-k item sets with rising support (option -K#)
+            2026.10.14 radix sort of items and transactions used
+            2026.10.14 collapsing of duplicates while reading (-D)
+            2026.10.14 compressed transactions in memory (option -X)
+            2026.10.14 open addressing item map used for item base
+            2026.10.14 search statistics added (function fpg_stats())
+            2026.10.14 time and node budgets added (options -L# and -Q#)
+            2026.10.14 memory system of the initial tree kept for reuse
+            2026.10.14 header tables of projections kept per depth
+            2026.10.14 item set index for queries added (option -E#)
 ------------------------------------------------------------------------
   Reference for the FP-growth algorithm:
     J. Han, H. Pei, and Y. Yin.
@@ -89,6 +107,12 @@
 #include <math.h>
 #include <time.h>
 #include <assert.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
 #include "memsys.h"
 #ifndef ISR_PATSPEC
 #define ISR_PATSPEC
@@ -109,7 +133,9 @@
 #endif
 #include "fpgrowth.h"
 #include "fim16.h"
+#include "fim64.h"
 #ifdef FPG_MAIN
+#include "isridx.h"
 #include "error.h"
 #endif
 #ifdef STORAGE
@@ -138,9 +164,25 @@
 #define E_MEASURE   (-13)       /* invalid evaluation measure */
 #define E_AGGMODE   (-14)       /* invalid aggregation mode */
 #define E_VARIANT   (-16)       /* invalid algorithm variant */
+#define E_INDEX     (-17)       /* item set index not possible */
 /* error codes -15 to -25 defined in tract.h */
 
 #define COPYERR     ((TDNODE*)-1)
+#define SPILLMAX    256         /* max. number of spill files/pass */
+#define PRECEDES(f,j,i) (((f)[j] > (f)[i]) \
+                     || (((f)[j] == (f)[i]) && ((j) < (i))))
+#define AUTO_DENSE  0.10        /* min. density for 16-items machine */
+
+#define BELOW(f,s)  ((f)->topk && ((s) < \
+                     ((f)->supp = (SUPP)isr_smin((f)->report))))
+#define AUTO_SHARE  0.50        /* min. node ratio for top-down */
+
+#define RECURSE(f,r,n,c) do { if (!(f)->stats) r = (c); else { \
+                      double t_ = sts_beg((f)->stats, n); \
+                      r = (c); sts_end((f)->stats, t_); } } while (0)
+
+#define TMCHECK     1023        /* mask for checking the time budget */
+#define OVER(f)     ((((f)->nmax > 0) || ((f)->tend > 0)) && over(f))
 
 #ifndef QUIET                   /* if not quiet version, */
 #define MSG         fprintf     /* print messages */
@@ -154,6 +196,17 @@
 
 #define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
 
+/* --- thread definitions --- */
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#define THREAD       HANDLE     /* threads identified by handles */
+#define THREAD_OK    0          /* return value is DWORD */
+#define WORKERDEF(n,p)  DWORD WINAPI n (LPVOID p)
+#else                           /* if Linux/Unix system */
+#define THREAD       pthread_t  /* use the POSIX thread type */
+#define THREAD_OK    NULL       /* return value is void* */
+#define WORKERDEF(n,p)  void*        n (void* p)
+#endif                          /* definition of a worker function */
+
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
@@ -215,6 +268,11 @@ typedef struct {                /* --- top-down freq. pat. tree --- */
   ITEM     items[1];            /* item identifier map */
 } TDTREE;                       /* (top-down tree) */
 
+typedef struct {                /* --- projection buffer --- */
+  size_t   size;                /* size of the buffer (in bytes) */
+  void     *buf;                /* buffer for a projected tree */
+} PRJBUF;                       /* (projection buffer) */
+
 struct _fpgrowth {              /* --- fpgrowth miner --- */
   int      target;              /* target type (e.g. closed/maximal) */
   double   smin;                /* minimum support of an item set */
@@ -236,7 +294,24 @@ struct _fpgrowth {              /* --- fpgrowth miner --- */
   ITEM     *map;                /* item identifier map */
   SUPP     *cis;                /* conditional item support */
   FIM16    *fim16;              /* 16-items machine */
+  FIM64    *fim64;              /* 32/64-items machine */
   ISTREE   *istree;             /* item set tree for fpg_tree() */
+  int      cpus;                /* number of threads for mining */
+  size_t   mmax;                /* memory budget for the fp-tree */
+  BENCHREC *bench;              /* benchmark record (phase times) */
+  size_t   nodes;               /* number of nodes of initial trees */
+  size_t   topk;                /* number of best item sets (0: all) */
+  FPGSTATS *stats;              /* search statistics (NULL: none) */
+  double   tmax;                /* time budget in seconds (0: none) */
+  size_t   nmax;                /* budget of search nodes (0: none) */
+  double   tend;                /* deadline of the search (wall time) */
+  size_t   ncnt;                /* number of checked search nodes */
+  int      stop;                /* whether the budget is exhausted */
+  SUPP     miss;                /* max. support of unreported sets */
+  MEMSYS   *mem;                /* memory system kept for reuse */
+  size_t   msize;               /* node size of this memory system */
+  PRJBUF   *prjs;               /* projection buffers (per depth) */
+  ITEM     prjn;                /* number of projection buffers */
   #ifdef VISITED                /* if to report visited search nodes */
   size_t   visited;             /* number of visited search nodes */
   #endif                        /* (rough search complexity measure) */
@@ -244,6 +319,16 @@ struct _fpgrowth {              /* --- fpgrowth miner --- */
 
 typedef int FPGFN (FPGROWTH *fpg);
 
+typedef struct {                /* --- thread worker data --- */
+  FPGROWTH fpg;                 /* private copy of fpgrowth miner */
+  CSTREE   *tree;               /* shared frequent pattern tree */
+  ITEM     *items;              /* top level items to process */
+  ITEM     cnt;                 /* number of top level items */
+  double   load;                /* estimated processing cost */
+  int      err;                 /* error indicator */
+  FPGSTATS stats;               /* private search statistics */
+} WORKDATA;                     /* (thread worker data) */
+
 /*----------------------------------------------------------------------
   Constants
 ----------------------------------------------------------------------*/
@@ -267,7 +352,8 @@ static const char *errmsgs[] = {
   /* E_AGGMODE -14 */  "invalid aggregation mode '%c'",
   /* E_NOITEMS -15 */  "no (frequent) items found",
   /* E_VARIANT -16 */  "invalid fpgrowth variant '%c'",
-  /*           -17 */  "unknown error"
+  /* E_INDEX   -17 */  "item set index needs target 's' and -m1 or -m0",
+  /*           -18 */  "unknown error"
 };
 #endif
 
@@ -285,6 +371,8 @@ static ISREPORT *report = NULL; /* item set reporter */
 static TABWRITE *twrite = NULL; /* table writer for pattern spectrum */
 static double   *border = NULL; /* support border for filtering */
 static FPGROWTH *fpgrowth = NULL;  /* fpgrowth miner object */
+static BENCHREC *bench  = NULL; /* benchmark record */
+static ISRIDX   *isxidx = NULL; /* item set index (for isridx) */
 #endif
 
 /*----------------------------------------------------------------------
@@ -386,6 +474,239 @@ static void tdt_show (TDTREE *tree, ITEMBASE *base, int ind)
 }  /* tdt_show() */
 
 #endif  /* #ifndef NDEBUG */
+/*----------------------------------------------------------------------
+  Auxiliary Functions for Benchmarking
+----------------------------------------------------------------------*/
+
+static size_t fpt_count (FPTREE *tree)
+{                               /* --- count nodes of an fp-tree */
+  ITEM   i;                     /* loop variable */
+  size_t n = 0;                 /* number of nodes */
+  FPNODE *node;                 /* to traverse the node lists */
+
+  assert(tree);                 /* check the function argument */
+  for (i = 0; i < tree->cnt; i++)
+    for (node = tree->heads[i].list; node; node = node->succ)
+      n++;                      /* traverse and count the nodes */
+  return n;                     /* return the number of nodes */
+}  /* fpt_count() */
+
+/*--------------------------------------------------------------------*/
+
+static size_t cst_count (CSTREE *tree)
+{                               /* --- count nodes of an fp-tree */
+  ITEM   i;                     /* loop variable */
+  size_t n = 0;                 /* number of nodes */
+  CSNODE *node;                 /* to traverse the node lists */
+
+  assert(tree);                 /* check the function argument */
+  for (i = 0; i < tree->cnt; i++)
+    for (node = tree->heads[i].list; node; node = node->succ)
+      n++;                      /* traverse and count the nodes */
+  return n;                     /* return the number of nodes */
+}  /* cst_count() */
+
+/*--------------------------------------------------------------------*/
+
+static size_t tdt_count (TDNODE *node)
+{                               /* --- count nodes of a top-down tree */
+  size_t n = 0;                 /* number of nodes */
+
+  for ( ; node; node = node->sibling)
+    n += 1 +tdt_count(node->children);
+  return n;                     /* count the nodes recursively */
+}  /* tdt_count() */
+
+/*--------------------------------------------------------------------*/
+
+static int sts_init (FPGSTATS *sts, ITEM size)
+{                               /* --- initialize search statistics */
+  size_t *p;                    /* reallocated per depth arrays */
+
+  assert(sts && (size >= 0));   /* check the function arguments */
+  if (size > sts->size) {       /* if the arrays are too small */
+    p = (size_t*)realloc(sts->prjcnt, (size_t)size
+                        *(2*sizeof(size_t) +sizeof(double)));
+    if (!p) return -1;          /* enlarge the per depth arrays */
+    sts->prjcnt = p; sts->size = size;
+  }                             /* note the new arrays and size */
+  sts->prjsize = sts->prjcnt  +sts->size;
+  sts->time    = (double*)(sts->prjsize +sts->size);
+  memset(sts->prjcnt, 0, (size_t)sts->size *2*sizeof(size_t));
+  memset(sts->time,   0, (size_t)sts->size   *sizeof(double));
+  sts->visited = sts->nodes = sts->mpeak = 0;
+  sts->depth   = sts->cur   = 0;/* clear all counters */
+  return 0;                     /* return 'ok' */
+}  /* sts_init() */
+
+/*--------------------------------------------------------------------*/
+
+static double sts_beg (FPGSTATS *sts, ITEM n)
+{                               /* --- note start of a projection */
+  ITEM d = sts->cur++;          /* get the current depth */
+
+  if (sts->cur > sts->depth) sts->depth = sts->cur;
+  if (d < sts->size) {          /* if depth is in the arrays, */
+    sts->prjcnt [d] += 1;       /* count the projection and */
+    sts->prjsize[d] += (size_t)n;  /* sum the number of items */
+  }
+  return bnr_wall();            /* return the start time */
+}  /* sts_beg() */
+
+/*--------------------------------------------------------------------*/
+
+static void sts_end (FPGSTATS *sts, double t)
+{                               /* --- note end of a projection */
+  ITEM d = --sts->cur;          /* get the current depth */
+
+  if (d < sts->size)            /* sum the time of the subtree */
+    sts->time[d] += bnr_wall() -t;
+}  /* sts_end() */
+
+/*--------------------------------------------------------------------*/
+
+static void sts_mem (FPGSTATS *sts, MEMSYS *mem, size_t size)
+{                               /* --- note node memory of a tree */
+  size_t n = ms_umax(mem) *size;/* get the peak node memory */
+  if (n > sts->mpeak) sts->mpeak = n;
+}  /* sts_mem() */
+
+/*--------------------------------------------------------------------*/
+
+static void sts_merge (FPGSTATS *dst, const FPGSTATS *src)
+{                               /* --- merge search statistics */
+  ITEM i;                       /* loop variable */
+
+  dst->visited += src->visited; /* sum the visited search nodes */
+  if (src->depth > dst->depth) dst->depth = src->depth;
+  i = (src->size < dst->size) ? src->size : dst->size;
+  while (--i >= 0) {            /* traverse the common depths */
+    dst->prjcnt [i] += src->prjcnt [i];
+    dst->prjsize[i] += src->prjsize[i];
+    dst->time   [i] += src->time   [i];
+  }                             /* sum the per depth statistics */
+}  /* sts_merge() */
+
+/* The search statistics are collected only if they were enabled    */
+/* with fpg_setstats(), so that the search pays no more than a test */
+/* of a null pointer per search node otherwise. The depth of a      */
+/* projection is the depth of the recursion in which it is created  */
+/* (0: projections of the initial tree), and its size is its number */
+/* of items. The time of a depth is the wall clock time spent on    */
+/* its projections, including all deeper recursion levels, so that  */
+/* the time of depth 0 is about the total search time (the sum over */
+/* all threads if the top level is processed in parallel).          */
+
+/*--------------------------------------------------------------------*/
+
+static int over (FPGROWTH *fpg)
+{                               /* --- check the search budget */
+  fpg->ncnt += 1;               /* count the current search node */
+  if ((fpg->nmax > 0) && (fpg->ncnt > fpg->nmax))
+    return fpg->stop = 1;       /* check the node budget */
+  if ((fpg->tend > 0) && ((fpg->ncnt & TMCHECK) == 0)
+  &&  (bnr_wall() >= fpg->tend))
+    return fpg->stop = 1;       /* check the time budget */
+  return 0;                     /* (only every 1024 search nodes) */
+}  /* over() */
+
+/*--------------------------------------------------------------------*/
+
+static void bound (FPGROWTH *fpg, SUPP supp)
+{                               /* --- note support of a skipped set */
+  if (supp > fpg->miss) fpg->miss = supp;
+}  /* bound() */
+
+/* If a search budget was set with fpg_setbudget(), every search    */
+/* node (that is, every item that is tried as an extension) is      */
+/* checked with the macro OVER(), which calls over() only if there  */
+/* is a budget. Reading the clock is comparatively expensive and    */
+/* thus is done only every 1024 search nodes. If the budget is      */
+/* exhausted, the search is aborted like on an error, but the flag  */
+/* "stop" records that the result is only partial. While unwinding  */
+/* the recursion, the largest support of an item that was not yet   */
+/* processed is recorded with bound(), as it is an upper bound for  */
+/* the support of all item sets that were not reported.             */
+
+/*----------------------------------------------------------------------
+  Memory Management Functions
+----------------------------------------------------------------------*/
+
+static MEMSYS* getmem (FPGROWTH *fpg, size_t size)
+{                               /* --- get a memory system for a tree */
+  MEMSYS *mem = fpg->mem;       /* memory system kept from last run */
+
+  fpg->mem = NULL;              /* take the kept memory system */
+  if (mem && (fpg->msize == size))
+    return mem;                 /* reuse it if the node size fits */
+  if (mem) ms_delete(mem);      /* otherwise delete it and */
+  fpg->msize = size;            /* create a new memory system */
+  return ms_create(size, 65535);
+}  /* getmem() */
+
+/*--------------------------------------------------------------------*/
+
+static void putmem (FPGROWTH *fpg, MEMSYS *mem)
+{                               /* --- keep a memory system for reuse */
+  if (fpg->mem) ms_delete(fpg->mem);
+  ms_clear(mem, 0);             /* free all nodes, but keep blocks */
+  fpg->mem = mem;               /* note the cleared memory system */
+}  /* putmem() */
+
+/* The memory system of the initial tree is not deleted at the end  */
+/* of the search, but cleared and kept in the miner object, so that */
+/* a miner that is run repeatedly (for example, on surrogate data   */
+/* sets, see fpgpsp.c) does not have to allocate (and fault in) the */
+/* memory blocks for the tree nodes anew for each run. The blocks   */
+/* are released when the miner object is deleted.                   */
+
+/*--------------------------------------------------------------------*/
+
+static void* getprj (FPGROWTH *fpg, size_t size)
+{                               /* --- get a buffer for a projection */
+  ITEM   d, n;                  /* recursion depth, number of buffers */
+  PRJBUF *p;                    /* to access the projection buffer */
+
+  d = isr_cnt(fpg->report);     /* get the current recursion depth */
+  if (d >= fpg->prjn) {         /* if the buffer array is too small */
+    n = fpg->prjn +((fpg->prjn > 16) ? fpg->prjn >> 1 : 16);
+    if (n <= d) n = d+1;        /* compute the new array size */
+    p = (PRJBUF*)realloc(fpg->prjs, (size_t)n *sizeof(PRJBUF));
+    if (!p) return NULL;        /* enlarge the buffer array */
+    memset(p +fpg->prjn, 0, (size_t)(n -fpg->prjn) *sizeof(PRJBUF));
+    fpg->prjs = p; fpg->prjn = n;
+  }                             /* note the enlarged buffer array */
+  p = fpg->prjs +d;             /* get the buffer for this depth */
+  if (size > p->size) {         /* if the buffer is too small */
+    if (p->buf) free(p->buf);   /* delete the old buffer */
+    p->buf  = malloc(size);     /* and create a new one */
+    p->size = (p->buf) ? size : 0;
+  }                             /* (contents need not be kept) */
+  return p->buf;                /* return the projection buffer */
+}  /* getprj() */
+
+/*--------------------------------------------------------------------*/
+
+static void clrprj (FPGROWTH *fpg)
+{                               /* --- delete the projection buffers */
+  while (--fpg->prjn >= 0)      /* traverse the buffers */
+    if (fpg->prjs[fpg->prjn].buf) free(fpg->prjs[fpg->prjn].buf);
+  if (fpg->prjs) free(fpg->prjs);
+  fpg->prjs = NULL; fpg->prjn = 0;
+}  /* clrprj() */
+
+/* The header tables of the projected trees are not allocated and   */
+/* freed in each recursion step, but taken from buffers that are    */
+/* kept in the miner object, one per recursion depth. As the item   */
+/* set reporter contains exactly one more item in each recursion    */
+/* level, the number of items in the reporter serves as the index.  */
+/* A buffer is only enlarged if a larger header table is needed and */
+/* otherwise reused as is (it is released when the miner object is  */
+/* deleted). The nodes of the projected trees are allocated with    */
+/* the memory system of the initial tree, which is used like a      */
+/* stack (ms_push()/ms_pop()), so that they are also released in    */
+/* bulk and the nodes of a projection lie in contiguous blocks.     */
+
 /*----------------------------------------------------------------------
   Frequent Pattern Growth (simple nodes with only successor/parent)
 ----------------------------------------------------------------------*/
@@ -488,19 +809,21 @@ static int rec_simple (FPGROWTH *fpg, FPTREE *tree)
   }                             /* abort the recursion */
   if ((tree->cnt > 1)           /* if there is more than one item */
   &&  isr_xable(fpg->report,2)){/* and another item can be added */
-    proj = (FPTREE*)malloc(sizeof(FPTREE)
+    proj = (FPTREE*)getprj(fpg, sizeof(FPTREE)
                          +(size_t)(tree->cnt-2) *sizeof(FPHEAD));
     if (!proj) return -1;       /* create a frequent pattern tree */
     proj->root.id   = TA_END;   /* of the maximally possible size */
     proj->root.succ = proj->root.parent = NULL;
     proj->dir = tree->dir;      /* initialize the root node and */
     proj->mem = tree->mem;      /* copy the processing direction */
-    if (ms_push(tree->mem) < 0) { free(proj); return -1; }
+    if (ms_push(tree->mem) < 0) return -1;
   }                             /* note the current memory state */
   if (tree->dir > 0) { z = tree->cnt; i = 0; }
   else               { z = -1;        i = tree->cnt-1; }
   for (r = 0; i != z; i += tree->dir) {
     h = tree->heads +i;         /* traverse the (frequent) items */
+    if (fpg->stats)             /* count the current search node */
+      fpg->stats->visited += 1; /* (for the search statistics) */
     #ifdef VISITED              /* if to report visited search nodes */
     fpg->visited += 1;          /* count current node as visited */
     if ((fpg->visited % 10000) == 0) {
@@ -508,6 +831,10 @@ static int rec_simple (FPGROWTH *fpg, FPTREE *tree)
       fprintf(stderr, "  %24"SIZE_FMT, isr_repcnt(fpg->report));
     }                           /* print numbers every 10000 nodes */
     #endif                      /* (visited nodes and reported sets) */
+    if (OVER(fpg)) {            /* if the search budget is exhausted, */
+      r = -1; break; }          /* abort the search (partial result) */
+    if (BELOW(fpg, h->supp))    /* skip items below a raised */
+      continue;                 /* minimum support (top-k sets) */
     r = isr_add(fpg->report, h->item, h->supp);
     if (r <  0) break;          /* add current item to the reporter */
     if (r <= 0) continue;       /* check if item needs processing */
@@ -518,15 +845,19 @@ static int rec_simple (FPGROWTH *fpg, FPTREE *tree)
       } }                       /* add items as perfect extensions */
     else if (proj) {            /* if another item can be added */
       r = proj_simple(fpg, proj, tree, i);
-      if (r > 0) r = rec_simple(fpg, proj);
+      if (r > 0) RECURSE(fpg, r, proj->cnt, rec_simple(fpg, proj));
       if (r < 0) break;         /* project frequent pattern tree and */
     }                           /* find freq. item sets recursively */
     r = isr_report(fpg->report);/* report the current item set */
     if (r < 0) break;           /* and check for an error */
     isr_remove(fpg->report, 1); /* remove the current item */
   }                             /* from the item set reporter */
-  if (proj) {                   /* delete the created projection */
-    free(proj); ms_pop(tree->mem); }
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for ( ; i != z; i += tree->dir)
+      bound(fpg, tree->heads[i].supp);
+  }                             /* note max. support of skipped items */
+  if (proj)                     /* release the created projection */
+    ms_pop(tree->mem);          /* (nodes only, header is kept) */
   return r;                     /* return the error status */
 }  /* rec_simple() */
 
@@ -663,7 +994,7 @@ static int rec_smp16 (FPGROWTH *fpg, FPTREE *tree)
   }                             /* abort the recursion */
   if ((tree->cnt > 1)           /* if there is more than one item */
   &&  isr_xable(fpg->report,2)){/* and another item can be added */
-    proj = (FPTREE*)malloc(sizeof(FPTREE)
+    proj = (FPTREE*)getprj(fpg, sizeof(FPTREE)
                          +(size_t)(tree->cnt-2) *sizeof(FPHEAD));
     if (!proj) return -1;       /* create a frequent pattern tree */
     proj->root.id   = TA_END;   /* of the maximally possible size */
@@ -671,13 +1002,15 @@ static int rec_smp16 (FPGROWTH *fpg, FPTREE *tree)
     proj->dir   = tree->dir;    /* initialize the root node and */
     proj->fim16 = tree->fim16;  /* copy the processing direction */
     proj->mem   = tree->mem;    /* and the 16-items machine */
-    if (ms_push(tree->mem) < 0) { free(proj); return -1; }
+    if (ms_push(tree->mem) < 0) return -1;
   }                             /* note the current memory state */
   mask = ITEM_MAX;              /* init. the packed item mask */
   if (tree->dir > 0) { z = tree->cnt; i = 0; }
   else               { z = -1;        i = tree->cnt-1; }
   for (r = 0; i != z; i += tree->dir) {
     h = tree->heads +i;         /* traverse the (frequent) items */
+    if (fpg->stats)             /* count the current search node */
+      fpg->stats->visited += 1; /* (for the search statistics) */
     #ifdef VISITED              /* if to report visited search nodes */
     fpg->visited += 1;          /* count current node as visited */
     if ((fpg->visited % 10000) == 0) {
@@ -685,6 +1018,8 @@ static int rec_smp16 (FPGROWTH *fpg, FPTREE *tree)
       fprintf(stderr, "  %24"SIZE_FMT, isr_repcnt(fpg->report));
     }                           /* print numbers every 10000 nodes */
     #endif                      /* (visited nodes and reported sets) */
+    if (OVER(fpg)) {            /* if the search budget is exhausted, */
+      r = -1; break; }          /* abort the search (partial result) */
     if (h->item < 0) {          /* if to use a 16-items machine */
       if (tree->dir < 0)        /* if downward processing direction */
         for (node = h->list; node; node = node->succ)
@@ -693,6 +1028,8 @@ static int rec_smp16 (FPGROWTH *fpg, FPTREE *tree)
       if (r < 0) break;         /* to the 16-items machine and mine */
       mask = r; continue;       /* get the packed items mask */
     }                           /* and go to the next item list */
+    if (BELOW(fpg, h->supp))    /* skip items below a raised */
+      continue;                 /* minimum support (top-k sets) */
     r = isr_add(fpg->report, h->item, h->supp);
     if (r <  0) break;          /* add current item to the reporter */
     if (r <= 0) continue;       /* check if item needs processing */
@@ -705,15 +1042,20 @@ static int rec_smp16 (FPGROWTH *fpg, FPTREE *tree)
       } }                       /* add items as perfect extensions */
     else if (proj) {            /* if another item can be added */
       r = proj_smp16(fpg, proj, tree, i, mask);
-      if (r > 0) r = rec_smp16(fpg, proj);
+      if (r > 0) RECURSE(fpg, r, proj->cnt, rec_smp16(fpg, proj));
       if (r < 0) break;         /* project frequent pattern tree and */
     }                           /* find freq. item sets recursively */
     r = isr_report(fpg->report);/* report the current item set */
     if (r < 0) break;           /* and check for an error */
     isr_remove(fpg->report, 1); /* remove the current item */
   }                             /* from the item set reporter */
-  if (proj) {                   /* delete the created projection */
-    free(proj); ms_pop(tree->mem); }
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for ( ; i != z; i += tree->dir)
+      bound(fpg, (tree->heads[i].item < 0)
+               ? tree->root.supp : tree->heads[i].supp);
+  }                             /* note max. support of skipped items */
+  if (proj)                     /* release the created projection */
+    ms_pop(tree->mem);          /* (nodes only, header is kept) */
   return r;                     /* return the error status */
 }  /* rec_smp16() */
 
@@ -723,7 +1065,7 @@ int fpg_simple (FPGROWTH *fpg)
 {                               /* --- search for frequent item sets */
   int        r = 0;             /* result of recursion/functions */
   ITEM       i, k, m;           /* loop variable, number of items */
-  TID        j, n;              /* loop variable, number of trans. */
+  TBGITER    *iter;             /* to traverse the transactions */
   SUPP       pex;               /* minimum support for perf. exts. */
   TRACT      *t;                /* to traverse the transactions */
   ITEM       *s, *d;            /* to build the item maps */
@@ -740,8 +1082,7 @@ int fpg_simple (FPGROWTH *fpg)
   pex = tbg_wgt(fpg->tabag);    /* check against the minimum support */
   if (fpg->supp > pex) return 0;/* and get minimum for perfect exts. */
   if (!(fpg->mode & FPG_PERFECT)) pex = SUPP_MAX;
-  n = tbg_cnt(fpg->tabag);      /* get the number of transactions */
-  k = tbg_itemcnt(fpg->tabag);  /* and check the number of items */
+  k = tbg_itemcnt(fpg->tabag);  /* get the number of items */
   if (k <= 0) return isr_report(fpg->report);
   f = tbg_ifrqs(fpg->tabag, 0); /* get the item frequencies */
   if (!f) return -1;            /* in the transaction bag */
@@ -765,7 +1106,7 @@ int fpg_simple (FPGROWTH *fpg)
   if (!tree) { free(fpg->set); return -1; }
   tree->cnt = k = m;            /* allocate the base tree structure */
   tree->dir = fpg->dir;         /* and initialize its fields */
-  tree->mem = ms_create(sizeof(FPNODE), 65535);
+  tree->mem = getmem(fpg, sizeof(FPNODE));
   if (!tree->mem) { free(tree); free(fpg->set); return -1; }
   tree->root.id   = TA_END;     /* create memory system for the nodes */
   tree->root.supp = 0;          /* and initialize the root node */
@@ -777,8 +1118,10 @@ int fpg_simple (FPGROWTH *fpg)
     if (!tree->fim16) { ms_delete(tree->mem);
       free(tree); free(fpg->set); return -1; }
     tree->heads[0].item = TA_END;   /* create a 16-items machine */
-    for (j = n; --j >= 0; ) {   /* traverse the transactions and */
-      t = tbg_tract(fpg->tabag, j);   /* collect non-elim. items */
+    bnr_begin(fpg->bench, "build");
+    iter = tbi_create(fpg->tabag);
+    if (!iter) r = -1;          /* create a transaction iterator */
+    while (iter && ((t = tbi_next(iter)) != NULL)) {
       for (k = 0, p = ta_items(t); *p > TA_END; p++) {
         if      ((m = *p)   <  0) s[k++] = m;
         else if ((m = d[m]) >= 0) s[k++] = m;
@@ -786,25 +1129,34 @@ int fpg_simple (FPGROWTH *fpg)
       r = add_smp16(tree, s, k, ta_wgt(t));
       if (r < 0) break;         /* add the reduced transaction */
     }                           /* to the frequent pattern tree */
+    tbi_delete(iter);           /* delete the iterator */
+    if (fpg->bench || fpg->stats) fpg->nodes += fpt_count(tree);
+    bnr_begin(fpg->bench, "mine");
     if (r >= 0) {               /* if freq. pattern tree was built, */
       r = rec_smp16(fpg, tree); /* find freq. item sets recursively */
       if (r >= 0) r = isr_report(fpg->report);
     }                           /* finally report the empty item set */
     m16_delete(tree->fim16); }  /* delete the 16-items machine */
   else {                        /* if not to use a 16-items machine */
-    for (j = n; --j >= 0; ) {   /* traverse the transactions and */
-      t = tbg_tract(fpg->tabag, j);   /* collect non-elim. items */
+    bnr_begin(fpg->bench, "build");
+    iter = tbi_create(fpg->tabag);
+    if (!iter) r = -1;          /* create a transaction iterator */
+    while (iter && ((t = tbi_next(iter)) != NULL)) {
       for (k = 0, p = ta_items(t); *p > TA_END; p++)
         if ((m = d[*p]) >= 0) s[k++] = m;
       r = add_simple(tree, s, k, ta_wgt(t));
       if (r < 0) break;         /* add the reduced transaction */
     }                           /* to the frequent pattern tree */
+    tbi_delete(iter);           /* delete the iterator */
+    if (fpg->bench || fpg->stats) fpg->nodes += fpt_count(tree);
+    bnr_begin(fpg->bench, "mine");
     if (r >= 0) {               /* if freq. pattern tree was built, */
       r = rec_simple(fpg,tree); /* find freq. item sets recursively */
       if (r >= 0) r = isr_report(fpg->report);
     }                           /* report the empty item set */
   }
-  ms_delete(tree->mem);         /* delete the memory mgmt. system */
+  if (fpg->stats) sts_mem(fpg->stats, tree->mem, sizeof(FPNODE));
+  putmem(fpg, tree->mem);       /* keep the memory mgmt. system */
   free(tree); free(fpg->set);   /* and the frequent pattern tree */
   #ifdef VISITED                /* if to report visited search nodes */
   fprintf(stderr, "\rtotal nodes  : %24"SIZE_FMT"%26s\n",
@@ -861,6 +1213,40 @@ static int add_cmplx (CSTREE *tree, const ITEM *ids, ITEM n, SUPP supp)
 
 /*--------------------------------------------------------------------*/
 
+static int wide_cmplx (FPGROWTH *fpg, CSTREE *dst, CSTREE *src, ITEM id,
+                       const ITEM *map)
+{                               /* --- mine with 32/64-items machine */
+  int     r;                    /* result of function call */
+  ITEM    i;                    /* loop variable, mapped identifier */
+  double  f;                    /* expected number of items */
+  BITTA64 b;                    /* bit-represented transaction */
+  CSNODE  *node, *anc;          /* to traverse the tree nodes */
+
+  assert(fpg && fpg->fim64      /* check the function arguments */
+  &&     dst && src && (id >= 0) && map);
+  for (f = 0, i = 0; i < dst->cnt; i++)
+    f += (double)dst->heads[i].supp;  /* compute the expected number */
+  f /= (double)src->heads[id].supp;   /* of items per transaction */
+  if (m64_choose(fpg->fim64, dst->cnt, f) <= 0)
+    return 1;                   /* check whether the machine pays off */
+  for (i = 0; i < dst->cnt; i++)/* set the item identifier map */
+    m64_setmap(fpg->fim64, i, dst->heads[i].item);
+  for (node = src->heads[id].list; node; node = node->succ) {
+    b = 0;                      /* traverse the item list */
+    for (anc = node->parent; anc->id >= 0; anc = anc->parent)
+      if ((i = map[anc->id]) >= 0) b |= (BITTA64)1 << i;
+    if (m64_add(fpg->fim64, b, node->supp) < 0) return -1;
+  }                             /* add bit-represented transactions */
+  r = m64_mine(fpg->fim64);     /* to the machine and mine */
+  return (r < 0) ? r : 0;       /* return 'no projection created' */
+}  /* wide_cmplx() */
+
+/* The width of the machine (32 or 64 items) is chosen per conditional */
+/* database by m64_choose(), which compares the cost of vectorized    */
+/* counting on bit masks with the expected cost of tree traversals.   */
+
+/*--------------------------------------------------------------------*/
+
 static int proj_cmplx (FPGROWTH *fpg, CSTREE *dst, CSTREE *src, ITEM id)
 {                               /* --- project a freq. pattern tree */
   int    r;                     /* result of function call */
@@ -907,6 +1293,10 @@ static int proj_cmplx (FPGROWTH *fpg, CSTREE *dst, CSTREE *src, ITEM id)
     r = m16_mine(fpg->fim16);   /* to the 16-items machine and mine */
     return (r < 0) ? r : 0;     /* return 'no projection created' */
   }
+  if (fpg->fim64) {             /* if to use a 32/64-items machine */
+    r = wide_cmplx(fpg, dst, src, id, map);
+    if (r <= 0) return r;       /* mine with the machine if this */
+  }                             /* is cheaper than a projection */
   dst->root.supp     = 0;       /* init. the root node support */
   dst->root.children = NULL;    /* and clear the child list */
   #if 0
@@ -1051,6 +1441,10 @@ static int proj_reord (FPGROWTH *fpg, CSTREE *dst, CSTREE *src, ITEM id)
     r = m16_mine(fpg->fim16);   /* to the 16-items machine and mine */
     return (r < 0) ? r : 0;     /* return 'no projection created' */
   }
+  if (fpg->fim64) {             /* if to use a 32/64-items machine */
+    r = wide_cmplx(fpg, dst, src, id, map);
+    if (r <= 0) return r;       /* mine with the machine if this */
+  }                             /* is cheaper than a projection */
   dst->root.supp     = 0;       /* init. the root node support */
   dst->root.children = NULL;    /* and clear the child list */
   #if 0
@@ -1129,13 +1523,13 @@ static int rec_cmplx (FPGROWTH *fpg, CSTREE *tree)
   }                             /* abort the recursion */
   if ((tree->cnt > 1)           /* if there is more than one item */
   &&  isr_xable(fpg->report,2)){/* and another item can be added */
-    proj = (CSTREE*)malloc(sizeof(CSTREE)
+    proj = (CSTREE*)getprj(fpg, sizeof(CSTREE)
                          +(size_t)(tree->cnt-2) *sizeof(CSHEAD));
     if (!proj) return -1;       /* create a frequent pattern tree */
     proj->root.id   = TA_END;   /* of the maximally possible size */
     proj->root.succ = proj->root.parent = proj->root.sibling = NULL;
     proj->mem = tree->mem;      /* initialize the root node */
-    if (ms_push(tree->mem) < 0) { free(proj); return -1; }
+    if (ms_push(tree->mem) < 0) return -1;
   }                             /* note the current memory state */
   #if 0                         /* needed for 16-items machine */
   i = (tree->heads[0].supp <= 0) ? 16 : 0;
@@ -1147,6 +1541,8 @@ static int rec_cmplx (FPGROWTH *fpg, CSTREE *tree)
   #endif                        /* (except all processing fits) */
   for (r = 0; i != z; i += fpg->dir) {
     h = tree->heads +i;         /* traverse the frequent items */
+    if (fpg->stats)             /* count the current search node */
+      fpg->stats->visited += 1; /* (for the search statistics) */
     #ifdef VISITED              /* if to report visited search nodes */
     fpg->visited += 1;          /* count current node as visited */
     if ((fpg->visited % 10000) == 0) {
@@ -1154,6 +1550,10 @@ static int rec_cmplx (FPGROWTH *fpg, CSTREE *tree)
       fprintf(stderr, "  %24"SIZE_FMT, isr_repcnt(fpg->report));
     }                           /* print numbers every 10000 nodes */
     #endif                      /* (visited nodes and reported sets) */
+    if (OVER(fpg)) {            /* if the search budget is exhausted, */
+      r = -1; break; }          /* abort the search (partial result) */
+    if (BELOW(fpg, h->supp))    /* skip items below a raised */
+      continue;                 /* minimum support (top-k sets) */
     r = isr_add(fpg->report, h->item, h->supp);
     if (r <  0) break;          /* add current item to the reporter */
     if (r <= 0) continue;       /* check if item needs processing */
@@ -1166,25 +1566,274 @@ static int rec_cmplx (FPGROWTH *fpg, CSTREE *tree)
       r = (fpg->mode & FPG_REORDER)
         ? proj_reord(fpg, proj, tree, i)
         : proj_cmplx(fpg, proj, tree, i);
-      if (r > 0) r = rec_cmplx(fpg, proj);
+      if (r > 0) RECURSE(fpg, r, proj->cnt, rec_cmplx(fpg, proj));
       if (r < 0) break;         /* project frequent pattern tree and */
     }                           /* find freq. item sets recursively */
     r = isr_report(fpg->report);/* report the current item set */
     if (r < 0) break;           /* and check for an error */
     isr_remove(fpg->report, 1); /* remove the current item */
   }                             /* from the item set reporter */
-  if (proj) {                   /* delete the created projection */
-    free(proj); ms_pop(tree->mem); }
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for ( ; i != z; i += fpg->dir)
+      bound(fpg, tree->heads[i].supp);
+  }                             /* note max. support of skipped items */
+  if (proj)                     /* release the created projection */
+    ms_pop(tree->mem);          /* (nodes only, header is kept) */
   return r;                     /* return the error status */
 }  /* rec_cmplx() */
 
 /*--------------------------------------------------------------------*/
 
+/*----------------------------------------------------------------------
+  Frequent Pattern Growth (parallel processing of the top level)
+----------------------------------------------------------------------*/
+
+static int cpucnt (void)
+{                               /* --- get the number of processors */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  SYSTEM_INFO sysinfo;          /* system information structure */
+  GetSystemInfo(&sysinfo);      /* get system information */
+  return (int)sysinfo.dwNumberOfProcessors;
+  #elif defined _SC_NPROCESSORS_ONLN
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+  #else                         /* if no direct function available */
+  return 1;                     /* use only one processor */
+  #endif
+}  /* cpucnt() */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(worker, p)
+{                               /* --- worker function for a thread */
+  WORKDATA *w = p;              /* type the argument pointer */
+  FPGROWTH *fpg;                /* private fpgrowth miner */
+  CSTREE   *tree;               /* shared frequent pattern tree */
+  CSTREE   *proj = NULL;        /* projected frequent pattern tree */
+  CSHEAD   *h;                  /* node list for current item */
+  CSNODE   *node;               /* to traverse the tree nodes */
+  ITEM     i, k;                /* loop variables */
+  int      r = 0;               /* error status */
+
+  assert(p);                    /* check the function argument */
+  fpg  = &w->fpg;               /* get the private fpgrowth miner */
+  tree = w->tree;               /* and the shared fp-tree */
+  if ((tree->cnt > 1)           /* if there is more than one item */
+  &&  isr_xable(fpg->report,2)){/* and another item can be added */
+    proj = (CSTREE*)malloc(sizeof(CSTREE)
+                         +(size_t)(tree->cnt-2) *sizeof(CSHEAD));
+    if (!proj) { w->err = -1; return THREAD_OK; }
+    proj->root.id   = TA_END;   /* create a frequent pattern tree */
+    proj->root.succ = proj->root.parent = proj->root.sibling = NULL;
+    proj->mem = ms_create(sizeof(CSNODE), 65535);
+    if (!proj->mem) { free(proj); w->err = -1; return THREAD_OK; }
+  }                             /* with a private memory system */
+  for (k = w->cnt; --k >= 0; ){ /* traverse the assigned items */
+    #ifdef FPG_ABORT            /* if to check for interrupt */
+    if (sig_aborted()) { r = -1; break; }
+    #endif                      /* abort the processing */
+    h = tree->heads +(i = w->items[k]);
+    if (fpg->stats)             /* count the current search node */
+      fpg->stats->visited += 1; /* (for the search statistics) */
+    #ifdef VISITED              /* if to report visited search nodes */
+    fpg->visited += 1;          /* count current node as visited */
+    #endif
+    if (OVER(fpg)) {            /* if the search budget is exhausted, */
+      r = -1; break; }          /* abort the search (partial result) */
+    if (BELOW(fpg, h->supp))    /* skip items below a raised */
+      continue;                 /* minimum support (top-k sets) */
+    r = isr_add(fpg->report, h->item, h->supp);
+    if (r <  0) break;          /* add current item to the reporter */
+    if (r <= 0) continue;       /* check if item needs processing */
+    if (!h->list->succ) {       /* if projection would be a chain */
+      for (node = h->list->parent; node->id >= 0; ) {
+        isr_addpex(fpg->report, tree->heads[node->id].item);
+        node = node->parent;    /* traverse the list of ancestors */
+      } }                       /* and add them as perfect exts. */
+    else if (proj) {            /* if another item can be added */
+      if (ms_push(proj->mem) < 0) { r = -1; break; }
+      r = (fpg->mode & FPG_REORDER)
+        ? proj_reord(fpg, proj, tree, i)
+        : proj_cmplx(fpg, proj, tree, i);
+      if (r > 0) RECURSE(fpg, r, proj->cnt, rec_cmplx(fpg, proj));
+      ms_pop(proj->mem);        /* project frequent pattern tree, */
+      if (r < 0) break;         /* find freq. item sets recursively */
+    }                           /* and release the projection */
+    r = isr_report(fpg->report);/* report the current item set */
+    if (r < 0) break;           /* and check for an error */
+    isr_remove(fpg->report, 1); /* remove the current item */
+  }                             /* from the item set reporter */
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for ( ; k >= 0; k--)
+      bound(fpg, tree->heads[w->items[k]].supp);
+  }                             /* note max. support of skipped items */
+  if (proj) {                   /* delete the created projection */
+    if (fpg->stats) sts_mem(fpg->stats, proj->mem, sizeof(CSNODE));
+    ms_delete(proj->mem); free(proj); }
+  if (fpg->stop) r = 0;         /* a stop of the search is no error */
+  w->err = (r < 0) ? -1 : 0;    /* note the error status */
+  return THREAD_OK;             /* return a dummy result */
+}  /* worker() */
+
+/*--------------------------------------------------------------------*/
+
+static int par_cmplx (FPGROWTH *fpg, CSTREE *tree)
+{                               /* --- process top level in parallel */
+  int      r = 0;               /* error status */
+  int      c, n, x;             /* number of threads, loop variables */
+  ITEM     i, k;                /* loop variables, number of items */
+  size_t   b;                   /* node memory of the workers */
+  double   *est;                /* estimated costs of the subtrees */
+  ITEM     *s;                  /* item buffers of the workers */
+  CSNODE   *node, *anc;         /* to traverse the tree nodes */
+  WORKDATA *w;                  /* data for worker threads */
+  THREAD   *threads;            /* thread handles */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  DWORD    thid;                /* dummy for storing the thread id */
+  #endif                        /* (not really needed here) */
+
+  assert(fpg && tree);          /* check the function arguments */
+  c = (fpg->cpus > 0) ? fpg->cpus : cpucnt();
+  if (c > tree->cnt) c = (int)tree->cnt;
+  if (c <= 1) return rec_cmplx(fpg, tree);
+  est = (double*)malloc((size_t)tree->cnt *sizeof(double)
+                       +(size_t)tree->cnt *sizeof(ITEM));
+  if (!est) return -1;          /* create cost and item arrays */
+  s = (ITEM*)(est +tree->cnt);  /* and estimate the subtree costs */
+  for (i = 0; i < tree->cnt; i++) {
+    est[i] = 1;                 /* by the sizes of the conditional */
+    for (node = tree->heads[i].list; node; node = node->succ)
+      for (anc = node->parent; anc->id >= 0; anc = anc->parent)
+        est[i] += 1;            /* databases that will be projected */
+  }                             /* (sum of path lengths to the root) */
+  threads = (THREAD*)calloc((size_t)c, sizeof(THREAD));
+  if (!threads) { free(est); return -1; }
+  w = (WORKDATA*)calloc((size_t)c, sizeof(WORKDATA));
+  if (!w) { free(threads); free(est); return -1; }
+  for (i = tree->cnt; --i >= 0; ) {
+    for (x = 0, n = 1; n < c; n++)
+      if (w[n].load < w[x].load) x = n;
+    w[x].load += est[i];        /* assign the items in descending */
+    w[x].cnt  += 1;             /* order (which is roughly the order */
+  }                             /* of decreasing costs) to the worker */
+  for (k = 0, n = 0; n < c; n++) {   /* with the smallest load */
+    w[n].items = s +k; k += w[n].cnt;
+    w[n].load  = 0; w[n].cnt = 0;
+  }                             /* distribute the item buffer */
+  for (i = tree->cnt; --i >= 0; ) {
+    for (x = 0, n = 1; n < c; n++)
+      if (w[n].load < w[x].load) x = n;
+    w[x].load += est[i];        /* repeat the assignment and */
+    w[x].items[w[x].cnt++] = i; /* store the items in the buffers */
+  }                             /* of the workers */
+  k = tbg_itemcnt(fpg->tabag);  /* get the number of items */
+  for (n = 0; n < c; n++) {     /* traverse the threads */
+    w[n].fpg        = *fpg;     /* copy the fpgrowth miner */
+    w[n].fpg.cpus   = 1;        /* and create private buffers */
+    w[n].fpg.report = NULL;     /* and a private item set reporter */
+    w[n].fpg.fim16  = NULL;
+    w[n].fpg.fim64  = NULL;
+    w[n].fpg.bench  = NULL;     /* (benchmarking in main thread only) */
+    w[n].fpg.stats  = NULL;     /* (private statistics set below) */
+    w[n].fpg.prjs   = NULL;     /* (private projection buffers) */
+    w[n].fpg.prjn   = 0;
+    w[n].fpg.nmax   = (fpg->nmax > 0) ? fpg->nmax/(size_t)c +1 : 0;
+    w[n].fpg.ncnt   = 0;        /* share the node budget */
+    w[n].fpg.set    = (ITEM*)malloc((size_t)(k+k) *sizeof(ITEM)
+                                   +(size_t) k    *sizeof(SUPP));
+    w[n].tree       = tree;     /* note the shared fp-tree */
+    w[n].err        = -1;       /* default: thread was not started */
+    #ifdef VISITED              /* if to report visited search nodes */
+    w[n].fpg.visited = 0;       /* initialize the search node counter */
+    #endif
+    if (!w[n].fpg.set) break;   /* check the item and support arrays */
+    if (fpg->stats) {           /* if to collect search statistics */
+      if (sts_init(&w[n].stats, k+1) != 0) break;
+      w[n].fpg.stats = &w[n].stats;
+    }                           /* init. private search statistics */
+    w[n].fpg.map    = w[n].fpg.set +k;
+    w[n].fpg.cis    = (SUPP*)(w[n].fpg.map +k);
+    w[n].fpg.report = isr_clone(fpg->report);
+    if (!w[n].fpg.report) break;/* create a private reporter */
+    if (fpg->fim16) {           /* if to use a 16-items machine */
+      w[n].fpg.fim16 = m16_create(fpg->dir, fpg->supp, w[n].fpg.report);
+      if (!w[n].fpg.fim16) break;
+    }                           /* create a private 16-items machine */
+    if (fpg->fim64) {           /* if to use a 32/64-items machine */
+      w[n].fpg.fim64 = m64_create(m64_width(fpg->fim64), fpg->dir,
+                                  fpg->supp, w[n].fpg.report);
+      if (!w[n].fpg.fim64) break;
+    }                           /* create a private 32/64-items mach. */
+    w[n].err = 0;               /* clear the error indicator */
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    threads[n] = CreateThread(NULL, 0, worker, w+n, 0, &thid);
+    if (!threads[n]) { w[n].err = -1; break; }
+    #else                       /* if Linux/Unix system */
+    if (pthread_create(threads+n, NULL, worker, w+n) != 0) {
+      w[n].err = -1; break; }   /* create a thread for each worker */
+    #endif                      /* to process the items in parallel */
+  }
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  WaitForMultipleObjects((DWORD)n, threads, TRUE, INFINITE);
+  for (x = n; --x >= 0; )       /* wait for threads to finish, */
+    CloseHandle(threads[x]);    /* then close all thread handles */
+  #else                         /* if Linux/Unix system */
+  for (x = n; --x >= 0; )       /* wait for threads to finish */
+    pthread_join(threads[x], NULL);
+  #endif                        /* (join threads with this one) */
+  if (n < c) r = -1;            /* check whether all threads started */
+  for (x = 0; x < n; x++)       /* join the error indicators */
+    r |= w[x].err;              /* of the finished threads */
+  for (b = 0, x = 0; x < n; x++) {   /* traverse finished workers */
+    if ((r >= 0) && (isr_merge(fpg->report, w[x].fpg.report) < 0))
+      r = -1;                   /* merge the results of the workers */
+    if (w[x].fpg.stats) {       /* if there are search statistics, */
+      sts_merge(fpg->stats, w[x].fpg.stats);
+      b += w[x].stats.mpeak;    /* merge the search statistics and */
+    }                           /* sum the node memory of the workers */
+    if (w[x].fpg.stop) {        /* if a worker exhausted the budget, */
+      fpg->stop = 1;            /* note that the result is partial */
+      bound(fpg, w[x].fpg.miss);
+    }                           /* and the max. missing support */
+    #ifdef VISITED              /* if to report visited search nodes */
+    fpg->visited += w[x].fpg.visited;
+    #endif                      /* sum the visited search nodes */
+  }
+  if (fpg->stop) r = -1;        /* unwind if the search was stopped */
+  if (fpg->stats) {             /* if to collect search statistics */
+    b += ms_umax(tree->mem) *sizeof(CSNODE);
+    if (b > fpg->stats->mpeak) fpg->stats->mpeak = b;
+  }                             /* note the concurrent node memory */
+  for (x = c; --x >= 0; ) {     /* traverse the worker data */
+    if (w[x].fpg.fim16)  m16_delete(w[x].fpg.fim16);
+    if (w[x].fpg.fim64)  m64_delete(w[x].fpg.fim64);
+    if (w[x].fpg.report) isr_delete(w[x].fpg.report, 0);
+    if (w[x].fpg.set)    free(w[x].fpg.set);
+    clrprj(&w[x].fpg);          /* delete the projection buffers */
+    if (w[x].stats.prjcnt) free(w[x].stats.prjcnt);
+  }                             /* delete the private objects */
+  free(w); free(threads);       /* delete worker data, thread handles */
+  free(est);                    /* and the subtree cost estimates */
+  return r;                     /* return the error status */
+}  /* par_cmplx() */
+
+/* The top level of the search is split in such a way that each item */
+/* of the header table is processed completely by one worker thread. */
+/* The workers read the (shared) full frequent pattern tree, but use */
+/* private projections, memory systems and item set reporters, the   */
+/* latter of which are merged into the given reporter at the end. As */
+/* the item sets of different top level items are written by         */
+/* different workers, the order of the output differs from the order */
+/* of a sequential run. Since closed/maximal item sets and generators */
+/* need a global repository, this is only used for all frequent item */
+/* sets.                                                             */
+
+/*--------------------------------------------------------------------*/
+
 int fpg_cmplx (FPGROWTH *fpg)
 {                               /* --- search for frequent item sets */
   int        r = 0;             /* result of recursion/functions */
   ITEM       i, k, m;           /* loop variable, number of items */
-  TID        j, n;              /* loop variable, number of trans. */
+  TBGITER    *iter;             /* to traverse the transactions */
   SUPP       pex;               /* minimum support for perfect exts. */
   ITEM       *s, *d;            /* to build the item maps */
   const ITEM *p;                /* to traverse transaction items */
@@ -1201,8 +1850,7 @@ int fpg_cmplx (FPGROWTH *fpg)
   pex = tbg_wgt(fpg->tabag);    /* check against the minimum support */
   if (fpg->supp > pex) return 0;/* and get minimum for perfect exts. */
   if (!(fpg->mode & FPG_PERFECT)) pex = SUPP_MAX;
-  n = tbg_cnt(fpg->tabag);      /* get the number of transactions */
-  k = tbg_itemcnt(fpg->tabag);  /* and check the number of items */
+  k = tbg_itemcnt(fpg->tabag);  /* get the number of items */
   if (k <= 0) return isr_report(fpg->report);
   f = tbg_ifrqs(fpg->tabag, 0); /* get the item frequencies */
   if (!f) return -1;            /* in the transaction bag */
@@ -1223,7 +1871,7 @@ int fpg_cmplx (FPGROWTH *fpg)
   tree = (CSTREE*)malloc(sizeof(CSTREE) +(size_t)(m-1) *sizeof(CSHEAD));
   if (!tree) { free(fpg->set); return -1; }
   tree->cnt = k = m;            /* allocate the base tree structure */
-  tree->mem = ms_create(sizeof(CSNODE), 65535);
+  tree->mem = getmem(fpg, sizeof(CSNODE));
   if (!tree->mem) { free(tree); free(fpg->set); return -1; }
   tree->root.id      = TA_END;  /* create memory system for the nodes */
   tree->root.supp    = 0;       /* and initialize the root node */
@@ -1237,20 +1885,38 @@ int fpg_cmplx (FPGROWTH *fpg)
     if (!fpg->fim16) { ms_delete(tree->mem);
       free(tree); free(fpg->set); return -1; }
   }                             /* create a 16-items machine */
-  for (j = n; --j >= 0; ) {     /* traverse the transactions and */
-    t = tbg_tract(fpg->tabag,j);/* collect the non-eliminated items */
+  fpg->fim64 = NULL;            /* default: no 32/64-items machine */
+  if (fpg->mode & (FPG_FIM32|FPG_FIM64)) {
+    fpg->fim64 = m64_create((fpg->mode & FPG_FIM64) ? 64 : 32,
+                            fpg->dir, fpg->supp, fpg->report);
+    if (!fpg->fim64) { if (fpg->fim16) m16_delete(fpg->fim16);
+      ms_delete(tree->mem); free(tree); free(fpg->set); return -1; }
+  }                             /* create a 32/64-items machine */
+  bnr_begin(fpg->bench, "build");
+  iter = tbi_create(fpg->tabag);
+  if (!iter) r = -1;            /* create a transaction iterator */
+  while (iter && ((t = tbi_next(iter)) != NULL)) {
     for (k = 0, p = ta_items(t); *p > TA_END; p++)
       if ((m = d[*p]) >= 0) s[k++] = m;
     r = add_cmplx(tree, s, k, ta_wgt(t));
     if (r < 0) break;           /* add the reduced transaction */
   }                             /* to the frequent pattern tree */
+  tbi_delete(iter);             /* delete the iterator */
+  if (fpg->bench || fpg->stats) fpg->nodes += cst_count(tree);
+  bnr_begin(fpg->bench, "mine");
   if (r >= 0) {                 /* if freq. pattern tree was built */
-    r = rec_cmplx(fpg, tree);   /* find freq. item sets recursively */
+    r = ((fpg->cpus != 1)       /* if to use multiple threads */
+    &&  !(fpg->target & (ISR_CLOSED|ISR_MAXIMAL|ISR_GENERAS)))
+      ? par_cmplx(fpg, tree)    /* process top level in parallel */
+      : rec_cmplx(fpg, tree);   /* find freq. item sets recursively */
     if (r >= 0) r = isr_report(fpg->report);
   }                             /* report the empty item set */
   if (fpg->fim16)               /* if a 16-items machine was used, */
     m16_delete(fpg->fim16);     /* delete the 16-items machine */
-  ms_delete(tree->mem);         /* delete the memory mgmt. system */
+  if (fpg->fim64)               /* if a 32/64-items machine was used, */
+    m64_delete(fpg->fim64);     /* delete the 32/64-items machine */
+  if (fpg->stats) sts_mem(fpg->stats, tree->mem, sizeof(CSNODE));
+  putmem(fpg, tree->mem);       /* keep the memory mgmt. system */
   free(tree); free(fpg->set);   /* and the frequent pattern tree */
   #ifdef VISITED                /* if to report visited search nodes */
   fprintf(stderr, "\rtotal nodes  : %24"SIZE_FMT"%26s\n",
@@ -1280,6 +1946,8 @@ static int rec_single (FPGROWTH *fpg, FPTREE *tree, ITEM n)
   i = (tree->fim16) ? 1 : 0;    /* skip packed items if they exist */
   for (r = 0; i < n; i++) {     /* traverse the (other) items, */
     h = tree->heads +i;         /* but skip infrequent items */
+    if (fpg->stats)             /* count the current search node */
+      fpg->stats->visited += 1; /* (for the search statistics) */
     #ifdef VISITED              /* if to report visited search nodes */
     fpg->visited += 1;          /* count current node as visited */
     if ((fpg->visited % 10000) == 0) {
@@ -1287,7 +1955,10 @@ static int rec_single (FPGROWTH *fpg, FPTREE *tree, ITEM n)
       fprintf(stderr, "  %24"SIZE_FMT, isr_repcnt(fpg->report));
     }                           /* print numbers every 10000 nodes */
     #endif                      /* (visited nodes and reported sets) */
-    if (h->supp < fpg->supp) continue;
+    if (OVER(fpg)) {            /* if the search budget is exhausted, */
+      r = -1; break; }          /* abort the search (partial result) */
+    if ((h->supp < fpg->supp) || BELOW(fpg, h->supp))
+      continue;                 /* skip infrequent items */
     r = isr_add(fpg->report, h->item, h->supp);
     if (r <  0) break;          /* add current item to the reporter */
     if (r <= 0) continue;       /* check if item needs processing */
@@ -1336,13 +2007,17 @@ static int rec_single (FPGROWTH *fpg, FPTREE *tree, ITEM n)
         r = m16_mine(tree->fim16);
         if (r < 0) { m = 0; break; }
       }                         /* mine frequent item sets */
-      if (m > 0) r = rec_single(fpg, tree, i);
+      if (m > 0) RECURSE(fpg, r, m, rec_single(fpg, tree, i));
       if (r < 0) break;         /* if the projection is not empty, */
     }                           /* process it recursively */
     r = isr_report(fpg->report);/* report the current item set */
     if (r < 0) break;           /* and check for an error */
     isr_remove(fpg->report, 1); /* remove the current item */
   }                             /* from the item set reporter */
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for ( ; i < n; i++)
+      bound(fpg, tree->heads[i].supp);
+  }                             /* note max. support of skipped items */
   return r;                     /* return the error status */
 }  /* rec_single() */
 
@@ -1352,7 +2027,7 @@ int fpg_single (FPGROWTH *fpg)
 {                               /* --- search for frequent item sets */
   int        r = 0;             /* result of recursion/functions */
   ITEM       i, k, m;           /* loop variable, number of items */
-  TID        j, n;              /* loop variable, number of trans. */
+  TBGITER    *iter;             /* to traverse the transactions */
   SUPP       pex;               /* minimum support for perfect exts. */
   ITEM       *s, *d;            /* to build the item maps */
   const ITEM *p;                /* to traverse transaction items */
@@ -1369,8 +2044,7 @@ int fpg_single (FPGROWTH *fpg)
   pex = tbg_wgt(fpg->tabag);    /* check against the minimum support */
   if (fpg->supp > pex) return 0;/* and get minimum for perfect exts. */
   if (!(fpg->mode & FPG_PERFECT)) pex = SUPP_MAX;
-  n = tbg_cnt(fpg->tabag);      /* get the number of transactions */
-  k = tbg_itemcnt(fpg->tabag);  /* and check the number of items */
+  k = tbg_itemcnt(fpg->tabag);  /* get the number of items */
   if (k <= 0) return isr_report(fpg->report);
   f = tbg_ifrqs(fpg->tabag, 0); /* get the item frequencies */
   if (!f) return -1;            /* in the transaction bag */
@@ -1392,7 +2066,7 @@ int fpg_single (FPGROWTH *fpg)
   if (!tree) { free(fpg->set); return -1; }
   tree->cnt = k = m;            /* allocate the base tree structure */
   tree->dir = fpg->dir;         /* and initialize its fields */
-  tree->mem = ms_create(sizeof(FPNODE), 65535);
+  tree->mem = getmem(fpg, sizeof(FPNODE));
   if (!tree->mem) { free(tree); free(fpg->set); return -1; }
   tree->root.id   = TA_END;     /* create memory system for the nodes */
   tree->root.supp = 0;          /* and initialize the root node */
@@ -1405,8 +2079,10 @@ int fpg_single (FPGROWTH *fpg)
   }                             /* create a 16-items machine */
   for (i = 0; i < k; i++) {     /* initialize the item heads */
     h = tree->heads+i; h->supp = f[h->item = s[i]]; h->list = NULL; }
-  for (j = n; --j >= 0; ) {     /* traverse the transactions and */
-    t = tbg_tract(fpg->tabag,j);/* collect the non-eliminated items */
+  bnr_begin(fpg->bench, "build");
+  iter = tbi_create(fpg->tabag);
+  if (!iter) r = -1;            /* create a transaction iterator */
+  while (iter && ((t = tbi_next(iter)) != NULL)) {
     for (k = 0, p = ta_items(t); *p > TA_END; p++) {
       if      ((m = *p)   <  0) s[k++] = m;
       else if ((m = d[m]) >= 0) s[k++] = m;
@@ -1414,6 +2090,9 @@ int fpg_single (FPGROWTH *fpg)
     r = add_smp16(tree, s, k, ta_wgt(t));
     if (r < 0) break;           /* add the reduced transaction */
   }                             /* to the frequent pattern tree */
+  tbi_delete(iter);             /* delete the iterator */
+  if (fpg->bench || fpg->stats) fpg->nodes += fpt_count(tree);
+  bnr_begin(fpg->bench, "mine");
   if ((r >= 0) && tree->fim16)  /* if there is a 16-items machine, */
     r = m16_mine(tree->fim16);  /* mine frequent item sets with it */
   if (r >= 0) {                 /* if freq. pattern tree was built */
@@ -1422,7 +2101,8 @@ int fpg_single (FPGROWTH *fpg)
   }                             /* find freq. item sets recursively */
   if (tree->fim16)              /* if a 16-items machine was used, */
     m16_delete(tree->fim16);    /* delete the 16-items machine */
-  ms_delete(tree->mem);         /* delete the memory mgmt. system */
+  if (fpg->stats) sts_mem(fpg->stats, tree->mem, sizeof(FPNODE));
+  putmem(fpg, tree->mem);       /* keep the memory mgmt. system */
   free(tree); free(fpg->set);   /* and the frequent pattern tree */
   #ifdef VISITED                /* if to report visited search nodes */
   fprintf(stderr, "\rtotal nodes  : %24"SIZE_FMT"%26s\n",
@@ -1560,14 +2240,17 @@ static int rec_topdn (FPGROWTH *fpg, TDTREE *tree)
   }                             /* abort the recursion */
   if ((tree->cnt > 1)           /* if there is more than one item */
   &&  isr_xable(fpg->report,2)){/* and another item can be added */
-    proj = (TDTREE*)malloc(sizeof(TDTREE)
+    proj = (TDTREE*)getprj(fpg, sizeof(TDTREE)
                          +(size_t)(tree->cnt-2) *sizeof(ITEM));
     if (!proj) return -1;       /* create a frequent pattern tree */
     proj->mem = tree->mem;      /* of the maximally possible size */
-    if (ms_push(tree->mem) < 0) { free(proj); return -1; }
+    if (ms_push(tree->mem) < 0) return -1;
   }                             /* note the current memory state */
   for (node = tree->root; node; node = tree->root) {
-    r = isr_add(fpg->report, tree->items[node->id], node->supp);
+    if (OVER(fpg)) {            /* if the search budget is exhausted, */
+      r = -1; break; }          /* abort the search (partial result) */
+    r = (BELOW(fpg, node->supp)) ? 0  /* skip items below a raised */
+      : isr_add(fpg->report, tree->items[node->id], node->supp);
     if (r <  0) break;          /* add current item to the reporter */
     if (r <= 0) {               /* check if item needs processing */
       tree->root = merge(node->sibling, node->children); continue; }
@@ -1577,6 +2260,8 @@ static int rec_topdn (FPGROWTH *fpg, TDTREE *tree)
       pex = (fpg->mode & FPG_PERFECT) ? node->supp : SUPP_MAX;
       map = fpg->map;           /* get perfect extension support */
       for (i = k = 0; i < node->id; i++) {
+        if (fpg->stats)         /* count the current search node */
+          fpg->stats->visited++;/* (for the search statistics) */
         #ifdef VISITED          /* if to report visited search nodes */
         fpg->visited += 1;      /* count current node as visited */
         if ((fpg->visited % 10000) == 0) {
@@ -1594,7 +2279,7 @@ static int rec_topdn (FPGROWTH *fpg, TDTREE *tree)
         proj->cnt  = k;         /* note the number of items */
         proj->root = copy(node->children, map, proj->mem);
         if (proj->root == COPYERR) { r = -1; break; }
-        r = rec_topdn(fpg, proj);
+        RECURSE(fpg, r, k, rec_topdn(fpg, proj));
         if (r < 0) break;       /* copy the subtree for the item */
       }                         /* and process it recursively */
     }
@@ -1603,8 +2288,13 @@ static int rec_topdn (FPGROWTH *fpg, TDTREE *tree)
     isr_remove(fpg->report, 1); /* remove the current item */
     tree->root = merge(node->sibling, node->children);
   }                             /* prune the processed item */
-  if (proj) {                   /* delete the created projection */
-    free(proj); ms_pop(tree->mem); }
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for (pex = 0; node; node = node->sibling)
+      pex += node->supp;        /* sum the support of the remaining */
+    bound(fpg, pex);            /* top level nodes, which bounds the */
+  }                             /* support of all unprocessed sets */
+  if (proj)                     /* release the created projection */
+    ms_pop(tree->mem);          /* (nodes only, header is kept) */
   return r;                     /* return the error status */
 }  /* rec_topdn() */
 
@@ -1614,7 +2304,7 @@ int fpg_topdn (FPGROWTH *fpg)
 {                               /* --- search for frequent item sets */
   int        r = 0;             /* result of recursion/functions */
   ITEM       i, k, m;           /* loop variable, number of items */
-  TID        j, n;              /* loop variable, number of trans. */
+  TBGITER    *iter;             /* to traverse the transactions */
   SUPP       pex;               /* minimum support for perfect exts. */
   TRACT      *t;                /* to traverse the transactions */
   ITEM       *s, *d;            /* to traverse flags / items */
@@ -1630,8 +2320,7 @@ int fpg_topdn (FPGROWTH *fpg)
   pex = tbg_wgt(fpg->tabag);    /* check against the minimum support */
   if (fpg->supp > pex) return 0;/* and get minimum for perfect exts. */
   if (!(fpg->mode & FPG_PERFECT)) pex = SUPP_MAX;
-  n = tbg_cnt(fpg->tabag);      /* get the number of transactions */
-  k = tbg_itemcnt(fpg->tabag);  /* and check the number of items */
+  k = tbg_itemcnt(fpg->tabag);  /* get the number of items */
   if (k <= 0) return isr_report(fpg->report);
   f = tbg_ifrqs(fpg->tabag, 0); /* get the item frequencies */
   if (!f) return -1;            /* in the transaction bag */
@@ -1653,21 +2342,27 @@ int fpg_topdn (FPGROWTH *fpg)
   if (!tree) { free(fpg->set); return -1; }
   tree->cnt  = k = m;           /* create a top-down prefix tree and */
   tree->root = NULL;            /* the memory system for the nodes */
-  tree->mem  = ms_create(sizeof(TDNODE), 65535);
+  tree->mem  = getmem(fpg, sizeof(TDNODE));
   if (!tree->mem) { free(tree); free(fpg->set); return -1; }
-  memcpy(tree->items, d, (size_t)k *sizeof(ITEM));
-  for (j = n; --j >= 0; ) {     /* traverse the transactions and */
-    t = tbg_tract(fpg->tabag,j);/* collect the non-eliminated items */
+  memcpy(tree->items, s, (size_t)k *sizeof(ITEM));
+  bnr_begin(fpg->bench, "build");
+  iter = tbi_create(fpg->tabag);
+  if (!iter) r = -1;            /* create a transaction iterator */
+  while (iter && ((t = tbi_next(iter)) != NULL)) {
     for (k = 0, p = ta_items(t); *p > TA_END; p++)
       if ((m = d[*p]) >= 0) s[k++] = m;
     r = add_topdn(tree, s, k, ta_wgt(t));
     if (r < 0) break;           /* add the reduced transaction */
   }                             /* to the frequent pattern tree */
+  tbi_delete(iter);             /* delete the iterator */
+  if (fpg->bench || fpg->stats) fpg->nodes += tdt_count(tree->root);
+  bnr_begin(fpg->bench, "mine");
   if (r >= 0) {                 /* if freq. pattern tree was built, */
     r = rec_topdn(fpg, tree);   /* find freq. item sets recursively */
     if (r >= 0) r = isr_report(fpg->report);
   }                             /* report the empty item set */
-  ms_delete(tree->mem);         /* delete the memory mgmt. system */
+  if (fpg->stats) sts_mem(fpg->stats, tree->mem, sizeof(TDNODE));
+  putmem(fpg, tree->mem);       /* keep the memory mgmt. system */
   free(tree); free(fpg->set);   /* delete the frequent pattern tree */
   #ifdef VISITED                /* if to report visited search nodes */
   fprintf(stderr, "\rtotal nodes  : %24"SIZE_FMT"%26s\n",
@@ -1699,6 +2394,8 @@ int rec_tree (FPGROWTH *fpg, FPTREE *tree, ITEM n)
     return -1;                  /* add children to current node */
   for (i = 1; i < n; i++) {     /* traverse the items, */
     h = tree->heads +i;         /* but skip the infrequent items */
+    if (fpg->stats)             /* count the current search node */
+      fpg->stats->visited += 1; /* (for the search statistics) */
     #ifdef VISITED              /* if to report visited search nodes */
     fpg->visited += 1;          /* count current node as visited */
     if ((fpg->visited % 10000) == 0) {
@@ -1730,7 +2427,7 @@ int rec_tree (FPGROWTH *fpg, FPTREE *tree, ITEM n)
       ist_setsupp(fpg->istree, h->item, h->supp);
       m += 1;                   /* set the item set support and */
     }                           /* count the frequent items */
-    if (m > 0) r = rec_tree(fpg, tree, i);
+    if (m > 0) RECURSE(fpg, r, m, rec_tree(fpg, tree, i));
     if (r < 0) break;           /* if the projection is not empty, */
     ist_up(fpg->istree);        /* process it recursively, */
   }                             /* then go back up in the tree */
@@ -1743,7 +2440,7 @@ int fpg_tree (FPGROWTH *fpg)
 {                               /* --- search for frequent item sets */
   int        r = 0;             /* result of recursion/functions */
   ITEM       i, k, m;           /* loop variable, number of items */
-  TID        j, n;              /* loop variable, number of trans. */
+  TBGITER    *iter;             /* to traverse the transactions */
   ITEM       *s, *d;            /* to build the item maps */
   const ITEM *p;                /* to traverse transaction items */
   const SUPP *f;                /* item frequencies in trans. bag */
@@ -1768,16 +2465,17 @@ int fpg_tree (FPGROWTH *fpg)
   if (!tree)  { free(fpg->set); return -1; }
   tree->cnt = k = m;            /* allocate the base tree structure */
   tree->dir = fpg->dir;         /* and initialize its fields */
-  tree->mem = ms_create(sizeof(FPNODE), 65535);
+  tree->mem = getmem(fpg, sizeof(FPNODE));
   if (!tree->mem) { free(tree); free(fpg->set); return -1; }
   tree->root.id   = TA_END;     /* create memory system for the nodes */
   tree->root.supp = 0;          /* and initialize the root node */
   tree->root.succ = tree->root.parent = NULL;
   for (i = 0; i < k; i++) {     /* initialize the item heads */
     h = tree->heads+i; h->supp = f[h->item = s[i]]; h->list = NULL; }
-  n = tbg_cnt(fpg->tabag);      /* get the number of transactions */
-  for (j = n; --j >= 0; ) {     /* traverse the transactions and */
-    t = tbg_tract(fpg->tabag,j);/* collect the non-eliminated items */
+  bnr_begin(fpg->bench, "build");
+  iter = tbi_create(fpg->tabag);
+  if (!iter) r = -1;            /* create a transaction iterator */
+  while (iter && ((t = tbi_next(iter)) != NULL)) {
     for (k = 0, p = ta_items(t); *p > TA_END; p++) {
       if      ((m = *p)   <  0) s[k++] = m;
       else if ((m = d[m]) >= 0) s[k++] = m;
@@ -1785,9 +2483,13 @@ int fpg_tree (FPGROWTH *fpg)
     r = add_simple(tree, s, k, ta_wgt(t));
     if (r < 0) break;           /* add the reduced transaction */
   }                             /* to the frequent pattern tree */
+  tbi_delete(iter);             /* delete the iterator */
+  if (fpg->bench || fpg->stats) fpg->nodes += fpt_count(tree);
+  bnr_begin(fpg->bench, "mine");
   if (r >= 0)                   /* find freq. item sets recursively */
     r = rec_tree(fpg, tree, tree->cnt);
-  ms_delete(tree->mem);         /* delete the memory mgmt. system */
+  if (fpg->stats) sts_mem(fpg->stats, tree->mem, sizeof(FPNODE));
+  putmem(fpg, tree->mem);       /* keep the memory mgmt. system */
   free(tree); free(fpg->set);   /* and the frequent pattern tree */
   return r;                     /* return the error status */
 }  /* fpg_tree() */
@@ -1803,6 +2505,287 @@ static FPGFN* fpgvars[] = {     /* --- table of fp-growth variants */
   fpg_topdn,                    /* top-down processing of the tree */
 };
 
+#ifndef QUIET                   /* if to print messages */
+static const char *fpgnames[] = {  /* --- names of the variants */
+  "simple", "complex", "single", "top-down" };
+#endif
+
+/*----------------------------------------------------------------------
+  Automatic Choice of the Algorithm Variant
+----------------------------------------------------------------------*/
+
+static void adapt (FPGROWTH *fpg)
+{                               /* --- make variant and modes consist. */
+  int e;                        /* evaluation without flags */
+
+  if (fpg->target == ISR_GENERAS) { /* if to filter for generators, */
+    fpg->mode |=  FPG_PERFECT;  /* need perfect extension pruning */
+    if (fpg->algo == FPG_TOPDOWN) fpg->algo = FPG_SINGLE; }
+  else if (fpg->target & (ISR_CLOSED|ISR_MAXIMAL)) {
+    fpg->mode &= ~FPG_REORDER;  /* reordering only for all item sets */
+    if (fpg->algo == FPG_SINGLE) fpg->algo = FPG_SIMPLE;
+  }                             /* not all variants work for filter */
+  e = fpg->eval & ~FPG_INVBXS;  /* get target and remove flags */
+  if ((fpg->target & ISR_RULES) || ((e > RE_NONE) && (e < RE_FNCNT)))
+    fpg->mode &= ~(FPG_FIM16|FPG_FIM32|FPG_FIM64); /* no packing */
+  if (!(fpg->target & ISR_MAXIMAL)) /* tail pruning only for mining */
+    fpg->mode &= ~FPG_TAIL;     /* maximal frequent item sets */
+  if (fpg->algo == FPG_AUTO)    /* the remaining modes depend on */
+    return;                     /* the (later) chosen variant */
+  if (fpg->algo != FPG_COMPLEX) /* reordering/recoding of items */
+    fpg->mode &= ~FPG_REORDER;  /* only for complex trees */
+  if ((fpg->algo != FPG_SIMPLE) && (fpg->algo != FPG_COMPLEX)
+  &&  (fpg->algo != FPG_SINGLE))/* not all algorithm variants */
+    fpg->mode &= ~FPG_FIM16;    /* support a 16-items machine */
+  if (fpg->algo != FPG_COMPLEX) /* 32/64-items machine is only used */
+    fpg->mode &= ~(FPG_FIM32|FPG_FIM64);  /* in the recursion on */
+  if (fpg->mode & FPG_FIM64)    /* complex fp-trees; the wider */
+    fpg->mode &= ~FPG_FIM32;    /* machine takes precedence */
+}  /* adapt() */
+
+/*--------------------------------------------------------------------*/
+
+static double sharing (TABAG *tabag)
+{                               /* --- compute prefix tree node ratio */
+  TID        i, n;              /* loop variable, num. of transactions */
+  size_t     x, c;              /* extent, number of prefix tree nodes */
+  const ITEM *p, *q, *s;        /* to traverse the transaction items */
+
+  x = tbg_extent(tabag);        /* get the number of item instances */
+  if (x <= 0) return 1;         /* (upper bound on number of nodes) */
+  n = tbg_cnt(tabag);           /* traverse the (sorted) transactions */
+  for (c = 0, s = NULL, i = 0; i < n; i++) {
+    p = q = ta_items(tbg_tract(tabag, i));
+    if (s) { while ((*p > TA_END) && (*p == *s)) { p++; s++; } }
+    for ( ; *p > TA_END; p++) c++;
+    s = q;                      /* skip the prefix shared with the */
+  }                             /* preceding transaction and count */
+  return (double)c /(double)x;  /* the nodes for the remaining items */
+}  /* sharing() */
+
+/*--------------------------------------------------------------------*/
+
+static void choose (FPGROWTH *fpg)
+{                               /* --- choose the algorithm variant */
+  ITEM   m;                     /* number of (frequent) items */
+  TID    n;                     /* number of transactions */
+  double dens, share;           /* density and prefix tree node ratio */
+  int    e;                     /* evaluation without flags */
+  #ifndef QUIET                 /* if to print messages */
+  clock_t t;                    /* timer for measurements */
+  #endif                        /* (only needed for messages) */
+
+  assert(fpg && fpg->tabag);    /* check the function argument */
+  if (fpg->algo != FPG_AUTO) return;
+  CLOCK(t);                     /* start timer, print log message */
+  XMSG(stderr, "choosing algorithm variant ... ");
+  m = tbg_itemcnt(fpg->tabag);  /* get the number of items */
+  n = tbg_cnt(fpg->tabag);      /* and transactions and compute */
+  dens = ((m > 0) && (n > 0))   /* the density of the data */
+       ? (double)tbg_extent(fpg->tabag) /((double)m *(double)n) : 0;
+  share = sharing(fpg->tabag);  /* compute the node ratio */
+  e = fpg->eval & ~FPG_INVBXS;  /* get the evaluation measure */
+  if ((fpg->target & ISR_RULES) || ((e > RE_NONE) && (e < RE_FNCNT)))
+    fpg->algo = FPG_COMPLEX;    /* rules use a single tree anyway */
+  else if ((dens >= AUTO_DENSE) || (m <= 16)) {
+    fpg->algo = FPG_SIMPLE;     /* dense data: use simple nodes */
+    if (fpg->mode & FPG_FIM16)  /* with a full 16-items machine */
+      fpg->mode = (fpg->mode & ~FPG_FIM16) | 16; }
+  else if ((fpg->target & (ISR_CLOSED|ISR_MAXIMAL))
+  &&       (share >= AUTO_SHARE))
+    fpg->algo = FPG_TOPDOWN;    /* sparse data with little sharing */
+  else                          /* otherwise use complex nodes */
+    fpg->algo = FPG_COMPLEX;    /* (with reordering if possible) */
+  adapt(fpg);                   /* adapt the modes to the variant */
+  XMSG(stderr, "[%s", fpgnames[fpg->algo]);
+  if ((fpg->algo != FPG_COMPLEX) && (fpg->mode & FPG_FIM16)) {
+    XMSG(stderr, ", %d-items machine", fpg->mode & FPG_FIM16); }
+  if (fpg->mode & FPG_REORDER) { XMSG(stderr, ", reordering"); }
+  XMSG(stderr, "; density %.3g, node ratio %.3g]", dens, share);
+  XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+}  /* choose() */
+
+/* The statistics are computed after the transactions have been      */
+/* recoded, sorted and reduced: the density is the fraction of the   */
+/* (frequent) items contained in an average transaction, and the     */
+/* node ratio is the number of nodes of a prefix tree built from the */
+/* sorted transactions divided by the number of item instances (it   */
+/* is low if the transactions share long prefixes). Dense data (or   */
+/* few items) is processed best with simple nodes and a 16-items     */
+/* machine, sparse data with little prefix sharing for closed and    */
+/* maximal item sets with the top-down variant, and everything else  */
+/* with complex nodes (which allow for item reordering).             */
+
+/*----------------------------------------------------------------------
+  Frequent Pattern Growth (memory bounded, projected databases on disk)
+----------------------------------------------------------------------*/
+
+static int spillable (FPGROWTH *fpg)
+{                               /* --- check for disk projections */
+  int e = fpg->eval & ~FPG_INVBXS;   /* evaluation without flags */
+  return (fpg->mmax > 0)        /* memory budget must be given and */
+  &&     !(fpg->target & (ISR_CLOSED|ISR_MAXIMAL|ISR_GENERAS|ISR_RULES))
+  &&     ((e <= RE_NONE) || (e >= RE_FNCNT));
+}  /* spillable() */            /* only all frequent item sets */
+
+/*--------------------------------------------------------------------*/
+
+static size_t treesize (FPGROWTH *fpg, TABAG *tabag)
+{                               /* --- estimate size of the fp-tree */
+  size_t z;                     /* size of a tree node */
+
+  switch (fpg->algo) {          /* evaluate the algorithm variant */
+    case FPG_COMPLEX: z = sizeof(CSNODE); break;
+    case FPG_TOPDOWN: z = sizeof(TDNODE); break;
+    default:          z = sizeof(FPNODE); break;
+  }                             /* (at most one node per instance) */
+  return tbg_extent(tabag) *z;  /* return an upper bound on the size */
+}  /* treesize() */
+
+/*--------------------------------------------------------------------*/
+
+static TABAG* readprj (FILE *file, ITEMBASE *base, ITEM *buf)
+{                               /* --- read a projected database */
+  ITEM  n;                      /* number of items in transaction */
+  SUPP  w;                      /* weight of a transaction */
+  TABAG *proj;                  /* projected transaction bag */
+  TRACT *t;                     /* to create the transactions */
+
+  proj = tbg_create(base);      /* create a projected trans. bag */
+  if (!proj) return NULL;       /* and read the projected database */
+  rewind(file);                 /* from the start of the file */
+  while (fread(&w, sizeof(SUPP), 1, file) == 1) {
+    if ((fread(&n,  sizeof(ITEM), 1, file) != 1)
+    ||  (fread(buf, sizeof(ITEM), (size_t)n, file) != (size_t)n))
+      break;                    /* read transaction weight and items */
+    t = ta_create(buf, n, w);   /* create a transaction and */
+    if (!t) break;              /* add it to the projected bag */
+    if (tbg_add(proj, t) != 0) { ta_delete(t); break; }
+  }
+  if (!feof(file) || ferror(file)) {
+    tbg_delete(proj, 0); return NULL; }
+  tbg_sort(proj, +1, 0);        /* sort and reduce the transactions */
+  tbg_reduce(proj, 0);          /* (combine equal transactions) */
+  return proj;                  /* return the projected trans. bag */
+}  /* readprj() */
+
+/*--------------------------------------------------------------------*/
+
+static int spill (FPGROWTH *fpg)
+{                               /* --- mine with disk projections */
+  int        r = 0;             /* result of recursion/functions */
+  int        cpus;              /* number of threads for mining */
+  ITEM       i, k, m, c;        /* loop variables, number of items */
+  ITEM       a, b, x, y;        /* range of items of a pass, indices */
+  SUPP       pex, w;            /* min. supp. for perf. exts., weight */
+  ITEM       *s, *d, *q;        /* item list, file indices, buffer */
+  const ITEM *p, *o;            /* to traverse transaction items */
+  const SUPP *f;                /* item frequencies in trans. bag */
+  TABAG      *tabag;            /* transaction bag to project */
+  TABAG      *proj;             /* projected transaction bag */
+  TRACT      *t;                /* to traverse the transactions */
+  TBGITER    *iter;             /* to traverse the transactions */
+  FILE       **files;           /* temporary files for projections */
+
+  assert(fpg);                  /* check the function argument */
+  tabag = fpg->tabag;           /* if the fp-tree fits the budget, */
+  if (!spillable(fpg) || (treesize(fpg, tabag) <= fpg->mmax))
+    return fpgvars[fpg->algo](fpg);   /* mine the data directly */
+  pex = tbg_wgt(tabag);         /* check against the minimum support */
+  if (fpg->supp > pex) return 0;/* and get minimum for perfect exts. */
+  if (!(fpg->mode & FPG_PERFECT)) pex = SUPP_MAX;
+  k = tbg_itemcnt(tabag);       /* get the number of items */
+  if (k <= 0) return isr_report(fpg->report);
+  f = tbg_ifrqs(tabag, 0);      /* get the item frequencies */
+  if (!f) return -1;            /* in the transaction bag */
+  files = (FILE**)malloc((size_t)SPILLMAX *sizeof(FILE*)
+                        +(size_t)(k+k+tbg_max(tabag)) *sizeof(ITEM));
+  if (!files) return -1;        /* create file and item arrays */
+  iter = tbi_create(tabag);     /* and a transaction iterator */
+  if (!iter) { free(files); return -1; }
+  s = (ITEM*)(files+SPILLMAX);  /* and organize the memory */
+  d = s+k; q = d+k;             /* (items, file indices, buffer) */
+  for (i = m = 0; i < k; i++) { /* collect the items to process */
+    if (f[i] <  fpg->supp) { d[i] = -2; continue; }
+    if (f[i] >= pex)       { isr_addpex(fpg->report, i);
+                             d[i] = -2; continue; }
+    d[i] = -1; s[m++] = i;      /* eliminate infrequent items and */
+  }                             /* collect perfect extension items */
+  cpus = fpg->cpus;             /* projections are mined with one */
+  fpg->cpus = 1;                /* thread (clones need empty sets) */
+  y = m;                        /* init. the first incomplete item */
+  for (a = 0; (a < m) && (r >= 0); a = b) {
+    b = (m-a > SPILLMAX) ? a+SPILLMAX : m;
+    for (x = a; x < b; x++) {   /* traverse the items of this pass */
+      files[x-a] = tmpfile();   /* and create a temporary file */
+      if (!files[x-a]) break;   /* for the projection of each item */
+      d[s[x]] = x-a;            /* note the file index in the map */
+    }
+    if (x < b) { r = -1; b = x; }
+    bnr_begin(fpg->bench, "spill");
+    tbi_seek(iter, 0);          /* traverse the transactions */
+    while ((r >= 0) && ((t = tbi_next(iter)) != NULL)) {
+      w = ta_wgt(t);            /* and the items they contain */
+      for (p = ta_items(t); *p > TA_END; p++) {
+        if (((i = *p) < 0) || ((x = d[i]) < 0))
+          continue;             /* skip items not in this pass */
+        for (c = 0, o = ta_items(t); *o > TA_END; o++)
+          if ((*o >= 0) && (d[*o] >= -1) && PRECEDES(f, *o, i))
+            q[c++] = *o;        /* collect the preceding items */
+        if ((fwrite(&w, sizeof(SUPP), 1, files[x]) != 1)
+        ||  (fwrite(&c, sizeof(ITEM), 1, files[x]) != 1)
+        ||  (fwrite(q,  sizeof(ITEM), (size_t)c, files[x])
+                                   != (size_t)c)) {
+          r = -1; break; }      /* write the projected transaction */
+      }                         /* to the file of the item */
+    }
+    for (x = a; x < b; x++) {   /* traverse the items of this pass */
+      i = s[x]; d[i] = -1;      /* get the item and clear its index */
+      if (r >= 0) r = isr_add(fpg->report, i, f[i]);
+      if (r > 0) {              /* if the item needs processing */
+        if (!isr_xable(fpg->report, 1))   /* if no other item */
+          r = isr_report(fpg->report);    /* can be added, only */
+        else {                  /* report the current item set */
+          proj = readprj(files[x-a], tbg_base(tabag), q);
+          if (!proj) r = -1;    /* read the projected database */
+          else {                /* and mine it recursively (as it */
+            fpg->tabag = proj;  /* may also exceed the budget) */
+            r = spill(fpg);     /* with the current item as prefix */
+            fpg->tabag = tabag; tbg_delete(proj, 0);
+          }                     /* restore the full transaction bag */
+        }                       /* and delete the projection */
+        if (r >= 0) isr_remove(fpg->report, 1);
+      }                         /* remove the current item */
+      if ((r < 0) && (y > x)) y = x;  /* note first incomplete item */
+      fclose(files[x-a]);       /* close (and thus delete) */
+    }                           /* the temporary file */
+  }
+  if (fpg->stop) {              /* if the search budget is exhausted, */
+    for ( ; y < m; y++)
+      bound(fpg, f[s[y]]);
+  }                             /* note max. support of skipped items */
+  fpg->cpus = cpus;             /* restore the number of threads */
+  tbi_delete(iter);             /* delete the transaction iterator */
+  free(files);                  /* and the file and item arrays */
+  if (r < 0) return r;          /* check for an error */
+  return isr_report(fpg->report);  /* report the current item set */
+}  /* spill() */
+
+/* If the frequent pattern tree that would be built for the given    */
+/* transactions exceeds the memory budget (estimated as one node per */
+/* item instance), the transactions are projected, in the style of   */
+/* parallel projection, to one temporary file per frequent item: for */
+/* each transaction containing an item, the items preceding it in    */
+/* the order of descending frequency are written to the file of that */
+/* item. The projected databases are then read back one by one (the  */
+/* one of the least frequent item is largest w.r.t. transactions,    */
+/* the one of the most frequent item has fewest items) and mined     */
+/* with the chosen variant of the algorithm, or projected further if */
+/* they still exceed the budget. At most SPILLMAX files are open at  */
+/* the same time; for more items several passes are executed. Since  */
+/* closed/maximal item sets and generators require a global          */
+/* repository, this is only used for all frequent item sets.         */
+
 /*--------------------------------------------------------------------*/
 
 FPGROWTH* fpg_create (int target, double smin, double smax,
@@ -1811,7 +2794,6 @@ FPGROWTH* fpg_create (int target, double smin, double smax,
                       int algo, int mode)
 {                               /* --- create an fpgrowth miner */
   FPGROWTH *fpg;                /* created fpgrowth miner */
-  int      e;                   /* evaluation without flags */
 
   /* --- make parameters consistent --- */
   if      (target & FPG_RULES)   target = ISR_RULES;
@@ -1821,25 +2803,8 @@ FPGROWTH* fpg_create (int target, double smin, double smax,
   else                           target = ISR_FREQUENT;
   if (!(target & ISR_RULES))    /* if not to find association rules, */
     conf = 100.0;               /* set a neutral confidence */
-  if (algo == FPG_AUTO)         /* if automatic choice of algorithm, */
-    algo = FPG_COMPLEX;         /* use the complex tree type */
-  if (target == ISR_GENERAS) {  /* if to filter for generators, */
-    mode |=  FPG_PERFECT;       /* need perfect extension pruning */
-    if (algo == FPG_TOPDOWN) algo = FPG_SINGLE; }
-  else if (target & (ISR_CLOSED|ISR_MAXIMAL)) {
-    mode &= ~FPG_REORDER;       /* reordering only for all item sets */
-    if (algo == FPG_SINGLE) algo = FPG_SIMPLE;
-  }                             /* not all variants work for filter */
-  if (algo != FPG_COMPLEX)      /* reordering/recoding of items */
-    mode &= ~FPG_REORDER;       /* only for complex trees */
-  if ((algo != FPG_SIMPLE) && (algo != FPG_COMPLEX)
-  &&  (algo != FPG_SINGLE))     /* not all algorithm variants */
-    mode &= ~FPG_FIM16;         /* support a 16-items machine */
-  e = eval & ~FPG_INVBXS;       /* get target and remove flags */
-  if ((target & ISR_RULES) || ((e > RE_NONE) && (e < RE_FNCNT)))
-    mode &= ~FPG_FIM16;         /* eval. does not support packing */
-  if (!(target & ISR_MAXIMAL))  /* tail pruning only for mining */
-    mode &= ~FPG_TAIL;          /* maximal frequent item sets */
+  if ((algo < FPG_SIMPLE) || (algo > FPG_AUTO))
+    algo = FPG_AUTO;            /* check the algorithm variant */
 
   /* --- create an fpgrowth miner --- */
   fpg = (FPGROWTH*)malloc(sizeof(FPGROWTH));
@@ -1864,7 +2829,25 @@ FPGROWTH* fpg_create (int target, double smin, double smax,
   fpg->map    = NULL;
   fpg->cis    = NULL;
   fpg->fim16  = NULL;
+  fpg->fim64  = NULL;
   fpg->istree = NULL;
+  fpg->cpus   = 1;
+  fpg->mmax   = 0;
+  fpg->bench  = NULL;
+  fpg->nodes  = 0;
+  fpg->topk   = 0;
+  fpg->stats  = NULL;
+  fpg->tmax   = 0;
+  fpg->nmax   = 0;
+  fpg->tend   = 0;
+  fpg->ncnt   = 0;
+  fpg->stop   = 0;
+  fpg->miss   = 0;
+  fpg->mem    = NULL;
+  fpg->msize  = 0;
+  fpg->prjs   = NULL;
+  fpg->prjn   = 0;
+  adapt(fpg);                   /* make variant and modes consistent */
   return fpg;                   /* return the created fpgrowth miner */
 }  /* fpg_create() */
 
@@ -1888,6 +2871,9 @@ void fpg_delete (FPGROWTH *fpg, int deldar)
     if (fpg->report) isr_delete(fpg->report, 0);
     if (fpg->tabag)  tbg_delete(fpg->tabag,  1);
   }                             /* delete if existing */
+  fpg_setstats(fpg, 0);         /* delete the search statistics */
+  if (fpg->mem) ms_delete(fpg->mem);
+  clrprj(fpg);                  /* delete the projection buffers */
   free(fpg);                    /* delete the base structure */
 }  /* fpg_delete() */
 
@@ -1917,18 +2903,11 @@ int fpg_data (FPGROWTH *fpg, TABAG *tabag, int mode, int sort)
     smin *= fpg->conf *(1-DBL_EPSILON);
   fpg->supp = (SUPP)ceilsupp(smin);
 
-  /* --- make parameters consistent --- */
-  pack = fpg->mode & FPG_FIM16; /* get number of items to pack */
-  if (pack > 16) pack = 16;     /* pack at most 16 items */
-  if (fpg->algo == FPG_COMPLEX) /* for complex fp-trees, if needed, */
-    pack = 0;                   /* items are packed in the recursion */
-  if (mode & FPG_NOPACK)        /* if excluded by processing mode, */
-    pack = 0;                   /* do not pack items */
-
   /* --- sort and recode items --- */
   if (!(mode & FPG_NORECODE)) { /* if to sort and recode the items */
     CLOCK(t);                   /* start timer, print log message */
     XMSG(stderr, "filtering, sorting and recoding items ... ");
+    bnr_begin(fpg->bench, "recode");
     if (fpg->mode & FPG_REORDER)/* simplified sorting if reordering */
       sort = (sort < 0) ? -1 : (sort > 0) ? +1 : 0;
     m = tbg_recode(tabag, fpg->supp, -1, -1, -sort);
@@ -1941,18 +2920,19 @@ int fpg_data (FPGROWTH *fpg, TABAG *tabag, int mode, int sort)
   /* --- sort and reduce transactions --- */
   CLOCK(t);                     /* start timer, print log message */
   XMSG(stderr, "sorting and reducing transactions ... ");
+  bnr_begin(fpg->bench, "reduce");
   e = fpg->eval & ~FPG_INVBXS;  /* filter transactions if possible */
   if (!(mode & FPG_NOFILTER) && !(fpg->target & ISR_RULES)
   &&  ((e <= RE_NONE) || (e >= RE_FNCNT)))
     tbg_filter(tabag, fpg->zmin, NULL, 0);
   if (!(mode & FPG_NOSORT)) {   /* if to sort items and transactions, */
-    tbg_itsort(tabag, +1, 0);   /* sort items in transactions and */
-    tbg_sort  (tabag, +1, 0);   /* sort the trans. lexicographically */
+    tbg_setcpus(tabag, fpg->cpus);    /* (with radix sort if possible) */
+    tbg_itsort(tabag, +1, TA_RADIX);  /* sort items in transactions */
+    tbg_sort  (tabag, +1, TA_RADIX);  /* and the transactions */
     if (!(mode & FPG_NOREDUCE)) /* if to combine equal transactions, */
       tbg_reduce(tabag, 0);     /* reduce transactions to unique ones */
   }                             /* (need sorting for reduction) */
-  if (pack > 0)                 /* if to use a 16-items machine, */
-    tbg_pack(tabag, pack);      /* pack the most frequent items */
+  bnr_end(fpg->bench);          /* end the reduction phase */
   #ifndef QUIET                 /* if to print messages */
   n = tbg_cnt(tabag);           /* get the number of transactions */
   w = tbg_wgt(tabag);           /* and the transaction weight */
@@ -1960,9 +2940,50 @@ int fpg_data (FPGROWTH *fpg, TABAG *tabag, int mode, int sort)
   if (w != (SUPP)n) { XMSG(stderr, "/%"SUPP_FMT, w); }
   XMSG(stderr, " transaction(s)] done [%.2fs].\n", SEC_SINCE(t));
   #endif
+  choose(fpg);                  /* choose the algorithm variant */
+
+  /* --- pack the most frequent items --- */
+  pack = fpg->mode & FPG_FIM16; /* get number of items to pack */
+  if (pack > 16) pack = 16;     /* pack at most 16 items */
+  if (fpg->algo == FPG_COMPLEX) /* for complex fp-trees, if needed, */
+    pack = 0;                   /* items are packed in the recursion */
+  if (mode & FPG_NOPACK)        /* if excluded by processing mode, */
+    pack = 0;                   /* do not pack items */
+  if (spillable(fpg) && (treesize(fpg, tabag) > fpg->mmax)) {
+    pack = 0;                   /* no packed items in projections */
+    if (fpg->algo != FPG_COMPLEX) fpg->mode &= ~FPG_FIM16;
+  }                             /* (transactions are split on disk) */
+  if (pack > 0)                 /* if to use a 16-items machine, */
+    tbg_pack(tabag, pack);      /* pack the most frequent items */
+
+  /* --- compress the transactions --- */
+  if (mode & FPG_COMPRESS) {    /* if to compress the transactions */
+    CLOCK(t);                   /* start timer, print log message */
+    XMSG(stderr, "compressing transactions ... ");
+    if (tbg_compress(tabag) < 0) return E_NOMEM;
+    XMSG(stderr, "[%"SIZE_FMT" byte(s)]", tbg_zipsize(tabag));
+    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* (only sequential access needed) */
   return 0;                     /* return 'ok' */
 }  /* fpg_data() */
 
+/* All state of a search is held in the FPGROWTH object and the     */
+/* item set reporter that is attached to it with fpg_report(), so   */
+/* that several miners may run concurrently in one process,         */
+/* provided each of them has its own FPGROWTH and ISREPORT objects. */
+/* The transaction bag and its item base may be shared, but only    */
+/* after they have been prepared, because fpg_data() recodes,       */
+/* filters, sorts and packs them in place: the first miner prepares */
+/* the data as usual, all other miners (which must use the same     */
+/* minimum support, target and mode) are then given the data with   */
+/* FPG_NORECODE|FPG_NOFILTER|FPG_NOSORT|FPG_NOPACK, which leaves it */
+/* untouched (FPG_COMPRESS must not be given). Afterwards all       */
+/* access to the transaction bag and the item base is read-only,    */
+/* except for ib_xname(), which formats object names into a buffer  */
+/* of the item base and is called by isr_create(). Hence item set   */
+/* reporters for a shared item base with object names have to be    */
+/* created one after the other.                                     */
+
 /*--------------------------------------------------------------------*/
 
 int fpg_report (FPGROWTH *fpg, ISREPORT *report)
@@ -1988,6 +3009,9 @@ int fpg_report (FPGROWTH *fpg, ISREPORT *report)
   if (fpg->mode & FPG_ZLIB)     /* if the compression flag is set, */
     mrep |= ISR_ZLIB;           /* transfer it to the report mode */
   #endif
+  if (fpg->mode & FPG_BINARY) mrep |= ISR_BINARY;
+  if (fpg->mode & FPG_DELTA)  mrep |= ISR_DELTA;
+  if (fpg->mode & FPG_ASYNC)  mrep |= ISR_ASYNC;
 
   /* --- configure item set reporter --- */
   w = tbg_wgt(fpg->tabag);      /* set support and size range */
@@ -2002,11 +3026,126 @@ int fpg_report (FPGROWTH *fpg, ISREPORT *report)
   if ((isr_prefmt(report, (TID)fpg->supp, n)      != 0)
   ||  (isr_settarg(report, fpg->target, mrep, -1) != 0))
     return E_NOMEM;             /* set pre-format and target type */
+  if ((fpg->topk > 0)           /* if to find the best item sets, */
+  &&  (isr_settopk(report, fpg->topk) != 0))
+    return E_NOMEM;             /* create an item set collector */
   return 0;                     /* return 'ok' */
 }  /* fpg_report() */
 
 /*--------------------------------------------------------------------*/
 
+void fpg_setcpus (FPGROWTH *fpg, int cpus)
+{                               /* --- set number of threads */
+  assert(fpg);                  /* check the function argument */
+  fpg->cpus = cpus;             /* note the number of threads */
+}  /* fpg_setcpus() */          /* (<= 0: use all processors) */
+
+/*--------------------------------------------------------------------*/
+
+void fpg_setmem (FPGROWTH *fpg, size_t mmax)
+{                               /* --- set memory budget */
+  assert(fpg);                  /* check the function argument */
+  fpg->mmax = mmax;             /* note the memory budget */
+}  /* fpg_setmem() */           /* (0: no limit) */
+
+/*--------------------------------------------------------------------*/
+
+void fpg_setbench (FPGROWTH *fpg, BENCHREC *bench)
+{                               /* --- set benchmark record */
+  assert(fpg);                  /* check the function argument */
+  fpg->bench = bench;           /* note the benchmark record */
+}  /* fpg_setbench() */         /* (NULL: no benchmarking) */
+
+/*--------------------------------------------------------------------*/
+
+void fpg_settopk (FPGROWTH *fpg, size_t k)
+{                               /* --- set number of best item sets */
+  assert(fpg);                  /* check the function argument */
+  fpg->topk = (fpg->target & (ISR_MAXIMAL|ISR_RULES))
+            ? 0 : k;            /* note the number of item sets */
+}  /* fpg_settopk() */          /* (0: report all item sets) */
+
+/* If only the k item sets with the highest support are to be found,  */
+/* the item set reporter collects them (see isr_settopk()) and        */
+/* raises its minimum support as soon as k item sets are collected.   */
+/* The search reads the raised minimum support (macro BELOW()), so    */
+/* that the remaining recursion is pruned with it. This is possible   */
+/* for frequent and closed item sets and generators, because the      */
+/* item sets that decide whether an item set qualifies (supersets or  */
+/* subsets with the same support) are never pruned, but not for       */
+/* maximal item sets, for which a rising threshold changes the set    */
+/* of item sets that qualify, and not for association rules.          */
+
+/*--------------------------------------------------------------------*/
+
+int fpg_setstats (FPGROWTH *fpg, int on)
+{                               /* --- enable/disable statistics */
+  assert(fpg);                  /* check the function argument */
+  if (!on) {                    /* if to disable the statistics */
+    if (!fpg->stats) return 0;  /* check for existing statistics */
+    if (fpg->stats->prjcnt) free(fpg->stats->prjcnt);
+    free(fpg->stats); fpg->stats = NULL; return 0;
+  }                             /* delete the search statistics */
+  if (fpg->stats) return 0;     /* check for existing statistics */
+  fpg->stats = (FPGSTATS*)calloc(1, sizeof(FPGSTATS));
+  return (fpg->stats) ? 0 : -1; /* create empty statistics */
+}  /* fpg_setstats() */
+
+/*--------------------------------------------------------------------*/
+
+const FPGSTATS* fpg_stats (FPGROWTH *fpg)
+{                               /* --- get the search statistics */
+  assert(fpg);                  /* check the function argument */
+  if (!fpg->stats) return NULL; /* check for enabled statistics */
+  fpg->stats->nodes = fpg->nodes;
+  return fpg->stats;            /* note the number of tree nodes */
+}  /* fpg_stats() */            /* and return the statistics */
+
+/* The statistics are cleared at the start of fpg_mine() and are    */
+/* updated during the search, so that they may also be read from an */
+/* item set reporting callback (see isr_setrepo(), with the miner   */
+/* as the callback data), for example to monitor whether a search   */
+/* is dominated by the search itself (visited nodes, projections),  */
+/* by the memory of the frequent pattern trees (peak node memory,   */
+/* which is noted whenever a tree is deleted) or by the output      */
+/* (number of output bytes, see isr_nbytes(), and item sets per     */
+/* size, see isr_stats()). For the variant with an item set tree    */
+/* (rules and rule-based evaluation) see also ist_getstats().       */
+
+/*--------------------------------------------------------------------*/
+
+void fpg_setbudget (FPGROWTH *fpg, double secs, size_t nodes)
+{                               /* --- set the search budget */
+  assert(fpg);                  /* check the function argument */
+  fpg->tmax = (secs > 0) ? secs : 0;
+  fpg->nmax = nodes;            /* note the time budget (in seconds) */
+}  /* fpg_setbudget() */        /* and the budget of search nodes */
+
+/*--------------------------------------------------------------------*/
+
+SUPP fpg_covered (FPGROWTH *fpg)
+{                               /* --- get the covered support */
+  assert(fpg);                  /* check the function argument */
+  if (!fpg->stop) return fpg->supp;
+  return (fpg->miss >= fpg->supp) ? fpg->miss+1 : fpg->supp;
+}  /* fpg_covered() */          /* (all sets with this support found) */
+
+/* With a search budget (a limit on the wall clock time and/or the  */
+/* number of search nodes, 0: no limit), fpg_mine() stops the       */
+/* search as soon as the budget is exhausted, keeps the item sets   */
+/* found so far and returns 1 (instead of 0) to indicate a partial  */
+/* result. Then fpg_covered() yields the support down to which the  */
+/* result is complete: every frequent item set with at least this   */
+/* support has been reported (for closed and maximal item sets and  */
+/* generators a reported set may have an unreported superset or     */
+/* subset with the same support, though). With several threads the  */
+/* node budget is shared evenly among the threads. The budget is    */
+/* not checked when association rules are generated (or an          */
+/* evaluation is computed with an item set tree), because the rules */
+/* can only be evaluated if all item sets are known.                */
+
+/*--------------------------------------------------------------------*/
+
 int fpg_mine (FPGROWTH *fpg, ITEM prune, int order)
 {                               /* --- fpgrowth algorithm */
   int      r;                   /* result of function call */
@@ -2022,16 +3161,32 @@ int fpg_mine (FPGROWTH *fpg, ITEM prune, int order)
   e = fpg->eval & ~FPG_INVBXS;  /* remove flags from measure code */
   if (e <= RE_NONE)             /* if there is no evaluation, */
     prune = ITEM_MIN;           /* do not prune with evaluation */
+  fpg->tend = 0; fpg->ncnt = 0; /* clear the search budget state */
+  fpg->stop = 0; fpg->miss = 0; /* (deadline set for the search) */
+  if (fpg->stats                /* clear the search statistics */
+  &&  (sts_init(fpg->stats, tbg_itemcnt(fpg->tabag)+1) != 0))
+    return E_NOMEM;             /* (one entry per recursion depth) */
 
   /* --- find frequent item sets/association rules --- */
   if (!(fpg->target & ISR_RULES)/* if to find plain item sets */
   &&  ((e <= RE_NONE) || (e >= RE_FNCNT))) {
     CLOCK(t);                   /* start the timer for the search */
     XMSG(stderr, "writing %s ... ", isr_name(fpg->report));
-    r = fpgvars[fpg->algo](fpg);
-    if (r < 0) return E_NOMEM;  /* search for frequent item sets */
+    fpg->nodes = 0;             /* clear the node counter */
+    fpg->tend  = (fpg->tmax > 0) ? bnr_wall() +fpg->tmax : 0;
+    r = spill(fpg);             /* search for frequent item sets */
+    if (fpg->stop) {            /* if the search budget is exhausted, */
+      isr_remove(fpg->report, isr_cnt(fpg->report));
+      r = 0;                    /* remove all items from the reporter */
+    }                           /* (result so far is kept) */
+    if ((r >= 0) && (fpg->topk > 0))
+      r = isr_reptopk(fpg->report); /* report the best item sets */
+    bnr_end(fpg->bench);        /* end the mining phase */
+    bnr_int(fpg->bench, "nodes", (double)fpg->nodes);
+    if (r < 0) return E_NOMEM;  /* (with disk projections if nec.) */
     XMSG(stderr, "[%"SIZE_FMT" set(s)]", isr_repcnt(fpg->report));
-    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t)); }
+    XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+    if (fpg->stop) return 1; }  /* return whether result is partial */
   else {                        /* if rules or rule-based evaluation */
     CLOCK(t);                   /* start timer, print log message */
     XMSG(stderr, "finding frequent item set(s) ... ");
@@ -2042,13 +3197,16 @@ int fpg_mine (FPGROWTH *fpg, ITEM prune, int order)
       && (fpg->zmax < ITEM_MAX)) ? fpg->zmax+1 : fpg->zmax;
     if (x > (m = tbg_max(fpg->tabag))) x = m;
     ist_setsize(fpg->istree, fpg->zmin, x);
+    fpg->nodes = 0;             /* clear the node counter */
     r = fpg_tree(fpg);          /* search for frequent item sets */
+    bnr_int(fpg->bench, "nodes", (double)fpg->nodes);
     if (r < 0) return cleanup(fpg);
     XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
     if ((prune >  ITEM_MIN)     /* if to filter with evaluation */
     &&  (prune <= 0)) {         /* (backward and weak forward) */
       CLOCK(t);                 /* start the timer for filtering */
       XMSG(stderr, "filtering with evaluation ... ");
+      bnr_begin(fpg->bench, "filter");
       ist_filter(fpg->istree, prune);
       XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
     }                           /* filter with evaluation */
@@ -2057,23 +3215,28 @@ int fpg_mine (FPGROWTH *fpg, ITEM prune, int order)
       XMSG(stderr, "filtering for %s item sets ... ",
            (fpg->target & ISR_GENERAS) ? "generator" :
            (fpg->target & ISR_MAXIMAL) ? "maximal" : "closed");
+      bnr_begin(fpg->bench, "filter");
       ist_clomax(fpg->istree,   /* filter closed/maximal/generators */
                  fpg->target | ((prune > ITEM_MIN) ? IST_SAFE : 0));
       XMSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
     }
     CLOCK(t);                   /* start timer, print log message */
     XMSG(stderr, "writing %s ... ", isr_name(fpg->report));
+    bnr_begin(fpg->bench, "report");
     if (e != FPG_LDRATIO)       /* set additional evaluation measure */
       ist_seteval(fpg->istree, fpg->eval, fpg->agg, fpg->thresh, prune);
     ist_init(fpg->istree, order);  /* initialize the extraction */
     r = ist_report(fpg->istree, fpg->report, fpg->target);
+    if ((r >= 0) && (fpg->topk > 0))
+      r = isr_reptopk(fpg->report); /* report the best item sets */
+    bnr_end(fpg->bench);        /* end the reporting phase */
     cleanup(fpg);               /* report item sets/rules, */
     if (r < 0) return E_NOMEM;  /* then clean up the work memory */
     XMSG(stderr, "[%"SIZE_FMT" %s(s)]", isr_repcnt(fpg->report),
                  (fpg->target == ISR_RULES) ? "rule" : "set");
     XMSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
   }                             /* print a log message */
-  return 0;                     /* return 'ok' */
+  return 0;                     /* return 'ok' (complete result) */
 }  /* fpg_mine() */
 
 /*----------------------------------------------------------------------
@@ -2135,6 +3298,7 @@ static void help (void)
                "(default)\n");
   printf("  d   top-down processing on a single prefix tree\n");
   printf("  t   top-down processing of the prefix trees\n");
+  printf("  a   automatic choice based on statistics of the data\n");
   printf("Variant 'd' does not support mining closed/maximal item ");
   printf("sets,\nvariant 't' does not support the use of a k-items ");
   printf("machine, and\nonly variant 'c' supports item reordering ");
@@ -2220,7 +3384,9 @@ static int setbdr (ISREPORT *report, SUPP w, ITEM zmin,
   if (tabag)    tbg_delete(tabag,  0);   \
   if (tread)    trd_delete(tread,  1);   \
   if (ibase)    ib_delete (ibase);       \
-  if (border)   free(border);
+  if (border)   free(border);          \
+  if (isxidx)   isx_delete(isxidx);    \
+  if (bench)    bnr_delete(bench);
 #endif
 
 GENERROR(error, exit)           /* generic error reporting function */
@@ -2236,6 +3402,8 @@ int main (int argc, char *argv[])
   CCHAR   *fn_out  = NULL;      /* name of the output file */
   CCHAR   *fn_sel  = NULL;      /* name of item selection file */
   CCHAR   *fn_psp  = NULL;      /* name of pattern spectrum file */
+  CCHAR   *fn_idx  = NULL;      /* name of item set index file */
+  CCHAR   *fn_bnr  = NULL;      /* name of benchmark record file */
   CCHAR   *recseps = NULL;      /* record  separators */
   CCHAR   *fldseps = NULL;      /* field   separators */
   CCHAR   *blanks  = NULL;      /* blank   characters */
@@ -2260,10 +3428,19 @@ int main (int argc, char *argv[])
   int     algo     = 'c';       /* variant of fpgrowth algorithm */
   int     mode     = FPG_DEFAULT|FPG_PREFMT;   /* search mode */
   int     pack     = 16;        /* number of bit-packed items */
+  int     wide     = 0;         /* max. items for 32/64-items mach. */
   int     mtar     = 0;         /* mode for transaction reading */
+  int     dmode    = 0;         /* mode for data preparation */
   int     scan     = 0;         /* flag for scanable item output */
   int     bdrcnt   = 0;         /* number of support values in border */
   int     stats    = 0;         /* flag for item set statistics */
+  int     cpus     = 1;         /* number of threads for mining */
+  double  mem      = 0;         /* memory budget for fp-tree in MB */
+  long    topk     = 0;         /* number of best item sets */
+  double  tmax     = 0;         /* time budget for the search */
+  double  nmax     = 0;         /* budget of search nodes */
+  int     bin      = 0;         /* binary output mode */
+  char    code[2]  = "x";       /* buffer for option codes */
   PATSPEC *psp;                 /* collected pattern spectrum */
   ITEM    m;                    /* number of items */
   TID     n;                    /* number of transactions */
@@ -2324,12 +3501,33 @@ int main (int argc, char *argv[])
                     "(default: %d)\n", pack);
     printf("         (only for variants s and d, "
                     "options -As or -Ad)\n");
+    printf("-W#      max. items for wide bit machine (32/64)  "
+                    "(default: %d)\n", wide);
+    printf("         (only for algorithm variant c, option -Ac)\n");
     printf("-j       do not sort items w.r.t. cond. support   "
                     "(default: sort)\n");
     printf("         (only for algorithm variant c, option -Ac)\n");
     printf("-u       do not use head union tail (hut) pruning "
                     "(default: use hut)\n");
     printf("         (only for maximal item sets, option -tm)\n");
+    printf("-T#      number of threads for mining             "
+                    "(default: %d)\n", cpus);
+    printf("         (<= 0: use all processors; only for "
+                    "variant c and target s)\n");
+    printf("-M#      memory budget for the fp-tree (in MB)    "
+                    "(default: no limit)\n");
+    printf("         (larger trees: mine projections on disk; "
+                    "only target s)\n");
+    printf("-K#      report only the # item sets with highest "
+                    "support (default: all)\n");
+    printf("         (raises the minimum support while mining; "
+                    "not for -tm, -tr)\n");
+    printf("-L#      time budget for the search (in seconds)  "
+                    "(default: no limit)\n");
+    printf("-Q#      budget of search nodes                   "
+                    "(default: no limit)\n");
+    printf("         (if exceeded, the search stops with a "
+                    "partial result; not for -tr)\n");
     printf("-F#:#..  support border for filtering item sets   "
                     "(default: none)\n");
     printf("         (list of minimum support values, "
@@ -2338,6 +3536,11 @@ int main (int argc, char *argv[])
                     "as given with option -m#)\n");
     printf("-R#      read item selection/appearance indicators\n");
     printf("-P#      write a pattern spectrum to a file\n");
+    printf("-E#      write an item set index to a file (for isridx)\n");
+    printf("         (only for target s and minimum size 0 or 1)\n");
+    printf("-J#      append a benchmark record (JSON) to a file\n");
+    printf("         (phase times, peak memory etc.; "
+                    "\"-\": standard output)\n");
     printf("-Z       print item set statistics "
                     "(number of item sets per size)\n");
     printf("-N       do not pre-format some integer numbers   "
@@ -2348,6 +3551,12 @@ int main (int argc, char *argv[])
     printf("-z       compress output with zlib (deflate)      "
                     "(default: plain text)\n");
     #endif                      /* print compression option */
+    printf("-B#      write binary output (for isrdec)         "
+                    "(default: %d)\n", bin);
+    printf("         (0: text, 1: binary, 2: binary with "
+                     "delta-encoded items)\n");
+    printf("-O       write output in a separate thread        "
+                    "(default: synchronous)\n");
     printf("-h#      record header  for output                "
                     "(default: \"%s\")\n", hdr);
     printf("-k#      item separator for output                "
@@ -2358,6 +3567,9 @@ int main (int argc, char *argv[])
                     "(default: \"%s\")\n", info);
     printf("-w       integer transaction weight in last field "
                     "(default: only items)\n");
+    printf("-D       collapse duplicate transactions while reading\n");
+    printf("-X       compress transactions in memory "
+                    "(delta coding, sequential access)\n");
     printf("-r#      record/transaction separators            "
                     "(default: \"\\n\")\n");
     printf("-f#      field /item        separators            "
@@ -2374,7 +3586,7 @@ int main (int argc, char *argv[])
     return 0;                   /* print a usage message */
   }                             /* and abort the program */
   #endif  /* #ifndef QUIET */
-  /* free option characters: y [A-Z]\[ACFINPRSZ] */
+  /* free option characters: y [A-Z]\[ABCDEFIJKMNOPRSTWXZ] */
 
   /* --- evaluate arguments --- */
   for (i = 1; i < argc; i++) {  /* traverse the arguments */
@@ -2400,22 +3612,34 @@ int main (int argc, char *argv[])
           case 'A': algo   = (*s) ? *s++ : 0;        break;
           case 'x': mode  &= ~FPG_PERFECT;           break;
           case 'l': pack   = (int) strtol(s, &s, 0); break;
+          case 'W': wide   = (int) strtol(s, &s, 0); break;
           case 'j': mode  &= ~FPG_REORDER;           break;
           case 'u': mode  &= ~FPG_TAIL;              break;
+          case 'T': cpus   = (int) strtol(s, &s, 0); break;
+          case 'M': mem    =       strtod(s, &s);    break;
+          case 'K': topk   =       strtol(s, &s, 0); break;
+          case 'L': tmax   =       strtod(s, &s);    break;
+          case 'Q': nmax   =       strtod(s, &s);    break;
           case 'F': bdrcnt = getbdr(s, &s, &border); break;
           case 'R': optarg = &fn_sel;                break;
           case 'P': optarg = &fn_psp;                break;
+          case 'E': optarg = &fn_idx;                break;
+          case 'J': optarg = &fn_bnr;                break;
           case 'Z': stats  = 1;                      break;
           case 'N': mode  &= ~FPG_PREFMT;            break;
           case 'g': scan   = 1;                      break;
           #ifdef USE_ZLIB       /* if optional output compression */
           case 'z': mode  |= FPG_ZLIB;               break;
           #endif                /* set the compression flag */
+          case 'B': bin    = (int) strtol(s, &s, 0); break;
+          case 'O': mode  |= FPG_ASYNC;              break;
           case 'h': optarg = &hdr;                   break;
           case 'k': optarg = &sep;                   break;
           case 'I': optarg = &imp;                   break;
           case 'v': optarg = &info;                  break;
           case 'w': mtar  |= TA_WEIGHT;              break;
+          case 'D': mtar  |= TA_COLLAPSE;            break;
+          case 'X': dmode |= FPG_COMPRESS;           break;
           case 'r': optarg = &recseps;               break;
           case 'f': optarg = &fldseps;               break;
           case 'b': optarg = &blanks;                break;
@@ -2440,8 +3664,23 @@ int main (int argc, char *argv[])
   if (bdrcnt < 0)   error(E_NOMEM);
   if ((conf  < 0) || (conf > 100))
     error(E_CONF, conf);        /* check the minimum confidence */
+  if (bin > 0) mode |= FPG_BINARY; /* set the binary output flags */
+  if (bin > 1) mode |= FPG_DELTA;  /* (plain or delta-encoded) */
   if ((!fn_inp || !*fn_inp) && (fn_sel && !*fn_sel))
     error(E_STDIN);             /* stdin must not be used twice */
+  if (fn_idx && (((target != 's') && (target != 'f')) || (zmin > 1)))
+    error(E_INDEX);             /* an index needs all frequent sets */
+  if (fn_idx) cpus = 1;         /* (collected by a single reporter) */
+  if (fn_bnr) {                 /* if to write a benchmark record */
+    bench = bnr_create();       /* create a benchmark record */
+    if (!bench) error(E_NOMEM); /* and note the parameters */
+    bnr_str(bench, "prog", "fpgrowth");
+    code[0] = (char)algo;   bnr_str(bench, "algo",   code);
+    code[0] = (char)target; bnr_str(bench, "target", code);
+    bnr_dbl(bench, "smin",    smin);
+    bnr_int(bench, "threads", cpus);
+    bnr_dbl(bench, "mem",     mem);
+  }                             /* (before the codes are translated) */
   switch (target) {             /* check and translate target type */
     case 's': target = ISR_ALL;              break;
     case 'f': target = ISR_FREQUENT;         break;
@@ -2491,10 +3730,13 @@ int main (int argc, char *argv[])
     case 'c': algo = FPG_COMPLEX;            break;
     case 'd': algo = FPG_SINGLE;             break;
     case 't': algo = FPG_TOPDOWN;            break;
+    case 'a': algo = FPG_AUTO;               break;
     default : error(E_VARIANT, (char)algo);  break;
   }                             /* (get fpgrowth algorithm code) */
   mode = (mode & ~FPG_FIM16)    /* add packed items to search mode */
        | ((pack <= 0) ? 0 : (pack < 16) ? pack : 16);
+  if      (wide > 32) mode |= FPG_FIM64;  /* add the width of the */
+  else if (wide >  0) mode |= FPG_FIM32;  /* 32/64-items machine */
   if (target & ISR_RULES)       /* if to find association rules, */
     fn_psp = NULL;              /* no pattern spectrum possible */
   if (info == dflt) {           /* if default info. format is used, */
@@ -2506,7 +3748,7 @@ int main (int argc, char *argv[])
   MSG(stderr, "\n");            /* terminate the startup message */
 
   /* --- read item selection/appearance indicators --- */
-  ibase = ib_create(0, 0);      /* create an item base */
+  ibase = ib_create(IB_OPENADR, 0);  /* create an item base */
   if (!ibase) error(E_NOMEM);   /* to manage the items */
   tread = trd_create();         /* create a transaction reader */
   if (!tread) error(E_NOMEM);   /* and configure the characters */
@@ -2529,16 +3771,27 @@ int main (int argc, char *argv[])
   tabag = tbg_create(ibase);    /* create a transaction bag */
   if (!tabag) error(E_NOMEM);   /* to store the transactions */
   CLOCK(t);                     /* start timer, open input file */
-  if (trd_open(tread, NULL, fn_inp) != 0)
-    error(E_FOPEN, trd_name(tread));
-  MSG(stderr, "reading %s ... ", trd_name(tread));
-  k = tbg_read(tabag, tread, mtar);
-  if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  bnr_begin(bench, "read");     /* start the reading phase */
+  if (tbg_isbin(fn_inp)) {      /* if a binary transaction bag file */
+    MSG(stderr, "loading %s ... ", fn_inp);
+    k = tbg_load(tabag, fn_inp);/* map the prepared transactions */
+    if (k < 0) error(k, fn_inp); }
+  else {                        /* if a transaction text file */
+    if (trd_open(tread, NULL, fn_inp) != 0)
+      error(E_FOPEN, trd_name(tread));
+    MSG(stderr, "reading %s ... ", trd_name(tread));
+    k = tbg_read(tabag, tread, mtar);
+    if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  }                             /* read the transaction database */
   trd_delete(tread, 1);         /* read the transaction database, */
   tread = NULL;                 /* then delete the table reader */
+  bnr_end(bench);               /* end the reading phase */
   m = ib_cnt(ibase);            /* get the number of items, */
   n = tbg_cnt(tabag);           /* the number of transactions, */
   w = tbg_wgt(tabag);           /* the total transaction weight */
+  bnr_int(bench, "items",        m);
+  bnr_int(bench, "transactions", n);
+  bnr_int(bench, "extent", (double)tbg_extent(tabag));
   MSG(stderr, "[%"ITEM_FMT" item(s), %"TID_FMT, m, n);
   if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
   MSG(stderr, " transaction(s)] done [%.2fs].", SEC_SINCE(t));
@@ -2550,7 +3803,15 @@ int main (int argc, char *argv[])
   fpgrowth = fpg_create(target, smin, smax, conf, zmin, zmax,
                         eval, agg, thresh, algo, mode);
   if (!fpgrowth) error(E_NOMEM);/* create an fpgrowth miner */
-  k = fpg_data(fpgrowth, tabag, 0, sort);
+  fpg_setcpus(fpgrowth, cpus);  /* set the number of threads */
+  fpg_setbench(fpgrowth, bench);/* and the benchmark record */
+  if (topk > 0)                 /* and the number of best sets */
+    fpg_settopk(fpgrowth, (size_t)topk);
+  if (mem > 0)                  /* and the memory budget */
+    fpg_setmem(fpgrowth, (size_t)(mem *1024.0 *1024.0));
+  if ((tmax > 0) || (nmax > 0)) /* and the search budget */
+    fpg_setbudget(fpgrowth, tmax, (nmax > 0) ? (size_t)nmax : 0);
+  k = fpg_data(fpgrowth, tabag, dmode, sort);
   if (k) error(k);              /* prepare data for fpgrowth */
   report = isr_create(ibase);   /* create an item set reporter */
   if (!report) error(E_NOMEM);  /* and configure it */
@@ -2560,6 +3821,11 @@ int main (int argc, char *argv[])
     error(E_NOMEM);             /* set limits and support border */
   if (fn_psp && (isr_addpsp(report, NULL) < 0))
     error(E_NOMEM);             /* set a pattern spectrum if req. */
+  if (fn_idx) {                 /* if to write an item set index, */
+    isxidx = isx_create(ibase); /* create an item set index */
+    if (!isxidx) error(E_NOMEM);/* and collect the reported sets */
+    isr_setrepo(report, isx_add, isxidx);
+  }
   if (isr_setfmt(report, scan, hdr, sep, imp, info) != 0)
     error(E_NOMEM);             /* set the output format strings */
   k = isr_open(report, NULL, fn_out);
@@ -2567,11 +3833,21 @@ int main (int argc, char *argv[])
   if (isr_setup(report) < 0)    /* open the item set file and */
     error(E_NOMEM);             /* set up the item set reporter */
   k = fpg_mine(fpgrowth, prune, 0);
-  if (k) error(k);              /* find frequent item sets */
+  if (k < 0) error(k);          /* find frequent item sets */
+  bnr_int(bench, "complete", (k > 0) ? 0 : 1);
+  if (k > 0) {                  /* if the search budget is exhausted */
+    MSG(stderr, "search stopped (budget exhausted); ");
+    MSG(stderr, "complete for support >= %"SUPP_FMT"\n",
+                fpg_covered(fpgrowth));
+  }                             /* print the covered support */
   if (stats)                    /* print item set statistics */
     isr_prstats(report, stdout, 0);
+  bnr_begin(bench, "close");    /* start the closing phase */
   if (isr_close(report) != 0)   /* close the output file */
     error(E_FWRITE, isr_name(report));
+  bnr_end(bench);               /* end the closing phase */
+  bnr_int(bench, "sets", (double)isr_repcnt(report));
+  bnr_int(bench, "outbytes", (double)isr_nbytes(report));
 
   /* --- write pattern spectrum --- */
   if (fn_psp) {                 /* if to write a pattern spectrum */
@@ -2590,6 +3866,20 @@ int main (int argc, char *argv[])
     MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
   }                             /* write a log message */
 
+  /* --- write item set index --- */
+  if (fn_idx) {                 /* if to write an item set index */
+    CLOCK(t);                   /* start timer, print log message */
+    MSG(stderr, "writing %s ... ", fn_idx);
+    k = isx_save(isxidx, fn_idx);  /* build the prefix tree */
+    if (k) error(k, fn_idx);    /* and write it to the index file */
+    MSG(stderr, "[%"SIZE_FMT" set(s)]", isx_setcnt(isxidx));
+    MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* write a log message */
+
+  /* --- write benchmark record --- */
+  if (bench && (bnr_append(bench, fn_bnr) != 0))
+    error(E_FWRITE, fn_bnr);    /* append the benchmark record */
+
   /* --- clean up --- */
   CLEANUP;                      /* clean up memory and close files */
   SHOWMEM;                      /* show (final) memory usage */
@@ -10,12 +10,23 @@
             2014.08.28 functions fpg_data() and fpg_report() added
             2016.11.20 fpgrowth miner object and interface introduced
             2017.05.30 optional output compression with zlib added
+            2026.10.14 function fpg_setcpus() added (multi-threading)
+            2026.10.14 modes FPG_FIM32 and FPG_FIM64 added
+            2026.10.14 binary output modes added (FPG_BINARY/FPG_DELTA)
+            2026.10.14 asynchronous output mode added (FPG_ASYNC)
+            2026.10.14 function fpg_setmem() added (memory budget)
+            2026.10.14 function fpg_setbench() added (benchmark records)
+            2026.10.14 function fpg_settopk() added (best item sets)
+            2026.10.14 data preparation mode FPG_COMPRESS added
+            2026.10.14 functions fpg_setstats() and fpg_stats() added
+            2026.10.14 functions fpg_setbudget() and fpg_covered() added
 ----------------------------------------------------------------------*/
 #ifndef __FPGROWTH__
 #define __FPGROWTH__
 #include "report.h"
 #include "ruleval.h"
 #include "istree.h"
+#include "bench.h"
 
 /*----------------------------------------------------------------------
   Preprocessor Definitions
@@ -34,6 +45,7 @@
 #define FPG_NOSORT    0x0004    /* do not sort items and transactions */
 #define FPG_NOREDUCE  0x0008    /* do not reduce transactions */
 #define FPG_NOPACK    0x0010    /* do not pack most frequent items */
+#define FPG_COMPRESS  0x0020    /* compress transactions in memory */
 #define FPG_SURR      (FPG_NORECODE|FPG_NOFILTER|FPG_NOREDUCE)
 
 /* --- evaluation measures --- */
@@ -61,10 +73,15 @@
 #define FPG_REORDER   0x0040    /* reorder items in cond. databases */
 #define FPG_ORIGSUPP  0x0080    /* use original support definition */
 #define FPG_TAIL      0x0100    /* head union tail pruning */
+#define FPG_FIM32     0x0200    /* use 32 items machine (bit rep.) */
+#define FPG_FIM64     0x0400    /* use 64 items machine (bit rep.) */
+#define FPG_DELTA     0x0800    /* delta-encode binary output */
 #define FPG_PREFMT    0x1000    /* pre-format integer numbers */
 #ifdef USE_ZLIB                 /* if optional output compression */
 #define FPG_ZLIB      0x4000    /* flag for output compression */
 #endif
+#define FPG_BINARY    0x2000    /* flag for binary output */
+#define FPG_ASYNC   0x10000    /* write output in a separate thread */
 #define FPG_DEFAULT   (FPG_PERFECT|FPG_REORDER|FPG_TAIL|FPG_FIM16)
 #ifdef NDEBUG
 #define FPG_NOCLEAN   0x8000    /* do not clean up memory */
@@ -79,6 +96,18 @@
 typedef struct _fpgrowth        /* fpgrowth miner */
 FPGROWTH;                       /* (opaque structure) */
 
+typedef struct {                /* --- fpgrowth search statistics --- */
+  size_t   visited;             /* number of visited search nodes */
+  size_t   nodes;               /* number of nodes of initial trees */
+  size_t   mpeak;               /* peak node memory (in bytes) */
+  ITEM     depth;               /* maximum recursion depth */
+  ITEM     cur;                 /* current recursion depth */
+  ITEM     size;                /* size of the per depth arrays */
+  size_t   *prjcnt;             /* number of projections per depth */
+  size_t   *prjsize;            /* number of items of projections */
+  double   *time;               /* time spent per recursion depth */
+} FPGSTATS;                     /* (fpgrowth search statistics) */
+
 /*----------------------------------------------------------------------
   Functions
 ----------------------------------------------------------------------*/
@@ -90,5 +119,14 @@ extern void      fpg_delete (FPGROWTH *fpg, int deldar);
 extern int       fpg_data   (FPGROWTH *fpg, TABAG *tabag,
                              int mode, int sort);
 extern int       fpg_report (FPGROWTH *fpg, ISREPORT *report);
+extern void      fpg_setcpus(FPGROWTH *fpg, int cpus);
+extern void      fpg_setmem (FPGROWTH *fpg, size_t mmax);
+extern void      fpg_setbench(FPGROWTH *fpg, BENCHREC *bench);
+extern void      fpg_settopk(FPGROWTH *fpg, size_t k);
+extern int       fpg_setstats(FPGROWTH *fpg, int on);
+extern const FPGSTATS* fpg_stats(FPGROWTH *fpg);
+extern void      fpg_setbudget(FPGROWTH *fpg, double secs,
+                               size_t nodes);
+extern SUPP      fpg_covered(FPGROWTH *fpg);
 extern int       fpg_mine   (FPGROWTH *fpg, ITEM prune, int order);
 #endif
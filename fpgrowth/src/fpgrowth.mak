@@ -8,6 +8,9 @@
 #           2011.09.20 external module fim16 added (16 items machine)
 #           2014.08.21 extended by module istree from apriori source
 #           2016.04.20 completed dependencies on header files
+#           2026.10.14 external module fim64 added (32/64 items machine)
+#           2026.10.14 external module bench added (benchmark records)
+#           2026.10.14 external module isridx added (item set index)
 #-----------------------------------------------------------------------
 THISDIR  = ..\..\fpgrowth\src
 UTILDIR  = ..\..\util\src
@@ -29,14 +32,17 @@ HDRS     = $(UTILDIR)\fntypes.h    $(UTILDIR)\arrays.h     \
            $(UTILDIR)\error.h      $(MATHDIR)\ruleval.h    \
            $(TRACTDIR)\tract.h     $(TRACTDIR)\patspec.h   \
            $(TRACTDIR)\clomax.h    $(TRACTDIR)\report.h    \
-           $(APRIDIR)\istree.h     fpgrowth.h
+           $(APRIDIR)\istree.h     $(UTILDIR)\bench.h      \
+           $(TRACTDIR)\isridx.h    fpgrowth.h
 OBJS     = $(UTILDIR)\memsys.obj   $(UTILDIR)\arrays.obj   \
            $(UTILDIR)\idmap.obj    $(UTILDIR)\escape.obj   \
            $(UTILDIR)\tabread.obj  $(UTILDIR)\tabwrite.obj \
            $(UTILDIR)\scform.obj   $(MATHDIR)\gamma.obj    \
            $(MATHDIR)\chi2.obj     $(MATHDIR)\ruleval.obj  \
            $(TRACTDIR)\clomax.obj  $(TRACTDIR)\repcm.obj   \
-           $(TRACTDIR)\fim16.obj   $(APRIDIR)\istree.obj
+           $(TRACTDIR)\fim16.obj   $(TRACTDIR)\fim64.obj   \
+           $(APRIDIR)\istree.obj   $(UTILDIR)\bench.obj    \
+           $(TRACTDIR)\isridx.obj
 
 FPGOBJS  = $(OBJS)                 $(TRACTDIR)\taread.obj  \
            $(TRACTDIR)\patspec.obj fpgmain.obj
@@ -61,7 +67,8 @@ fpgpsp.exe:   $(PSPOBJS) fpgrowth.mak
 # Main Programs
 #-----------------------------------------------------------------------
 fpgmain.obj:  $(HDRS)               $(UTILDIR)\tabread.h \
-              $(UTILDIR)\tabwrite.h $(TRACTDIR)\fim16.h
+              $(UTILDIR)\tabwrite.h $(TRACTDIR)\fim16.h \
+              $(TRACTDIR)\fim64.h
 fpgmain.obj:  fpgrowth.c fpgrowth.mak
 	$(CC) $(CFLAGS) $(INCS) /D FPG_MAIN fpgrowth.c /Fo$@
 
@@ -73,7 +80,8 @@ pspmain.obj:  $(HDRS) fpgpsp.c fpgrowth.mak
 #-----------------------------------------------------------------------
 # FP-growth as a module
 #-----------------------------------------------------------------------
-fpgrowth.obj: $(HDRS)               $(TRACTDIR)\fim16.h
+fpgrowth.obj: $(HDRS)               $(TRACTDIR)\fim16.h \
+              $(TRACTDIR)\fim64.h
 fpgrowth.obj: fpgrowth.h fpgrowth.c fpgrowth.mak
 	$(CC) $(CFLAGS) $(INCS) fpgrowth.c /Fo$@
 
@@ -108,6 +116,10 @@ $(UTILDIR)\scform.obj:
 	cd $(UTILDIR)
 	$(MAKE) /f util.mak    scform.obj   ADDFLAGS="$(ADDFLAGS)"
 	cd $(THISDIR)
+$(UTILDIR)\bench.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak    bench.obj    ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
 $(UTILDIR)\random.obj:
 	cd $(UTILDIR)
 	$(MAKE) /f util.mak    random.obj   ADDFLAGS="$(ADDFLAGS)"
@@ -148,10 +160,18 @@ $(TRACTDIR)\repcm.obj:
 	cd $(TRACTDIR)
 	$(MAKE) /f tract.mak   repcm.obj    ADDFLAGS="$(ADDFLAGS)"
 	cd $(THISDIR)
+$(TRACTDIR)\isridx.obj:
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak   isridx.obj   ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
 $(TRACTDIR)\fim16.obj:
 	cd $(TRACTDIR)
 	$(MAKE) /f tract.mak   fim16.obj    ADDFLAGS="$(ADDFLAGS)"
 	cd $(THISDIR)
+$(TRACTDIR)\fim64.obj:
+	cd $(TRACTDIR)
+	$(MAKE) /f tract.mak   fim64.obj    ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
 $(APRIDIR)\istree.obj:
 	cd $(APRIDIR)
 	$(MAKE) /f apriori.mak istree.obj   ADDFLAGS="$(ADDFLAGS)"
@@ -7,6 +7,7 @@
             2008.03.14 more incomplete Gamma functions added
             2008.03.15 table of factorials and logarithms added
             2008.03.17 gamma distribution functions added
+            2026.10.14 tables precomputed (constant, no lazy init.)
 ----------------------------------------------------------------------*/
 #if defined GAMMA_MAIN \
  || defined GAMMAPDF_MAIN \
@@ -47,35 +48,301 @@
 /*----------------------------------------------------------------------
   Table of Factorials/Gamma Values
 ----------------------------------------------------------------------*/
-static double facts[MAXFACT+1] = { 0 };
-static double logfs[MAXFACT+1];
-static double halfs[MAXFACT+1];
-static double loghs[MAXFACT+1];
+/* factorials n! */
+static const double facts[MAXFACT+1] = {
+  1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800, 39916800,
+  479001600, 6227020800, 87178291200, 1307674368000, 20922789888000,
+  355687428096000, 6402373705728000, 1.21645100408832e+17,
+  2.43290200817664e+18, 5.109094217170944e+19, 1.1240007277776077e+21,
+  2.5852016738884978e+22, 6.2044840173323941e+23,
+  1.5511210043330986e+25, 4.0329146112660565e+26,
+  1.0888869450418352e+28, 3.0488834461171384e+29,
+  8.8417619937397008e+30, 2.6525285981219103e+32,
+  8.2228386541779224e+33, 2.6313083693369352e+35,
+  8.6833176188118859e+36, 2.9523279903960412e+38,
+  1.0333147966386144e+40, 3.7199332678990118e+41,
+  1.3763753091226343e+43, 5.2302261746660104e+44,
+  2.0397882081197442e+46, 8.1591528324789768e+47,
+  3.3452526613163803e+49, 1.4050061177528798e+51,
+  6.0415263063373834e+52, 2.6582715747884485e+54,
+  1.1962222086548019e+56, 5.5026221598120885e+57,
+  2.5862324151116818e+59, 1.2413915592536073e+61,
+  6.0828186403426752e+62, 3.0414093201713376e+64,
+  1.5511187532873822e+66, 8.0658175170943877e+67,
+  4.2748832840600255e+69, 2.3084369733924138e+71,
+  1.2696403353658276e+73, 7.1099858780486348e+74,
+  4.0526919504877221e+76, 2.3505613312828789e+78,
+  1.3868311854568986e+80, 8.3209871127413916e+81,
+  5.0758021387722484e+83, 3.1469973260387939e+85,
+  1.9826083154044401e+87, 1.2688693218588417e+89,
+  8.2476505920824715e+90, 5.4434493907744307e+92,
+  3.6471110918188683e+94, 2.4800355424368305e+96, 1.711224524281413e+98,
+  1.197857166996989e+100, 8.5047858856786218e+101,
+  6.1234458376886077e+103, 4.4701154615126834e+105,
+  3.3078854415193856e+107, 2.4809140811395391e+109,
+  1.8854947016660498e+111, 1.4518309202828584e+113,
+  1.1324281178206295e+115, 8.9461821307829729e+116,
+  7.1569457046263779e+118, 5.7971260207473655e+120,
+  4.7536433370128398e+122, 3.9455239697206569e+124,
+  3.314240134565352e+126, 2.8171041143805494e+128,
+  2.4227095383672724e+130, 2.1077572983795269e+132,
+  1.8548264225739836e+134, 1.6507955160908452e+136,
+  1.4857159644817607e+138, 1.3520015276784023e+140,
+  1.24384140546413e+142, 1.1567725070816409e+144,
+  1.0873661566567424e+146, 1.0329978488239052e+148,
+  9.916779348709491e+149, 9.6192759682482062e+151,
+  9.426890448883242e+153, 9.3326215443944096e+155,
+  9.3326215443944102e+157, 9.4259477598383536e+159,
+  9.6144667150351211e+161, 9.9029007164861754e+163,
+  1.0299016745145622e+166, 1.0813967582402903e+168,
+  1.1462805637347078e+170, 1.2265202031961373e+172,
+  1.3246418194518284e+174, 1.4438595832024928e+176,
+  1.5882455415227421e+178, 1.7629525510902437e+180,
+  1.9745068572210728e+182, 2.2311927486598123e+184,
+  2.5435597334721862e+186, 2.9250936934930141e+188,
+  3.3931086844518965e+190, 3.969937160808719e+192,
+  4.6845258497542883e+194, 5.5745857612076033e+196,
+  6.6895029134491239e+198, 8.09429852527344e+200,
+  9.8750442008335976e+202, 1.2146304367025325e+205,
+  1.5061417415111404e+207, 1.8826771768889254e+209,
+  2.3721732428800459e+211, 3.0126600184576582e+213,
+  3.8562048236258025e+215, 4.9745042224772855e+217,
+  6.4668554892204716e+219, 8.4715806908788174e+221,
+  1.1182486511960039e+224, 1.4872707060906852e+226,
+  1.9929427461615181e+228, 2.6904727073180495e+230,
+  3.6590428819525472e+232, 5.0128887482749898e+234,
+  6.9177864726194859e+236, 9.6157231969410859e+238,
+  1.346201247571752e+241, 1.8981437590761701e+243,
+  2.6953641378881614e+245, 3.8543707171800706e+247,
+  5.5502938327393013e+249, 8.0479260574719866e+251,
+  1.1749972043909099e+254, 1.7272458904546376e+256,
+  2.5563239178728637e+258, 3.8089226376305671e+260,
+  5.7133839564458505e+262, 8.6272097742332346e+264,
+  1.3113358856834518e+267, 2.0063439050956811e+269,
+  3.0897696138473489e+271, 4.7891429014633912e+273,
+  7.4710629262828905e+275, 1.1729568794264138e+278,
+  1.8532718694937338e+280, 2.9467022724950369e+282,
+  4.714723635992059e+284, 7.5907050539472148e+286,
+  1.2296942187394488e+289, 2.0044015765453015e+291,
+  3.2872185855342945e+293, 5.423910666131586e+295,
+  9.0036917057784329e+297, 1.5036165148649983e+300,
+  2.5260757449731969e+302, 4.2690680090047027e+304,
+  7.257415615307994e+306 };
+
+/* logarithms ln(n!) */
+static const double logfs[MAXFACT+1] = {
+  0, 0, 0.69314718055994529, 1.791759469228055, 3.1780538303479458,
+  4.7874917427820458, 6.5792512120101012, 8.5251613610654147,
+  10.604602902745251, 12.801827480081469, 15.104412573075516,
+  17.502307845873887, 19.987214495661885, 22.552163853123425,
+  25.19122118273868, 27.89927138384089, 30.671860106080672,
+  33.505073450136891, 36.395445208033053, 39.339884187199495,
+  42.335616460753485, 45.380138898476908, 48.471181351835227,
+  51.606675567764377, 54.784729398112319, 58.003605222980518,
+  61.261701761002001, 64.557538627006338, 67.88974313718154,
+  71.257038967168015, 74.658236348830158, 78.092223553315307,
+  81.557959456115043, 85.054467017581516, 88.580827542197682,
+  92.136175603687093, 95.719694542143202, 99.330612454787428,
+  102.96819861451381, 106.63176026064346, 110.32063971475739,
+  114.03421178146171, 117.77188139974507, 121.53308151543864,
+  125.3172711493569, 129.12393363912722, 132.95257503561632,
+  136.80272263732635, 140.67392364823425, 144.5657439463449,
+  148.47776695177302, 152.40959258449735, 156.3608363030788,
+  160.3311282166309, 164.32011226319517, 168.32744544842765,
+  172.35279713916279, 176.39584840699735, 180.45629141754378,
+  184.53382886144948, 188.6281734236716, 192.7390472878449,
+  196.86618167289001, 201.00931639928152, 205.1681994826412,
+  209.34258675253685, 213.53224149456327, 217.73693411395422,
+  221.95644181913033, 226.1905483237276, 230.43904356577696,
+  234.70172344281826, 238.97838956183432, 243.26884900298271,
+  247.57291409618688, 251.89040220972319, 256.22113555000954,
+  260.56494097186322, 264.92164979855278, 269.29109765101981,
+  273.67312428569369, 278.06757344036612, 282.4742926876304,
+  286.89313329542699, 291.32395009427029, 295.7666013507606,
+  300.22094864701415, 304.68685676566872, 309.1641935801469,
+  313.65282994987905, 318.1526396202093, 322.66349912672615,
+  327.1852877037752, 331.71788719692847, 336.26118197919845,
+  340.81505887079902, 345.37940706226686, 349.95411804077025,
+  354.53908551944079, 359.1342053695754, 363.73937555556347,
+  368.35449607240474, 372.97946888568902, 377.61419787391867,
+  382.25858877306001, 386.91254912321756, 391.57598821732961,
+  396.24881705179155, 400.93094827891576, 405.6222961611449,
+  410.32277652693733, 415.03230672824964, 419.75080559954472,
+  424.47819341825709, 429.21439186665157, 433.95932399501481,
+  438.71291418612117, 443.47508812091894, 448.24577274538461,
+  453.02489623849613, 457.81238798127816, 462.60817852687489,
+  467.4121995716082, 472.22438392698058, 477.04466549258564,
+  481.87297922988796, 486.70926113683942, 491.55344822329801,
+  496.40547848721764, 501.2652908915793, 506.13282534203489,
+  511.00802266523601, 515.89082458782241, 520.78117371604412,
+  525.67901351599505, 530.58428829443346, 535.49694318016952,
+  540.41692410599762, 545.34417779115483, 550.27865172428551,
+  555.22029414689484, 560.16905403727299, 565.12488109487435,
+  570.08772572513419, 575.0575390247102, 580.0342727671308,
+  585.01787938883911, 590.00831197561786, 595.00552424938201,
+  600.00947055532743, 605.02010584942366, 610.03738568623862,
+  615.06126620708483, 620.09170412847732, 625.12865673089095,
+  630.1720818478102, 635.22193785505976, 640.27818366040799,
+  645.34077869343503, 650.40968289565524, 655.48485671088906,
+  660.56626107587351, 665.65385741110595, 670.74760761191271,
+  675.84747403973688, 680.95341951363741, 686.06540730199401,
+  691.1834011144108, 696.30736509381404, 701.43726380873704,
+  706.57306224578736 };
+
+/* Gamma function of half numbers, Gamma(n+0.5) */
+static const double halfs[MAXFACT+1] = {
+  1.7724538509055161, 0.88622692545275805, 1.329340388179137,
+  3.3233509704478426, 11.63172839656745, 52.342777784553526,
+  287.88527781504439, 1871.2543057977884, 14034.407293483413,
+  119292.46199460901, 1133278.3889487856, 11899423.083962249,
+  136843365.46556586, 1710542068.3195732, 23092317922.31424,
+  334838609873.55646, 5189998453040.125, 85634974475162.062,
+  1498612053315336, 27724322986333716, 5.4062429823350746e+17,
+  1.1082798113786903e+19, 2.3828015944641839e+20,
+  5.3613035875444143e+21, 1.2599063430729373e+23,
+  3.0867705405286966e+24, 7.8712648783481758e+25,
+  2.0858851927622665e+27, 5.7361842800962329e+28,
+  1.6348125198274264e+30, 4.8226969334909077e+31,
+  1.4709225647147269e+33, 4.6334060788513895e+34,
+  1.5058569756267017e+36, 5.0446208683494509e+37,
+  1.7403941995805607e+39, 6.1783994085109903e+40,
+  2.2551157841065113e+42, 8.4566841903994176e+43,
+  3.2558234133037758e+45, 1.2860502482549915e+47,
+  5.2085035054327154e+48, 2.1615289547545769e+50,
+  9.1864980577069524e+51, 3.9961266551025243e+53,
+  1.7782763615206234e+55, 8.0911574449188361e+56,
+  3.7623882118872588e+58, 1.787134400646448e+60, 8.6676018431352735e+61,
+  4.2904629123519605e+63, 2.1666837707377401e+65,
+  1.1158421419299361e+67, 5.8581712451321647e+68,
+  3.1341216161457078e+70, 1.7080962807994108e+72, 9.47993435843673e+73,
+  5.3561629125167524e+75, 3.0797936746971328e+77,
+  1.8016792996978227e+79, 1.0719991833202046e+81,
+  6.4855950590872371e+82, 3.988640961338651e+84, 2.4929006008366569e+86,
+  1.5829918815312771e+88, 1.0210297635876738e+90,
+  6.6877449514992637e+91, 4.44735039274701e+93, 3.0019615151042319e+95,
+  2.0563436378463987e+97, 1.429158828303247e+99,
+  1.0075569739537892e+101, 7.204032363769593e+102,
+  5.2229234637329547e+104, 3.8388487458437218e+106,
+  2.8599423156535725e+108, 2.1592564483184472e+110,
+  1.6518311829636121e+112, 1.2801691667967993e+114,
+  1.0049327959354875e+116, 7.9892157276871258e+117,
+  6.4313186607881363e+119, 5.2415247085423308e+121,
+  4.3242578845474231e+123, 3.6107553335970981e+125,
+  3.051088256889548e+127, 2.6086804596405634e+129,
+  2.2565085975890872e+131, 1.9744450228904514e+133,
+  1.7473838452580496e+135, 1.5639085415059543e+137,
+  1.4153372300628886e+139, 1.295033565507543e+141,
+  1.1979060480944773e+143, 1.1200421549683362e+145,
+  1.0584398364450777e+147, 1.0108100438050492e+149,
+  9.7543169227187252e+150, 9.5104589996507565e+152,
+  9.3678021146559952e+154, 9.3209631040827147e+156,
+  9.3675679196031286e+158, 9.5080814383971755e+160,
+  9.7457834743571047e+162, 1.0086885895959603e+165,
+  1.0540795761277785e+167, 1.1120539528148063e+169,
+  1.1843374597477686e+171, 1.2731627692288511e+173,
+  1.3813816046133035e+175, 1.5126128570515673e+177,
+  1.6714372070419819e+179, 1.8636524858518097e+181,
+  2.0966090465832858e+183, 2.3796512678720295e+185,
+  2.7247007017134736e+187, 3.1470293104790622e+189,
+  3.6662891467081073e+191, 4.3078897473820262e+193,
+  5.1048493506477007e+195, 6.100294974024002e+197,
+  7.3508554436989221e+199, 8.9312893640941908e+201,
+  1.0940829471015384e+204, 1.3511924396703999e+206,
+  1.6822345873896478e+208, 2.1112044071740079e+210,
+  2.67067357507512e+212, 3.4051088082207781e+214,
+  4.3755648185637002e+216, 5.6663564400399914e+218,
+  7.3945951542521883e+220, 9.7238926278416274e+222,
+  1.2884157731890156e+225, 1.7200350572073358e+227,
+  2.3134471519438667e+229, 3.1347208908839392e+231,
+  4.2788940160565774e+233, 5.8834792720777939e+235,
+  8.1486187918277449e+237, 1.1367323214599705e+240,
+  1.5971089116512585e+242, 2.2599091099865308e+244,
+  3.2203704817308066e+246, 4.6212316412837076e+248,
+  6.6776797216549582e+250, 9.716023995007964e+252,
+  1.4233975152686667e+255, 2.0995113350212833e+257,
+  3.1177743325066057e+259, 4.6610726270973756e+261,
+  7.0149143037815508e+263, 1.062759517022905e+266,
+  1.62070826345993e+268, 2.4877871844109927e+270,
+  3.8436311999149834e+272, 5.9768465158677991e+274,
+  9.3537647973331059e+276, 1.4732179555799643e+279,
+  2.3350504595942436e+281, 3.7244054830528182e+283,
+  5.9776708002997728e+285, 9.6539383424841325e+287,
+  1.5687649806536717e+290, 2.5649307433687531e+292,
+  4.219311072841599e+294, 6.982959825552846e+296,
+  1.1626628109545488e+299, 1.9474602083488694e+301,
+  3.281470451067845e+303 };
+
+/* logarithms ln(Gamma(n+0.5)) */
+static const double loghs[MAXFACT+1] = {
+  0.57236494292470008, -0.12078223763524518, 0.28468287047291918,
+  1.2009736023470743, 2.4537365708424423, 3.9578139676187165,
+  5.6625620598571418, 7.5343642367587327, 9.5492672573009969,
+  11.689333420797269, 13.940625219403763, 16.292000476567242,
+  18.734347511936445, 21.2600761562447, 23.862765841689086,
+  26.536914491115613, 29.277754515040815, 32.081114895947351,
+  34.943315776876815, 37.861086508961094, 40.831500974530798,
+  43.851925860675159, 46.919978795808781, 50.033494105019152,
+  53.190494526169267, 56.389167643719944, 59.62784609588433,
+  62.904990828876507, 66.219176833549028, 69.569080920823637,
+  72.953471184169402, 76.371197867782769, 79.821185413614359,
+  83.302425502950058, 86.813970941781079, 90.354930265818382,
+  93.924462962299756, 97.521775222888209, 101.14611615586458,
+  104.7967743971583, 108.47307506906539, 112.17437704317788,
+  115.90007047041453, 119.64957454634491, 123.42233548443954,
+  127.21782467361173, 131.03553699956865, 134.87498931216194,
+  138.73571902320253, 142.61728282114598, 146.51925549072064,
+  150.44122882700194, 154.38281063467164, 158.34362380426921,
+  162.32330545817118, 166.32150615984037, 170.33788918059275,
+  174.37212981874515, 178.42391476654845, 182.49294152078627,
+  186.57891783333784, 190.68156119837465, 194.80059837318711,
+  198.93576492992949, 203.08680483582813, 207.25347005962985,
+  211.43552020227105, 215.63272214993287, 219.84484974781134,
+  224.07168349307952, 228.31301024565028, 232.5686229554685,
+  236.83832040516845, 241.12190696702908, 245.41919237324788,
+  249.72999149863338, 254.05412415488837, 258.39141489572086,
+  262.74169283208016, 267.10479145686855, 271.48054847852882,
+  275.86880566295332, 280.26940868320014, 284.68220697654078,
+  289.10705360839762, 293.54380514276073, 297.99232151870342,
+  302.45246593264125, 306.92410472600483, 311.40710727801871,
+  315.90134590329956, 320.4066957540054, 324.92303472628691,
+  329.45024337080525, 333.98820480709992, 338.53680464159959,
+  343.09593088908628, 347.66547389743124, 352.24532627543505,
+  356.83538282361309, 361.43554046777763, 366.04569819527677,
+  370.66575699375858, 375.29561979233705, 379.93519140504247,
+  384.58437847644734, 389.24308942936347, 393.91123441451293,
+  398.58872526208069, 403.2754754350612, 407.97139998431771,
+  412.67641550527554, 417.39044009617572, 422.11339331782017,
+  426.84519615474164, 431.58577097773593, 436.33504150769778,
+  441.09293278070356, 445.85937111428774, 450.63428407486293,
+  455.41760044623453, 460.20925019916524, 465.00916446194583,
+  469.81727549193062, 474.63351664799865, 479.4578223639034,
+  484.29012812247521, 489.13037043064281, 493.97848679524128,
+  498.8344156995766, 503.69809658071614, 508.56946980747892,
+  513.44847665909674, 518.33505930452304, 523.22916078236335,
+  528.13072498140525, 533.03969662172494, 537.95602123635001,
+  542.87964515345664, 547.81051547908396, 552.74858008034539,
+  557.69378756911919, 562.64608728620249, 567.60542928591121,
+  572.57176432111089, 577.54504382866332, 582.52521991527487,
+  587.51224534373205, 592.50607351951192, 597.50665847775463,
+  602.51395487058539, 607.52791795477435, 612.54850357972373,
+  617.57566817577128, 622.60936874279844, 627.64956283913625,
+  632.69620857075552, 637.74926458073583, 642.80869003900148,
+  647.87444463231884, 652.94648855454375, 658.02478249711373,
+  663.10928763977654, 668.19996564154633, 673.29677863188363,
+  678.39968920208901, 683.50866039690618, 688.62365570632664,
+  693.74463905759171, 698.87157480738415 };
+
+/* The tables contain the values that were formerly computed by a   */
+/* function init() on the first call of one of the functions below  */
+/* (facts[i] = i!, logfs[i] = ln(i!), and halfs[i] = Gamma(i+0.5),  */
+/* loghs[i] = ln(Gamma(i+0.5)) with Gamma(0.5) = \sqrt(\pi)), with  */
+/* all digits needed to reproduce the computed values exactly. As   */
+/* they are constant, no initialization is needed and the functions */
+/* can be called concurrently from several threads.                 */
 
 /*----------------------------------------------------------------------
   Functions
 ----------------------------------------------------------------------*/
-
-static void init (void)
-{                               /* --- init. factorial tables */
-  int    i;                     /* loop variable */
-  double x = 1;                 /* factorial */
-
-  facts[0] = facts[1] = 1;      /* store factorials for 0 and 1 */
-  logfs[0] = logfs[1] = 0;      /* and their logarithms */
-  for (i = 1; ++i <= MAXFACT; ) {
-    facts[i] = x *= i;          /* initialize the factorial table */
-    logfs[i] = log(x);          /* and the table of their logarithms */
-  }
-  halfs[0] = x = SQRT_PI;       /* store Gamma(0.5) */
-  loghs[0] = 0.5*LN_PI;         /* and its logarithm */
-  for (i = 0; ++i < MAXFACT; ) {
-    halfs[i] = x *= i-0.5;      /* initialize the table for */
-    loghs[i] = log(x);          /* the Gamma function of half numbers */
-  }                             /* and the table of their logarithms */
-}  /* init() */
-
-/*--------------------------------------------------------------------*/
 #if 0
 
 double logGamma (double n)
@@ -83,7 +350,6 @@ double logGamma (double n)
   double s;                     /*           = ln((n-1)!), n \in IN */
 
   assert(n > 0);                /* check the function argument */
-  if (facts[0] <= 0) init();    /* initialize the tables */
   if (n < MAXFACT +1 +4 *EPSILON) {
     if (fabs(  n -floor(  n)) < 4 *EPSILON)
       return logfs[(int)floor(n)-1];
@@ -107,7 +373,6 @@ double logGamma (double n)
   double s;                     /*           = ln((n-1)!), n \in IN */
 
   assert(n > 0);                /* check the function argument */
-  if (facts[0] <= 0) init();    /* initialize the tables */
   if (n < MAXFACT +1 +4 *EPSILON) {
     if (fabs(  n -floor(  n)) < 4 *EPSILON)
       return logfs[(int)floor(n)-1];
@@ -151,7 +416,6 @@ in the second version, the value is slightly more accurate.
 double Gamma (double n)
 {                               /* --- compute Gamma(n) = (n-1)! */
   assert(n > 0);                /* check the function argument */
-  if (facts[0] <= 0) init();    /* initialize the tables */
   if (n < MAXFACT +1 +4 *EPSILON) {
     if (fabs(  n -floor(  n)) < 4 *EPSILON)
       return facts[(int)floor(n)-1];
@@ -6,12 +6,17 @@
             2011.08.03 bug in re_fetprob fixed (roundoff error corr.)
             2012.02.15 function re_supp() added (rule support)
             2013.03.29 adapted to type changes in module tract (SUPP)
+            2026.10.14 rule evaluator with factorial table and memo added
+            2026.10.14 batch evaluation functions added (SSE2 versions)
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
 #include <float.h>
 #include <math.h>
 #include <assert.h>
+#ifdef __SSE2__                 /* if SSE2 instructions available */
+#include <emmintrin.h>          /* use them for batch evaluation */
+#endif
 #include "gamma.h"
 #include "chi2.h"
 #include "ruleval.h"
@@ -24,13 +29,24 @@
   Preprocessor Definitions
 ----------------------------------------------------------------------*/
 #define LN_2        0.69314718055994530942  /* ln(2) */
+#define LNF_MAX     0x01000000  /* maximum size of factorial table */
+#define MEMOSIZE    4096        /* number of memo entries (power of 2) */
+
+#define LNF(t,n)    ((t) ? (t)[(size_t)(n)] : logGamma((double)((n)+1)))
+#define LD2(a,i)    _mm_set_pd((double)(a)[(i)+1], (double)(a)[i])
 
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
+typedef double TABLEFN (const double *lnf, double lim,
+                        SUPP supp, SUPP body, SUPP head, SUPP base);
+
 typedef struct {                /* --- rule evaluation info. --- */
-  RULEVALFN *fn;                /* evaluation function */
-  int       dir;                /* evaluation direction */
+  RULEVALFN  *fn;               /* evaluation function */
+  RULEVALVFN *vfn;              /* batch evaluation function */
+  TABLEFN    *tab;              /* evaluation with factorial table */
+  int        dir;               /* evaluation direction */
+  int        memo;              /* whether to memorize values */
 } REINFO;                       /* (rule evaluation information) */
 
 /*----------------------------------------------------------------------
@@ -234,7 +250,8 @@ double re_infopval (SUPP supp, SUPP body, SUPP head, SUPP base)
 
 /*--------------------------------------------------------------------*/
 
-double re_fetprob (SUPP supp, SUPP body, SUPP head, SUPP base)
+static double fetprob (const double *lnf, double lim,
+                       SUPP supp, SUPP body, SUPP head, SUPP base)
 {                               /* --- Fisher's exact test (prob.) */
   SUPP   rest, n;               /* counter for rest cases, buffer */
   double com;                   /* common probability term */
@@ -251,33 +268,36 @@ double re_fetprob (SUPP supp, SUPP body, SUPP head, SUPP base)
   }                             /* complement/exchange the marginals */
   if (head < body) {            /* ensure that body <= head */
     n = head; head = body; body = n; }
-  com = logGamma((double)(     head+1))
-      + logGamma((double)(     body+1))
-      + logGamma((double)(base-head+1))
-      + logGamma((double)(base-body+1))
-      - logGamma((double)(base+1));/* compute common probability term */
+  com = LNF(lnf,      head)
+      + LNF(lnf,      body)
+      + LNF(lnf, base-head)
+      + LNF(lnf, base-body)
+      - LNF(lnf, base);         /* compute common probability term */
   cut = com                     /* and log of the cutoff probability */
-      - logGamma((double)(body-supp+1))
-      - logGamma((double)(head-supp+1))
-      - logGamma((double)(     supp+1))
-      - logGamma((double)(rest+supp+1));
+      - LNF(lnf, body-supp)
+      - LNF(lnf, head-supp)
+      - LNF(lnf,      supp)
+      - LNF(lnf, rest+supp);
   cut *= 1.0-DBL_EPSILON;       /* adapt for roundoff errors */
   /* cut must be multiplied with a value < 1 in order to increase it, */
   /* because it is the logarithm of a probability and hence negative. */
   for (sum = 0, supp = 0; supp <= body; supp++) {
     p = com                     /* traverse the contingency tables */
-      - logGamma((double)(body-supp+1))
-      - logGamma((double)(head-supp+1))
-      - logGamma((double)(     supp+1))
-      - logGamma((double)(rest+supp+1));
-    if (p <= cut) sum += exp(p);/* sum probabilities greater */
-  }                             /* than the cutoff probability */
+      - LNF(lnf, body-supp)
+      - LNF(lnf, head-supp)
+      - LNF(lnf,      supp)
+      - LNF(lnf, rest+supp);
+    if (p > cut) continue;      /* sum probabilities greater */
+    sum += exp(p);              /* than the cutoff probability */
+    if (sum > lim) break;       /* abort if the limit is exceeded */
+  }                             /* (the p-value can only grow) */
   return sum;                   /* return computed probability */
-}  /* re_fetprob() */
+}  /* fetprob() */
 
 /*--------------------------------------------------------------------*/
 
-double re_fetchi2 (SUPP supp, SUPP body, SUPP head, SUPP base)
+static double fetchi2 (const double *lnf, double lim,
+                       SUPP supp, SUPP body, SUPP head, SUPP base)
 {                               /* --- Fisher's exact test (chi^2) */
   SUPP   rest, n;               /* counter for rest cases, buffer */
   double com;                   /* common probability term */
@@ -294,11 +314,11 @@ double re_fetchi2 (SUPP supp, SUPP body, SUPP head, SUPP base)
   }                             /* complement/exchange the marginals */
   if (head < body) {            /* ensure that body <= head */
     n = head; head = body; body = n; }
-  com = logGamma((double)(     head+1))
-      + logGamma((double)(     body+1))
-      + logGamma((double)(base-head+1))
-      + logGamma((double)(base-body+1))
-      - logGamma((double)(base+1));/* compute common probability term */
+  com = LNF(lnf,      head)
+      + LNF(lnf,      body)
+      + LNF(lnf, base-head)
+      + LNF(lnf, base-body)
+      - LNF(lnf, base);         /* compute common probability term */
   exs = (double)head *(double)body /(double)base;
   if ((double)supp < exs)
        { n =              (SUPP)ceil (exs+(exs-(double)supp)); }
@@ -307,31 +327,28 @@ double re_fetchi2 (SUPP supp, SUPP body, SUPP head, SUPP base)
   if (supp < 0) supp = -1;      /* clamp it to the possible maximum */
   if (n-supp-4 < supp+body-n) { /* if fewer less extreme tables */
     for (sum = 1; ++supp < n;){ /* traverse the less extreme tables */
-      sum -= exp(com -logGamma((double)(body-supp+1))
-                     -logGamma((double)(head-supp+1))
-                     -logGamma((double)(     supp+1))
-                     -logGamma((double)(rest+supp+1)));
+      sum -= exp(com -LNF(lnf, body-supp) -LNF(lnf, head-supp)
+                     -LNF(lnf,      supp) -LNF(lnf, rest+supp));
     } }                         /* sum the probability of the tables */
   else {                        /* if fewer more extreme tables */
     for (sum = 0; supp >= 0; supp--) {
-      sum += exp(com -logGamma((double)(body-supp+1))
-                     -logGamma((double)(head-supp+1))
-                     -logGamma((double)(     supp+1))
-                     -logGamma((double)(rest+supp+1)));
+      sum += exp(com -LNF(lnf, body-supp) -LNF(lnf, head-supp)
+                     -LNF(lnf,      supp) -LNF(lnf, rest+supp));
+      if (sum > lim) return sum;
     }                           /* traverse the more extreme tables */
     for (supp = n; supp <= body; supp++) {
-      sum += exp(com -logGamma((double)(body-supp+1))
-                     -logGamma((double)(head-supp+1))
-                     -logGamma((double)(     supp+1))
-                     -logGamma((double)(rest+supp+1)));
+      sum += exp(com -LNF(lnf, body-supp) -LNF(lnf, head-supp)
+                     -LNF(lnf,      supp) -LNF(lnf, rest+supp));
+      if (sum > lim) return sum;
     }                           /* sum the probability of the tables */
   }                             /* (upper and lower table ranges) */
   return sum;                   /* return computed probability */
-}  /* re_fetchi2() */
+}  /* fetchi2() */
 
 /*--------------------------------------------------------------------*/
 
-double re_fetinfo (SUPP supp, SUPP body, SUPP head, SUPP base)
+static double fetinfo (const double *lnf, double lim,
+                       SUPP supp, SUPP body, SUPP head, SUPP base)
 {                               /* --- Fisher's exact test (info.) */
   SUPP   rest, n;               /* counter for rest cases, buffer */
   double com;                   /* common probability term */
@@ -348,25 +365,26 @@ double re_fetinfo (SUPP supp, SUPP body, SUPP head, SUPP base)
   }                             /* complement/exchange the marginals */
   if (head < body) {            /* ensure that body <= head */
     n = head; head = body; body = n; }
-  com = logGamma((double)(     head+1))
-      + logGamma((double)(     body+1))
-      + logGamma((double)(base-head+1))
-      + logGamma((double)(base-body+1))
-      - logGamma((double)(base+1));/* compute common probability term */
+  com = LNF(lnf,      head)
+      + LNF(lnf,      body)
+      + LNF(lnf, base-head)
+      + LNF(lnf, base-body)
+      - LNF(lnf, base);         /* compute common probability term */
   cut = re_info(supp, body, head, base) *(1.0-DBL_EPSILON);
   for (sum = 0, supp = 0; supp <= body; supp++) {
-    if (re_info(supp, body, head, base) >= cut)
-      sum += exp(com -logGamma((double)(body-supp+1))
-                     -logGamma((double)(head-supp+1))
-                     -logGamma((double)     (supp+1))
-                     -logGamma((double)(rest+supp+1)));
-  }                             /* sum probs. of less extreme tables */
+    if (re_info(supp, body, head, base) < cut)
+      continue;                 /* skip less extreme tables */
+    sum += exp(com -LNF(lnf, body-supp) -LNF(lnf, head-supp)
+                   -LNF(lnf,      supp) -LNF(lnf, rest+supp));
+    if (sum > lim) break;       /* sum probs. of more extreme tables */
+  }                             /* and abort if limit is exceeded */
   return sum;                   /* return computed probability */
-}  /* re_fetinfo() */
+}  /* fetinfo() */
 
 /*--------------------------------------------------------------------*/
 
-double re_fetsupp (SUPP supp, SUPP body, SUPP head, SUPP base)
+static double fetsupp (const double *lnf, double lim,
+                       SUPP supp, SUPP body, SUPP head, SUPP base)
 {                               /* --- Fisher's exact test (support) */
   SUPP   rest, n;               /* counter for rest cases, buffer */
   double com;                   /* common probability term */
@@ -382,53 +400,202 @@ double re_fetsupp (SUPP supp, SUPP body, SUPP head, SUPP base)
   }                             /* complement/exchange the marginals */
   if (head < body) {            /* ensure that body <= head */
     n = head; head = body; body = n; }
-  com = logGamma((double)(     head+1))
-      + logGamma((double)(     body+1))
-      + logGamma((double)(base-head+1))
-      + logGamma((double)(base-body+1))
-      - logGamma((double)(base+1));/* compute common probability term */
+  com = LNF(lnf,      head)
+      + LNF(lnf,      body)
+      + LNF(lnf, base-head)
+      + LNF(lnf, base-body)
+      - LNF(lnf, base);         /* compute common probability term */
   if (supp <= body -supp) {     /* if fewer lesser support values */
     for (sum = 1.0; --supp >= 0; )
-      sum -= exp(com -logGamma((double)(body-supp+1))
-                     -logGamma((double)(head-supp+1))
-                     -logGamma((double)(     supp+1))
-                     -logGamma((double)(rest+supp+1))); }
+      sum -= exp(com -LNF(lnf, body-supp) -LNF(lnf, head-supp)
+                     -LNF(lnf,      supp) -LNF(lnf, rest+supp)); }
   else {                        /* if fewer greater support values */
-    for (sum = 0.0; supp <= body; supp++)
-      sum += exp(com -logGamma((double)(body-supp+1))
-                     -logGamma((double)(head-supp+1))
-                     -logGamma((double)(     supp+1))
-                     -logGamma((double)(rest+supp+1)));
-  }                             /* sum the table probabilities */
+    for (sum = 0.0; supp <= body; supp++) {
+      sum += exp(com -LNF(lnf, body-supp) -LNF(lnf, head-supp)
+                     -LNF(lnf,      supp) -LNF(lnf, rest+supp));
+      if (sum > lim) break;     /* sum the table probabilities */
+    }                           /* and abort if limit is exceeded */
+  }
   return sum;                   /* return computed probability */
-}  /* re_fetsupp() */
+}  /* fetsupp() */
+
+/*--------------------------------------------------------------------*/
+
+double re_fetprob (SUPP supp, SUPP body, SUPP head, SUPP base)
+{ return fetprob(NULL, INFINITY, supp, body, head, base); }
+
+/*--------------------------------------------------------------------*/
+
+double re_fetchi2 (SUPP supp, SUPP body, SUPP head, SUPP base)
+{ return fetchi2(NULL, INFINITY, supp, body, head, base); }
+
+/*--------------------------------------------------------------------*/
+
+double re_fetinfo (SUPP supp, SUPP body, SUPP head, SUPP base)
+{ return fetinfo(NULL, INFINITY, supp, body, head, base); }
+
+/*--------------------------------------------------------------------*/
+
+double re_fetsupp (SUPP supp, SUPP body, SUPP head, SUPP base)
+{ return fetsupp(NULL, INFINITY, supp, body, head, base); }
+
+/*----------------------------------------------------------------------
+  Batch Evaluation Functions
+----------------------------------------------------------------------*/
+
+void re_confv (const SUPP *supp, const SUPP *body, const SUPP *head,
+               SUPP base, double *vals, size_t n)
+{                               /* --- rule confidence (batch) */
+  size_t  i = 0;                /* loop variable */
+  #ifdef __SSE2__               /* if SSE2 instructions available */
+  __m128d s, b, z;              /* support values, zero */
+
+  z = _mm_setzero_pd();         /* process two rules at a time */
+  for ( ; i+1 < n; i += 2) {    /* (mask out vanishing body supports) */
+    s = LD2(supp, i); b = LD2(body, i);
+    _mm_storeu_pd(vals+i, _mm_and_pd(_mm_cmpgt_pd(b, z),
+                                     _mm_div_pd(s, b)));
+  }
+  #endif
+  for ( ; i < n; i++)           /* evaluate the remaining rules */
+    vals[i] = re_conf(supp[i], body[i], head[i], base);
+}  /* re_confv() */
+
+/*--------------------------------------------------------------------*/
+
+void re_liftv (const SUPP *supp, const SUPP *body, const SUPP *head,
+               SUPP base, double *vals, size_t n)
+{                               /* --- lift value (batch) */
+  size_t  i = 0;                /* loop variable */
+  #ifdef __SSE2__               /* if SSE2 instructions available */
+  __m128d s, b, h, m, x, z;     /* support values, mask, base, zero */
+
+  z = _mm_setzero_pd();         /* get zero and the base support */
+  x = _mm_set1_pd((double)base);
+  for ( ; i+1 < n; i += 2) {    /* process two rules at a time */
+    s = LD2(supp, i); b = LD2(body, i); h = LD2(head, i);
+    m = _mm_and_pd(_mm_cmpgt_pd(b, z), _mm_cmpgt_pd(h, z));
+    _mm_storeu_pd(vals+i, _mm_and_pd(m,
+      _mm_div_pd(_mm_mul_pd(s, x), _mm_mul_pd(b, h))));
+  }                             /* compute (supp*base)/(body*head) */
+  #endif
+  for ( ; i < n; i++)           /* evaluate the remaining rules */
+    vals[i] = re_lift(supp[i], body[i], head[i], base);
+}  /* re_liftv() */
+
+/*--------------------------------------------------------------------*/
+
+void re_cvctv (const SUPP *supp, const SUPP *body, const SUPP *head,
+               SUPP base, double *vals, size_t n)
+{                               /* --- conviction (batch) */
+  size_t  i = 0;                /* loop variable */
+  #ifdef __SSE2__               /* if SSE2 instructions available */
+  __m128d s, b, h, m, x;        /* support values, mask, base */
+
+  if (base > 0) {               /* if there are transactions */
+    x = _mm_set1_pd((double)base);
+    for ( ; i+1 < n; i += 2) {  /* process two rules at a time */
+      s = LD2(supp, i); b = LD2(body, i); h = LD2(head, i);
+      m = _mm_cmpgt_pd(b, s);   /* mask out rules with body <= supp */
+      _mm_storeu_pd(vals+i, _mm_and_pd(m,
+        _mm_div_pd(_mm_mul_pd(b, _mm_sub_pd(x, h)),
+                   _mm_mul_pd(_mm_sub_pd(b, s), x))));
+    }                           /* compute (body*(base-head)) */
+  }                             /*       / ((body-supp)*base) */
+  #endif
+  for ( ; i < n; i++)           /* evaluate the remaining rules */
+    vals[i] = re_cvct(supp[i], body[i], head[i], base);
+}  /* re_cvctv() */
+
+/*--------------------------------------------------------------------*/
+
+void re_certv (const SUPP *supp, const SUPP *body, const SUPP *head,
+               SUPP base, double *vals, size_t n)
+{                               /* --- certainty factor (batch) */
+  size_t  i = 0;                /* loop variable */
+  #ifdef __SSE2__               /* if SSE2 instructions available */
+  __m128d s, b, h, m, x, z, o;  /* support values, mask, base etc. */
+  __m128d p, d, g;              /* prior, difference, sign mask */
+
+  if (base > 0) {               /* if there are transactions */
+    x = _mm_set1_pd((double)base);
+    z = _mm_setzero_pd(); o = _mm_set1_pd(1.0);
+    for ( ; i+1 < n; i += 2) {  /* process two rules at a time */
+      s = LD2(supp, i); b = LD2(body, i); h = LD2(head, i);
+      m = _mm_cmpgt_pd(b, z);   /* mask out vanishing body supports */
+      p = _mm_div_pd(h, x);     /* compute the head prior and */
+      d = _mm_sub_pd(_mm_div_pd(s, b), p);  /* the conf. difference */
+      g = _mm_cmpge_pd(d, z);   /* select 1-p or p as the divisor */
+      p = _mm_or_pd(_mm_and_pd(g, _mm_sub_pd(o, p)),
+                    _mm_andnot_pd(g, p));
+      _mm_storeu_pd(vals+i, _mm_and_pd(m, _mm_div_pd(d, p)));
+    }                           /* compute the certainty factor */
+  }
+  #endif
+  for ( ; i < n; i++)           /* evaluate the remaining rules */
+    vals[i] = re_cert(supp[i], body[i], head[i], base);
+}  /* re_certv() */
+
+/*--------------------------------------------------------------------*/
+
+void re_chi2v (const SUPP *supp, const SUPP *body, const SUPP *head,
+               SUPP base, double *vals, size_t n)
+{                               /* --- normalized chi^2 (batch) */
+  size_t  i = 0;                /* loop variable */
+  #ifdef __SSE2__               /* if SSE2 instructions available */
+  __m128d s, b, h, m, x, z, t;  /* support values, mask, base etc. */
+
+  x = _mm_set1_pd((double)base);
+  z = _mm_setzero_pd();         /* get zero and the base support */
+  for ( ; i+1 < n; i += 2) {    /* process two rules at a time */
+    s = LD2(supp, i); b = LD2(body, i); h = LD2(head, i);
+    m = _mm_and_pd(_mm_and_pd(_mm_cmpgt_pd(h, z), _mm_cmplt_pd(h, x)),
+                   _mm_and_pd(_mm_cmpgt_pd(b, z), _mm_cmplt_pd(b, x)));
+    t = _mm_sub_pd(_mm_mul_pd(h, b), _mm_mul_pd(s, x));
+    t = _mm_div_pd(_mm_mul_pd(t, t),   /* check the marginals and */
+          _mm_mul_pd(_mm_mul_pd(_mm_mul_pd(h, _mm_sub_pd(x, h)), b),
+                     _mm_sub_pd(x, b)));       /* compute chi^2 */
+    _mm_storeu_pd(vals+i, _mm_and_pd(m, t));
+  }
+  #endif
+  for ( ; i < n; i++)           /* evaluate the remaining rules */
+    vals[i] = re_chi2(supp[i], body[i], head[i], base);
+}  /* re_chi2v() */
+
+/* The batch evaluation functions compute the measure for n rules    */
+/* with the supports supp[i], body[i] and head[i] (i = 0..n-1) and   */
+/* a common base support and store the values in vals[i]. If SSE2    */
+/* instructions are available, two rules are processed at a time,    */
+/* with the same operations in the same order as the corresponding   */
+/* scalar function, so that the results are exactly the same. Cases  */
+/* in which the scalar function returns zero are masked out.         */
 
 /*--------------------------------------------------------------------*/
 
 static const REINFO reinfo[] ={ /* --- rule evaluation functions */
-  /* RE_NONE       0 */  { re_none,       0 },
-  /* RE_SUPP       1 */  { re_supp,      +1 },
-  /* RE_CONF       2 */  { re_conf,      +1 },
-  /* RE_CONFDIFF   3 */  { re_confdiff,  +1 },
-  /* RE_LIFT       4 */  { re_lift,      +1 },
-  /* RE_LIFTDIFF   5 */  { re_liftdiff,  +1 },
-  /* RE_LIFTQUOT   6 */  { re_liftquot,  +1 },
-  /* RE_CVCT       7 */  { re_cvct,      +1 },
-  /* RE_CVCTDIFF   8 */  { re_cvctdiff,  +1 },
-  /* RE_CVCTQUOT   9 */  { re_cvctquot,  +1 },
-  /* RE_CPROB     10 */  { re_cprob,     +1 },
-  /* RE_IMPORT    11 */  { re_import,    +1 },
-  /* RE_CERT      12 */  { re_cert,      +1 },
-  /* RE_CHI2      13 */  { re_chi2,      +1 },
-  /* RE_CHI2PVAL  14 */  { re_chi2pval,  -1 },
-  /* RE_YATES     15 */  { re_yates,     +1 },
-  /* RE_YATESPVAL 16 */  { re_yatespval, -1 },
-  /* RE_INFO      17 */  { re_info,      +1 },
-  /* RE_INFOPVAL  18 */  { re_infopval,  -1 },
-  /* RE_FETPROB   19 */  { re_fetprob,   -1 },
-  /* RE_FETCHI2   20 */  { re_fetchi2,   -1 },
-  /* RE_FETINFO   21 */  { re_fetinfo,   -1 },
-  /* RE_FETSUPP   21 */  { re_fetsupp,   -1 },
+  /* RE_NONE       0 */  { re_none,       0,         0,         0, 0 },
+  /* RE_SUPP       1 */  { re_supp,       0,         0,        +1, 0 },
+  /* RE_CONF       2 */  { re_conf,       re_confv,  0,        +1, 0 },
+  /* RE_CONFDIFF   3 */  { re_confdiff,   0,         0,        +1, 0 },
+  /* RE_LIFT       4 */  { re_lift,       re_liftv,  0,        +1, 0 },
+  /* RE_LIFTDIFF   5 */  { re_liftdiff,   0,         0,        +1, 0 },
+  /* RE_LIFTQUOT   6 */  { re_liftquot,   0,         0,        +1, 0 },
+  /* RE_CVCT       7 */  { re_cvct,       re_cvctv,  0,        +1, 0 },
+  /* RE_CVCTDIFF   8 */  { re_cvctdiff,   0,         0,        +1, 0 },
+  /* RE_CVCTQUOT   9 */  { re_cvctquot,   0,         0,        +1, 0 },
+  /* RE_CPROB     10 */  { re_cprob,      0,         0,        +1, 0 },
+  /* RE_IMPORT    11 */  { re_import,     0,         0,        +1, 0 },
+  /* RE_CERT      12 */  { re_cert,       re_certv,  0,        +1, 0 },
+  /* RE_CHI2      13 */  { re_chi2,       re_chi2v,  0,        +1, 0 },
+  /* RE_CHI2PVAL  14 */  { re_chi2pval,   0,         0,        -1, 1 },
+  /* RE_YATES     15 */  { re_yates,      0,         0,        +1, 0 },
+  /* RE_YATESPVAL 16 */  { re_yatespval,  0,         0,        -1, 1 },
+  /* RE_INFO      17 */  { re_info,       0,         0,        +1, 0 },
+  /* RE_INFOPVAL  18 */  { re_infopval,   0,         0,        -1, 1 },
+  /* RE_FETPROB   19 */  { re_fetprob,    0,         fetprob,  -1, 1 },
+  /* RE_FETCHI2   20 */  { re_fetchi2,    0,         fetchi2,  -1, 1 },
+  /* RE_FETINFO   21 */  { re_fetinfo,    0,         fetinfo,  -1, 1 },
+  /* RE_FETSUPP   22 */  { re_fetsupp,    0,         fetsupp,  -1, 1 },
 };                              /* table of evaluation functions */
 
 /*--------------------------------------------------------------------*/
@@ -446,3 +613,113 @@ int re_dir (int id)
   assert((id >= 0) && (id <= RE_FNCNT));
   return reinfo[id].dir;        /* retrieve direction from table */
 }  /* re_dir() */
+
+/*----------------------------------------------------------------------
+  Rule Evaluator Functions
+----------------------------------------------------------------------*/
+
+void re_init (REVAL *rev, int id, double lim)
+{                               /* --- initialize a rule evaluator */
+  assert(rev && (id >= 0) && (id < RE_FNCNT));
+  rev->id   = id;               /* note the measure identifier */
+  rev->lim  = lim;              /* and the early termination limit */
+  rev->base = -1;               /* there is no base support yet */
+  rev->lnf  = NULL;             /* (tables are created on demand) */
+  rev->memo = NULL;
+}  /* re_init() */
+
+/*--------------------------------------------------------------------*/
+
+void re_exit (REVAL *rev)
+{                               /* --- clean up a rule evaluator */
+  assert(rev);                  /* check the function argument */
+  if (rev->lnf)  { free(rev->lnf);  rev->lnf  = NULL; }
+  if (rev->memo) { free(rev->memo); rev->memo = NULL; }
+  rev->base = -1;               /* delete the factorial table */
+}  /* re_exit() */              /* and the memo of measure values */
+
+/*--------------------------------------------------------------------*/
+
+static void rebase (REVAL *rev, SUPP base)
+{                               /* --- set a new base support */
+  size_t i, n;                  /* loop variable, table size */
+
+  assert(rev && (base >= 0));   /* check the function arguments */
+  rev->base = base;             /* note the new base support */
+  if (!rev->memo)               /* allocate a memo of values */
+    rev->memo = (REMEMO*)malloc(MEMOSIZE *sizeof(REMEMO));
+  if (rev->memo)                /* invalidate all memo entries */
+    for (i = 0; i < MEMOSIZE; i++) rev->memo[i].supp = -1;
+  if (rev->lnf) { free(rev->lnf); rev->lnf = NULL; }
+  if (!reinfo[rev->id].tab || ((double)base >= (double)LNF_MAX))
+    return;                     /* check whether a table is needed */
+  n = (size_t)base+1;           /* get the size of the table */
+  rev->lnf = (double*)malloc(n *sizeof(double));
+  if (!rev->lnf) return;        /* create a factorial table */
+  for (i = 0; i < n; i++)       /* (if allocation fails, */
+    rev->lnf[i] = logGamma((double)(i+1));
+}  /* rebase() */               /* logGamma() is called directly) */
+
+/*--------------------------------------------------------------------*/
+
+double re_eval (REVAL *rev, SUPP supp, SUPP body, SUPP head, SUPP base)
+{                               /* --- evaluate with a rule evaluator */
+  const REINFO *r;              /* rule evaluation information */
+  REMEMO       *m = NULL;       /* memo entry for the marginals */
+  double       v;               /* value of the evaluation measure */
+
+  assert(rev);                  /* check the function argument */
+  r = reinfo +rev->id;          /* get the evaluation information */
+  if (!r->memo)                 /* if evaluation is cheap, */
+    return r->fn(supp, body, head, base);    /* evaluate directly */
+  if (base != rev->base)        /* if the base support changed, */
+    rebase(rev, base);          /* rebuild the tables */
+  if (rev->memo) {              /* if there is a memo of values */
+    m = rev->memo +((((size_t)supp *0x9e3779b1u)
+                    ^((size_t)body *0x85ebca77u) ^(size_t)head)
+                    & (MEMOSIZE-1));
+    if ((m->supp == supp) && (m->body == body) && (m->head == head))
+      return m->val;            /* if the value has been computed, */
+  }                             /* return the memorized value */
+  v = (r->tab) ? r->tab(rev->lnf, rev->lim, supp, body, head, base)
+               : r->fn (supp, body, head, base);
+  if (m) { m->supp = supp; m->body = body; m->head = head; m->val = v; }
+  return v;                     /* compute and memorize the value */
+}  /* re_eval() */
+
+/* A rule evaluator speeds up the computation of measures that are  */
+/* expensive to evaluate (p-values and Fisher's exact test). It     */
+/* keeps a table of the logarithms of the factorials 0! to base!,   */
+/* which is built once per base support (with logGamma(), so that   */
+/* the values are exactly the same as without the table), and a     */
+/* direct mapped memo of measure values indexed by the marginals    */
+/* (supp, body, head), because many rules and item sets share their */
+/* contingency tables. Since the probability sums of Fisher's exact */
+/* test can only grow, they are aborted as soon as they exceed the  */
+/* limit 'lim' given to re_init(): the returned value then still    */
+/* exceeds the limit, that is, the threshold decision is correct,   */
+/* but the value is not exact. Hence a finite limit should only be  */
+/* used if values beyond it are discarded (not if values are        */
+/* averaged, for example).                                          */
+
+/*--------------------------------------------------------------------*/
+
+void re_evalv (REVAL *rev, const SUPP *supp, const SUPP *body,
+               const SUPP *head, SUPP base, double *vals, size_t n)
+{                               /* --- batch evaluation of rules */
+  const REINFO *r;              /* rule evaluation information */
+  size_t       i;               /* loop variable */
+
+  assert(rev && (supp || (n <= 0)) && (body || (n <= 0))
+  &&    (head || (n <= 0)) && (vals || (n <= 0)));
+  r = reinfo +rev->id;          /* get the evaluation information */
+  if (r->vfn) {                 /* if there is a batch function, */
+    r->vfn(supp, body, head, base, vals, n); return; }  /* use it */
+  if (!r->memo) {               /* if evaluation is cheap, */
+    for (i = 0; i < n; i++)     /* evaluate the rules directly */
+      vals[i] = r->fn(supp[i], body[i], head[i], base);
+    return;                     /* (no need to check the tables) */
+  }
+  for (i = 0; i < n; i++)       /* evaluate the rules individually */
+    vals[i] = re_eval(rev, supp[i], body[i], head[i], base);
+}  /* re_evalv() */             /* (using the tables and the memo) */
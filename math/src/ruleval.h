@@ -6,6 +6,8 @@
             2012.02.15 function re_supp() added (rule support)
             2013.03.29 adapted to type changes in module tract (SUPP)
             2014.05.15 functions re_cprob() and re_import() added
+            2026.10.14 rule evaluator (REVAL) with table and memo added
+            2026.10.14 batch evaluation functions and re_evalv() added
 ----------------------------------------------------------------------*/
 #ifndef __RULEVAL__
 #define __RULEVAL__
@@ -47,7 +49,25 @@
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
-typedef double RULEVALFN (SUPP supp, SUPP body, SUPP head, SUPP base);
+typedef double RULEVALFN  (SUPP supp, SUPP body, SUPP head, SUPP base);
+typedef void   RULEVALVFN (const SUPP *supp, const SUPP *body,
+                           const SUPP *head, SUPP base,
+                           double *vals, size_t n);
+
+typedef struct {                /* --- memo entry --- */
+  SUPP      supp;               /* support of body and head */
+  SUPP      body;               /* support of body */
+  SUPP      head;               /* support of head */
+  double    val;                /* value of evaluation measure */
+} REMEMO;                       /* (memo entry) */
+
+typedef struct {                /* --- rule evaluator --- */
+  int       id;                 /* identifier of evaluation measure */
+  double    lim;                /* limit for early termination */
+  SUPP      base;               /* base support of the tables */
+  double    *lnf;               /* logarithms of factorials */
+  REMEMO    *memo;              /* memo of measure values */
+} REVAL;                        /* (rule evaluator) */
 
 /*----------------------------------------------------------------------
   Rule Evaluation Functions
@@ -76,7 +96,31 @@ extern double re_fetchi2   (SUPP supp, SUPP body, SUPP head, SUPP base);
 extern double re_fetinfo   (SUPP supp, SUPP body, SUPP head, SUPP base);
 extern double re_fetsupp   (SUPP supp, SUPP body, SUPP head, SUPP base);
 
+extern void   re_confv     (const SUPP *supp, const SUPP *body,
+                            const SUPP *head, SUPP base,
+                            double *vals, size_t n);
+extern void   re_liftv     (const SUPP *supp, const SUPP *body,
+                            const SUPP *head, SUPP base,
+                            double *vals, size_t n);
+extern void   re_cvctv     (const SUPP *supp, const SUPP *body,
+                            const SUPP *head, SUPP base,
+                            double *vals, size_t n);
+extern void   re_certv     (const SUPP *supp, const SUPP *body,
+                            const SUPP *head, SUPP base,
+                            double *vals, size_t n);
+extern void   re_chi2v     (const SUPP *supp, const SUPP *body,
+                            const SUPP *head, SUPP base,
+                            double *vals, size_t n);
+
 extern RULEVALFN* re_function (int id);
 extern int        re_dir      (int id);
 
+extern void       re_init     (REVAL *rev, int id, double lim);
+extern void       re_exit     (REVAL *rev);
+extern double     re_eval     (REVAL *rev, SUPP supp, SUPP body,
+                               SUPP head,  SUPP base);
+extern void       re_evalv    (REVAL *rev, const SUPP *supp,
+                               const SUPP *body, const SUPP *head,
+                               SUPP base, double *vals, size_t n);
+
 #endif
@@ -19,6 +19,11 @@
             2014.05.12 option -F# added (support border for filtering)
             2014.08.26 adapted to modified item set reporter interface
             2014.10.24 changed from LGPL license to MIT license
+            2026.10.14 binary transaction bag files accepted as input
+            2026.10.14 radix sort of transactions used (TA_RADIX)
+            2026.10.14 parallel processing of the top level (-T#)
+            2026.10.14 time and node budgets added (options -L# and -Q#)
+            2026.10.14 item ids and weights separated for search (_iw)
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,6 +33,12 @@
 #include <math.h>
 #include <time.h>
 #include <assert.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
 #ifndef TA_READ
 #define TA_READ
 #endif
@@ -39,6 +50,7 @@
 #define PSP_REPORT
 #endif
 #include "report.h"
+#include "bench.h"
 #include "error.h"
 #ifdef STORAGE
 #include "storage.h"
@@ -75,6 +87,26 @@
 
 #define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
 
+#define TMCHECK     1023        /* mask for checking the time budget */
+#define OVER(d)     ((((d)->nmax > 0) || ((d)->tend > 0)) && over(d))
+
+/* --- thread definitions --- */
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#define THREAD       HANDLE     /* threads identified by handles */
+#define THREAD_OK    0          /* return value is DWORD */
+#define WORKERDEF(n,p)  DWORD WINAPI n (LPVOID p)
+#define MUTEX        CRITICAL_SECTION
+#define LOCK(m)      EnterCriticalSection(&(m))
+#define UNLOCK(m)    LeaveCriticalSection(&(m))
+#else                           /* if Linux/Unix system */
+#define THREAD       pthread_t  /* use the POSIX thread type */
+#define THREAD_OK    NULL       /* return value is void* */
+#define WORKERDEF(n,p)  void*        n (void* p)
+#define MUTEX        pthread_mutex_t
+#define LOCK(m)      pthread_mutex_lock(&(m))
+#define UNLOCK(m)    pthread_mutex_unlock(&(m))
+#endif                          /* definition of a worker function */
+
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
@@ -97,12 +129,14 @@ typedef struct {                /* --- pattern extension --- */
 
 typedef struct {                /* --- pattern occurrence --- */
   SUPP       wgt;               /* weight of containing transaction */
-  WITEM      *items;            /* items  of containing transaction */
-  WITEM      **ips;             /* (positions of) items in pattern */
+  const ITEM *items;            /* items  of containing transaction */
+  const float *iwgs;            /* weights of the transaction items */
+  const ITEM **ips;             /* (positions of) items in pattern */
+  float      *pws;              /* weights of the items in pattern */
 } WPATOCC;                      /* (pattern occurrence) */
 
 typedef struct {                /* --- occurrence extension --- */
-  WITEM      *item;             /* extension item in transaction */
+  const ITEM *item;             /* extension item in transaction */
   WPATOCC    *occ;              /* pattern occurrence to extend */
 } WOCCEXT;                      /* occurrence extension */
 
@@ -123,8 +157,28 @@ typedef struct {                /* --- recursion data --- */
   ITEM       *items;            /* current pattern sequence: items */
   double     *wgts;             /* current pattern sequence: weights */
   ISREPORT   *report;           /* item set/sequence reporter */
+  double     tend;              /* deadline of the search (0: none) */
+  size_t     nmax;              /* budget of search nodes (0: none) */
+  size_t     ncnt;              /* number of checked search nodes */
+  int        stop;              /* whether the budget is exhausted */
+  SUPP       miss;              /* max. support of unreported seqs. */
 } RECDATA;                      /* (recursion data) */
 
+typedef struct {                /* --- shared work queue --- */
+  ITEM       next;              /* next top level extension item */
+  MUTEX      mutex;             /* mutex for accessing the queue */
+} WORKQUEUE;                    /* (shared work queue) */
+
+typedef struct {                /* --- thread worker data --- */
+  TABAG      *tabag;            /* shared transaction bag */
+  WORKQUEUE  *queue;            /* shared queue of top level items */
+  RECDATA    rd;                /* private recursion data */
+  SUPP       max;               /* maximal extension support */
+  int        err;               /* error indicator */
+} WORKDATA;                     /* (thread worker data) */
+
+typedef WORKERDEF(WORKERFN, p); /* worker function type */
+
 /*----------------------------------------------------------------------
   Constants
 ----------------------------------------------------------------------*/
@@ -208,9 +262,9 @@ static void show (PATEXT *exts, ITEM n, ITEM len, int ind)
 
 static void xshow (WPATEXT *exts, ITEM n, ITEM len, int ind)
 {                               /* --- show pattern extensions */
-  int     i, k, m;              /* loop variables */
-  WPATOCC *o;                   /* to traverse the pattern occs. */
-  WITEM   *x;                   /* to traverse the (extended) items */
+  int        i, k, m;           /* loop variables */
+  WPATOCC    *o;                /* to traverse the pattern occs. */
+  const ITEM *x;                /* to traverse the (extended) items */
 
   assert(exts);                 /* check the function arguments */
   for (i = 0; i < n; i++) {     /* traverse the pattern extensions */
@@ -223,17 +277,47 @@ static void xshow (WPATEXT *exts, ITEM n, ITEM len, int ind)
       indent(ind); printf("  ");/* indent the output line */
       for (m = 0; m < len; m++) {
         x = o->ips[m];          /* traverse the pattern */
-        printf(" %s:%g", ib_name(ibase, x->item), x->wgt);
+        printf(" %s:%g", ib_name(ibase, *x), o->pws[m]);
       }                         /* print the pattern items */
       printf(" |");             /* print a tail separator */
-      for (x = exts[i].oxs[k].item; x->item >= 0; x++)
-        printf(" %s:%g", ib_name(ibase, x->item), x->wgt);
+      for (x = exts[i].oxs[k].item; *x >= 0; x++)
+        printf(" %s:%g", ib_name(ibase, *x), o->iwgs[x-o->items]);
       printf("\n");             /* print the tail items */
     }                           /* and terminate the output line */
   }
 }  /* xshow() */
 
 #endif
+/*----------------------------------------------------------------------
+  Search Budget
+----------------------------------------------------------------------*/
+
+static int over (RECDATA *rd)
+{                               /* --- check the search budget */
+  rd->ncnt += 1;                /* count the current search node */
+  if ((rd->nmax > 0) && (rd->ncnt > rd->nmax))
+    return rd->stop = 1;        /* check the node budget */
+  if ((rd->tend > 0) && ((rd->ncnt & TMCHECK) == 0)
+  &&  (bnr_wall() >= rd->tend))
+    return rd->stop = 1;        /* check the time budget */
+  return 0;                     /* (only every 1024 search nodes) */
+}  /* over() */
+
+/*--------------------------------------------------------------------*/
+
+static void bound (RECDATA *rd, SUPP supp)
+{                               /* --- note support of a skipped seq. */
+  if (supp > rd->miss) rd->miss = supp;
+}  /* bound() */
+
+/* As in fpgrowth, every frequent extension item is a search node   */
+/* that is checked with the macro OVER(), and the clock is read only */
+/* every 1024 search nodes. If the budget is exhausted, the search   */
+/* is aborted like on an error, but with the flag "stop" set, and    */
+/* while the recursion unwinds, the largest support of an extension  */
+/* that was not yet processed is recorded, which bounds the support  */
+/* of all sequences that were not reported.                          */
+
 /*----------------------------------------------------------------------
   Sequence Mining with Unique Item Occurrences (no item weights)
 ----------------------------------------------------------------------*/
@@ -295,6 +379,8 @@ static SUPP recurse (PATEXT *exts, size_t z, ITEM len, RECDATA *rd)
     e = exts +i;                /* traverse the pattern extensions */
     if (e->supp < rd->smin)     /* if extension item is infrequent, */
       continue;                 /* the item need not be processed */
+    if (OVER(rd)) {             /* if the search budget is exhausted, */
+      s = -1; break; }          /* abort the search (partial result) */
     if (e->supp > max)          /* find maximal extension support */
       max = e->supp;            /* (for test if a pattern is closed) */
     if ((rd->mode & ISR_CLOSED) /* if to find only closed sequences */
@@ -327,61 +413,49 @@ static SUPP recurse (PATEXT *exts, size_t z, ITEM len, RECDATA *rd)
       s = -1; break; }          /* report the current pattern */
     isr_remove(rd->report, 1);  /* remove the current item */
   }                             /* from the item set reporter */
+  if (rd->stop) {               /* if the search budget is exhausted, */
+    for ( ; i < rd->cnt; i++)
+      bound(rd, exts[i].supp);
+  }                             /* note max. support of skipped items */
   if (cond) free(cond);         /* delete the conditional extensions */
   return (s < 0) ? s : max;     /* return maximal extension support */
 }  /* recurse() */
 
 /*--------------------------------------------------------------------*/
 
-static int sequoia (TABAG *tabag, int target, SUPP smin, int mode,
-                    ISREPORT *report)
-{                               /* --- search for frequent sequences */
+static PATEXT* initext (TABAG *tabag, TID *frqs)
+{                               /* --- create initial extensions */
   ITEM       i, k;              /* loop variable, number of items */
   TID        j, n;              /* loop variable, number of trans. */
   size_t     z;                 /* number of item instances */
-  SUPP       r;                 /* result of recursion */
   TRACT      *t;                /* to traverse the transactions */
   const ITEM *s, **p;           /* to traverse the items */
   OCCEXT     *x;                /* to traverse occurrence extensions */
   PATOCC     *occs, *o;         /* array of pattern occurrences */
   PATEXT     *exts, *e;         /* array of pattern extensions */
-  RECDATA    rd;                /* recursion data */
 
-  assert(tabag && report);      /* check the function arguments */
-  rd.target = target;           /* store target type and search mode */
-  rd.mode   = mode;             /* check and adapt minimum support */
-  rd.smin   = (smin > 0) ? smin : 1;
-  if (tbg_wgt(tabag) < rd.smin) /* check the total transaction weight */
-    return 0;                   /* against the minimum support */
-  rd.report = report;           /* initialize the recursion data */
-  rd.zmax   = isr_zmax(report); /* (reporter and max. seq. length) */
-  rd.cnt    = k = tbg_itemcnt(tabag);   /* get the number of items */
-  if (k <= 0) return isr_report(report);
-  rd.buf  = (ITEM*)malloc((size_t)k *sizeof(ITEM)
-                         +(size_t)k *sizeof(TID));
-  if (!rd.buf) return -1;       /* create an item buffer */
-  rd.frqs = (TID*)(rd.buf +k);  /* and an item counter array */
-  n = tbg_cnt(tabag);           /* get the number of transactions */
+  assert(tabag && frqs);        /* check the function arguments */
+  k = tbg_itemcnt(tabag);       /* get the number of items, */
+  n = tbg_cnt(tabag);           /* the number of transactions */
   z = tbg_extent(tabag);        /* and the number of item instances */
-  occs = (PATOCC*)malloc((size_t)n *sizeof(PATOCC)
+  exts = (PATEXT*)malloc((size_t)k *sizeof(PATEXT)
+                        +(size_t)z *sizeof(OCCEXT)
+                        +(size_t)n *sizeof(PATOCC)
                         +(size_t)z *sizeof(ITEM*));
-  if (!occs) { free(rd.buf); return -1; }
-  p = (const ITEM**)(occs +n);  /* create pattern occurrences */
-  memset(rd.frqs, 0, (size_t)k *sizeof(TID));
+  if (!exts) return NULL;       /* allocate memory for pattern */
+  x    = (OCCEXT*)(exts +k);    /* and occurrence extensions */
+  occs = (PATOCC*)(x +z);       /* and for pattern occurrences */
+  p    = (const ITEM**)(occs +n);
   for (j = 0; j < n; j++) {     /* traverse the transactions and */
     t = tbg_tract(tabag, j);    /* create a pattern occurrence */
     o = occs +j;                /* for each transaction */
     o->wgt = ta_wgt(t);         /* note the transaction weight and */
     o->ips = p; p += ta_size(t);/* organize extension item arrays */
     for (s = o->items = ta_items(t); *s >= 0; s++)
-      rd.frqs[*s]++;            /* note the item array and */
+      frqs[*s]++;               /* note the item array and */
   }                             /* count the item occurrences */
-  exts = (PATEXT*)malloc((size_t)k *sizeof(PATEXT)
-                        +(size_t)z *sizeof(OCCEXT));
-  if (!exts) return -1;         /* allocate memory for pattern */
-  x = (OCCEXT*)(exts +k);       /* and occurrence extensions */
   for (i = 0; i < k; i++) {     /* initialize the pattern extensions */
-    e = exts+i; e->supp = 0; e->cnt = 0; e->oxs = x; x += rd.frqs[i]; }
+    e = exts+i; e->supp = 0; e->cnt = 0; e->oxs = x; x += frqs[i]; }
   for (j = 0; j < n; j++) {     /* traverse the transactions and */
     o = occs +j;                /* the items in each transaction */
     for (s = o->items; *s >= 0; s++) {
@@ -392,16 +466,15 @@ static int sequoia (TABAG *tabag, int target, SUPP smin, int mode,
       e->supp += o->wgt;        /* sum transaction weights (support) */
     }                           /* (exts represents the possible */
   }                             /* extensions of the empty sequence) */
-  memset(rd.frqs, 0, (size_t)k *sizeof(TID));
-  r = recurse(exts, z, 0, &rd); /* search for frequent sequences */
-  if ( (r >= 0)                 /* if no error occurred */
-  &&  ((r < tbg_wgt(tabag))     /* if the empty sequence is closed */
-  ||  !(mode & ISR_CLOSED)))    /* or all sequences are requested, */
-    r = isr_report(report);     /* report the empty sequence */
-  free(rd.buf);                 /* deallocate the pattern buffer, */
-  free(exts); free(occs);       /* pattern extensions and occurrences */
-  return (r < 0) ? (int)r : 0;  /* return the error status */
-}  /* sequoia() */
+  memset(frqs, 0, (size_t)k *sizeof(TID));
+  return exts;                  /* return the pattern extensions */
+}  /* initext() */
+
+/* The pattern extensions, the occurrence extensions and the pattern */
+/* occurrences (together with their item position arrays) are        */
+/* allocated as one memory block, which is referenced by the returned */
+/* pointer. The item counter array must be cleared on input and it   */
+/* is cleared again on output.                                       */
 
 /*----------------------------------------------------------------------
   Sequence Mining with Unique Item Occurrences and Weight Averaging
@@ -409,10 +482,10 @@ static int sequoia (TABAG *tabag, int target, SUPP smin, int mode,
 
 static int closed_iw (WPATEXT *ext, ITEM n, RECDATA *rd)
 {                               /* --- check for a closed extension */
-  TID     i, k, c;              /* loop variables, buffer */
-  ITEM    *b;                   /* to traverse the item buffer */
-  WPATOCC *o;                   /* to traverse pattern occurrences */
-  WITEM   *x, *z;               /* to traverse the (extended) items */
+  TID        i, k, c;           /* loop variables, buffer */
+  ITEM       *b;                /* to traverse the item buffer */
+  WPATOCC    *o;                /* to traverse pattern occurrences */
+  const ITEM *x, *z;            /* to traverse the (extended) items */
 
   assert(ext                    /* check the function arguments */
   &&    (ext->cnt > 0) && (len > 0) && rd);
@@ -423,9 +496,9 @@ static int closed_iw (WPATEXT *ext, ITEM n, RECDATA *rd)
       x = (n > 0) ? o->ips[n-1]+1 : o->items;
       z = o->ips[n];            /* get the bounds of the current gap */
       for (k = 0; x < z; x++) { /* traverse the current gap */
-        c = ++rd->frqs[x->item];/* count gap items that occur */
+        c = ++rd->frqs[*x];     /* count gap items that occur */
         if (c >  i) k++;        /* in all pattern occurrences */
-        if (c <= 1) *b++ = x->item;
+        if (c <= 1) *b++ = *x;
       }                         /* collect all occurring items */
       if (k <= 0) break;        /* if the item counter is zero, */
     }                           /* no item is in all occurrences */
@@ -440,13 +513,14 @@ static int closed_iw (WPATEXT *ext, ITEM n, RECDATA *rd)
 
 static SUPP rec_iw (WPATEXT *exts, size_t z, ITEM len, RECDATA *rd)
 {                               /* --- recursive pattern search */
-  ITEM    i, k, m;              /* loop variables */
-  SUPP    s, max;               /* (maximum) extension support */
-  WPATEXT *cond = NULL;         /* conditional pattern extensions */
-  WPATEXT *e, *c;               /* to traverse pattern extensions */
-  WPATOCC *o;                   /* to traverse pattern occurrences */
-  WOCCEXT *x;                   /* to traverse occurrence extensions */
-  WITEM   *p;                   /* to traverse the tail items */
+  ITEM       i, k, m;           /* loop variables */
+  SUPP       s, max;            /* (maximum) extension support */
+  double     w, *wgts;          /* occurrence and pattern weights */
+  WPATEXT    *cond = NULL;      /* conditional pattern extensions */
+  WPATEXT    *e, *c;            /* to traverse pattern extensions */
+  WPATOCC    *o;                /* to traverse pattern occurrences */
+  WOCCEXT    *x;                /* to traverse occurrence extensions */
+  const ITEM *p;                /* to traverse the tail items */
 
   assert(exts                   /* check the function arguments */
   &&    (z > 0) && (len >= 0) && rd);
@@ -461,11 +535,15 @@ static SUPP rec_iw (WPATEXT *exts, size_t z, ITEM len, RECDATA *rd)
     e = exts +i;                /* traverse the pattern extensions */
     if (e->supp < rd->smin)     /* if extension item is infrequent, */
       continue;                 /* the item need not be processed */
+    if (OVER(rd)) {             /* if the search budget is exhausted, */
+      s = -1; break; }          /* abort the search (partial result) */
     if (e->supp > max)          /* find maximal extension support */
       max = e->supp;            /* (for test if a pattern is closed) */
     rd->items[len-1] = i;       /* add the ext. item to the pattern */
     for (k = 0; k < e->cnt; k++) {        /* and to its occurrences */
-      x = e->oxs+k; x->occ->ips[len-1] = x->item; }
+      x = e->oxs +k; o = x->occ; o->ips[len-1] = x->item;
+      o->pws[len-1] = o->iwgs[x->item -o->items];
+    }                           /* (note item position and weight) */
     if ((rd->mode & ISR_CLOSED) /* if to find only closed sequences */
     &&  !closed_iw(e, len, rd)) /* and the extension is not closed, */
       continue;                 /* the item need not be processed */
@@ -476,8 +554,8 @@ static SUPP rec_iw (WPATEXT *exts, size_t z, ITEM len, RECDATA *rd)
       for (z = 0, k = 0; k < e->cnt; k++) {
         x = e->oxs +k;          /* traverse the occurrence extensions */
         o = x->occ;             /* get corresp. pattern occurrence */
-        for (p = x->item; (++p)->item >= 0; z++) {
-          c = cond   +p->item;  /* traverse the tail of the sequence */
+        for (p = x->item; *++p >= 0; z++) {
+          c = cond   +*p;       /* traverse the tail of the sequence */
           x = c->oxs +c->cnt++; /* append an occurrence extension */
           x->item  = p;         /* to the array for the tail item, */
           x->occ   = o;         /* note the extension item position, */
@@ -492,34 +570,365 @@ static SUPP rec_iw (WPATEXT *exts, size_t z, ITEM len, RECDATA *rd)
     if ((rd->mode & ISR_CLOSED) /* if to report only closed patterns */
     &&  (s >= e->supp))         /* and the pattern is not closed, */
       continue;                 /* continue with the next item */
+    wgts = rd->wgts;            /* get the pattern weight array */
     for (k = 0; k < len; k++)   /* traverse the current pattern and */
-      rd->wgts[k] = 0;          /* clear (conditional) item weights */
+      wgts[k] = 0;              /* clear (conditional) item weights */
     for (k = 0; k < e->cnt; k++) {
       o = e->oxs[k].occ;        /* traverse the pattern occurrences */
-      for (m = 0; m < len; m++) /* and their item occurrences and */
-        rd->wgts[m] += (double)o->wgt *o->ips[m]->wgt;
-    }                           /* sum (conditional) item weights */
+      w = (double)o->wgt;       /* and their item occurrences and */
+      for (m = 0; m < len; m++) /* sum (conditional) item weights */
+        wgts[m] += w *o->pws[m];/* (contiguous arrays, so that */
+    }                           /* the loop can be vectorized) */
     if (isr_isetx(rd->report,rd->items,len,rd->wgts,e->supp,0,0) < 0) {
       s = -1; break; }          /* report the current pattern */
   }
+  if (rd->stop) {               /* if the search budget is exhausted, */
+    for ( ; i < rd->cnt; i++)
+      bound(rd, exts[i].supp);
+  }                             /* note max. support of skipped items */
   if (cond) free(cond);         /* delete the conditional extensions */
   return (s < 0) ? s : max;     /* return the error status or */
 }  /* rec_iw() */               /* the maximal extension support */
 
 /*--------------------------------------------------------------------*/
 
+static WPATEXT* initext_iw (TABAG *tabag, TID *frqs)
+{                               /* --- create initial extensions */
+  ITEM       i, k, m;           /* loop variables, number of items */
+  TID        j, n;              /* loop variable, number of trans. */
+  size_t     z;                 /* number of item instances */
+  WTRACT     *t;                /* to traverse the transactions */
+  const WITEM *s;               /* to traverse the (extended) items */
+  const ITEM *d, **p;           /* to traverse the item arrays */
+  ITEM       *a;                /* to fill the item arrays */
+  float      *f, *g;            /* to fill the weight arrays */
+  WOCCEXT    *x;                /* to traverse occurrence extensions */
+  WPATOCC    *occs, *o;         /* array of pattern occurrences */
+  WPATEXT    *exts, *e;         /* array of pattern extensions */
+
+  assert(tabag && frqs);        /* check the function arguments */
+  k = tbg_itemcnt(tabag);       /* get the number of items, */
+  n = tbg_cnt(tabag);           /* the number of transactions */
+  z = tbg_extent(tabag);        /* and the number of item instances */
+  exts = (WPATEXT*)malloc((size_t)k *sizeof(WPATEXT)
+                         +(size_t)z *sizeof(WOCCEXT)
+                         +(size_t)n *sizeof(WPATOCC)
+                         +(size_t)z *sizeof(ITEM*)
+                         +(z+z+(size_t)n) *sizeof(float)
+                         +(z  +(size_t)n) *sizeof(ITEM));
+  if (!exts) return NULL;       /* allocate memory for pattern */
+  x    = (WOCCEXT*)(exts +k);   /* and occurrence extensions */
+  occs = (WPATOCC*)(x +z);      /* and for pattern occurrences */
+  p    = (const ITEM**)(occs +n);
+  f    = (float*)(p +z);        /* and for separate arrays of */
+  g    = f +z;                  /* item identifiers and weights */
+  a    = (ITEM*)(g +z+n);       /* (structure of arrays) */
+  for (j = 0; j < n; j++) {     /* traverse the transactions and */
+    t = tbg_wtract(tabag, j);   /* create a pattern occurrence */
+    o = occs +j;                /* for each transaction */
+    o->wgt = wta_wgt(t);        /* note the transaction weight and */
+    m = wta_size(t);            /* organize extension item arrays */
+    o->ips   = p; p += m;       /* and the pattern weight arrays */
+    o->pws   = f; f += m;
+    o->items = a; o->iwgs = g;  /* note the item and weight arrays */
+    for (s = wta_items(t); s->item >= 0; s++) {
+      *a++ = s->item; *g++ = s->wgt;
+      frqs[s->item]++;          /* copy the items and their weights */
+    }                           /* and count the item occurrences */
+    *a++ = -1; *g++ = 0;        /* store sentinels after the items */
+  }
+  for (i = 0; i < k; i++) {     /* initialize the pattern extensions */
+    e = exts+i; e->supp = 0; e->cnt = 0; e->oxs = x; x += frqs[i]; }
+  for (j = 0; j < n; j++) {     /* traverse the transactions and */
+    o = occs +j;                /* the items in each transaction */
+    for (d = o->items; *d >= 0; d++) {
+      e = exts   +*d;           /* get the corresp. pattern extension */
+      x = e->oxs +e->cnt++;     /* and its next occurrence extension */
+      x->item  = d;             /* set the extension item */
+      x->occ   = o;             /* and the pattern occurrence */
+      e->supp += o->wgt;        /* sum transaction weights (support) */
+    }                           /* (exts represents the possible */
+  }                             /* extensions of the empty sequence) */
+  memset(frqs, 0, (size_t)k *sizeof(TID));
+  return exts;                  /* return the pattern extensions */
+}  /* initext_iw() */
+
+/* The items and the item weights of the transactions are copied    */
+/* into two separate arrays (structure of arrays, each transaction  */
+/* with a sentinel -1/0), so that traversing the (tails of the)     */
+/* sequences and checking for closedness only touch the item        */
+/* identifiers. The weights of the pattern items, which are needed  */
+/* only for the averaging step, are stored in a contiguous array    */
+/* for each pattern occurrence when an item is added to the pattern */
+/* (in rec_iw()).                                                   */
+
+/*----------------------------------------------------------------------
+  Sequence Mining (parallel processing of the top level)
+----------------------------------------------------------------------*/
+
+static int cpucnt (void)
+{                               /* --- get the number of processors */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  SYSTEM_INFO sysinfo;          /* system information structure */
+  GetSystemInfo(&sysinfo);      /* get system information */
+  return (int)sysinfo.dwNumberOfProcessors;
+  #elif defined _SC_NPROCESSORS_ONLN
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+  #else                         /* if no direct function available */
+  return 1;                     /* use only one processor */
+  #endif
+}  /* cpucnt() */
+
+/*--------------------------------------------------------------------*/
+
+static ITEM fetch (WORKQUEUE *queue, ITEM cnt, int abort)
+{                               /* --- get the next top level item */
+  ITEM i;                       /* next item to process */
+
+  assert(queue);                /* check the function argument */
+  LOCK(queue->mutex);           /* lock the shared queue, */
+  i = queue->next;              /* get the next item and */
+  queue->next = (abort || (i >= cnt)) ? cnt : i+1;
+  UNLOCK(queue->mutex);         /* advance (or empty) the queue */
+  return i;                     /* return the item to process */
+}  /* fetch() */                /* (abort: first unfetched item) */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(worker, p)
+{                               /* --- worker function (no weights) */
+  WORKDATA *w = (WORKDATA*)p;   /* type the argument pointer */
+  ITEM     i;                   /* top level item to process */
+  SUPP     r, *supps;           /* result of recursion, item supports */
+  PATEXT   *exts;               /* private pattern extensions */
+
+  assert(p);                    /* check the function argument */
+  exts  = initext(w->tabag, w->rd.frqs);
+  supps = (SUPP*)malloc((size_t)w->rd.cnt *sizeof(SUPP));
+  if (!exts || !supps) w->err = -1;
+  else {                        /* check the created arrays */
+    for (i = 0; i < w->rd.cnt; i++) {
+      supps[i] = exts[i].supp; exts[i].supp = 0; }
+    while ((i = fetch(w->queue, w->rd.cnt, 0)) < w->rd.cnt) {
+      if (supps[i] < w->rd.smin) continue;
+      exts[i].supp = supps[i];  /* enable only the fetched item */
+      r = recurse(exts, tbg_extent(w->tabag), 0, &w->rd);
+      exts[i].supp = 0;         /* search for frequent sequences */
+      if (r < 0) { w->err = (w->rd.stop) ? 0 : -1; break; }
+      if (r > w->max) w->max = r;
+    }                           /* note the maximal support */
+  }
+  if (w->rd.stop) {             /* if the search budget is exhausted, */
+    for (i = fetch(w->queue, w->rd.cnt, 1); i < w->rd.cnt; i++)
+      bound(&w->rd, supps[i]);  /* empty the shared queue and note */
+  }                             /* the max. support of skipped items */
+  else if (w->err)              /* on error empty the shared queue, */
+    fetch(w->queue, w->rd.cnt, 1);  /* so that all workers stop */
+  if (supps) free(supps);       /* delete the item supports */
+  if (exts)  free(exts);        /* and the pattern extensions */
+  return THREAD_OK;             /* return a dummy result */
+}  /* worker() */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(worker_iw, p)
+{                               /* --- worker function (weights) */
+  WORKDATA *w = (WORKDATA*)p;   /* type the argument pointer */
+  ITEM     i;                   /* top level item to process */
+  SUPP     r, *supps;           /* result of recursion, item supports */
+  WPATEXT  *exts;               /* private pattern extensions */
+
+  assert(p);                    /* check the function argument */
+  exts  = initext_iw(w->tabag, w->rd.frqs);
+  supps = (SUPP*)malloc((size_t)w->rd.cnt *sizeof(SUPP));
+  if (!exts || !supps) w->err = -1;
+  else {                        /* check the created arrays */
+    for (i = 0; i < w->rd.cnt; i++) {
+      supps[i] = exts[i].supp; exts[i].supp = 0; }
+    while ((i = fetch(w->queue, w->rd.cnt, 0)) < w->rd.cnt) {
+      if (supps[i] < w->rd.smin) continue;
+      exts[i].supp = supps[i];  /* enable only the fetched item */
+      r = rec_iw(exts, tbg_extent(w->tabag), 0, &w->rd);
+      exts[i].supp = 0;         /* search for frequent sequences */
+      if (r < 0) { w->err = (w->rd.stop) ? 0 : -1; break; }
+      if (r > w->max) w->max = r;
+    }                           /* note the maximal support */
+  }
+  if (w->rd.stop) {             /* if the search budget is exhausted, */
+    for (i = fetch(w->queue, w->rd.cnt, 1); i < w->rd.cnt; i++)
+      bound(&w->rd, supps[i]);  /* empty the shared queue and note */
+  }                             /* the max. support of skipped items */
+  else if (w->err)              /* on error empty the shared queue, */
+    fetch(w->queue, w->rd.cnt, 1);  /* so that all workers stop */
+  if (supps) free(supps);       /* delete the item supports */
+  if (exts)  free(exts);        /* and the pattern extensions */
+  return THREAD_OK;             /* return a dummy result */
+}  /* worker_iw() */
+
+/*--------------------------------------------------------------------*/
+
+static SUPP parallel (TABAG *tabag, RECDATA *rd, int c,
+                      WORKERFN *fn)
+{                               /* --- process top level in parallel */
+  SUPP      r = 0;              /* error status/maximal support */
+  int       n, x;               /* loop variables */
+  ITEM      k;                  /* number of items */
+  WORKDATA  *w;                 /* data for worker threads */
+  THREAD    *threads;           /* thread handles */
+  WORKQUEUE queue;              /* shared queue of top level items */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  DWORD     thid;               /* dummy for storing the thread id */
+  #endif                        /* (not really needed here) */
+
+  assert(tabag && rd && (c > 1) && fn);  /* check the arguments */
+  threads = (THREAD*)calloc((size_t)c, sizeof(THREAD));
+  if (!threads) return -1;      /* create thread handles */
+  w = (WORKDATA*)calloc((size_t)c, sizeof(WORKDATA));
+  if (!w) { free(threads); return -1; }
+  queue.next = 0;               /* initialize the shared queue */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  InitializeCriticalSection(&queue.mutex);
+  #else                         /* if Linux/Unix system */
+  pthread_mutex_init(&queue.mutex, NULL);
+  #endif                        /* create the queue mutex */
+  k = rd->cnt;                  /* get the number of items */
+  for (n = 0; n < c; n++) {     /* traverse the threads */
+    w[n].tabag     = tabag;     /* note the shared transaction bag */
+    w[n].queue     = &queue;    /* and the shared work queue */
+    w[n].rd        = *rd;       /* copy the recursion data */
+    w[n].rd.report = NULL;      /* and create private buffers */
+    w[n].rd.nmax   = (rd->nmax > 0) ? rd->nmax/(size_t)c +1 : 0;
+    w[n].max       = 0;         /* and a private item set reporter */
+    w[n].err       = -1;        /* default: thread was not started */
+    w[n].rd.wgts   = (double*)malloc((size_t) k    *sizeof(double)
+                                    +(size_t)(k+k) *sizeof(ITEM)
+                                    +(size_t) k    *sizeof(TID));
+    if (!w[n].rd.wgts) break;   /* check the buffers */
+    w[n].rd.items  = (ITEM*)(w[n].rd.wgts +k);
+    w[n].rd.buf    = w[n].rd.items +k;
+    w[n].rd.frqs   = (TID*) (w[n].rd.buf +k);
+    memset(w[n].rd.frqs, 0, (size_t)k *sizeof(TID));
+    w[n].rd.report = isr_clone(rd->report);
+    if (!w[n].rd.report) break; /* create a private reporter */
+    w[n].err = 0;               /* clear the error indicator */
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    threads[n] = CreateThread(NULL, 0, fn, w+n, 0, &thid);
+    if (!threads[n]) { w[n].err = -1; break; }
+    #else                       /* if Linux/Unix system */
+    if (pthread_create(threads+n, NULL, fn, w+n) != 0) {
+      w[n].err = -1; break; }   /* create a thread for each worker */
+    #endif                      /* to process the items in parallel */
+  }
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  WaitForMultipleObjects((DWORD)n, threads, TRUE, INFINITE);
+  for (x = n; --x >= 0; )       /* wait for threads to finish, */
+    CloseHandle(threads[x]);    /* then close all thread handles */
+  DeleteCriticalSection(&queue.mutex);
+  #else                         /* if Linux/Unix system */
+  for (x = n; --x >= 0; )       /* wait for threads to finish */
+    pthread_join(threads[x], NULL);
+  pthread_mutex_destroy(&queue.mutex);
+  #endif                        /* (join threads with this one) */
+  if (n < c) r = -1;            /* check whether all threads started */
+  for (x = 0; x < n; x++) {     /* traverse the finished workers */
+    if (w[x].err) r = -1;       /* join the error indicators */
+    if ((r >= 0) && (isr_merge(rd->report, w[x].rd.report) < 0))
+      r = -1;                   /* merge the results of the workers */
+    if ((r >= 0) && (w[x].max > r))
+      r = w[x].max;             /* find the maximal support */
+    if (w[x].rd.stop) {         /* if a worker exhausted the budget, */
+      rd->stop = 1;             /* note that the result is partial */
+      bound(rd, w[x].rd.miss);
+    }                           /* and the max. missing support */
+  }
+  if (rd->stop) r = -1;         /* abort if the search was stopped */
+  for (x = c; --x >= 0; ) {     /* traverse the worker data */
+    if (w[x].rd.report) isr_delete(w[x].rd.report, 0);
+    if (w[x].rd.wgts)   free(w[x].rd.wgts);
+  }                             /* delete the private objects */
+  free(w); free(threads);       /* delete worker data, thread handles */
+  return r;                     /* return the error status */
+}  /* parallel() */
+
+/* The top level of the search is split in such a way that each item */
+/* (that is, each extension of the empty sequence) is processed      */
+/* completely by one worker thread. The workers fetch the items from */
+/* a shared queue, so that a thread that finishes an item early      */
+/* simply takes the next one. Since the search writes the current    */
+/* pattern into the (item position arrays of the) pattern            */
+/* occurrences, each worker creates its own initial extensions and   */
+/* occurrences; it restricts the search to the fetched item by       */
+/* clearing the supports of all other items. The workers use private */
+/* buffers and item set reporters, the latter of which (including    */
+/* their pattern spectra) are merged into the given reporter at the  */
+/* end. As the sequences of different top level items are written by */
+/* different workers, the order of the output differs from the order */
+/* of a sequential run. Closed sequences can be found in parallel,   */
+/* since the closedness check only needs the pattern occurrences.    */
+
+/*----------------------------------------------------------------------
+  Sequence Mining (main functions)
+----------------------------------------------------------------------*/
+
+static int sequoia (TABAG *tabag, int target, SUPP smin, int mode,
+                    int cpus, double tmax, size_t nmax, SUPP *miss,
+                    ISREPORT *report)
+{                               /* --- search for frequent sequences */
+  ITEM       k;                 /* number of items */
+  int        c;                 /* number of threads */
+  SUPP       r;                 /* result of recursion */
+  PATEXT     *exts;             /* array of pattern extensions */
+  RECDATA    rd;                /* recursion data */
+
+  assert(tabag && report);      /* check the function arguments */
+  rd.target = target;           /* store target type and search mode */
+  rd.mode   = mode;             /* check and adapt minimum support */
+  rd.smin   = (smin > 0) ? smin : 1;
+  if (tbg_wgt(tabag) < rd.smin) /* check the total transaction weight */
+    return 0;                   /* against the minimum support */
+  rd.report = report;           /* initialize the recursion data */
+  rd.zmax   = isr_zmax(report); /* (reporter and max. seq. length) */
+  rd.tend   = (tmax > 0) ? bnr_wall() +tmax : 0;
+  rd.nmax   = nmax;             /* note the search budget */
+  rd.ncnt   = 0; rd.stop = 0; rd.miss = 0;
+  rd.cnt    = k = tbg_itemcnt(tabag);   /* get the number of items */
+  if (k <= 0) return isr_report(report);
+  c = (cpus > 0) ? cpus : cpucnt();
+  if (c > (int)k) c = (int)k;   /* get the number of threads */
+  if (c > 1)                    /* if to use multiple threads */
+    r = parallel(tabag, &rd, c, worker);
+  else {                        /* if to use a single thread */
+    rd.buf  = (ITEM*)malloc((size_t)k *sizeof(ITEM)
+                           +(size_t)k *sizeof(TID));
+    if (!rd.buf) return -1;     /* create an item buffer */
+    rd.frqs = (TID*)(rd.buf +k);/* and an item counter array */
+    memset(rd.frqs, 0, (size_t)k *sizeof(TID));
+    exts = initext(tabag, rd.frqs);
+    if (!exts) { free(rd.buf); return -1; }
+    r = recurse(exts, tbg_extent(tabag), 0, &rd);
+    free(exts); free(rd.buf);   /* search for frequent sequences, */
+  }                             /* then delete the extensions */
+  if (rd.stop) {                /* if the search budget is exhausted, */
+    isr_remove(report, isr_cnt(report));
+    *miss = rd.miss; return 1;  /* remove all items from the reporter */
+  }                             /* and return that result is partial */
+  if ( (r >= 0)                 /* if no error occurred */
+  &&  ((r < tbg_wgt(tabag))     /* if the empty sequence is closed */
+  ||  !(mode & ISR_CLOSED)))    /* or all sequences are requested, */
+    r = isr_report(report);     /* report the empty sequence */
+  return (r < 0) ? (int)r : 0;  /* return the error status */
+}  /* sequoia() */
+
+/*--------------------------------------------------------------------*/
+
 static int sequoia_iw (TABAG *tabag, int target, SUPP smin,
-                       int mode, ISREPORT *report)
+                       int mode, int cpus, double tmax, size_t nmax,
+                       SUPP *miss, ISREPORT *report)
 {                               /* --- search for frequent sequences */
-  ITEM    i, k;                 /* loop variable, number of items */
-  TID     j, n;                 /* loop variable, number of trans. */
-  size_t  z;                    /* number of item instances */
+  ITEM    k;                    /* number of items */
+  int     c;                    /* number of threads */
   SUPP    r;                    /* result of recursion */
-  WTRACT  *t;                   /* to traverse the transactions */
-  WITEM   *s, **p;              /* to traverse the (extended) items */
-  WOCCEXT *x;                   /* to traverse occurrence extensions */
-  WPATOCC *occs, *o;            /* array of pattern occurrences */
-  WPATEXT *exts, *e;            /* array of pattern extensions */
+  WPATEXT *exts;                /* array of pattern extensions */
   RECDATA rd;                   /* recursion data */
 
   assert(tabag && report);      /* check the function arguments */
@@ -530,56 +939,39 @@ static int sequoia_iw (TABAG *tabag, int target, SUPP smin,
     return 0;                   /* against the minimum support */
   rd.report = report;           /* initialize the recursion data */
   rd.zmax = isr_zmax(report);   /* (reporter and max. seq. length) */
+  rd.tend = (tmax > 0) ? bnr_wall() +tmax : 0;
+  rd.nmax = nmax;               /* note the search budget */
+  rd.ncnt = 0; rd.stop = 0; rd.miss = 0;
   rd.cnt  = k = tbg_itemcnt(tabag);
   if (k <= 0)                   /* get and check the number of items */
     return (isr_isetx(report, NULL, 0, NULL, tbg_wgt(tabag), 0, 0) < 0)
          ? -1 : 0;              /* report the empty sequence */
-  rd.wgts = (double*)malloc((size_t) k    *sizeof(double)
-                           +(size_t)(k+k) *sizeof(ITEM)
-                           +(size_t) k    *sizeof(TID));
-  if (!rd.wgts) return -1;      /* create a pattern weight array and */
-  rd.items = (ITEM*)(rd.wgts+k);/* an item buffer for the reporting, */
-  rd.buf   = rd.items +k;       /* a buffer for the closedness check */
-  rd.frqs  = (TID*) (rd.buf +k);/* and an item counter array */
-  n = tbg_cnt(tabag);           /* get the number of transactions */
-  z = tbg_extent(tabag);        /* and the number of item instances */
-  occs = (WPATOCC*)malloc((size_t)n *sizeof(WPATOCC)
-                         +(size_t)z *sizeof(WITEM*));
-  if (!occs) { free(rd.wgts); return -1; }
-  p = (WITEM**)(occs +n);       /* create pattern occurrences */
-  memset(rd.frqs, 0, (size_t)k *sizeof(TID));
-  for (j = 0; j < n; j++) {     /* traverse the transactions and */
-    t = tbg_wtract(tabag, j);   /* create a pattern occurrence */
-    o = occs +j;                /* for each transaction */
-    o->wgt = wta_wgt(t);        /* note the transaction weight and */
-    o->ips = p; p += wta_size(t);/* organize extension item arrays */
-    for (s = o->items = wta_items(t); s->item >= 0; s++)
-      rd.frqs[s->item]++;       /* note the item array and */
-  }                             /* count the item occurrences */
-  exts = (WPATEXT*)malloc((size_t)k *sizeof(WPATEXT)
-                         +(size_t)z *sizeof(WOCCEXT));
-  if (!exts) return -1;         /* allocate memory for pattern */
-  x = (WOCCEXT*)(exts +k);      /* and occurrence extensions */
-  for (i = 0; i < k; i++) {     /* initialize the pattern extensions */
-    e = exts+i; e->supp = 0; e->cnt = 0; e->oxs = x; x += rd.frqs[i]; }
-  for (j = 0; j < n; j++) {     /* traverse the transactions and */
-    o = occs +j;                /* the items in each transaction */
-    for (s = o->items; s->item >= 0; s++) {
-      e = exts   +s->item;      /* get the corresp. pattern extension */
-      x = e->oxs +e->cnt++;     /* and its next occurrence extension */
-      x->item  = s;             /* set the extension item */
-      x->occ   = o;             /* and the pattern occurrence */
-      e->supp += o->wgt;        /* sum transaction weights (support) */
-    }                           /* (exts represents the possible */
-  }                             /* extensions of the empty sequence) */
-  memset(rd.frqs, 0, (size_t)k *sizeof(TID));
-  r = rec_iw(exts, z, 0, &rd);  /* search for frequent sequences */
-  if ((r < tbg_wgt(tabag))      /* report empty sequence if closed */
-  || !(mode & ISR_CLOSED))      /* or all sequences are requested */
+  c = (cpus > 0) ? cpus : cpucnt();
+  if (c > (int)k) c = (int)k;   /* get the number of threads */
+  if (c > 1)                    /* if to use multiple threads */
+    r = parallel(tabag, &rd, c, worker_iw);
+  else {                        /* if to use a single thread */
+    rd.wgts = (double*)malloc((size_t) k    *sizeof(double)
+                             +(size_t)(k+k) *sizeof(ITEM)
+                             +(size_t) k    *sizeof(TID));
+    if (!rd.wgts) return -1;    /* create a pattern weight array and */
+    rd.items = (ITEM*)(rd.wgts+k);   /* an item buffer for reporting, */
+    rd.buf   = rd.items +k;     /* a buffer for the closedness check */
+    rd.frqs  = (TID*) (rd.buf +k);   /* and an item counter array */
+    memset(rd.frqs, 0, (size_t)k *sizeof(TID));
+    exts = initext_iw(tabag, rd.frqs);
+    if (!exts) { free(rd.wgts); return -1; }
+    r = rec_iw(exts, tbg_extent(tabag), 0, &rd);
+    free(exts); free(rd.wgts);  /* search for frequent sequences, */
+  }                             /* then delete the extensions */
+  if (rd.stop) {                /* if the search budget is exhausted, */
+    *miss = rd.miss; return 1;  /* note the max. missing support */
+  }                             /* and return that result is partial */
+  if ((r >= 0)                  /* if no error occurred */
+  &&  ((r < tbg_wgt(tabag))     /* report empty sequence if closed */
+  ||   !(mode & ISR_CLOSED)))   /* or all sequences are requested */
     r = (isr_isetx(report, NULL, 0, NULL, tbg_wgt(tabag), 0, 0) < 0)
       ? -1 : 0;                 /* report the empty sequence */
-  free(rd.wgts);                /* deallocate the pattern buffer, */
-  free(exts); free(occs);       /* pattern extensions and occurrences */
   return (r < 0) ? (int)r : 0;  /* return the error status */
 }  /* sequoia_iw() */
 
@@ -694,6 +1086,10 @@ int main (int argc, char *argv[])
   int     scan     = 0;         /* flag for scanable item output */
   int     bdrcnt   = 0;         /* number of support values in border */
   int     stats    = 0;         /* flag for sequence statistics */
+  int     cpus     = 1;         /* number of threads for mining */
+  double  tmax     = 0;         /* time budget for the search */
+  double  nmax     = 0;         /* budget of search nodes */
+  SUPP    miss     = 0;         /* max. support of unreported seqs. */
   PATSPEC *psp;                 /* collected pattern spectrum */
   ITEM    m;                    /* number of items */
   TID     n;                    /* number of transactions */
@@ -728,6 +1124,15 @@ int main (int argc, char *argv[])
                     "one per item set size,\n");
     printf("         starting at the minimum size, "
                     "as given with option -m#)\n");
+    printf("-T#      number of threads for mining             "
+                    "(default: %d)\n", cpus);
+    printf("         (<= 0: use all processors)\n");
+    printf("-L#      time budget for the search (in seconds)  "
+                    "(default: no limit)\n");
+    printf("-Q#      budget of search nodes                   "
+                    "(default: no limit)\n");
+    printf("         (if exceeded, the search stops with a "
+                    "partial result)\n");
     printf("-P#      write a pattern spectrum to a file\n");
     printf("-Z       print item set statistics "
                     "(number of item sets per size)\n");
@@ -761,7 +1166,7 @@ int main (int argc, char *argv[])
     return 0;                   /* print a usage message */
   }                             /* and abort the program */
   #endif  /* #ifndef QUIET */
-  /* free option characters: acdejlopqwxyz [A-Z]\[CFPZ] */
+  /* free option characters: acdejlopqwxyz [A-Z]\[CFPTZ] */
 
   /* --- evaluate arguments --- */
   for (i = 1; i < argc; i++) {  /* traverse arguments */
@@ -776,6 +1181,9 @@ int main (int argc, char *argv[])
           case 'n': zmax   = (ITEM)strtol(s, &s, 0); break;
           case 's': supp   =       strtod(s, &s);    break;
           case 'F': bdrcnt = getbdr(s, &s, &border); break;
+          case 'T': cpus   = (int) strtol(s, &s, 0); break;
+          case 'L': tmax   =       strtod(s, &s);    break;
+          case 'Q': nmax   =       strtod(s, &s);    break;
           case 'P': optarg = &fn_psp;                break;
           case 'Z': stats  = 1;                      break;
           case 'g': scan   = 1;                      break;
@@ -830,11 +1238,17 @@ int main (int argc, char *argv[])
     trd_chars(tread, TRD_FLDSEP|TRD_ADD, wgtseps);
   }                             /* set them as add. field separators */
   CLOCK(t);                     /* start timer, open input file */
-  if (trd_open(tread, NULL, fn_inp) != 0)
-    error(E_FOPEN, trd_name(tread));
-  MSG(stderr, "reading %s ... ", trd_name(tread));
-  k = tbg_read(tabag, tread, mtar);
-  if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  if (tbg_isbin(fn_inp)) {      /* if a binary transaction bag file */
+    MSG(stderr, "loading %s ... ", fn_inp);
+    k = tbg_load(tabag, fn_inp);/* map the prepared transactions */
+    if (k < 0) error(k, fn_inp); }
+  else {                        /* if a transaction text file */
+    if (trd_open(tread, NULL, fn_inp) != 0)
+      error(E_FOPEN, trd_name(tread));
+    MSG(stderr, "reading %s ... ", trd_name(tread));
+    k = tbg_read(tabag, tread, mtar);
+    if (k < 0) error(-k, tbg_errmsg(tabag, NULL, 0));
+  }                             /* read the transaction database */
   trd_delete(tread, 1);         /* read the transaction database, */
   tread = NULL;                 /* then delete the table scanner */
   m = ib_cnt(ibase);            /* get the number of items, */
@@ -861,7 +1275,8 @@ int main (int argc, char *argv[])
   /* --- trim and reduce transactions --- */
   CLOCK(t);                     /* start timer, print log message */
   MSG(stderr, "filtering and reducing transactions ... ");
-  tbg_sort(tabag, 1, 0);        /* sort the trans. lexicographically */
+  tbg_setcpus(tabag, cpus);     /* set the number of sort threads */
+  tbg_sort(tabag, 1, TA_RADIX); /* sort the trans. lexicographically */
   n = tbg_reduce(tabag, 0);     /* and reduce them to unique ones */
   MSG(stderr, "[%"TID_FMT, n);  /* print number of transactions */
   if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
@@ -886,11 +1301,18 @@ int main (int argc, char *argv[])
   CLOCK(t);                     /* start timer, print log message */
   MSG(stderr, "writing %s ... ", isr_name(report));
   k = (wgtseps && *wgtseps)     /* search for frequent sequences */
-    ? sequoia_iw(tabag, target, smin, 0, report)
-    : sequoia   (tabag, target, smin, 0, report);
+    ? sequoia_iw(tabag, target, smin, 0, cpus, tmax,
+                 (nmax > 0) ? (size_t)nmax : 0, &miss, report)
+    : sequoia   (tabag, target, smin, 0, cpus, tmax,
+                 (nmax > 0) ? (size_t)nmax : 0, &miss, report);
   if (k < 0) error(E_NOMEM);    /* check for a search error */
   MSG(stderr, "[%"SIZE_FMT" sequence(s)]", isr_repcnt(report));
   MSG(stderr, " done [%.2fs].\n", SEC_SINCE(t));
+  if (k > 0) {                  /* if the search budget is exhausted */
+    MSG(stderr, "search stopped (budget exhausted); ");
+    MSG(stderr, "complete for support >= %"SUPP_FMT"\n",
+                (miss >= smin) ? miss+1 : smin);
+  }                             /* print the covered support */
   if (stats)                    /* print item set statistics */
     isr_prstats(report, stdout, 0);
   if (isr_close(report) != 0)   /* close the output file */
@@ -6,6 +6,7 @@
 #           2010.08.22 module escape added (for module tabread)
 #           2013.10.19 modules tabread and patspec added
 #           2016.04.20 completed dependencies on header files
+#           2026.10.14 external module bench added (search budget)
 #-----------------------------------------------------------------------
 THISDIR  = ..\..\sequoia\src
 UTILDIR  = ..\..\util\src
@@ -24,12 +25,13 @@ HDRS     = $(UTILDIR)\fntypes.h    $(UTILDIR)\arrays.h     \
            $(UTILDIR)\symtab.h     $(UTILDIR)\error.h      \
            $(UTILDIR)\tabread.h    $(UTILDIR)\tabwrite.h   \
            $(TRACTDIR)\tract.h     $(TRACTDIR)\patspec.h   \
-           $(TRACTDIR)\report.h
+           $(TRACTDIR)\report.h    $(UTILDIR)\bench.h
 OBJS     = $(UTILDIR)\arrays.obj   $(UTILDIR)\idmap.obj    \
            $(UTILDIR)\escape.obj   $(UTILDIR)\tabread.obj  \
            $(UTILDIR)\tabwrite.obj $(UTILDIR)\scform.obj   \
            $(TRACTDIR)\taread.obj  $(TRACTDIR)\patspec.obj \
-           $(TRACTDIR)\report.obj  sequoia.obj
+           $(TRACTDIR)\report.obj  $(UTILDIR)\bench.obj   \
+           sequoia.obj
 PRGS     = sequoia.exe
 
 #-----------------------------------------------------------------------
@@ -77,6 +79,10 @@ $(UTILDIR)\scform.obj:
 	cd $(UTILDIR)
 	$(MAKE) /f util.mak scform.obj   ADDFLAGS="$(ADDFLAGS)"
 	cd $(THISDIR)
+$(UTILDIR)\bench.obj:
+	cd $(UTILDIR)
+	$(MAKE) /f util.mak bench.obj    ADDFLAGS="$(ADDFLAGS)"
+	cd $(THISDIR)
 $(TRACTDIR)\taread.obj:
 	cd $(TRACTDIR)
 	$(MAKE) /f tract.mak taread.obj  ADDFLAGS="$(ADDFLAGS)"
@@ -0,0 +1,275 @@
+/*----------------------------------------------------------------------
+  File    : fim64.c
+  Contents: finding frequent item sets with at most 32/64 items
+            (bit-represented transactions, vectorized support counting)
+  History : 2026.10.14 file created (wider variant of fim16.c)
+----------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "fim64.h"
+#ifdef STORAGE
+#include "storage.h"
+#endif
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define BLKSIZE     1024        /* block size for transaction arrays */
+#define DUPBITS     16          /* max. number of bits for combining */
+#define INTSUPP     (((SUPP)1/(SUPP)2 == 0) \
+                    && (sizeof(SUPP) == sizeof(int)))
+
+#if defined __GNUC__ || defined __clang__
+#define lowbit(x)   ((ITEM)__builtin_ctzll(x))
+#define highbit(x)  ((ITEM)(63-__builtin_clzll(x)))
+#else                           /* if no builtin functions available */
+
+static ITEM lowbit (BITTA64 x)
+{                               /* --- get index of lowest set bit */
+  ITEM i = 0;                   /* bit index */
+  while (!(x & 1)) { x >>= 1; i++; }
+  return i;                     /* shift until lowest bit is set */
+}  /* lowbit() */
+
+/*--------------------------------------------------------------------*/
+
+static ITEM highbit (BITTA64 x)
+{                               /* --- get index of highest set bit */
+  ITEM i = 0;                   /* bit index */
+  while (x >>= 1) i++;          /* shift until no bit is left */
+  return i;                     /* return the bit index */
+}  /* highbit() */
+
+#endif
+/*----------------------------------------------------------------------
+  Auxiliary Functions
+----------------------------------------------------------------------*/
+
+static void count (const BITTA64 *btas, const SUPP *wgts, size_t n,
+                   SUPP *supp, ITEM k)
+{                               /* --- count the item supports */
+  BITTA64 b;                    /* to traverse the item bits */
+  #ifdef __AVX2__               /* if AVX2 instructions available */
+  ITEM    i;                    /* loop variable */
+  int     c[64];                /* buffer for the support counters */
+  __m256i lo, hi, w;            /* transaction halves and weight */
+  __m256i m[4], s[8];           /* bit masks and support counters */
+
+  if (INTSUPP && (k > DUPBITS)) {  /* if many items are to be counted */
+    for (i = 0; i < 4; i++) {   /* build the masks for eight items */
+      m[i] = _mm256_setr_epi32((int)(1u << (8*i  )),(int)(1u << (8*i+1)),
+                               (int)(1u << (8*i+2)),(int)(1u << (8*i+3)),
+                               (int)(1u << (8*i+4)),(int)(1u << (8*i+5)),
+                               (int)(1u << (8*i+6)),(int)(1u << (8*i+7)));
+      s[i] = s[i+4] = _mm256_setzero_si256();
+    }                           /* clear the support counters */
+    for ( ; n > 0; n--) {       /* traverse the transactions */
+      b  = *btas++;             /* get the next transaction */
+      w  = _mm256_set1_epi32((int)*wgts++);
+      lo = _mm256_set1_epi32((int)(unsigned int)(b & 0xffffffffu));
+      for (i = 0; i < 4; i++)   /* add weight to items in lower half */
+        s[i] = _mm256_add_epi32(s[i], _mm256_and_si256(w,
+                 _mm256_cmpeq_epi32(_mm256_and_si256(lo, m[i]), m[i])));
+      if (k <= 32) continue;    /* check for an upper half */
+      hi = _mm256_set1_epi32((int)(unsigned int)(b >> 32));
+      for (i = 0; i < 4; i++)   /* add weight to items in upper half */
+        s[i+4] = _mm256_add_epi32(s[i+4], _mm256_and_si256(w,
+                 _mm256_cmpeq_epi32(_mm256_and_si256(hi, m[i]), m[i])));
+    }                           /* (eight items per vector operation) */
+    for (i = 0; i < 8; i++)     /* store the support counters */
+      _mm256_storeu_si256((__m256i*)(c +8*i), s[i]);
+    for (i = 0; i < k; i++)     /* copy the support counters */
+      supp[i] = (SUPP)c[i];     /* to the support array */
+    return;                     /* (branch-free counting is faster */
+  }                             /* than bit scanning for dense data) */
+  #endif
+  memset(supp, 0, (size_t)k *sizeof(SUPP));
+  for ( ; n > 0; n--, wgts++)   /* traverse the transactions */
+    for (b = *btas++; b; b &= b-1)
+      supp[lowbit(b)] += *wgts; /* traverse the set bits and */
+}  /* count() */                /* sum the transaction weights */
+
+/*--------------------------------------------------------------------*/
+
+static size_t reduce (FIM64 *fim, BITTA64 *btas, SUPP *wgts,
+                      size_t n, BITTA64 keep)
+{                               /* --- remove items and duplicates */
+  size_t  i, k;                 /* loop variables */
+  BITTA64 b;                    /* buffer for a transaction */
+
+  assert(fim && btas && wgts);  /* check the function arguments */
+  for (i = k = 0; i < n; i++) { /* traverse the transactions */
+    b = btas[i] & keep;         /* remove infrequent items and */
+    if (!b) continue;           /* perfect extensions, skip empty */
+    btas[k] = b; wgts[k++] = wgts[i];
+  }                             /* store the reduced transaction */
+  if (highbit(keep) >= DUPBITS) /* if the remaining items are */
+    return k;                   /* too many for a weight table, abort */
+  for (i = n = 0; i < k; i++) { /* traverse the transactions */
+    b = btas[i];                /* and combine duplicates */
+    if (fim->dups[b] <= 0) btas[n++] = b;
+    fim->dups[b] += wgts[i];    /* keep first occurrence and */
+  }                             /* sum the transaction weights */
+  for (i = 0; i < n; i++) {     /* traverse the unique transactions */
+    b = btas[i]; wgts[i] = fim->dups[b]; fim->dups[b] = 0; }
+  return n;                     /* return the number of transactions */
+}  /* reduce() */
+
+/*--------------------------------------------------------------------*/
+
+static int rec (FIM64 *fim, const BITTA64 *btas, const SUPP *wgts,
+                size_t n, ITEM k, const SUPP *supp)
+{                               /* --- find item sets recursively */
+  int      r;                   /* error status */
+  ITEM     i, e, j;             /* loop variables */
+  size_t   x, c;                /* loop variable, number of trans. */
+  BITTA64  b, m, keep;          /* item bit, prefix mask, kept items */
+  BITTA64  *pb = NULL;          /* projected transactions */
+  SUPP     *pw = NULL;          /* weights of projected transactions */
+  SUPP     s[64];               /* conditional item supports */
+  ISREPORT *rep;                /* item set reporter */
+
+  assert(fim && btas && wgts && supp);   /* check function arguments */
+  rep = fim->report;            /* get the item set reporter */
+  if ((k > 1)                   /* if there is more than one item */
+  &&  isr_xable(rep, 2)) {      /* and another item can be added */
+    pb = (BITTA64*)malloc(n *(sizeof(BITTA64) +sizeof(SUPP)));
+    if (!pb) return -1;         /* create a projection buffer */
+    pw = (SUPP*)(pb +n);        /* for the transactions and */
+  }                             /* for the transaction weights */
+  if (fim->dir > 0) { i = 0;   e = k;  }
+  else              { i = k-1; e = -1; }
+  for (r = 0; i != e; i += fim->dir) {
+    if (supp[i] < fim->smin)    /* traverse the frequent items */
+      continue;                 /* (skip infrequent items) */
+    r = isr_add(rep, fim->map[i], supp[i]);
+    if (r <  0) break;          /* add current item to the reporter */
+    if (r == 0) continue;       /* check if item needs processing */
+    if (pb && (i > 0)) {        /* if another item can be added */
+      b = (BITTA64)1 << i;      /* get the bit of the current item */
+      m = b-1;                  /* and the mask for the prefix items */
+      for (c = x = 0; x < n; x++) {
+        if (!(btas[x] & b)) continue;
+        pb[c] = btas[x] & m; pw[c++] = wgts[x];
+      }                         /* collect the conditional database */
+      count(pb, pw, c, s, i);   /* and count the item supports */
+      for (keep = 0, j = 0; j < i; j++) {
+        if (s[j] <  fim->smin) {/* skip infrequent items */
+          s[j] = 0; continue; } /* (clear their support) */
+        if (s[j] >= supp[i]) {  /* collect perfect extension items */
+          isr_addpex(rep, fim->map[j]); s[j] = 0; continue; }
+        keep |= (BITTA64)1 << j;/* note the items that are kept */
+      }                         /* in the conditional database */
+      if (keep) {               /* if there are items left */
+        c = reduce(fim, pb, pw, c, keep);
+        r = rec(fim, pb, pw, c, highbit(keep)+1, s);
+        if (r < 0) break;       /* remove items and duplicates and */
+      }                         /* find freq. item sets recursively */
+    }
+    r = isr_report(rep);        /* report the current item set */
+    if (r < 0) break;           /* and check for an error */
+    isr_remove(rep, 1);         /* remove the current item */
+  }                             /* from the item set reporter */
+  if (pb) free(pb);             /* delete the projection buffer */
+  return r;                     /* return the error status */
+}  /* rec() */
+
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+
+FIM64* m64_create (int width, int dir, SUPP smin, ISREPORT *report)
+{                               /* --- create a 32/64-items machine */
+  FIM64 *fim;                   /* created 32/64-items machine */
+
+  assert(report);               /* check the function arguments */
+  fim = (FIM64*)malloc(sizeof(FIM64));
+  if (!fim) return NULL;        /* create the base structure */
+  fim->dups = (SUPP*)calloc((size_t)1 << DUPBITS, sizeof(SUPP));
+  if (!fim->dups) { free(fim); return NULL; }
+  fim->width  = (width <= 32) ? 32 : 64;
+  fim->dir    = (dir   <   0) ? -1 : +1;
+  fim->smin   = (smin  >   0) ? smin : 1;
+  fim->report = report;         /* store the parameters */
+  fim->size   = fim->tacnt = 0; /* and initialize the */
+  fim->btas   = NULL;           /* transaction arrays */
+  fim->wgts   = NULL;
+  memset(fim->map, 0, sizeof(fim->map));
+  return fim;                   /* return the created machine */
+}  /* m64_create() */
+
+/*--------------------------------------------------------------------*/
+
+void m64_delete (FIM64 *fim)
+{                               /* --- delete a 32/64-items machine */
+  assert(fim);                  /* check the function argument */
+  if (fim->btas) free(fim->btas);
+  free(fim->dups);              /* delete the transaction arrays */
+  free(fim);                    /* and the base structure */
+}  /* m64_delete() */
+
+/*--------------------------------------------------------------------*/
+
+int m64_choose (FIM64 *fim, ITEM n, double fill)
+{                               /* --- choose the machine width */
+  if (!fim || (n > fim->width)) /* if there is no machine or */
+    return 0;                   /* too many items, use a tree */
+  if (n <= 32) return (fill >= M64_FILL32) ? 32 : 0;
+  return              (fill >= M64_FILL64) ? 64 : 0;
+}  /* m64_choose() */
+
+/* The machine counts eight items with one vector operation whereas  */
+/* a tree needs one (pointer chasing) step per item in a transaction. */
+/* Hence it pays off if the expected number of items per transaction */
+/* (fill) is at least (about) width/16 for a machine of this width.  */
+
+/*--------------------------------------------------------------------*/
+
+int m64_add (FIM64 *fim, BITTA64 tract, SUPP supp)
+{                               /* --- add a transaction */
+  size_t  n;                    /* new size of the arrays */
+  BITTA64 *p;                   /* reallocated transaction array */
+
+  assert(fim && (supp >= 0));   /* check the function arguments */
+  if (!tract) return 0;         /* empty transactions are not needed */
+  if (fim->tacnt >= fim->size){ /* if the arrays are full */
+    n = fim->size +((fim->size > BLKSIZE) ? fim->size >> 1 : BLKSIZE);
+    p = (BITTA64*)malloc(n *(sizeof(BITTA64) +sizeof(SUPP)));
+    if (!p) return -1;          /* allocate larger arrays */
+    if (fim->btas) {            /* copy the existing transactions */
+      memcpy(p, fim->btas, fim->tacnt *sizeof(BITTA64));
+      memcpy(p+n, fim->wgts, fim->tacnt *sizeof(SUPP));
+      free(fim->btas);          /* delete the old arrays */
+    }                           /* (both arrays in one memory block) */
+    fim->btas = p; fim->wgts = (SUPP*)(p+n); fim->size = n;
+  }                             /* set the new arrays */
+  fim->btas[fim->tacnt]   = tract;
+  fim->wgts[fim->tacnt++] = supp;
+  return 0;                     /* store the transaction */
+}  /* m64_add() */
+
+/*--------------------------------------------------------------------*/
+
+int m64_mine (FIM64 *fim)
+{                               /* --- mine frequent item sets */
+  int     r = 0;                /* result of recursion */
+  size_t  i;                    /* loop variable */
+  ITEM    k;                    /* number of items */
+  BITTA64 b;                    /* union of the transactions */
+  SUPP    s[64];                /* item supports */
+
+  assert(fim);                  /* check the function argument */
+  for (b = 0, i = 0; i < fim->tacnt; i++)
+    b |= fim->btas[i];          /* collect the used items */
+  if (b) {                      /* if there are transactions */
+    k = highbit(b)+1;           /* get the number of items, */
+    count(fim->btas, fim->wgts, fim->tacnt, s, k);
+    r = rec(fim, fim->btas, fim->wgts, fim->tacnt, k, s);
+  }                             /* count supports and mine */
+  fim->tacnt = 0;               /* clear the transactions */
+  return r;                     /* return the error status */
+}  /* m64_mine() */
@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------
+  File    : fim64.h
+  Contents: finding frequent item sets with at most 32/64 items
+            (bit-represented transactions, vectorized support counting)
+  History : 2026.10.14 file created (wider variant of fim16.h)
+----------------------------------------------------------------------*/
+#ifndef __FIM64__
+#define __FIM64__
+#include "tract.h"
+#include "report.h"
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define M64_FILL32  2.0         /* min. exp. items for 32-items mach. */
+#define M64_FILL64  4.0         /* min. exp. items for 64-items mach. */
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef unsigned long long BITTA64; /* bit rep. of a transaction */
+
+typedef struct {                /* --- 32/64-items machine --- */
+  int      width;               /* maximum number of items (32 or 64) */
+  int      dir;                 /* direction of item order */
+  SUPP     smin;                /* minimum support of an item set */
+  ISREPORT *report;             /* item set reporter */
+  size_t   size;                /* size of the transaction arrays */
+  size_t   tacnt;               /* number of transactions */
+  BITTA64  *btas;               /* bit-represented transactions */
+  SUPP     *wgts;               /* weights of the transactions */
+  SUPP     *dups;               /* buffer for combining duplicates */
+  ITEM     map[64];             /* item identifier map */
+} FIM64;                        /* (32/64-items machine) */
+
+/*----------------------------------------------------------------------
+  Functions
+----------------------------------------------------------------------*/
+extern FIM64* m64_create (int width, int dir, SUPP smin,
+                          ISREPORT *report);
+extern void   m64_delete (FIM64 *fim);
+extern int    m64_width  (FIM64 *fim);
+extern int    m64_choose (FIM64 *fim, ITEM n, double fill);
+extern void   m64_setmap (FIM64 *fim, ITEM i, ITEM item);
+extern int    m64_add    (FIM64 *fim, BITTA64 tract, SUPP supp);
+extern int    m64_mine   (FIM64 *fim);
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define m64_width(f)      ((f)->width)
+#define m64_setmap(f,i,x) ((f)->map[i] = (x))
+
+#endif
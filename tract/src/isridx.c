@@ -0,0 +1,890 @@
+/*----------------------------------------------------------------------
+  File    : isridx.c
+  Contents: persistent index of frequent item sets
+  History : 2026.10.14 file created
+----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <assert.h>
+#ifdef ISX_MAIN
+#include <time.h>
+#endif
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>           /* for memory mapping index files */
+#endif
+#include "isridx.h"
+#ifdef ISX_MAIN
+#include "error.h"
+#endif
+#ifdef STORAGE
+#include "storage.h"
+#endif
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define BLKSIZE      1024       /* block size for enlarging arrays */
+#define NONE   ((size_t)-1)     /* no node (set is not indexed) */
+#define BINPAD(n)    (((n) +7) & ~(size_t)7)
+/* BINPAD rounds a size up to a multiple of 8 (alignment of blocks). */
+
+#ifdef ISX_MAIN
+#define PRGNAME     "isridx"
+#define DESCRIPTION "query a persistent index of frequent item sets"
+#define VERSION     "version 1.0 (2026.10.14)"
+
+/* --- error codes --- */
+/* error codes   0 to  -4 defined in tract.h */
+#define E_STDIN      (-5)       /* double assignment of stdin */
+#define E_OPTION     (-6)       /* unknown option */
+#define E_OPTARG     (-7)       /* missing option argument */
+#define E_ARGCNT     (-8)       /* too few/many arguments */
+#define E_TARGET     (-9)       /* invalid target type */
+#define E_SIZE      (-10)       /* invalid set/rule size */
+#define E_SUPPORT   (-11)       /* invalid support */
+#define E_CONF      (-12)       /* invalid confidence */
+#define E_ITEM      (-13)       /* unknown item */
+
+#ifndef QUIET                   /* if not quiet version, */
+#define MSG         fprintf     /* print messages */
+#define CLOCK(t)    ((t) = clock())
+#else                           /* if quiet version, */
+#define MSG(...)    ((void)0)   /* suppress messages */
+#define CLOCK(t)    ((void)0)
+#endif
+
+#define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
+#endif
+
+/*----------------------------------------------------------------------
+  Constants
+----------------------------------------------------------------------*/
+static CCHAR isxmagic[8] = "ISRIDX\x1a\x01";  /* index file id. */
+
+#ifdef ISX_MAIN
+static CCHAR *errmsgs[] = {     /* error messages */
+  /* E_NONE      0 */  "no error",
+  /* E_NOMEM    -1 */  "not enough memory",
+  /* E_FOPEN    -2 */  "cannot open file %s",
+  /* E_FREAD    -3 */  "read error on file %s",
+  /* E_FWRITE   -4 */  "write error on file %s",
+  /* E_STDIN    -5 */  "double assignment of standard input",
+  /* E_OPTION   -6 */  "unknown option -%c",
+  /* E_OPTARG   -7 */  "missing option argument",
+  /* E_ARGCNT   -8 */  "wrong number of arguments",
+  /* E_TARGET   -9 */  "invalid target type '%c'",
+  /* E_SIZE    -10 */  "invalid item set or rule size %"ITEM_FMT,
+  /* E_SUPPORT -11 */  "invalid minimum support %g",
+  /* E_CONF    -12 */  "invalid minimum confidence %g",
+  /* E_ITEM    -13 */  "unknown item '%s'",
+  /*           -14 */  "unknown error"
+};
+
+/*----------------------------------------------------------------------
+  Global Variables
+----------------------------------------------------------------------*/
+#ifndef QUIET
+static CCHAR  *prgname;         /* program name for error messages */
+#endif
+static ISRIDX *isx   = NULL;    /* item set index */
+static FILE   *out   = NULL;    /* output file */
+static ITEM   *items = NULL;    /* item buffer for sets/rules */
+static char   *names = NULL;    /* buffer for a set to look up */
+#endif
+
+/*----------------------------------------------------------------------
+  Auxiliary Functions
+----------------------------------------------------------------------*/
+
+static size_t isxtypes (void)
+{                               /* --- signature of the data types */
+  size_t t;                     /* signature of the data types */
+
+  t = (size_t)sizeof(ITEM)      /* combine the sizes of the types */
+    | (((size_t)sizeof(RSUPP))   <<  4)
+    | (((size_t)sizeof(size_t))  <<  8)
+    | (((size_t)sizeof(ISXNODE)) << 12);
+  if ((RSUPP)0.5 > 0)           /* note whether the support type */
+    t |= (size_t)1 << 20;       /* is a floating point type */
+  return t;                     /* return the type signature */
+}  /* isxtypes() */
+
+/*--------------------------------------------------------------------*/
+
+static int setcmp (const void *p1, const void *p2, void *data)
+{                               /* --- compare two collected sets */
+  const ITEM *a, *b;            /* items of the two sets */
+  ITEM       i, n;              /* loop variable, number of items */
+
+  a = (ITEM*)data +((const ISXSET*)p1)->off;
+  b = (ITEM*)data +((const ISXSET*)p2)->off;
+  n = (*a < *b) ? *a : *b;      /* get the smaller number of items */
+  for (i = 1; i <= n; i++) {    /* compare sets lexicographically */
+    if (a[i] < b[i]) return -1;
+    if (a[i] > b[i]) return +1;
+  }                             /* (a prefix precedes its extensions) */
+  if (*a < *b) return -1;       /* if the items are equal, */
+  if (*a > *b) return +1;       /* compare the sizes */
+  return 0;                     /* return 'equal' */
+}  /* setcmp() */
+
+/*--------------------------------------------------------------------*/
+
+static int seqcmp (const void *p1, const void *p2, void *data)
+{                               /* --- compare sets and positions */
+  int r = setcmp(p1, p2, data); /* compare the items of the sets */
+  if (r != 0) return r;         /* and then the insertion order */
+  if (((const ISXSET*)p1)->off < ((const ISXSET*)p2)->off) return -1;
+  if (((const ISXSET*)p1)->off > ((const ISXSET*)p2)->off) return +1;
+  return 0;                     /* return sign of the difference */
+}  /* seqcmp() */
+
+/*--------------------------------------------------------------------*/
+
+static int suppcmp (const void *p1, const void *p2, void *data)
+{                               /* --- compare supports of two nodes */
+  size_t  a = *(const size_t*)p1; /* get the node indices */
+  size_t  b = *(const size_t*)p2;
+  ISXNODE *nodes = (ISXNODE*)data;
+
+  if (nodes[a].supp > nodes[b].supp) return -1;
+  if (nodes[a].supp < nodes[b].supp) return +1;
+  return (a < b) ? -1 : (a > b) ? +1 : 0;
+}  /* suppcmp() */              /* (descending support, then level) */
+
+/*--------------------------------------------------------------------*/
+
+static size_t find (const ISXNODE *nodes, const ITEM *items, ITEM n)
+{                               /* --- find the node of an item set */
+  size_t  k = 0;                /* index of the current node */
+  size_t  l, r, m;              /* range and middle of binary search */
+  ITEM    i;                    /* loop variable */
+
+  assert(nodes && (items || (n <= 0)));  /* check the arguments */
+  for (i = 0; i < n; i++) {     /* traverse the items of the set */
+    l = nodes[k].chn;           /* get the range of the child nodes */
+    r = l +(size_t)nodes[k].chcnt;
+    while (l < r) {             /* binary search for the item */
+      m = (l+r) >> 1;           /* among the children of the node */
+      if (nodes[m].item < items[i]) l = m+1;
+      else                          r = m;
+    }                           /* (children are sorted by item) */
+    if ((l >= nodes[k].chn +(size_t)nodes[k].chcnt)
+    ||  (nodes[l].item != items[i]))
+      return NONE;              /* if there is no child node, */
+    k = l;                      /* the item set is not indexed, */
+  }                             /* otherwise go to the child node */
+  return k;                     /* return the index of the node */
+}  /* find() */
+
+/*--------------------------------------------------------------------*/
+
+static ITEM getset (const ISXNODE *nodes, size_t k, ITEM *set)
+{                               /* --- get the items of a node */
+  ITEM n, i;                    /* number of items, loop variable */
+
+  assert(nodes && set);         /* check the function arguments */
+  for (n = i = nodes[k].size; --i >= 0; k = nodes[k].parent)
+    set[i] = nodes[k].item;     /* collect the items on the path */
+  return n;                     /* to the root and return */
+}  /* getset() */               /* the number of items */
+
+/*--------------------------------------------------------------------*/
+
+static void unmap (ISRIDX *idx)
+{                               /* --- release the index block */
+  if (idx->names) { free((void*)idx->names); idx->names = NULL; }
+  if (idx->set)   { free(idx->set);          idx->set   = NULL; }
+  idx->hdr = NULL; idx->nodes = NULL; idx->order = NULL;
+  if (!idx->map) return;        /* check for an index block */
+  #ifndef _WIN32                /* if POSIX system */
+  if (idx->mapped) munmap(idx->map, idx->mapsz);
+  else                          /* the block was memory mapped */
+  #endif                        /* or built/read into memory */
+  free(idx->map);               /* delete the index block */
+  idx->map = NULL; idx->mapsz = 0; idx->mapped = 0;
+}  /* unmap() */
+
+/*--------------------------------------------------------------------*/
+
+static int bind (ISRIDX *idx)
+{                               /* --- set up access to the block */
+  ITEM   i;                     /* loop variable for items */
+  char   *p;                    /* to traverse the index block */
+  CCHAR  *name, *nend;          /* to traverse the item names */
+  ISXHDR *hdr;                  /* header of the index block */
+
+  assert(idx && idx->map);      /* check the function argument */
+  p   = (char*)idx->map;        /* get the index block */
+  hdr = (ISXHDR*)p;             /* check file id., type signature */
+  if ((idx->mapsz < sizeof(ISXHDR))   /* and the block sizes */
+  ||  (memcmp(hdr->magic, isxmagic, sizeof(hdr->magic)) != 0)
+  ||  (hdr->types != isxtypes())
+  ||  (hdr->icnt < 0) || (hdr->zmax < 0) || (hdr->nodes < 1)
+  ||  (hdr->sets > hdr->nodes)
+  ||  (BINPAD(sizeof(ISXHDR)) +BINPAD(hdr->names)
+      +hdr->nodes *sizeof(ISXNODE) +hdr->sets *sizeof(size_t)
+      != idx->mapsz))
+    return E_FREAD;             /* check the file header */
+  name = p += BINPAD(sizeof(ISXHDR));
+  nend = name +hdr->names;      /* get the item name block */
+  if ((hdr->names > 0) && (nend[-1] != 0))
+    return E_FREAD;             /* check the last item name */
+  idx->names = (CCHAR**)malloc((size_t)(hdr->icnt+1) *sizeof(CCHAR*));
+  if (!idx->names) return E_NOMEM;
+  for (i = 0; i < hdr->icnt; i++) {
+    if (name >= nend) return E_FREAD;
+    idx->names[i] = name;       /* traverse and note the item names */
+    name += strlen(name) +1;    /* (pointers into the index block) */
+  }
+  idx->set = (ITEM*)malloc((size_t)(hdr->zmax+1) *2 *sizeof(ITEM));
+  if (!idx->set) return E_NOMEM;/* create a buffer for query sets */
+  idx->hdr   = hdr;             /* note the header, the tree nodes */
+  idx->nodes = (ISXNODE*)(p += BINPAD(hdr->names));
+  idx->order = (size_t*) (p += hdr->nodes *sizeof(ISXNODE));
+  isx_init(idx, ISR_ALL, hdr->smin, 0, hdr->zmax, 0);
+  return 0;                     /* initialize a query for all sets */
+}  /* bind() */                 /* and return 'ok' */
+
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+
+ISRIDX* isx_create (ITEMBASE *base)
+{                               /* --- create an item set index */
+  ISRIDX *idx;                  /* created item set index */
+
+  idx = (ISRIDX*)calloc(1, sizeof(ISRIDX));
+  if (!idx) return NULL;        /* create the base structure */
+  idx->base = base;             /* note the underlying item base */
+  return idx;                   /* return the created index */
+}  /* isx_create() */
+
+/*--------------------------------------------------------------------*/
+
+void isx_delete (ISRIDX *idx)
+{                               /* --- delete an item set index */
+  assert(idx);                  /* check the function argument */
+  unmap(idx);                   /* release the index block */
+  if (idx->sets) free(idx->sets);
+  if (idx->buf)  free(idx->buf);/* delete the collected sets */
+  free(idx);                    /* and the base structure */
+}  /* isx_delete() */
+
+/*--------------------------------------------------------------------*/
+
+void isx_clear (ISRIDX *idx)
+{                               /* --- clear the collected sets */
+  assert(idx);                  /* check the function argument */
+  unmap(idx);                   /* release the index block */
+  idx->cnt = idx->len = 0;      /* clear the collected sets */
+  idx->zmax = 0; idx->err = 0;  /* and the error status */
+}  /* isx_clear() */
+
+/*--------------------------------------------------------------------*/
+
+void isx_add (ISREPORT *rep, void *data)
+{                               /* --- collect a reported item set */
+  ISRIDX *idx = (ISRIDX*)data;  /* item set index to add to */
+  ITEM   n;                     /* number of items in the set */
+  size_t z;                     /* new size of the arrays */
+  ITEM   *s;                    /* to store the items */
+  void   *p;                    /* to enlarge the arrays */
+
+  assert(rep && data);          /* check the function arguments */
+  if (idx->err) return;         /* check for an earlier error */
+  n = isr_cnt(rep);             /* get the number of items */
+  if (idx->len +(size_t)n +1 > idx->bsz) {
+    z = idx->bsz +((idx->bsz > BLKSIZE) ? idx->bsz >> 1 : BLKSIZE);
+    if (z < idx->len +(size_t)n +1) z = idx->len +(size_t)n +1;
+    p = realloc(idx->buf, z *sizeof(ITEM));
+    if (!p) { idx->err = E_NOMEM; return; }
+    idx->buf = (ITEM*)p; idx->bsz = z;
+  }                             /* enlarge the item buffer */
+  if (idx->cnt >= idx->max) {   /* if the set array is full */
+    z = idx->max +((idx->max > BLKSIZE) ? idx->max >> 1 : BLKSIZE);
+    p = realloc(idx->sets, z *sizeof(ISXSET));
+    if (!p) { idx->err = E_NOMEM; return; }
+    idx->sets = (ISXSET*)p; idx->max = z;
+  }                             /* enlarge the set array */
+  s = idx->buf +idx->len;       /* get the position of the set */
+  s[0] = n;                     /* store the number of items */
+  memcpy(s+1, isr_items(rep), (size_t)n *sizeof(ITEM));
+  ia_qsort(s+1, (size_t)n, +1); /* store the items in sorted order */
+  idx->sets[idx->cnt].off  = idx->len;
+  idx->sets[idx->cnt].supp = isr_supp(rep);
+  idx->cnt += 1;                /* note the offset and the support */
+  idx->len += (size_t)n +1;     /* of the item set */
+  if (n > idx->zmax) idx->zmax = n;
+  idx->wgt  = isr_suppx(rep, 0);/* note the largest set size, */
+  idx->smin = isr_smin(rep);    /* the total transaction weight, */
+}  /* isx_add() */              /* and the minimum support */
+
+/* This function is meant as an item set reporting callback (see    */
+/* isr_setrepo(), with the index as the data pointer). It needs all */
+/* frequent item sets (target ISR_ALL) to answer support queries,   */
+/* to derive association rules and to filter closed and maximal     */
+/* item sets. As it does not lock the index, the reporter must not  */
+/* be cloned for multiple threads.                                  */
+
+/*--------------------------------------------------------------------*/
+
+int isx_build (ISRIDX *idx)
+{                               /* --- build the index block */
+  size_t  i, k, m, n;           /* loop variables, numbers of sets */
+  size_t  last;                 /* index of the last created node */
+  size_t  nn, nmax;             /* number of nodes and array size */
+  size_t  *cur;                 /* current nodes of the sets */
+  size_t  *act;                 /* active sets (with more items) */
+  size_t  *order;               /* indexed sets by support */
+  size_t  z;                    /* size of the item name block */
+  ITEM    d, j, x;              /* tree level, loop variables */
+  ITEM    *s, *set;             /* to traverse the items */
+  RSUPP   supp;                 /* support of an item set */
+  ISXNODE *nodes, *node;        /* prefix tree nodes */
+  ISXHDR  *hdr;                 /* header of the index block */
+  char    *p;                   /* to fill the index block */
+  CCHAR   *name;                /* to traverse the item names */
+  void    *t;                   /* to enlarge the node array */
+
+  assert(idx && idx->base);     /* check the function argument */
+  if (idx->err) return idx->err;/* check for a collection error */
+  unmap(idx);                   /* release an existing index block */
+
+  /* --- sort the collected item sets --- */
+  obj_qsort(idx->sets, idx->cnt, sizeof(ISXSET), +1, seqcmp, idx->buf);
+  for (n = i = 0; i < idx->cnt; i++) {
+    if ((i+1 < idx->cnt)        /* remove duplicate item sets */
+    &&  (setcmp(idx->sets+i, idx->sets+i+1, idx->buf) == 0))
+      continue;                 /* (keep the last reported copy, */
+    idx->sets[n++] = idx->sets[i];   /* e.g. after an update) */
+  }
+  idx->cnt = n;                 /* note the number of unique sets */
+
+  /* --- build the prefix tree --- */
+  nmax  = idx->cnt +BLKSIZE;    /* create the node array */
+  nodes = (ISXNODE*)malloc(nmax *sizeof(ISXNODE));
+  cur   = (size_t*) malloc((idx->cnt+idx->cnt+1) *sizeof(size_t));
+  if (!nodes || !cur) {         /* and the set state arrays */
+    if (cur)   free(cur);
+    if (nodes) free(nodes);
+    return E_NOMEM;             /* on failure delete the arrays */
+  }                             /* and abort the function */
+  act = cur +idx->cnt;          /* split the set state arrays */
+  node = nodes;                 /* create the root node */
+  node->parent = node->chn = 0; /* (represents the empty set) */
+  node->supp   = idx->wgt; node->xsup  = -1;
+  node->item   = -1;       node->size  =  0; node->chcnt = 0;
+  nn = 1;                       /* the empty set is always indexed */
+  for (m = i = 0; i < idx->cnt; i++) {
+    cur[i] = 0;                 /* all sets start at the root */
+    if (idx->buf[idx->sets[i].off] > 0) act[m++] = i;
+  }                             /* collect the non-empty sets */
+  for (d = 1; m > 0; d++) {     /* build the tree level by level */
+    last = NONE;                /* there is no node on this level */
+    for (n = k = 0; k < m; k++) {
+      i = act[k];               /* traverse the active sets */
+      s = idx->buf +idx->sets[i].off;
+      if ((last == NONE)        /* if the prefix differs from */
+      ||  (nodes[last].parent != cur[i])  /* the prefix of the */
+      ||  (nodes[last].item   != s[d])) { /* preceding set */
+        if (nn >= nmax) {       /* if the node array is full */
+          nmax += nmax >> 1;    /* enlarge the node array */
+          t = realloc(nodes, nmax *sizeof(ISXNODE));
+          if (!t) { free(cur); free(nodes); return E_NOMEM; }
+          nodes = (ISXNODE*)t;  /* set the new node array */
+        }
+        node = nodes +nn;       /* create a new node */
+        node->parent = cur[i]; node->chn  = 0;
+        node->supp   = -1;     node->xsup = -1;
+        node->item   = s[d];   node->size = d; node->chcnt = 0;
+        node = nodes +cur[i];   /* get the parent node */
+        if (node->chcnt <= 0) node->chn = nn;
+        node->chcnt += 1;       /* add the new node as a child */
+        last = nn++;            /* (sets are sorted, so children */
+      }                         /* of a node are consecutive) */
+      cur[i] = last;            /* go to the node of the prefix */
+      if (s[0] <= d) nodes[last].supp = idx->sets[i].supp;
+      else           act[n++] = i;
+    }                           /* set the support of complete sets */
+    m = n;                      /* and keep the other sets active */
+  }
+  free(cur);                    /* delete the set state arrays */
+
+  /* --- compute the maximum superset supports --- */
+  set = (ITEM*)malloc((size_t)(idx->zmax+1) *2 *sizeof(ITEM));
+  if (!set) { free(nodes); return E_NOMEM; }
+  for (k = 1; k < nn; k++) {    /* traverse the non-root nodes */
+    if ((supp = nodes[k].supp) < 0) continue;
+    d = getset(nodes, k, set);  /* get the items of the set */
+    s = set +d;                 /* and a buffer for subsets */
+    for (x = 0; x < d; x++) {   /* traverse the items to remove */
+      for (n = 0, j = 0; j < d; j++)
+        if (j != x) s[n++] = set[j];
+      i = find(nodes, s, d-1);  /* find the node of the subset */
+      if ((i != NONE) && (supp > nodes[i].xsup))
+        nodes[i].xsup = supp;   /* update the maximum support */
+    }                           /* of a superset of the subset */
+  }                             /* (immediate supersets suffice) */
+  free(set);                    /* delete the item buffer */
+
+  /* --- sort the indexed sets by support --- */
+  for (n = k = 0; k < nn; k++)  /* count the indexed sets */
+    if (nodes[k].supp >= 0) n++;
+  order = (size_t*)malloc((n+1) *sizeof(size_t));
+  if (!order) { free(nodes); return E_NOMEM; }
+  for (n = k = 0; k < nn; k++)  /* collect the indexed sets */
+    if (nodes[k].supp >= 0) order[n++] = k;
+  obj_qsort(order, n, sizeof(size_t), +1, suppcmp, nodes);
+
+  /* --- assemble the index block --- */
+  for (z = 0, j = 0; j < ib_cnt(idx->base); j++)
+    z += strlen(ib_name(idx->base, j)) +1;
+  idx->mapsz = BINPAD(sizeof(ISXHDR)) +BINPAD(z)
+             + nn *sizeof(ISXNODE) +n *sizeof(size_t);
+  idx->map   = p = (char*)calloc(idx->mapsz, 1);
+  if (!p) { free(order); free(nodes); idx->mapsz = 0; return E_NOMEM; }
+  hdr = (ISXHDR*)p;             /* create the index block */
+  memcpy(hdr->magic, isxmagic, sizeof(hdr->magic));
+  hdr->types = isxtypes();      /* store file id. and type signature */
+  hdr->icnt  = ib_cnt(idx->base);
+  hdr->zmax  = idx->zmax;       /* store the index parameters */
+  hdr->wgt   = idx->wgt;
+  hdr->smin  = idx->smin;
+  hdr->names = z;
+  hdr->nodes = nn;
+  hdr->sets  = n;
+  p += BINPAD(sizeof(ISXHDR));  /* copy the item names */
+  for (j = 0; j < hdr->icnt; j++) {
+    name = ib_name(idx->base, j);
+    z    = strlen(name) +1;     /* traverse the items and */
+    memcpy(p, name, z); p += z; /* copy their names */
+  }                             /* (including terminating '\0') */
+  p = (char*)idx->map +BINPAD(sizeof(ISXHDR)) +BINPAD(hdr->names);
+  memcpy(p, nodes, nn *sizeof(ISXNODE));
+  memcpy(p +nn *sizeof(ISXNODE), order, n *sizeof(size_t));
+  free(order); free(nodes);     /* copy nodes and support order */
+  return bind(idx);             /* set up access to the block */
+}  /* isx_build() */
+
+/* The item sets are sorted lexicographically, which makes it possible */
+/* to build the prefix tree level by level: the nodes of a level are  */
+/* the distinct prefixes of the corresponding length, and all children */
+/* of a node are consecutive and sorted by their items. Each node     */
+/* stores the maximum support of an (immediate) superset, so that     */
+/* closed sets (superset support less than own support) and maximal   */
+/* sets (superset support less than query minimum support) can be     */
+/* recognized for any minimum support that is not less than the one   */
+/* used for mining. The block layout is identical to the file layout, */
+/* so that a loaded (memory mapped) index needs no conversion.        */
+
+/*--------------------------------------------------------------------*/
+
+int isx_save (ISRIDX *idx, const char *fname)
+{                               /* --- save an index to a file */
+  int  r;                       /* result of index building */
+  FILE *file;                   /* index output file */
+
+  assert(idx && fname);         /* check the function arguments */
+  if (!idx->map && ((r = isx_build(idx)) != 0))
+    return r;                   /* build the index block if needed */
+  file = fopen(fname, "wb");    /* open the index output file */
+  if (!file) return E_FOPEN;    /* and write the index block */
+  r = (fwrite(idx->map, 1, idx->mapsz, file) != idx->mapsz);
+  r |= (fclose(file) != 0);     /* close the index output file */
+  return (r) ? E_FWRITE : 0;    /* return a write error indicator */
+}  /* isx_save() */
+
+/*--------------------------------------------------------------------*/
+
+int isx_load (ISRIDX *idx, const char *fname)
+{                               /* --- load an index from a file */
+  int      r;                   /* result of block check */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  FILE     *file;               /* index input file */
+  long     size;                /* size of the input file */
+  #else                         /* if POSIX system */
+  int      fd;                  /* file descriptor of input file */
+  struct stat st;               /* file status (for the size) */
+  #endif
+
+  assert(idx && fname);         /* check the function arguments */
+  isx_clear(idx);               /* remove collected sets and block */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  file = fopen(fname, "rb");    /* open the index input file */
+  if (!file) return E_FOPEN;    /* and determine its size */
+  if ((fseek(file, 0, SEEK_END) != 0) || ((size = ftell(file)) < 0)
+  ||  (fseek(file, 0, SEEK_SET) != 0)) { fclose(file); return E_FREAD; }
+  idx->map = malloc((size_t)size);
+  if (!idx->map) { fclose(file); return E_NOMEM; }
+  idx->mapsz = (size_t)size;    /* read the whole file into memory */
+  if (fread(idx->map, 1, idx->mapsz, file) != idx->mapsz) {
+    fclose(file); unmap(idx); return E_FREAD; }
+  fclose(file);                 /* close the index input file */
+  #else                         /* if POSIX system */
+  fd = open(fname, O_RDONLY);   /* open the index input file */
+  if (fd < 0) return E_FOPEN;   /* and determine its size */
+  if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(ISXHDR))) {
+    close(fd); return E_FREAD; }
+  idx->mapsz  = (size_t)st.st_size;
+  idx->map    = mmap(NULL, idx->mapsz, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);                    /* map the file into memory */
+  if (idx->map == MAP_FAILED) { idx->map = NULL; idx->mapsz = 0;
+    return E_FREAD; }           /* (read-only, shared mapping: */
+  idx->mapped = 1;              /* pages are loaded on demand and */
+  #endif                        /* shared between query processes) */
+  r = bind(idx);                /* set up access to the block */
+  if (r != 0) unmap(idx);       /* and check the index */
+  return r;                     /* return the error status */
+}  /* isx_load() */
+
+/*--------------------------------------------------------------------*/
+
+int isx_isidx (const char *fname)
+{                               /* --- check for an index file */
+  FILE   *file;                 /* file to check */
+  size_t n;                     /* number of bytes read */
+  char   buf[sizeof(isxmagic)]; /* buffer for file identification */
+
+  if (!fname || !*fname)        /* standard input cannot be */
+    return 0;                   /* an index file (no mapping) */
+  file = fopen(fname, "rb");    /* open the file to check */
+  if (!file) return 0;          /* (errors are reported on loading) */
+  n = fread(buf, 1, sizeof(buf), file);
+  fclose(file);                 /* read the file identification */
+  return (n == sizeof(buf)) && (memcmp(buf, isxmagic, n) == 0);
+}  /* isx_isidx() */            /* compare to the index file id. */
+
+/*--------------------------------------------------------------------*/
+
+ITEM isx_item (ISRIDX *idx, const char *name)
+{                               /* --- get an item identifier */
+  ITEM i;                       /* loop variable */
+
+  assert(idx && idx->hdr && name);  /* check the function arguments */
+  for (i = 0; i < idx->hdr->icnt; i++)
+    if (strcmp(idx->names[i], name) == 0) return i;
+  return -1;                    /* find the item by its name */
+}  /* isx_item() */
+
+/*--------------------------------------------------------------------*/
+
+RSUPP isx_supp (ISRIDX *idx, const ITEM *items, ITEM n)
+{                               /* --- get the support of a set */
+  size_t k;                     /* index of the node of the set */
+
+  assert(idx && idx->hdr && (items || (n <= 0)));
+  if (n > idx->hdr->zmax) return -1;   /* check the set size */
+  memcpy(idx->set, items, (size_t)n *sizeof(ITEM));
+  ia_qsort(idx->set, (size_t)n, +1);   /* sort the items and */
+  n = ia_unique(idx->set, (size_t)n);  /* remove duplicates */
+  k = find(idx->nodes, idx->set, n);   /* find the node of the set */
+  return (k != NONE) ? idx->nodes[k].supp : -1;
+}  /* isx_supp() */
+
+/* The support of a set that is not in the index is reported as -1. */
+/* It is less than the minimum support used for mining (isx_smin()) */
+/* or the set has more items than any indexed set (isx_zmax()).     */
+
+/*--------------------------------------------------------------------*/
+
+void isx_init (ISRIDX *idx, int target, RSUPP smin,
+               ITEM zmin, ITEM zmax, double conf)
+{                               /* --- initialize a query */
+  assert(idx && idx->hdr);      /* check the function arguments */
+  idx->target = target;         /* note the target type and */
+  idx->qsupp  = (smin > idx->hdr->smin) ? smin : idx->hdr->smin;
+  idx->qzmin  = (zmin > 0) ? zmin : 0;   /* the support and */
+  idx->qzmax  = (zmax < idx->hdr->zmax) ? zmax : idx->hdr->zmax;
+  idx->qconf  = conf *(1.0-DBL_EPSILON); /* the size range */
+  idx->pos    = 0;              /* start with the most frequent set */
+  idx->head   = -1;             /* (no rule heads to process yet) */
+}  /* isx_init() */             /* (as for ist_create()) */
+
+/*--------------------------------------------------------------------*/
+
+ITEM isx_iset (ISRIDX *idx, ITEM *set, RSUPP *supp)
+{                               /* --- get the next item set */
+  const ISXNODE *node;          /* node of the current item set */
+
+  assert(idx && idx->hdr && set && supp);
+  while (idx->pos < idx->hdr->sets) {
+    node = idx->nodes +idx->order[idx->pos++];
+    if (node->supp < idx->qsupp) { /* if below minimum support, */
+      idx->pos = idx->hdr->sets; break; }  /* abort the query */
+    if ((node->size < idx->qzmin) || (node->size > idx->qzmax))
+      continue;                 /* check the item set size */
+    if ((idx->target & ISR_CLOSED)  && (node->xsup >= node->supp))
+      continue;                 /* check for a closed  item set */
+    if ((idx->target & ISR_MAXIMAL) && (node->xsup >= idx->qsupp))
+      continue;                 /* check for a maximal item set */
+    *supp = node->supp;         /* get the support of the item set */
+    return getset(idx->nodes, (size_t)(node -idx->nodes), set);
+  }                             /* return the number of items */
+  return -1;                    /* there is no other item set */
+}  /* isx_iset() */
+
+/* The item sets are returned in the order of descending support, */
+/* with the items of each set in ascending order of identifiers.  */
+
+/*--------------------------------------------------------------------*/
+
+ITEM isx_rule (ISRIDX *idx, ITEM *rule, RSUPP *supp,
+               RSUPP *body, RSUPP *head)
+{                               /* --- get the next association rule */
+  ITEM          i, k, n;        /* loop variables, number of items */
+  size_t        b, h;           /* indices of body and head nodes */
+  const ISXNODE *node;          /* node of the current item set */
+
+  assert(idx && idx->hdr && rule && supp && body && head);
+  while (1) {                   /* find the next rule */
+    if (idx->head < 0) {        /* if all heads have been processed, */
+      n = isx_iset(idx, idx->set, supp);  /* get the next item set */
+      if (n < 0) return -1;     /* (sets are in descending support */
+      idx->head = n-1; continue;/* order, so the query may end) */
+    }                           /* and start with its last item */
+    node = idx->nodes +idx->order[idx->pos-1];
+    n    = node->size;          /* get the current item set */
+    i    = idx->head--;         /* and the next head item */
+    for (rule[0] = idx->set[i], k = 1; k <= i; k++)
+      rule[k] = idx->set[k-1];  /* collect the head item */
+    for (k = i+1; k < n; k++)   /* and the body items */
+      rule[k] = idx->set[k];    /* (in ascending order) */
+    b = find(idx->nodes, rule+1, n-1);  /* find the rule body */
+    h = find(idx->nodes, rule,   1);    /* and the rule head */
+    if ((b == NONE) || (idx->nodes[b].supp < 0)
+    ||  (h == NONE) || (idx->nodes[h].supp < 0))
+      continue;                 /* skip rules with unindexed parts */
+    if ((double)node->supp < (double)idx->nodes[b].supp *idx->qconf)
+      continue;                 /* check the rule confidence */
+    *supp = node->supp;         /* get the support of the rule, */
+    *body = idx->nodes[b].supp; /* of its body and of its head */
+    *head = idx->nodes[h].supp;
+    return n;                   /* return the number of items */
+  }
+}  /* isx_rule() */
+
+/* Each item of a reported item set is tried as the head of a rule, */
+/* with the remaining items forming the body (isx_init() should be  */
+/* called with a minimum size of at least 1). The head item is      */
+/* stored in rule[0], the body items follow in ascending order.     */
+/* Rules whose body or head is not indexed (because the reporter    */
+/* suppressed it, e.g. a set of perfect extensions of the empty     */
+/* set) are skipped, as their confidence cannot be computed. As for */
+/* the option -o of apriori, the support of a rule is the support   */
+/* of the union of its body and its head.                           */
+
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+#ifdef ISX_MAIN
+
+#ifndef NDEBUG                  /* if debug version */
+  #undef  CLEANUP               /* clean up memory and close files */
+  #define CLEANUP \
+  if (isx)    isx_delete(isx);  \
+  if (out && (out != stdout)) fclose(out); \
+  if (names)  free(names); \
+  if (items)  free(items);
+#endif
+
+GENERROR(error, exit)           /* generic error reporting function */
+
+/*--------------------------------------------------------------------*/
+
+static void putitems (const ITEM *set, ITEM n, CCHAR *sep)
+{                               /* --- print a set of items */
+  ITEM i;                       /* loop variable */
+
+  for (i = 0; i < n; i++) {     /* traverse the items */
+    if (i > 0) fputs(sep, out); /* print an item separator */
+    fputs(isx_name(isx, set[i]), out);
+  }                             /* print the item name */
+}  /* putitems() */
+
+/*--------------------------------------------------------------------*/
+
+int main (int argc, char *argv[])
+{                               /* --- main function */
+  int     i, k = 0;             /* loop variables, buffers */
+  char    *s, *t;               /* to traverse the options/names */
+  CCHAR   **optarg = NULL;      /* option argument */
+  CCHAR   *fn_idx  = NULL;      /* name of index  file */
+  CCHAR   *fn_out  = NULL;      /* name of output file */
+  CCHAR   *lookup  = NULL;      /* item set to look up */
+  CCHAR   *sep     = " ";       /* item separator */
+  CCHAR   *imp     = " <- ";    /* implication sign */
+  CCHAR   *stype;               /* string for target type */
+  int     target   = 's';       /* target type (sets/rules) */
+  ITEM    zmin     = 1;         /* minimum size of a set/rule */
+  ITEM    zmax     = ITEM_MAX;  /* maximum size of a set/rule */
+  double  supp     = 0;         /* minimum support (0: index) */
+  double  conf     = 80;        /* minimum confidence (in percent) */
+  RSUPP   smin;                 /* minimum support as a number */
+  RSUPP   sx, sb, sh;           /* supports of set, body and head */
+  ITEM    n, m;                 /* number of items, loop variable */
+  size_t  recs     = 0;         /* number of reported sets/rules */
+  #ifndef QUIET                 /* if not quiet version */
+  clock_t tm;                   /* timer for measurements */
+
+  prgname = argv[0];            /* get program name for error msgs. */
+
+  /* --- print usage message --- */
+  if (argc > 1) {               /* if arguments are given */
+    fprintf(stderr, "%s - %s\n", argv[0], DESCRIPTION);
+    fprintf(stderr, VERSION); } /* print a startup message */
+  else {                        /* if no arguments given */
+    printf("usage: %s [options] idxfile [outfile]\n", argv[0]);
+    printf("%s\n", DESCRIPTION);
+    printf("%s\n", VERSION);
+    printf("-t#      target type                              "
+                    "(default: %c)\n", target);
+    printf("         (s: frequent, c: closed, m: maximal item sets,\n");
+    printf("          r: association rules)\n");
+    printf("-m#      minimum number of items per set/rule     "
+                    "(default: %"ITEM_FMT")\n", zmin);
+    printf("-n#      maximum number of items per set/rule     "
+                    "(default: no limit)\n");
+    printf("-s#      minimum support of an item set/rule      "
+                    "(default: index)\n");
+    printf("         (positive: percentage, "
+                    "negative: absolute number)\n");
+    printf("-c#      minimum confidence of a rule             "
+                    "(default: %g%%)\n", conf);
+    printf("-i#      item set to look up the support of\n");
+    printf("         (item names separated by blanks)\n");
+    printf("-k#      item separator for output                "
+                    "(default: \"%s\")\n", sep);
+    printf("-I#      implication sign for rules               "
+                    "(default: \"%s\")\n", imp);
+    printf("idxfile  file to read the item set index from     "
+                    "[required]\n");
+    printf("         (written with option -E of apriori "
+                    "or fpgrowth)\n");
+    printf("outfile  file to write item sets/rules to         "
+                    "[optional]\n");
+    return 0;                   /* print a usage message */
+  }                             /* and abort the program */
+  #endif  /* #ifndef QUIET */
+
+  /* --- evaluate arguments --- */
+  for (i = 1; i < argc; i++) {  /* traverse arguments */
+    s = argv[i];                /* get option argument */
+    if (optarg) { *optarg = s; optarg = NULL; continue; }
+    if ((*s == '-') && *++s) {  /* -- if argument is an option */
+      while (*s) {              /* traverse options */
+        switch (*s++) {         /* evaluate switches */
+          case 't': target = (*s) ? *s++ : 's';     break;
+          case 'm': zmin   = (ITEM)strtol(s, &s, 0); break;
+          case 'n': zmax   = (ITEM)strtol(s, &s, 0); break;
+          case 's': supp   =       strtod(s, &s);    break;
+          case 'c': conf   =       strtod(s, &s);    break;
+          case 'i': optarg = &lookup;               break;
+          case 'k': optarg = &sep;                  break;
+          case 'I': optarg = &imp;                  break;
+          default : error(E_OPTION, *--s);          break;
+        }                       /* set option variables */
+        if (optarg && *s) { *optarg = s; optarg = NULL; break; }
+      } }                       /* get option argument */
+    else {                      /* -- if argument is no option */
+      switch (k++) {            /* evaluate non-options */
+        case  0: fn_idx = s;      break;
+        case  1: fn_out = s;      break;
+        default: error(E_ARGCNT); break;
+      }                         /* note filenames */
+    }
+  }
+  if (optarg) error(E_OPTARG);  /* check (option) arguments */
+  if (k < 1)  error(E_ARGCNT);  /* and number of arguments */
+  switch (target) {             /* check and translate target type */
+    case 's': target = ISR_ALL;     stype = "item sets";         break;
+    case 'c': target = ISR_CLOSED;  stype = "closed item sets";  break;
+    case 'm': target = ISR_MAXIMAL; stype = "maximal item sets"; break;
+    case 'r': target = ISR_RULES;   stype = "association rules"; break;
+    default : error(E_TARGET, (char)target);                     break;
+  }                             /* (get target type code) */
+  if (zmin < 0)    error(E_SIZE, zmin); /* check the limits */
+  if (zmax < 0)    error(E_SIZE, zmax); /* for the set size */
+  if (supp > 100)  error(E_SUPPORT, supp); /* and the support */
+  if ((conf < 0) || (conf > 100)) error(E_CONF, conf);
+  MSG(stderr, "\n");            /* terminate the startup message */
+
+  /* --- load the item set index --- */
+  CLOCK(tm);                    /* start timer, load index */
+  MSG(stderr, "reading %s ... ", fn_idx);
+  isx = isx_create(NULL);       /* create an item set index */
+  if (!isx) error(E_NOMEM);     /* and load it from the file */
+  k = isx_load(isx, fn_idx);
+  if (k != 0) error(k, fn_idx); /* check for a load error */
+  MSG(stderr, "[%"ITEM_FMT" item(s), %"SIZE_FMT" set(s)]",
+              isx_cnt(isx), isx_setcnt(isx));
+  MSG(stderr, " done [%.2fs].\n", SEC_SINCE(tm));
+  n = isx_zmax(isx);            /* create an item buffer */
+  items = (ITEM*)malloc((size_t)(n+1) *2 *sizeof(ITEM));
+  if (!items) error(E_NOMEM);   /* for sets and rules */
+  if (!fn_out || !*fn_out) out = stdout;
+  else if (!(out = fopen(fn_out, "w"))) error(E_FOPEN, fn_out);
+
+  /* --- look up an item set --- */
+  if (lookup) {                 /* if to look up an item set */
+    names = (char*)malloc((strlen(lookup)+1) *sizeof(char));
+    if (!names) error(E_NOMEM); /* copy the item names */
+    strcpy(names, lookup);      /* (to be able to split them) */
+    for (n = 0, t = strtok(names, " \t"); t; t = strtok(NULL, " \t")) {
+      m = isx_item(isx, t);     /* traverse and find the items */
+      if (m < 0) error(E_ITEM, t);
+      if (n <= isx_zmax(isx)) items[n] = m;
+      n++;                      /* collect the item identifiers */
+    }                           /* (too large sets are not indexed) */
+    sx = (n > isx_zmax(isx)) ? -1 : isx_supp(isx, items, n);
+    if (n > isx_zmax(isx)) fputs(lookup, out);
+    else putitems(items, n, sep);    /* print the item set */
+    if (sx < 0) fputs(" (infrequent)\n", out);
+    else fprintf(out, " (%"RSUPP_FMT")\n", sx); }
+
+  /* --- report item sets or association rules --- */
+  else {                        /* if to query the index */
+    CLOCK(tm);                  /* start timer, print log message */
+    MSG(stderr, "writing %s ... ", (fn_out) ? fn_out : "<stdout>");
+    smin = (RSUPP)ceilsupp((supp >= 0)
+         ? supp/100.0 *(double)isx_wgt(isx) *(1-DBL_EPSILON) : -supp);
+    if (smin < isx_smin(isx))   /* check against the index support */
+      MSG(stderr, "(support raised to %"RSUPP_FMT") ", isx_smin(isx));
+    if (target & ISR_RULES) {   /* if to report association rules */
+      isx_init(isx, ISR_ALL, smin, (zmin > 1) ? zmin : 1, zmax,
+               conf/100.0);     /* (rules need at least one item) */
+      while ((n = isx_rule(isx, items, &sx, &sb, &sh)) >= 0) {
+        putitems(items, 1, sep); fputs(imp, out);
+        putitems(items+1, n-1,  sep);
+        fprintf(out, " (%"RSUPP_FMT", %.2f)\n", sx,
+                (double)sx/(double)sb *100.0);
+        recs++;                 /* print rule and its support */
+      } }                       /* and confidence (in percent) */
+    else {                      /* if to report item sets */
+      isx_init(isx, target, smin, zmin, zmax, 0);
+      while ((n = isx_iset(isx, items, &sx)) >= 0) {
+        putitems(items, n, sep);
+        fprintf(out, " (%"RSUPP_FMT")\n", sx);
+        recs++;                 /* print the item set */
+      }                         /* and its support */
+    }
+    MSG(stderr, "[%"SIZE_FMT" %s] done [%.2fs].\n",
+        recs, stype, SEC_SINCE(tm));
+  }
+  if (ferror(out) || ((out != stdout) && (fclose(out) != 0)))
+    error(E_FWRITE, (out == stdout) ? "<stdout>" : fn_out);
+  if (out != stdout) out = NULL;/* (file is closed) */
+
+  /* --- clean up --- */
+  CLEANUP;                      /* clean up memory and close files */
+  SHOWMEM;                      /* show (final) memory usage */
+  return 0;                     /* return 'ok' */
+}  /* main() */
+
+#endif
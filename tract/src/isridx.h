@@ -0,0 +1,103 @@
+/*----------------------------------------------------------------------
+  File    : isridx.h
+  Contents: persistent index of frequent item sets
+  History : 2026.10.14 file created
+----------------------------------------------------------------------*/
+#ifndef __ISRIDX__
+#define __ISRIDX__
+#include "report.h"
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef struct {                /* --- index file header --- */
+  char     magic[8];            /* file type identification */
+  size_t   types;               /* signature of the data types */
+  ITEM     icnt;                /* number of items */
+  ITEM     zmax;                /* maximum size of an indexed set */
+  RSUPP    wgt;                 /* total weight of transactions */
+  RSUPP    smin;                /* minimum support of indexed sets */
+  size_t   names;               /* size of the item name block */
+  size_t   nodes;               /* number of prefix tree nodes */
+  size_t   sets;                /* number of indexed item sets */
+} ISXHDR;                       /* (index file header) */
+
+typedef struct {                /* --- prefix tree node --- */
+  size_t   parent;              /* index of the parent node */
+  size_t   chn;                 /* index of the first child node */
+  RSUPP    supp;                /* support of the item set (or -1) */
+  RSUPP    xsup;                /* maximum support of a superset */
+  ITEM     item;                /* last item of the item set */
+  ITEM     size;                /* number of items (tree level) */
+  ITEM     chcnt;               /* number of child nodes */
+} ISXNODE;                      /* (prefix tree node) */
+
+typedef struct {                /* --- collected item set --- */
+  size_t   off;                 /* offset of the items in the buffer */
+  RSUPP    supp;                /* support of the item set */
+} ISXSET;                       /* (collected item set) */
+
+typedef struct {                /* --- item set index --- */
+  ITEMBASE *base;               /* underlying item base (or NULL) */
+  int      err;                 /* error status (collecting sets) */
+  RSUPP    wgt;                 /* total weight of transactions */
+  RSUPP    smin;                /* minimum support of the reporter */
+  ITEM     zmax;                /* maximum size of a collected set */
+  ITEM     *buf;                /* buffer for the collected items */
+  size_t   len, bsz;            /* used and allocated buffer size */
+  ISXSET   *sets;               /* collected item sets */
+  size_t   cnt, max;            /* number of sets and array size */
+  void     *map;                /* index block (built/mapped) */
+  size_t   mapsz;               /* size of the index block */
+  int      mapped;              /* whether the block is mapped */
+  ISXHDR   *hdr;                /* header of the index block */
+  CCHAR    **names;             /* item names (into the block) */
+  ISXNODE  *nodes;              /* prefix tree nodes (level order) */
+  size_t   *order;              /* indexed sets by descending support */
+  int      target;              /* target type of the current query */
+  RSUPP    qsupp;               /* minimum support of the query */
+  ITEM     qzmin, qzmax;        /* size range of the query */
+  double   qconf;               /* minimum confidence of the query */
+  size_t   pos;                 /* position in the order array */
+  ITEM     head;                /* index of the next rule head */
+  ITEM     *set;                /* items of the current query set */
+} ISRIDX;                       /* (item set index) */
+
+/*----------------------------------------------------------------------
+  Functions
+----------------------------------------------------------------------*/
+extern ISRIDX*  isx_create  (ITEMBASE *base);
+extern void     isx_delete  (ISRIDX *idx);
+extern void     isx_clear   (ISRIDX *idx);
+extern void     isx_add     (ISREPORT *rep, void *data);
+extern int      isx_build   (ISRIDX *idx);
+extern int      isx_save    (ISRIDX *idx, const char *fname);
+extern int      isx_load    (ISRIDX *idx, const char *fname);
+extern int      isx_isidx   (const char *fname);
+
+extern ITEM     isx_cnt     (ISRIDX *idx);
+extern CCHAR*   isx_name    (ISRIDX *idx, ITEM item);
+extern ITEM     isx_item    (ISRIDX *idx, const char *name);
+extern RSUPP    isx_wgt     (ISRIDX *idx);
+extern RSUPP    isx_smin    (ISRIDX *idx);
+extern ITEM     isx_zmax    (ISRIDX *idx);
+extern size_t   isx_setcnt  (ISRIDX *idx);
+
+extern RSUPP    isx_supp    (ISRIDX *idx, const ITEM *items, ITEM n);
+extern void     isx_init    (ISRIDX *idx, int target, RSUPP smin,
+                             ITEM zmin, ITEM zmax, double conf);
+extern ITEM     isx_iset    (ISRIDX *idx, ITEM *set, RSUPP *supp);
+extern ITEM     isx_rule    (ISRIDX *idx, ITEM *rule, RSUPP *supp,
+                             RSUPP *body, RSUPP *head);
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define isx_cnt(x)      ((x)->hdr->icnt)
+#define isx_name(x,i)   ((x)->names[i])
+#define isx_wgt(x)      ((x)->hdr->wgt)
+#define isx_smin(x)     ((x)->hdr->smin)
+#define isx_zmax(x)     ((x)->hdr->zmax)
+#define isx_setcnt(x)   ((x)->hdr->sets)
+
+#endif
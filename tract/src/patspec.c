@@ -13,6 +13,8 @@
             2014.07.25 spectrum estimation for item sequences added
             2014.10.24 treatment of non-integer support type corrected
             2016.10.05 slot counting with and without duplicate check
+            2026.10.14 functions psp_save() and psp_load() added
+            2026.10.14 byte order marker added to binary file header
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -68,6 +70,7 @@
 
 /*--------------------------------------------------------------------*/
 #define BLKSIZE      32         /* block size for enlarging arrays */
+#define BYTEORD      ((size_t)0x04030201)  /* byte order marker */
 
 #ifdef PSP_MAIN
 /* --- error codes --- */
@@ -91,6 +94,26 @@
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
+typedef struct {                /* --- binary file header --- */
+  char   magic[8];              /* file identification */
+  size_t order;                 /* byte order marker (BYTEORD) */
+  size_t types;                 /* signature of the data types */
+  ITEM   minsize;               /* minimum pattern size (offset) */
+  ITEM   maxsize;               /* maximum pattern size (limit) */
+  RSUPP  minsupp;               /* minimum support (offset) */
+  RSUPP  maxsupp;               /* maximum support (limit) */
+  size_t cnt;                   /* number of (surrogate) data sets */
+  size_t rows;                  /* number of stored rows */
+  size_t total;                 /* total frequency of signatures */
+} PSPHDR;                       /* (binary file header) */
+
+typedef struct {                /* --- binary row record --- */
+  ITEM   size;                  /* pattern size of the row */
+  RSUPP  min, max;              /* range of stored support values */
+  size_t cnt;                   /* number of stored signatures */
+  size_t sum;                   /* sum of occurrences (for this size) */
+} PSPREC;                       /* (binary row record) */
+
 #if defined PSP_TRAIN && defined PSP_ESTIM
 
 typedef struct {                /* --- heap element for slot counting */
@@ -107,8 +130,9 @@ typedef struct {                /* --- point process element */
 /*----------------------------------------------------------------------
   Global Variables
 ----------------------------------------------------------------------*/
-static PSPROW empty = { RSUPP_MAX, RSUPP_MIN, RSUPP_MIN, 0, NULL };
+static const PSPROW empty = { RSUPP_MAX, RSUPP_MIN, RSUPP_MIN, 0, NULL };
 /* an empty row entry for initializing new rows */
+static const char pspmagic[8] = "PATSPC\x1a";  /* binary file id. */
 
 #ifdef PSP_MAIN
 static CCHAR *errmsgs[] = {     /* error messages */
@@ -131,6 +155,8 @@ static CCHAR *errmsgs[] = {     /* error messages */
 #ifdef PSP_MAIN
 static CCHAR    *prgname;       /* program name for error messages */
 static PATSPEC  *psp    = NULL; /* pattern spectrum */
+static PATSPEC  *shards[2];     /* partial spectra (shards) */
+static PATSPEC  *merged = NULL; /* merged partial spectra */
 static TABWRITE *twrite = NULL; /* table writer */
 #endif
 
@@ -367,6 +393,161 @@ int psp_addpsp (PATSPEC *dst, PATSPEC *src)
   return dst->err;              /* return the error status */
 }  /* psp_addpsp() */
 
+/*--------------------------------------------------------------------*/
+
+static size_t psptypes (void)
+{                               /* --- signature of the data types */
+  return  (size_t)sizeof(ITEM)          /* combine the sizes of */
+       | ((size_t)sizeof(RSUPP)  <<  4) /* the basic data types */
+       | ((size_t)sizeof(size_t) <<  8) /* that are stored */
+       | ((size_t)INTSUPP        << 12) /* in a binary file */
+       | ((size_t)sizeof(PSPREC) << 16) /* and the sizes of the */
+       | ((size_t)sizeof(PSPHDR) << 24);/* records (incl. padding) */
+}  /* psptypes() */
+
+/*--------------------------------------------------------------------*/
+
+int psp_save (PATSPEC *psp, const char *fname, size_t cnt)
+{                               /* --- save spectrum to a binary file */
+  ITEM   size;                  /* loop variable for sizes */
+  PSPROW *row;                  /* to traverse the rows (sizes) */
+  PSPHDR hdr;                   /* binary file header */
+  PSPREC rec;                   /* binary row record */
+  FILE   *file;                 /* binary output file */
+  int    e = 0;                 /* write error indicator */
+  #if INTSUPP                   /* if integer support type */
+  RSUPP  supp;                  /* loop variable for supports */
+  size_t frq;                   /* (size,supp) signature frequency */
+  #endif
+
+  assert(psp && fname);         /* check the function arguments */
+  memset(&hdr, 0, sizeof(hdr)); /* clear the header (incl. padding) */
+  memcpy(hdr.magic, pspmagic, sizeof(hdr.magic));
+  hdr.order   = BYTEORD;        /* store file id., byte order */
+  hdr.types   = psptypes();     /* marker and type signature */
+  hdr.minsize = psp->minsize;   /* note the parameters */
+  hdr.maxsize = psp->maxsize;   /* of the pattern spectrum */
+  hdr.minsupp = psp->minsupp;
+  hdr.maxsupp = psp->maxsupp;
+  hdr.cnt     = cnt;            /* and the number of data sets */
+  hdr.total   = psp->total;
+  for (size = psp->minsize; size <= psp->cur; size++)
+    if (psp->rows[size].sum > 0) hdr.rows++;
+  file = fopen(fname, "wb");    /* count the non-empty rows, */
+  if (!file) return E_FOPEN;    /* open the binary output file */
+  e |= (fwrite(&hdr, sizeof(hdr), 1, file) != 1);
+  memset(&rec, 0, sizeof(rec)); /* write the file header and */
+  for (size = psp->minsize; size <= psp->cur; size++) {
+    row = psp->rows +size;      /* traverse the rows (sizes) */
+    if (row->sum <= 0) continue;/* skip rows without signatures */
+    rec.size = size;            /* note the pattern size */
+    rec.sum  = row->sum;        /* and the sum of occurrences */
+    #if INTSUPP                 /* if integer support type */
+    rec.min = row->cur; rec.max = row->min; rec.cnt = 0;
+    for (supp = row->min; supp <= row->cur; supp++) {
+      if (row->frqs[supp-row->min] <= 0) continue;
+      if (supp < rec.min) rec.min = supp;
+      rec.max = supp; rec.cnt++;/* determine the support range */
+    }                           /* and count the signatures */
+    e |= (fwrite(&rec, sizeof(rec), 1, file) != 1);
+    for (supp = rec.min; supp <= rec.max; supp++) {
+      if ((frq = row->frqs[supp-row->min]) <= 0) continue;
+      e |= (fwrite(&supp, sizeof(RSUPP),  1, file) != 1);
+      e |= (fwrite(&frq,  sizeof(size_t), 1, file) != 1);
+    }                           /* write the row record and */
+    #else                       /* the (support,frequency) pairs */
+    rec.min = row->min;         /* note the support range */
+    rec.max = row->max;         /* and write the row record */
+    e |= (fwrite(&rec, sizeof(rec), 1, file) != 1);
+    #endif                      /* (with the range as the only */
+  }                             /* signature for double support) */
+  e |= (fclose(file) != 0);     /* close the binary output file */
+  return (e) ? E_FWRITE : 0;    /* return a write error indicator */
+}  /* psp_save() */
+
+/*--------------------------------------------------------------------*/
+
+int psp_load (PATSPEC **psp, const char *fname, size_t *cnt)
+{                               /* --- load spectrum from binary file */
+  PATSPEC *p;                   /* pattern spectrum to add to */
+  PSPHDR  hdr;                  /* binary file header */
+  PSPREC  rec;                  /* binary row record */
+  FILE    *file;                /* binary input file */
+  size_t  i;                    /* loop variable for rows */
+  size_t  total = 0;            /* total frequency of signatures */
+  int     e = 0;                /* error indicator */
+  #if INTSUPP                   /* if integer support type */
+  size_t  k;                    /* loop variable for signatures */
+  RSUPP   supp, prev;           /* support of a signature */
+  size_t  frq;                  /* (size,supp) signature frequency */
+  #endif
+
+  assert(psp && fname);         /* check the function arguments */
+  file = fopen(fname, "rb");    /* open the binary input file */
+  if (!file) return E_FOPEN;    /* and read the file header */
+  if ((fread(&hdr, sizeof(hdr), 1, file) != 1)
+  ||  (memcmp(hdr.magic, pspmagic, sizeof(hdr.magic)) != 0)
+  ||  (hdr.order   != BYTEORD)
+  ||  (hdr.types   != psptypes())
+  ||  (hdr.minsize <  0) || (hdr.maxsize < hdr.minsize)
+  ||  (hdr.minsupp <  0) || (hdr.maxsupp < hdr.minsupp)) {
+    fclose(file); return E_FREAD; }
+  p = *psp;                     /* check file id. and parameters */
+  if (!p) {                     /* if no pattern spectrum is given */
+    p = psp_create(hdr.minsize, hdr.maxsize, hdr.minsupp, hdr.maxsupp);
+    if (!p) { fclose(file); return E_NOMEM; }
+  }                             /* create a pattern spectrum */
+  for (i = 0; (i < hdr.rows) && !e; i++) {
+    if ((fread(&rec, sizeof(rec), 1, file) != 1)
+    ||  (rec.size < hdr.minsize) || (rec.size > hdr.maxsize)
+    ||  (rec.min  < hdr.minsupp) || (rec.max  > hdr.maxsupp)
+    ||  (rec.max  < rec.min)) { e = E_FREAD; break; }
+    #if INTSUPP                 /* if integer support type */
+    for (prev = rec.min-1, k = 0; k < rec.cnt; k++) {
+      if ((fread(&supp, sizeof(RSUPP),  1, file) != 1)
+      ||  (fread(&frq,  sizeof(size_t), 1, file) != 1)
+      ||  (supp <= prev) || (supp > rec.max)) {
+        e = E_FREAD; break; }   /* read a (support,frequency) pair */
+      psp_incfrq(p, rec.size, prev = supp, frq);
+      total += frq;             /* add the signature frequency */
+    }                           /* to the pattern spectrum */
+    #else                       /* if double support type */
+    if ((rec.size >= p->minsize) && (rec.size <= p->maxsize)
+    &&  (rec.min  >= p->minsupp) && (rec.min  <= p->maxsupp)
+    &&  (resize(p, rec.size, rec.min) < 0))
+      break;                    /* enlarge table if necessary */
+    psp_incfrq(p, rec.size, rec.max, rec.sum);
+    total += rec.sum;           /* update the pattern spectrum */
+    #endif                      /* with the row of the file */
+  }
+  if (!e && (total != hdr.total)) e = E_FREAD;
+  if (!e && (p->err < 0))         e = E_NOMEM;
+  fclose(file);                 /* close the binary input file */
+  if (e) { if (!*psp) psp_delete(p); return e; }
+  *psp = p;                     /* set the (created) spectrum and */
+  if (cnt) *cnt += hdr.cnt;     /* sum the numbers of data sets */
+  return 0;                     /* return 'ok' */
+}  /* psp_load() */
+
+/* A pattern spectrum is saved as a file header (with a type        */
+/* signature and the parameters of the spectrum) and one record per */
+/* non-empty row, which is followed by the (support,frequency)      */
+/* pairs of the signatures if the support type is integer (that is, */
+/* only the non-zero counters are stored). The header, the records  */
+/* and the pairs are written as they are laid out in memory, so the */
+/* file is not portable between machines with different type sizes, */
+/* structure padding or byte order. To detect such a mismatch, the  */
+/* header contains a byte order marker (the bytes of which appear   */
+/* reversed on a machine with the opposite byte order) and a type   */
+/* signature that combines the sizes of the basic types and of the  */
+/* records; psp_load() rejects a file if either of them differs.    */
+/* The function psp_load() adds the loaded frequencies to the       */
+/* spectrum *psp (creating it with the parameters stored in the     */
+/* file if *psp is null) and adds the stored number of data sets to */
+/* *cnt, so that several partial spectra, which were generated from */
+/* disjoint sets of surrogate data sets, can be merged by loading   */
+/* them one after the other.                                        */
+
 /*--------------------------------------------------------------------*/
 #ifdef PSP_ESTIM                /* if estimation from a train set */
 
@@ -875,8 +1056,11 @@ void psp_show (PATSPEC *psp)
 #ifndef NDEBUG                  /* if debug version */
   #undef  CLEANUP               /* clean up memory and close files */
   #define CLEANUP \
-  if (twrite) twr_delete(twrite, 1); \
-  if (psp)    psp_delete(psp);
+  if (twrite)    twr_delete(twrite, 1);  \
+  if (merged)    psp_delete(merged);     \
+  if (shards[1]) psp_delete(shards[1]);  \
+  if (shards[0]) psp_delete(shards[0]);  \
+  if (psp)       psp_delete(psp);
 #endif
 
 GENERROR(error, exit)           /* generic error reporting function */
@@ -887,11 +1071,20 @@ int main (int argc, char *argv[])
 {                               /* --- main function for testing */
   int    i;                     /* loop variable */
   size_t equiv = 1;             /* equivalent number of surrogates */
+  size_t cnt   = 0;             /* number of merged shards */
   ITEM   size;                  /* size    of a signature */
   RSUPP  supp;                  /* support of a signature */
 
+  prgname = argv[0];            /* get program name for error msgs. */
+  if (argc > 2) error(E_ARGCNT);/* check the number of arguments */
   psp = psp_create(2, 12, 2, 12);
   if (!psp) error(E_NOMEM);     /* create a pattern spectrum */
+  if (argc > 1) {               /* if a shard file name is given, */
+    for (i = 0; i < 2; i++) {   /* create two partial spectra */
+      shards[i] = psp_create(2, 12, 2, 12);
+      if (!shards[i]) error(E_NOMEM);
+    }                           /* the signatures are distributed */
+  }                             /* alternately to the partial spectra */
   for (i = 0; i < 10000; i++) { /* create some random signatures */
     size = (ITEM) (16 *(double)rand()/((double)RAND_MAX +1));
     supp = (RSUPP)(16 *(double)rand()/((double)RAND_MAX +1));
@@ -899,6 +1092,7 @@ int main (int argc, char *argv[])
     printf("%d: (%"ITEM_FMT",%"RSUPP_FMT")\n", i, size, supp);
     #endif
     psp_incfrq(psp, size, supp, 1);
+    if (shards[0]) psp_incfrq(shards[i & 1], size, supp, 1);
   }                             /* register each signature */
   twrite = twr_create();        /* create a table writer and */
   if (!twrite) error(E_NOMEM);  /* configure the characters */
@@ -910,7 +1104,21 @@ int main (int argc, char *argv[])
   twrite = NULL;                /* and delete the table writer */
   printf("sigcnt: %"SIZE_FMT"\n", psp_sigcnt(psp));
   printf("total:  %"SIZE_FMT"\n", psp_total(psp));
-  return 0;                     /* return 'ok' */
+  if (argc <= 1) return 0;      /* if no shard file name is given, */
+  for (i = 0; i < 2; i++) {     /* abort, otherwise save each shard */
+    if (psp_save(shards[i], argv[1], 1) != 0)
+      error(E_FWRITE, argv[1]); /* to the file and load it again */
+    if (psp_load(&merged, argv[1], &cnt) != 0)
+      error(E_FREAD,  argv[1]); /* (adding it to the merged spectrum) */
+  }
+  for (i = 1, size = 0; (size < 16) && i; size++)
+    for (supp = 0; (supp < 16) && i; supp++)
+      i = (psp_getfrq(merged, size, supp) == psp_getfrq(psp, size, supp));
+  i = i && (cnt == 2)           /* compare the merged spectrum */
+        && (psp_total(merged) == psp_total(psp));  /* to the full one */
+  printf("merged: %"SIZE_FMT" shard(s), %s\n", cnt,
+         (i) ? "equal to full spectrum" : "differs from full spectrum");
+  return (i) ? 0 : 1;           /* return whether merge is correct */
 }  /* main() */
 
 #endif
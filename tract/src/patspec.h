@@ -8,6 +8,7 @@
             2013.10.15 functions psp_error() and psp_clear() added
             2014.02.28 optional function psp_estim() added (PSP_ESTIM)
             2014.07.25 spectrum estimation for item sequences added
+            2026.10.14 functions psp_save() and psp_load() added
 ----------------------------------------------------------------------*/
 #ifndef __PATSPEC__
 #define __PATSPEC__
@@ -160,6 +161,10 @@ extern int      psp_setfrq  (PATSPEC *psp, ITEM size, RSUPP supp,
 extern int      psp_incfrq  (PATSPEC *psp, ITEM size, RSUPP supp,
                              size_t frq);
 extern int      psp_addpsp  (PATSPEC *dst, PATSPEC *src);
+extern int      psp_save    (PATSPEC *psp, const char *fname,
+                             size_t cnt);
+extern int      psp_load    (PATSPEC **psp, const char *fname,
+                             size_t *cnt);
 #ifdef PSP_ESTIM
 extern int      psp_tbgest  (TABAG *tabag, PATSPEC *psp, size_t eqsur,
                              double alpha, size_t smpls);
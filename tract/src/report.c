@@ -74,6 +74,13 @@
             2016.10.14 function isr_size() added (item array size)
             2016.10.14 bugs in array/memory sizes for sequences fixed
             2017.05.30 optional compression with zlib library added
+            2026.10.14 functions isr_clone() and isr_merge() added
+            2026.10.14 binary output mode and decoder (isrdec) added
+            2026.10.14 asynchronous output with a writer thread added
+            2026.10.14 top-k item set collection added (isr_settopk())
+            2026.10.14 generator repository with open addressing
+            2026.10.14 number of output bytes counted (isr_nbytes())
+            2026.10.14 formatted object names copied in isr_createx()
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -81,10 +88,21 @@
 #include <float.h>
 #include <assert.h>
 #include <math.h>
+#ifdef ISR_MAIN
+#include <time.h>
+#endif
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 #include "report.h"
 #ifndef ISR_NONAMES
 #include "scanner.h"
 #endif
+#ifdef ISR_MAIN
+#include "error.h"
+#endif
 #ifdef STORAGE
 #include "storage.h"
 #endif
@@ -105,8 +123,74 @@
 #define BS_WRITE    (64*1024)   /* size of internal write buffer */
 #define BS_INT         48       /* buffer size for integer output */
 #define BS_FLOAT       96       /* buffer size for float   output */
+#define BS_ASYNC        4       /* number of buffers of async. writer */
 #define LN_2        0.69314718055994530942  /* ln(2) */
 
+/* --- binary output format --- */
+#define BIN_VERSION     1       /* version of the binary format */
+#define BIN_DELTA    0x01       /* flag for delta-encoded items */
+#define BIN_DBLSUPP  0x02       /* flag for double precision support */
+#define BIN_SET         0       /* record type: item set */
+#define BIN_WSET        1       /* record type: item set with weights */
+#define BIN_RULE        2       /* record type: association rule */
+#define BIN_SEQRULE     3       /* record type: sequence rule */
+#define BIN_EXTRULE     4       /* record type: extended seq. rule */
+#define BIN_TYPEMASK 0x07       /* mask for the record type */
+#define BIN_VALUES   0x08       /* flag for weight/evaluation values */
+#define BIN_TYPES       4       /* number of bits for type and flag */
+#define BIN_SVALS(w,e) ((((w) != 0) || ((e) != 0)) ? BIN_VALUES : 0)
+#define BIN_RVALS(e)   (((e) != 0) ? BIN_VALUES : 0)
+#define BIN_SPACE      16       /* space needed for a single number */
+
+/* --- thread definitions --- */
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#define THREAD       HANDLE     /* threads identified by handles */
+#define THREAD_OK    0          /* return value is DWORD */
+#define WORKERDEF(n,p)  DWORD WINAPI n (LPVOID p)
+#define MUTEX        CRITICAL_SECTION
+#define COND         CONDITION_VARIABLE
+#define LOCK(m)      EnterCriticalSection(&(m))
+#define UNLOCK(m)    LeaveCriticalSection(&(m))
+#define WAIT(c,m)    SleepConditionVariableCS(&(c), &(m), INFINITE)
+#define SIGNAL(c)    WakeConditionVariable(&(c))
+#else                           /* if Linux/Unix system */
+#define THREAD       pthread_t  /* use the POSIX thread type */
+#define THREAD_OK    NULL       /* return value is void* */
+#define WORKERDEF(n,p)  void*        n (void* p)
+#define MUTEX        pthread_mutex_t
+#define COND         pthread_cond_t
+#define LOCK(m)      pthread_mutex_lock(&(m))
+#define UNLOCK(m)    pthread_mutex_unlock(&(m))
+#define WAIT(c,m)    pthread_cond_wait(&(c), &(m))
+#define SIGNAL(c)    pthread_cond_signal(&(c))
+#endif                          /* (mutex and condition variable) */
+
+#ifdef ISR_MAIN
+#define PRGNAME     "isrdec"
+#define DESCRIPTION "decode binary item set/rule/transaction id output"
+#define VERSION     "version 1.0 (2026.10.14)"
+
+/* --- error codes --- */
+/* error codes   0 to  -4 defined in tract.h */
+#define E_STDIN      (-5)       /* double assignment of stdin */
+#define E_OPTION     (-6)       /* unknown option */
+#define E_OPTARG     (-7)       /* missing option argument */
+#define E_ARGCNT     (-8)       /* too few/many arguments */
+#define E_FORMAT     (-9)       /* invalid binary format */
+
+#define BS_READ     (64*1024)   /* size of internal read buffer */
+
+#ifndef QUIET                   /* if not quiet version, */
+#define MSG         fprintf     /* print messages */
+#define CLOCK(t)    ((t) = clock())
+#else                           /* if quiet version, */
+#define MSG(...)    ((void)0)   /* suppress messages */
+#define CLOCK(t)    ((void)0)
+#endif
+
+#define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
+#endif
+
 /*----------------------------------------------------------------------
   Constants
 ----------------------------------------------------------------------*/
@@ -118,6 +202,251 @@ static const double pows[] = {  /* several powers of ten */
   1e+24, 1e+25, 1e+26, 1e+27, 1e+28, 1e+29, 1e+30, 1e+31,
   1e+32, 1e+33 };
 
+#ifdef ISR_MAIN
+static CCHAR *errmsgs[] = {     /* error messages */
+  /* E_NONE      0 */  "no error",
+  /* E_NOMEM    -1 */  "not enough memory",
+  /* E_FOPEN    -2 */  "cannot open file %s",
+  /* E_FREAD    -3 */  "read error on file %s",
+  /* E_FWRITE   -4 */  "write error on file %s",
+  /* E_STDIN    -5 */  "double assignment of standard input",
+  /* E_OPTION   -6 */  "unknown option -%c",
+  /* E_OPTARG   -7 */  "missing option argument",
+  /* E_ARGCNT   -8 */  "wrong number of arguments",
+  /* E_FORMAT   -9 */  "invalid binary format in file %s",
+  /*           -10 */  "unknown error"
+};
+#endif
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+struct isrwriter {              /* --- asynchronous writer --- */
+  FILE     *file;               /* file to write to */
+  #ifdef USE_ZLIB               /* if optional output compression */
+  z_stream *zstm;               /* stream for compression (or NULL) */
+  UCHAR    *zbuf;               /* output buffer for compression */
+  #endif
+  int      head;                /* index of next buffer to write */
+  int      full;                /* number of filled buffers */
+  int      quit;                /* flag for terminating the thread */
+  MUTEX    mutex;               /* mutex for the buffer ring */
+  COND     cond;                /* signaled if 'full' changes */
+  THREAD   thread;              /* writer thread (drains buffers) */
+  char     *bufs [BS_ASYNC];    /* ring of write buffers */
+  size_t   lens [BS_ASYNC];     /* numbers of characters to write */
+  int      flush[BS_ASYNC];     /* flush modes for compression */
+};                              /* (asynchronous writer) */
+
+typedef struct {                /* --- collected (top-k) item set --- */
+  RSUPP    supp;                /* support of the item set */
+  double   wgt;                 /* weight of the item set */
+  double   eval;                /* additional evaluation value */
+  ITEM     cnt;                 /* number of items in the set */
+  ITEM     items[1];            /* items in the set (report order) */
+} TOPKSET;                      /* (collected item set) */
+
+struct isrtopk {                /* --- top-k item set collector --- */
+  size_t   max;                 /* maximum number of item sets (k) */
+  size_t   cnt;                 /* current number of item sets */
+  int      err;                 /* error status (memory error) */
+  TOPKSET  **sets;              /* heap of item sets (min. support) */
+};                              /* (top-k item set collector) */
+
+#ifdef ISR_MAIN
+typedef struct {                /* --- binary output reader --- */
+  FILE     *file;               /* file to read from */
+  CCHAR    *name;               /* name of the input file */
+  UCHAR    *buf;                /* read buffer (decompressed data) */
+  UCHAR    *next;               /* next byte to read */
+  UCHAR    *end;                /* end of the read data */
+  #ifdef USE_ZLIB               /* if optional decompression */
+  int      zlib;                /* whether input is compressed */
+  z_stream zstm;                /* stream for decompression */
+  UCHAR    *zbuf;               /* input buffer for decompression */
+  #endif
+} BINREAD;                      /* (binary output reader) */
+
+/*----------------------------------------------------------------------
+  Global Variables
+----------------------------------------------------------------------*/
+#ifndef QUIET
+static CCHAR   *prgname;        /* program name for error messages */
+#endif
+static BINREAD *bread  = NULL;  /* binary output reader */
+static FILE    *out    = NULL;  /* decoded output file */
+static char    *names  = NULL;  /* item names (from file header) */
+static CCHAR   **inames = NULL; /* item name array */
+static ITEM    *items  = NULL;  /* item buffer for a record */
+static double  *iwgts  = NULL;  /* item weight buffer for a record */
+#endif
+
+/*----------------------------------------------------------------------
+  Asynchronous Output Functions
+----------------------------------------------------------------------*/
+/* With the mode ISR_ASYNC, a full write buffer is not written to the */
+/* output file directly, but handed to a writer thread, which drains  */
+/* it (and compresses it, if requested) while the mining recursion    */
+/* fills another buffer. Since the ring of buffers has a fixed size,  */
+/* the miner waits if all buffers are full (bounded backpressure).    */
+/*--------------------------------------------------------------------*/
+
+static void wrt_write (ISRWRITER *wrt, const char *buf, size_t n,
+                       int flush)
+{                               /* --- write a buffer to the file */
+  assert(wrt && buf);           /* check the function arguments */
+  #ifdef USE_ZLIB               /* if optional output compression */
+  if (wrt->zstm) {              /* if to compress the output */
+    wrt->zstm->next_in  = (UCHAR*)buf;
+    wrt->zstm->avail_in = (unsigned)n;
+    do {                        /* compress and write output */
+      wrt->zstm->avail_out = BS_WRITE;
+      wrt->zstm->next_out  = wrt->zbuf;
+      deflate(wrt->zstm, flush);
+      n = (size_t)BS_WRITE -wrt->zstm->avail_out;
+      fwrite(wrt->zbuf, sizeof(UCHAR), n, wrt->file);
+    } while (wrt->zstm->avail_out == 0);
+  } else                        /* while output buffer becomes empty */
+  #endif                        /* (i.e. more data can be compressed) */
+  fwrite(buf, sizeof(char), n, wrt->file);
+  #ifndef NDEBUG                /* in debug mode */
+  fflush(wrt->file);            /* flush the output buffer */
+  #endif                        /* after every write operation */
+}  /* wrt_write() */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(writer, p)
+{                               /* --- writer thread function */
+  ISRWRITER *wrt = (ISRWRITER*)p;  /* asynchronous writer */
+  int       i;                  /* index of the buffer to write */
+
+  assert(p);                    /* check the function argument */
+  LOCK(wrt->mutex);             /* lock the buffer ring */
+  while (1) {                   /* buffer write loop */
+    while ((wrt->full <= 0) && !wrt->quit)
+      WAIT(wrt->cond, wrt->mutex);  /* wait for a filled buffer */
+    if (wrt->full <= 0) break;  /* if all buffers are written, abort */
+    i = wrt->head;              /* get the next buffer to write */
+    UNLOCK(wrt->mutex);         /* (buffer stays in the ring) */
+    wrt_write(wrt, wrt->bufs[i], wrt->lens[i], wrt->flush[i]);
+    LOCK(wrt->mutex);           /* write buffer without the lock */
+    wrt->head = (i+1) % BS_ASYNC;
+    wrt->full--;                /* release the written buffer */
+    SIGNAL(wrt->cond);          /* and wake up a waiting miner */
+  }
+  UNLOCK(wrt->mutex);           /* unlock the buffer ring */
+  return THREAD_OK;             /* return a dummy result */
+}  /* writer() */
+
+/*--------------------------------------------------------------------*/
+
+static void wrt_free (ISRWRITER *wrt)
+{                               /* --- free the writer's memory */
+  int i;                        /* loop variable */
+
+  assert(wrt);                  /* check the function argument */
+  for (i = 0; i < BS_ASYNC; i++)
+    if (wrt->bufs[i]) free(wrt->bufs[i]);
+  #ifdef USE_ZLIB               /* if optional output compression */
+  if (wrt->zbuf) free(wrt->zbuf);
+  #endif                        /* delete the compression buffer */
+  free(wrt);                    /* delete the base structure */
+}  /* wrt_free() */
+
+/*--------------------------------------------------------------------*/
+
+static void wrt_delete (ISRWRITER *wrt)
+{                               /* --- delete an asynchronous writer */
+  assert(wrt);                  /* check the function argument */
+  LOCK(wrt->mutex);             /* tell the writer thread to */
+  wrt->quit = 1;                /* terminate after it has written */
+  SIGNAL(wrt->cond);            /* all buffers that are still full */
+  UNLOCK(wrt->mutex);
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  WaitForSingleObject(wrt->thread, INFINITE);
+  CloseHandle(wrt->thread);     /* wait for the writer thread */
+  DeleteCriticalSection(&wrt->mutex);
+  #else                         /* if Linux/Unix system */
+  pthread_join(wrt->thread, NULL);
+  pthread_cond_destroy (&wrt->cond);
+  pthread_mutex_destroy(&wrt->mutex);
+  #endif                        /* destroy the synchronization */
+  wrt_free(wrt);                /* delete the write buffers */
+}  /* wrt_delete() */
+
+/*--------------------------------------------------------------------*/
+
+#ifdef USE_ZLIB
+static ISRWRITER* wrt_create (FILE *file, z_stream *zstm)
+#else
+static ISRWRITER* wrt_create (FILE *file)
+#endif
+{                               /* --- create an asynchronous writer */
+  ISRWRITER *wrt;               /* created asynchronous writer */
+  int       i;                  /* loop variable, thread result */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  DWORD     thid;               /* dummy for storing the thread id */
+  #endif                        /* (not really needed here) */
+
+  assert(file);                 /* check the function argument */
+  wrt = (ISRWRITER*)calloc(1, sizeof(ISRWRITER));
+  if (!wrt) return NULL;        /* create the base structure */
+  wrt->file = file;             /* and note the output file */
+  for (i = 0; i < BS_ASYNC; i++) {
+    wrt->bufs[i] = (char*)malloc(BS_WRITE *sizeof(char));
+    if (!wrt->bufs[i]) { wrt_free(wrt); return NULL; }
+  }                             /* create the ring of write buffers */
+  #ifdef USE_ZLIB               /* if optional output compression */
+  wrt->zstm = zstm;             /* note the compression stream */
+  if (zstm) {                   /* if to compress the output */
+    wrt->zbuf = (UCHAR*)malloc(BS_WRITE *sizeof(UCHAR));
+    if (!wrt->zbuf) { wrt_free(wrt); return NULL; }
+  }                             /* create a compression buffer */
+  #endif                        /* (own buffer for each writer) */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  InitializeCriticalSection(&wrt->mutex);
+  InitializeConditionVariable(&wrt->cond);
+  wrt->thread = CreateThread(NULL, 0, writer, wrt, 0, &thid);
+  i = (wrt->thread) ? 0 : -1;   /* start the writer thread */
+  if (i != 0) DeleteCriticalSection(&wrt->mutex);
+  #else                         /* if Linux/Unix system */
+  pthread_mutex_init(&wrt->mutex, NULL);
+  pthread_cond_init (&wrt->cond,  NULL);
+  i = pthread_create(&wrt->thread, NULL, writer, wrt);
+  if (i != 0) {                 /* start the writer thread */
+    pthread_cond_destroy (&wrt->cond);
+    pthread_mutex_destroy(&wrt->mutex);
+  }                             /* on failure destroy */
+  #endif                        /* the synchronization objects */
+  if (i != 0) { wrt_free(wrt); return NULL; }
+  return wrt;                   /* return the created writer */
+}  /* wrt_create() */
+
+/*--------------------------------------------------------------------*/
+
+static char* wrt_put (ISRWRITER *wrt, char *buf, char *end, int flush)
+{                               /* --- hand a buffer to the writer */
+  int  i;                       /* index of the ring buffer */
+  char *e;                      /* empty buffer to return */
+
+  assert(wrt && buf && (end >= buf));  /* check the arguments */
+  LOCK(wrt->mutex);             /* lock the buffer ring */
+  while (wrt->full >= BS_ASYNC) /* while all buffers are full, */
+    WAIT(wrt->cond, wrt->mutex);/* wait for the writer thread */
+  i = (wrt->head +wrt->full) % BS_ASYNC;
+  e = wrt->bufs[i];             /* exchange the given buffer */
+  wrt->bufs [i] = buf;          /* with an empty ring buffer */
+  wrt->lens [i] = (size_t)(end -buf);
+  wrt->flush[i] = flush;        /* note what is to be written */
+  wrt->full++;                  /* count the filled buffer and */
+  SIGNAL(wrt->cond);            /* wake up the writer thread */
+  UNLOCK(wrt->mutex);           /* unlock the buffer ring */
+  return e;                     /* return the empty buffer */
+}  /* wrt_put() */
+
+/*--------------------------------------------------------------------*/
+
 /*----------------------------------------------------------------------
   Basic Output Functions
 ----------------------------------------------------------------------*/
@@ -127,12 +456,14 @@ static void fastchk (ISREPORT *rep)
   if (rep->border               /* if there is a filtering border */
   ||  rep->repofn               /* or a report function */
   ||  rep->evalfn               /* or an evaluation function */
+  ||  rep->topk                 /* or the best sets are collected */
   ||  rep->tidfile)             /* or trans ids. are to be written, */
     rep->fast =  0;             /* standard output has to be used */
   else if (!rep->file)          /* if no output (and no filtering), */
     rep->fast = -1;             /* only count the item sets */
   else {                        /* if only an output file is written */
-    rep->fast = ((rep->zmin <= 1) && (rep->zmax >= ITEM_MAX)
+    rep->fast = (!(rep->mode & ISR_BINARY)
+              &&  (rep->zmin <= 1) && (rep->zmax >= ITEM_MAX)
               && ((strcmp(rep->info, " (%a)") == 0)
               ||  (strcmp(rep->info, " (%d)") == 0))
               &&  (strcmp(rep->hdr,  "")      == 0)
@@ -168,6 +499,16 @@ static void isr_flush (ISREPORT *rep)
 #endif
 {                               /* --- flush the output buffer */
   assert(rep);                  /* check the function arguments */
+  rep->nbytes += (size_t)(rep->next -rep->buf);
+  if (rep->wrt) {               /* if to write asynchronously */
+    #ifdef USE_ZLIB             /* if optional output compression */
+    rep->buf = wrt_put(rep->wrt, rep->buf, rep->next, flush);
+    #else                       /* hand the buffer to the writer */
+    rep->buf = wrt_put(rep->wrt, rep->buf, rep->next, 0);
+    #endif                      /* and get an empty buffer back */
+    rep->end = (rep->next = rep->buf) +BS_WRITE;
+    return;                     /* set the buffer pointers */
+  }                             /* and abort the function */
   #ifdef USE_ZLIB               /* if optional output compression */
   if (rep->mode & ISR_ZLIB) {   /* if to compress the output */
     size_t n;                   /* number of bytes to write */
@@ -407,6 +748,15 @@ static void isr_tidflush (ISREPORT *rep)
 #endif
 {                               /* --- flush the output buffer */
   assert(rep);                  /* check the function arguments */
+  if (rep->tidwrt) {            /* if to write asynchronously */
+    #ifdef USE_ZLIB             /* if optional output compression */
+    rep->tidbuf = wrt_put(rep->tidwrt, rep->tidbuf, rep->tidnxt, flush);
+    #else                       /* hand the buffer to the writer */
+    rep->tidbuf = wrt_put(rep->tidwrt, rep->tidbuf, rep->tidnxt, 0);
+    #endif                      /* and get an empty buffer back */
+    rep->tidend = (rep->tidnxt = rep->tidbuf) +BS_WRITE;
+    return;                     /* set the buffer pointers */
+  }                             /* and abort the function */
   #ifdef USE_ZLIB               /* if optional output compression */
   if (rep->mode & ISR_ZLIB) {   /* if to compress the output */
     size_t n;                   /* number of bytes to write */
@@ -510,39 +860,234 @@ static void isr_occout (ISREPORT *rep, ITEM occ)
   isr_tidputsn(rep, buf+i, BS_INT-i);      /* print the digits */
 }  /* isr_occout() */
 
+/*----------------------------------------------------------------------
+  Binary Output Functions
+----------------------------------------------------------------------*/
+/* In binary mode (ISR_BINARY) the output file starts with the magic */
+/* bytes "ISRB", a version byte, a flag byte (BIN_DELTA, BIN_DBLSUPP) */
+/* and the item names (number of names, then length and characters */
+/* of each name). Each record starts with a number that combines the */
+/* number of items n and the record type as (n << BIN_TYPES) | type, */
+/* where the type may carry the flag BIN_VALUES, which indicates that */
+/* weight and evaluation are given (all zero otherwise, not written). */
+/* With delta encoding (ISR_DELTA) the number of leading items that */
+/* are shared with the preceding record follows, and only the other */
+/* items are written. Rules list the head first, sequence rules have */
+/* the (first and second) head(s) at the end. Item sets are followed */
+/* by support (and weight and evaluation), (sequence) rules by their */
+/* support, body and head support (and evaluation), extended sequence */
+/* rules by their six support values. A transaction id file starts with "ISRT", */
+/* a version byte and a flag byte, and each of its records consists */
+/* of the number of ids n as (n << 1) | occflag, followed by the ids */
+/* (one-based, as in text output; with delta encoding the differences */
+/* to the preceding id), each followed by an item occurrence counter */
+/* if occflag is set. Integer numbers as well as integer support */
+/* values are written in 7-bit groups, with the highest bit set for */
+/* all but the last group, floating point values as 8 bytes in little */
+/* endian order. Records do not refer to data before the last header, */
+/* so that the output of cloned reporters can simply be appended. */
+
+static int isr_binnum (ISREPORT *rep, size_t num)
+{                               /* --- write a variable length number */
+  char *s;                      /* to traverse the output buffer */
+  int  n;                       /* number of written bytes */
+
+  assert(rep);                  /* check the function arguments */
+  if (rep->end -rep->next < BIN_SPACE)
+    isr_flush(rep);             /* ensure space in the buffer */
+  for (s = rep->next; num >= 0x80; num >>= 7)
+    *s++ = (char)((num & 0x7f) | 0x80);
+  *s++ = (char)num;             /* store the 7-bit groups */
+  n = (int)(s -rep->next);      /* compute the number of bytes */
+  rep->next = s; return n;      /* advance the buffer pointer and */
+}  /* isr_binnum() */           /* return the number of bytes */
+
+/*--------------------------------------------------------------------*/
+
+static int isr_bindbl (ISREPORT *rep, double num)
+{                               /* --- write a floating point number */
+  unsigned long long b;         /* bit pattern of the number */
+  int                i;         /* loop variable */
+
+  assert(rep);                  /* check the function arguments */
+  if (rep->end -rep->next < BIN_SPACE)
+    isr_flush(rep);             /* ensure space in the buffer */
+  memcpy(&b, &num, sizeof(b));  /* get the bit pattern and */
+  for (i = 0; i < 8; i++) {     /* store it in little endian order */
+    *rep->next++ = (char)(b & 0xff); b >>= 8; }
+  return 8;                     /* return the number of bytes */
+}  /* isr_bindbl() */
+
+/*--------------------------------------------------------------------*/
+
+static int isr_binsupp (ISREPORT *rep, RSUPP supp)
+{                               /* --- write a support value */
+  #define int    1              /* to check definition of RSUPP */
+  #define double 2              /* for double precision type */
+  #if RSUPP==double
+  #undef int
+  #undef double
+  return isr_bindbl(rep, supp); /* write double support directly */
+  #else
+  #undef int
+  #undef double
+  assert(supp >= 0);            /* write integer support */
+  return isr_binnum(rep, (size_t)supp);
+  #endif                        /* as a variable length number */
+}  /* isr_binsupp() */
+
+/*--------------------------------------------------------------------*/
+
+static int isr_binhdr (ISREPORT *rep)
+{                               /* --- write header of binary output */
+  ITEM       i, n;              /* loop variable, number of items */
+  int        f = 0;             /* flags of the binary format */
+  size_t     k;                 /* length of an item name */
+  const char *name;             /* to traverse the item names */
+
+  assert(rep);                  /* check the function arguments */
+  if (!rep->bprv) {             /* if there is no record buffer */
+    rep->bprv = (ITEM*)malloc((size_t)(rep->size+3) *2 *sizeof(ITEM));
+    if (!rep->bprv) return E_NOMEM;
+    rep->bcur = rep->bprv +rep->size+3;
+  }                             /* create buffers for delta coding */
+  rep->bcnt = 0;                /* there is no preceding record */
+  if (rep->mode & ISR_DELTA) f |= BIN_DELTA;
+  #define int    1              /* to check definition of RSUPP */
+  #define double 2              /* for double precision type */
+  #if RSUPP==double
+  f |= BIN_DBLSUPP;             /* note support value type */
+  #endif
+  #undef int
+  #undef double
+  isr_putsn(rep, "ISRB", 4);    /* write the magic bytes */
+  isr_putc (rep, BIN_VERSION);  /* and the format version */
+  isr_putc (rep, f);            /* write the format flags */
+  n = ib_cnt(rep->base);        /* get the number of items */
+  isr_binnum(rep, (size_t)n);   /* and write the item names */
+  for (i = 0; i < n; i++) {     /* traverse the items */
+    name = rep->inames[i]; if (!name) name = "";
+    k = strlen(name);           /* get the item name and its length */
+    isr_binnum(rep, k);         /* write the name length */
+    isr_putsn (rep, name, (int)k);
+  }                             /* write the name characters */
+  return 0;                     /* return 'ok' */
+}  /* isr_binhdr() */
+
+/*--------------------------------------------------------------------*/
+
+static void isr_binrec (ISREPORT *rep, int type,
+                        const ITEM *items, ITEM n)
+{                               /* --- write start of binary record */
+  ITEM i, k = 0;                /* loop variable, shared prefix */
+
+  assert(rep && (items || (n <= 0)));  /* check the arguments */
+  isr_binnum(rep, ((size_t)n << BIN_TYPES) | (size_t)type);
+  if (rep->mode & ISR_DELTA) {  /* if to write only new items */
+    while ((k < n) && (k < rep->bcnt) && (items[k] == rep->bprv[k]))
+      k++;                      /* find the shared item prefix */
+    isr_binnum(rep, (size_t)k); /* write its length */
+    if (items != rep->bprv)     /* and note the current items */
+      memcpy(rep->bprv, items, (size_t)n *sizeof(ITEM));
+    rep->bcnt = n;              /* (for the next record) */
+  }
+  for (i = k; i < n; i++)       /* write the (new) items */
+    isr_binnum(rep, (size_t)items[i]);
+}  /* isr_binrec() */
+
+/*--------------------------------------------------------------------*/
+
+static void isr_tidbnum (ISREPORT *rep, size_t num)
+{                               /* --- write a variable length number */
+  assert(rep);                  /* check the function arguments */
+  if (rep->tidend -rep->tidnxt < BIN_SPACE)
+    isr_tidflush(rep);          /* ensure space in the buffer */
+  for ( ; num >= 0x80; num >>= 7)
+    *rep->tidnxt++ = (char)((num & 0x7f) | 0x80);
+  *rep->tidnxt++ = (char)num;   /* store the 7-bit groups */
+}  /* isr_tidbnum() */
+
+/*--------------------------------------------------------------------*/
+
+static void isr_tidbhdr (ISREPORT *rep)
+{                               /* --- write header of binary tid file */
+  assert(rep);                  /* check the function arguments */
+  isr_tidputsn(rep, "ISRT", 4); /* write the magic bytes */
+  isr_tidputc (rep, BIN_VERSION);            /* the format version */
+  isr_tidputc (rep, (rep->mode & ISR_DELTA) ? BIN_DELTA : 0);
+}  /* isr_tidbhdr() */          /* and the format flags */
+
+/*--------------------------------------------------------------------*/
+
+static void isr_tidbin (ISREPORT *rep)
+{                               /* --- write binary trans. id list */
+  TID  k, n;                    /* loop variable, number of ids */
+  TID  p = 0;                   /* preceding transaction id */
+  ITEM min;                     /* minimum number of items */
+  int  d;                       /* flag for delta encoding */
+
+  assert(rep && rep->tids);     /* check the function arguments */
+  d = ((rep->mode & ISR_DELTA) != 0);
+  if      (rep->tidcnt > 0) {   /* if tids are in ascending order */
+    isr_tidbnum(rep, (size_t)rep->tidcnt << 1);
+    for (k = 0; k < rep->tidcnt; k++) {
+      isr_tidbnum(rep, (size_t)(rep->tids[k]+1 -p));
+      if (d) p = rep->tids[k]+1;/* write the transaction ids */
+    } }                         /* (possibly as differences) */
+  else if (rep->tidcnt < 0) {   /* if tids are in descending order */
+    isr_tidbnum(rep, (size_t)-rep->tidcnt << 1);
+    for (k = -rep->tidcnt; k > 0; ) {
+      isr_tidbnum(rep, (size_t)(rep->tids[--k]+1 -p));
+      if (d) p = rep->tids[k]+1;/* write the transaction ids */
+    } }                         /* (possibly as differences) */
+  else if (rep->tracnt > 0) {   /* if item occurrence counters */
+    min = (ITEM)(rep->cnt-rep->miscnt);
+    for (n = k = 0; k < rep->tracnt; k++)
+      if (rep->occs[k] >= min) n++;
+    isr_tidbnum(rep, ((size_t)n << 1) | (size_t)(rep->miscnt > 0));
+    for (k = 0; k < rep->tracnt; k++) {
+      if (rep->occs[k] < min)   /* skip all transactions that */
+        continue;               /* do not contain enough items */
+      isr_tidbnum(rep, (size_t)(k+1 -p));
+      if (d) p = k+1;           /* write the transaction identifier */
+      if (rep->miscnt > 0)      /* if missing items are accepted, */
+        isr_tidbnum(rep, (size_t)rep->occs[k]);
+    } }                         /* write number of contained items */
+  else                          /* if there are no transaction ids, */
+    isr_tidbnum(rep, 0);        /* write an empty list */
+}  /* isr_tidbin() */
+
 /*----------------------------------------------------------------------
   Generator Filtering Functions
 ----------------------------------------------------------------------*/
 #ifdef ISR_CLOMAX
 
+static size_t is_ihash (ITEM item)
+{                               /* --- compute item hash value */
+  size_t h = (size_t)item;      /* get the item as a hash value */
+  h ^= h >> 16; h *= (size_t)0x45d9f3bUL;
+  h ^= h >> 16; h *= (size_t)0x45d9f3bUL;
+  return h ^ (h >> 16);         /* mix the bits of the item */
+}  /* is_ihash() */
+
+/*--------------------------------------------------------------------*/
+
 static size_t is_hash (const void *set, int type)
 {                               /* --- compute item set hash value */
-  size_t     i;                 /* loop variable */
+  ITEM       n;                 /* number of items */
   size_t     h;                 /* computed hash value */
   const ITEM *p;                /* to access the items */
 
   assert(set);                  /* check the function argument */
   p = (const ITEM*)set;         /* type the item set pointer */
-  h = (size_t)*p++;             /* get the number of items */
-  i = (h >> 3) +1;              /* use Duff's device */
-  switch (h & 7) {              /* to compute the hash value */
-    do {    h = h *251 +(size_t)*p++;
-    case 7: h = h *251 +(size_t)*p++;
-    case 6: h = h *251 +(size_t)*p++;
-    case 5: h = h *251 +(size_t)*p++;
-    case 4: h = h *251 +(size_t)*p++;
-    case 3: h = h *251 +(size_t)*p++;
-    case 2: h = h *251 +(size_t)*p++;
-    case 1: h = h *251 +(size_t)*p++;
-    case 0: ; } while (--i > 0);
-  }                             /* semicolon is necessary */
+  h = (size_t)(n = *p++);       /* get the number of items */
+  while (--n >= 0)              /* sum the hash values */
+    h += is_ihash(*p++);        /* of the individual items */
   return h;                     /* return the computed hash value */
-  /* This hash function treats an item set like a string, that is, */
-  /* the hash code depends on the order of the items. This is no   */
-  /* drawback, though, because the comparison also requires that   */
-  /* the items are in the same order in the item sets to compare.  */
-  /* However, an order-independent hash code could be used to make */
-  /* the function is_isgen() faster by avoiding recomputations.    */
+  /* This hash function is independent of the order of the items, */
+  /* so that the hash values of the subsets with one item less     */
+  /* can be computed from the hash value of the set by subtracting */
+  /* the hash value of the removed item (see is_isgen()).          */
 }  /* is_hash() */
 
 /*--------------------------------------------------------------------*/
@@ -570,23 +1115,30 @@ static int is_isgen (ISREPORT *rep, ITEM item, RSUPP supp)
 {                               /* --- check for a generator */
   ITEM   i;                     /* loop variable */
   size_t z;                     /* key size */
+  size_t h;                     /* hash value of the new item set */
   ITEM   *p;                    /* to access the hash table key */
   RSUPP  *s;                    /* to access the hash table data */
   ITEM   a, b;                  /* buffers for items (hold-out) */
 
   assert(rep && (item >= 0));   /* check the function arguments */
   rep->iset[rep->cnt+1] = item; /* store the new item at the end */
+  h = (size_t)(rep->cnt+1) +is_ihash(item);
   if (rep->cnt > 0) {           /* if the current set is not empty */
     rep->iset[0] = rep->cnt;    /* copy the item set to the buffer */
     p = (ITEM*)memcpy(rep->iset+1, rep->items,
                       (size_t)rep->cnt *sizeof(ITEM));
+    for (i = 0; i < rep->cnt; i++)
+      h += is_ihash(p[i]);      /* compute the item set hash value */
+    for (i = 0; i < rep->cnt; i++)   /* prefetch the slots of */
+      st_prefetch(rep->gentab, h -1 -is_ihash(p[i]));  /* subsets */
     if (rep->mode & ISR_SORT)   /* sort the items according to code */
       ia_qsort(p, (size_t)rep->cnt+1, rep->dir);
     a = p[i = rep->cnt];        /* note the first hold-out item */
     for (++i; --i >= 0; ) {     /* traverse the items in the set */
       b = p[i]; p[i] = a; a = b;/* get next subset (next hold-out) */
       if (a == item) continue;  /* do not exclude the new item */
-      s = (RSUPP*)st_lookup(rep->gentab, rep->iset, 0);
+      s = (RSUPP*)st_lookupx(rep->gentab, rep->iset, 0,
+                             h -1 -is_ihash(a));
       if (!s || (*s == supp))   /* if a subset with one item less */
         break;                  /* is not in the generator repository */
     }                           /* or has the same support, abort */
@@ -596,13 +1148,122 @@ static int is_isgen (ISREPORT *rep, ITEM item, RSUPP supp)
   }                             /* (with the proper item order) */
   rep->iset[0] = rep->cnt+1;    /* store the new item set size */
   z = (size_t)(rep->cnt+2) *sizeof(ITEM);  /* compute key size */
-  s = (RSUPP*)st_insert(rep->gentab, rep->iset, 0, z, sizeof(RSUPP));
+  s = (RSUPP*)st_insertx(rep->gentab, rep->iset, 0, z,
+                         sizeof(RSUPP), h);
   if (!s) return -1;            /* add the new set to the repository */
   *s = supp;                    /* and store its support as the data */
   return 1;                     /* return 'set is a generator' */
 }  /* is_isgen() */
 
 #endif
+/*----------------------------------------------------------------------
+  Top-k Item Set Functions
+----------------------------------------------------------------------*/
+
+static void tk_delete (ISRTOPK *tk)
+{                               /* --- delete a top-k collector */
+  size_t i;                     /* loop variable */
+
+  assert(tk);                   /* check the function argument */
+  for (i = 0; i < tk->cnt; i++) /* delete the collected item sets */
+    free(tk->sets[i]);          /* and the heap array */
+  free(tk->sets); free(tk);     /* and the base structure */
+}  /* tk_delete() */
+
+/*--------------------------------------------------------------------*/
+
+static ISRTOPK* tk_create (size_t k)
+{                               /* --- create a top-k collector */
+  ISRTOPK *tk;                  /* created top-k collector */
+
+  assert(k > 0);                /* check the function argument */
+  tk = (ISRTOPK*)malloc(sizeof(ISRTOPK));
+  if (!tk) return NULL;         /* create the base structure */
+  tk->sets = (TOPKSET**)malloc(k *sizeof(TOPKSET*));
+  if (!tk->sets) { free(tk); return NULL; }
+  tk->max = k;                  /* create the heap array and */
+  tk->cnt = 0;                  /* note the number of item sets */
+  tk->err = 0;                  /* clear the error status */
+  return tk;                    /* return the created collector */
+}  /* tk_create() */
+
+/*--------------------------------------------------------------------*/
+
+static void tk_sift (TOPKSET **heap, size_t i, size_t n)
+{                               /* --- let element sift down */
+  size_t  k;                    /* index of a child element */
+  TOPKSET *t;                   /* element to sift down */
+
+  assert(heap && (i < n));      /* check the function arguments */
+  t = heap[i];                  /* note the sift element */
+  while ((k = i+i+1) < n) {     /* while there are children */
+    if ((k+1 < n) && (heap[k+1]->supp < heap[k]->supp))
+      k += 1;                   /* get the child with smaller support */
+    if (heap[k]->supp >= t->supp)
+      break;                    /* if heap condition holds, abort */
+    heap[i] = heap[k]; i = k;   /* move the child up and */
+  }                             /* continue at its position */
+  heap[i] = t;                  /* store the sift element */
+}  /* tk_sift() */
+
+/*--------------------------------------------------------------------*/
+
+static int tk_add (ISRTOPK *tk, const ITEM *items, ITEM n,
+                   RSUPP supp, double wgt, double eval)
+{                               /* --- add an item set to collector */
+  size_t  i, k;                 /* heap indices */
+  TOPKSET *t;                   /* item set to store */
+
+  assert(tk && (items || (n <= 0)));  /* check the function args. */
+  if (tk->cnt < tk->max) {      /* if the heap is not yet full */
+    t = (TOPKSET*)malloc(sizeof(TOPKSET)
+                        +(size_t)n *sizeof(ITEM));
+    if (!t) return -1; }        /* create a new item set */
+  else {                        /* if the heap is full */
+    if (supp <= tk->sets[0]->supp)
+      return 0;                 /* check against the smallest support */
+    t = (TOPKSET*)realloc(tk->sets[0], sizeof(TOPKSET)
+                                      +(size_t)n *sizeof(ITEM));
+    if (!t) return -1;          /* reuse the item set with */
+    tk->sets[0] = t;            /* the smallest support */
+  }                             /* (at the root of the heap) */
+  t->supp = supp;               /* store the item set information */
+  t->wgt  = wgt;
+  t->eval = eval;
+  t->cnt  = n;                  /* copy the items of the set */
+  memcpy(t->items, items, (size_t)n *sizeof(ITEM));
+  if (tk->cnt >= tk->max) {     /* if an item set was replaced, */
+    tk_sift(tk->sets, 0, tk->cnt); return 0; }   /* sift it down */
+  for (i = tk->cnt++; i > 0; i = k) {
+    k = (i-1) >> 1;             /* traverse the parent elements */
+    if (tk->sets[k]->supp <= supp) break;
+    tk->sets[i] = tk->sets[k];  /* while the heap condition does */
+  }                             /* not hold, move the parent down */
+  tk->sets[i] = t;              /* store the new item set */
+  return 0;                     /* return 'ok' */
+}  /* tk_add() */
+
+/*--------------------------------------------------------------------*/
+
+static void tk_raise (ISREPORT *rep)
+{                               /* --- raise the minimum support */
+  RSUPP s;                      /* smallest support in heap */
+
+  assert(rep && rep->topk);     /* check the function argument */
+  if (rep->topk->cnt < rep->topk->max)
+    return;                     /* check whether the heap is full */
+  s = rep->topk->sets[0]->supp +RSUPP_EPS;
+  if (s > rep->smin) rep->smin = s;
+}  /* tk_raise() */             /* set new minimum support */
+
+/* The collector is a binary min-heap w.r.t. the item set support,  */
+/* so that the item set with the smallest support is at the root.   */
+/* As soon as k item sets have been collected, an item set can only */
+/* enter the heap if its support exceeds the smallest support in    */
+/* the heap. Hence the minimum support of the reporter is raised to */
+/* this value, so that item sets that cannot enter are filtered out */
+/* early and miners can prune their search with isr_smin().         */
+
 /*----------------------------------------------------------------------
   Main Functions
 ----------------------------------------------------------------------*/
@@ -658,6 +1319,7 @@ ISREPORT* isr_createx (ITEMBASE *base, ITEM max)
   rep->inames  = (const char**)(rep->pos +k+1);
   rep->nmax    = rep->nsum = 0; /* clear maximum/sum of name lengths */
   rep->repcnt  = 0;             /* init. the item set counter */
+  rep->nbytes  = 0;             /* init. the output byte counter */
   rep->psp     = NULL;          /* clear pattern spectrum variable */
   rep->ints    = NULL;          /* clear pre-formatted integers */
   rep->imax    = -1;
@@ -667,6 +1329,8 @@ ISREPORT* isr_createx (ITEMBASE *base, ITEM max)
   rep->tidfile = NULL;          /* clear transaction id output file */
   rep->tidname = NULL;          /* and its name */
   rep->tidbuf  = rep->tidnxt = rep->tidend = NULL;
+  rep->wrt     = rep->tidwrt = NULL; /* no asynchronous writers */
+  rep->topk    = NULL;          /* no top-k item set collector */
   #ifdef USE_ZLIB               /* if to use optional compression */
   rep->zbuf    = NULL;          /* clear the compression buffer */
   #endif
@@ -678,6 +1342,8 @@ ISREPORT* isr_createx (ITEMBASE *base, ITEM max)
   rep->fast    = -1;            /* default: only count the item sets */
   rep->fosize  = 0;
   rep->out     = NULL;          /* there is no output buffer yet */
+  rep->bprv    = rep->bcur = NULL;
+  rep->bcnt    = 0;             /* no binary record buffers yet */
   rep->pxpp    = (ITEM*)  malloc((size_t)(k+k+k+2) *sizeof(ITEM));
   rep->iset    = (ITEM*)  malloc((size_t)(k+1)     *sizeof(ITEM));
   rep->supps   = (RSUPP*) malloc((size_t)(k+1)     *sizeof(RSUPP));
@@ -700,6 +1366,7 @@ ISREPORT* isr_createx (ITEMBASE *base, ITEM max)
   #ifndef ISR_NONAMES           /* if to use item names */
   for (rep->nmax = rep->nsum = 0, i = 0; i < n; i++) {
     name = ib_xname(base, i);   /* traverse items and their names */
+    buf  = NULL;                /* (no formatted copy made yet) */
     if (!rep->scan)             /* if to use items names directly, */
       m = strlen(name);         /* simply get their string lengths */
     else {                      /* if name formatting may be needed */
@@ -710,6 +1377,11 @@ ISREPORT* isr_createx (ITEMBASE *base, ITEM max)
         name = buf;             /* format the item name */
       }                         /* (quote certain characters) */
     }                           /* and replace the original name */
+    if (name && !buf && (name != ib_name(base, i))) {
+      buf = (char*)malloc((strlen(name)+1) *sizeof(char));
+      if (buf) strcpy(buf, name);
+      name = buf;               /* copy a formatted object pointer, */
+    }                           /* (ib_xname() reuses its buffer) */
     rep->nsum += m;             /* sum name size and find maximum */
     if (m > rep->nmax) rep->nmax = m;
     rep->inames[i] = name;      /* store the (formatted) item name */
@@ -727,6 +1399,8 @@ int isr_delete (ISREPORT *rep, int delis)
 
   assert(rep);                  /* check the function arguments */
   if (rep->out) free(rep->out); /* delete the item set output buffer */
+  if (rep->bprv)   free(rep->bprv);
+  if (rep->topk)   tk_delete(rep->topk);
   #ifdef ISR_CLOMAX             /* if closed/maximal filtering */
   if (rep->clomax) cm_delete(rep->clomax);
   if (rep->gentab) st_delete(rep->gentab);
@@ -784,7 +1458,8 @@ int isr_settarg (ISREPORT *rep, int target, int mode, int dir)
     if (target & ISR_GENERAS) { /* if to filter for generators, */
       size_t n = 1024*1024-1;   /* create an item set hash table */
       rep->gentab = st_create(n, 0, is_hash, is_cmp, NULL, (OBJFN*)0);
-      if (!rep->gentab) return E_NOMEM; }
+      if (!rep->gentab) return E_NOMEM;
+      if (st_setmode(rep->gentab, ST_OPENADR) != 0) return E_NOMEM; }
     else {                      /* if to filter for closed/maximal */
       rep->clomax = cm_create(dir, ib_cnt(rep->base));
       if (!rep->clomax) return E_NOMEM;
@@ -919,6 +1594,20 @@ void isr_setrule (ISREPORT *rep, ISRULEFN rulefn, void *data)
 
 /*--------------------------------------------------------------------*/
 
+int isr_settopk (ISREPORT *rep, size_t k)
+{                               /* --- set number of best item sets */
+  assert(rep);                  /* check the function argument */
+  if (rep->topk) { tk_delete(rep->topk); rep->topk = NULL; }
+  if (k > 0) {                  /* delete an existing collector */
+    rep->topk = tk_create(k);   /* and create a new one if needed */
+    if (!rep->topk) return E_NOMEM;
+  }                             /* (k = 0: report all item sets) */
+  fastchk(rep);                 /* check for fast output */
+  return 0;                     /* return 'ok' */
+}  /* isr_settopk() */
+
+/*--------------------------------------------------------------------*/
+
 int isr_prefmt (ISREPORT *rep, TID min, TID max)
 {                               /* --- pre-format transaction ids */
   TID  t, z;                    /* to traverse the integers to format */
@@ -994,6 +1683,17 @@ int isr_open (ISREPORT *rep, FILE *file, const char *name)
       return E_NOMEM;           /* initialize the compression */
   }                             /* (default method: deflate) */
   #endif
+  if (file && (rep->mode & ISR_ASYNC)) {
+    #ifdef USE_ZLIB             /* if optional output compression */
+    rep->wrt = wrt_create(file, (rep->mode & ISR_ZLIB)
+                              ? &rep->zsets : NULL);
+    #else                       /* (compression in writer thread) */
+    rep->wrt = wrt_create(file);
+    #endif                      /* create an asynchronous writer */
+    if (!rep->wrt) return E_NOMEM;
+  }                             /* (hand full buffers to a thread) */
+  if (file && (rep->mode & ISR_BINARY))
+    return isr_binhdr(rep);     /* write header of binary output */
   return 0;                     /* return 'ok' */
 }  /* isr_open() */
 
@@ -1006,6 +1706,10 @@ int isr_close (ISREPORT *rep)
   assert(rep);                  /* check the function arguments */
   if (!rep->file) return 0;     /* check for an output file */
   isr_finish(rep);              /* flush the write buffer */
+  if (rep->wrt) {               /* if asynchronous output, wait */
+    wrt_delete(rep->wrt);       /* for the writer thread and */
+    rep->wrt = NULL;            /* delete the writer */
+  }
   #ifdef USE_ZLIB               /* if optional output compression */
   if (rep->mode & ISR_ZLIB) deflateEnd(&rep->zsets);
   #endif                        /* clean up the compression stream */
@@ -1055,6 +1759,17 @@ int isr_tidopen (ISREPORT *rep, FILE *file, const char *name)
       return E_NOMEM;           /* initialize the compression */
   }                             /* (default method: deflate) */
   #endif
+  if (file && (rep->mode & ISR_ASYNC)) {
+    #ifdef USE_ZLIB             /* if optional output compression */
+    rep->tidwrt = wrt_create(file, (rep->mode & ISR_ZLIB)
+                                 ? &rep->ztids : NULL);
+    #else                       /* (compression in writer thread) */
+    rep->tidwrt = wrt_create(file);
+    #endif                      /* create an asynchronous writer */
+    if (!rep->tidwrt) return E_NOMEM;
+  }                             /* (hand full buffers to a thread) */
+  if (file && (rep->mode & ISR_BINARY))
+    isr_tidbhdr(rep);           /* write header of binary tid file */
   return 0;                     /* return 'ok' */
 }  /* isr_tidopen() */
 
@@ -1067,6 +1782,10 @@ int isr_tidclose (ISREPORT *rep)
   assert(rep);                  /* check the function arguments */
   if (!rep->tidfile) return 0;  /* check for an output file */
   isr_tidfinish(rep);           /* flush the write buffer */
+  if (rep->tidwrt) {            /* if asynchronous output, wait */
+    wrt_delete(rep->tidwrt);    /* for the writer thread and */
+    rep->tidwrt = NULL;         /* delete the writer */
+  }
   #ifdef USE_ZLIB               /* if optional output compression */
   if (rep->mode & ISR_ZLIB) deflateEnd(&rep->ztids);
   #endif                        /* clean up the compression stream */
@@ -1112,6 +1831,137 @@ int isr_setup (ISREPORT *rep)
 
 /*--------------------------------------------------------------------*/
 
+ISREPORT* isr_clone (ISREPORT *rep)
+{                               /* --- clone an item set reporter */
+  ISREPORT *dup;                /* created clone of the reporter */
+  ITEM     i;                   /* loop variable */
+  ITEM     *p;                  /* to traverse the perfect exts. */
+  int      mode;                /* reporting mode of the clone */
+  FILE     *file;               /* temporary output file */
+
+  assert(rep && (rep->cnt == 0));  /* check the function argument */
+  dup = isr_createx(rep->base, rep->size);
+  if (!dup) return NULL;        /* create a new item set reporter */
+  mode = rep->mode;             /* get the reporting mode */
+  #ifdef USE_ZLIB               /* if optional output compression, */
+  mode &= ~ISR_ZLIB;            /* do not compress temporary output */
+  #endif                        /* (compressed when merging) */
+  mode &= ~ISR_ASYNC;           /* write temporary output directly */
+  if ((isr_settarg(dup, rep->target, mode, rep->dir) != 0)
+  ||  (isr_setfmtx(dup, rep->scan, rep->hdr, rep->sep, rep->imp,
+                   rep->info, rep->iwf) != 0)
+  ||  ((rep->ints)              /* copy the output format */
+  &&   (isr_prefmt(dup, rep->imin, rep->imax) != 0))) {
+    isr_delete(dup, 0); return NULL; }
+  isr_setsupp(dup, rep->smin, rep->smax);
+  isr_setsize(dup, rep->zmin, rep->zmax);
+  for (i = 0; i < rep->bdrcnt; i++) {
+    if (isr_setbdr(dup, i, rep->border[i]) < 0) {
+      isr_delete(dup, 0); return NULL; }
+  }                             /* copy the filtering border */
+  isr_seteval(dup, rep->evalfn, rep->evaldat,
+                   rep->evaldir, rep->evaldir *rep->evalthh);
+  isr_setrepo(dup, rep->repofn, rep->repodat);
+  isr_setrule(dup, rep->rulefn, rep->ruledat);
+  isr_tidcfg (dup, rep->tracnt, rep->miscnt);
+  dup->supps[0] = rep->supps[0];/* copy the empty set support */
+  dup->wgts [0] = rep->wgts [0];/* and the empty set weight */
+  #ifdef ISR_PATSPEC            /* if pattern spectrum functions */
+  if (rep->psp && (isr_addpsp(dup, NULL) < 0)) {
+    isr_delete(dup, 0); return NULL; }
+  #endif                        /* create a pattern spectrum */
+  if (rep->topk && (isr_settopk(dup, rep->topk->max) != 0)) {
+    isr_delete(dup, 0); return NULL; }
+  if (rep->file) {              /* if there is an output file, */
+    file = tmpfile();           /* write to a temporary file */
+    if (!file || (isr_open(dup, file, "<tmpfile>") != 0)) {
+      if (file) { fclose(file); } isr_delete(dup, 0); return NULL; }
+    dup->next = dup->buf;       /* discard a binary output header */
+  }                             /* (contents are copied by merging) */
+  if (rep->tidfile) {           /* if there is a trans. id file, */
+    file = tmpfile();           /* write to a temporary file */
+    if (!file || (isr_tidopen(dup, file, "<tmpfile>") != 0)) {
+      if (file) { fclose(file); } isr_delete(dup, 0); return NULL; }
+    dup->tidnxt = dup->tidbuf;  /* discard a binary tid file header */
+  }                             /* (contents are copied by merging) */
+  if (isr_setup(dup) != 0) {    /* set up the cloned reporter */
+    isr_delete(dup, 0); return NULL; }
+  for (p = rep->items; --p >= rep->pexs; )
+    isr_addpex(dup, *p);        /* copy perfect exts. of empty set */
+  return dup;                   /* return the created clone */
+}  /* isr_clone() */
+
+/* The clone has the same configuration as the given reporter, but  */
+/* no compression or asynchronous output and (if needed) temporary  */
+/* output files, so that it can be used in a separate thread. The   */
+/* results are transferred to the original reporter with the        */
+/* function isr_merge(), after which the clone should be deleted    */
+/* with isr_delete(clone, 0).                                       */
+
+/*--------------------------------------------------------------------*/
+
+int isr_merge (ISREPORT *dst, ISREPORT *src)
+{                               /* --- merge results of a clone */
+  ITEM   i;                     /* loop variable */
+  size_t n;                     /* number of characters read */
+  int    r = 0;                 /* result of copying */
+  TOPKSET *t;                   /* to traverse the collected sets */
+
+  assert(dst && src && (dst->base == src->base));
+  if (dst->topk && src->topk) { /* if both collect the best sets */
+    for (n = 0; n < src->topk->cnt; n++) {
+      t = src->topk->sets[n];   /* add the sets of the source */
+      if (tk_add(dst->topk, t->items, t->cnt, t->supp,
+                 t->wgt, t->eval) < 0) r = -1;
+    }                           /* to the destination collector */
+    tk_raise(dst);              /* and raise the minimum support */
+  }
+  dst->repcnt += src->repcnt;   /* sum the number of reported sets */
+  for (i = (src->size < dst->size) ? src->size : dst->size; i >= 0; i--)
+    dst->stats[i] += src->stats[i]; /* sum the set size statistics */
+  #ifdef ISR_PATSPEC            /* if pattern spectrum functions */
+  if (dst->psp && src->psp && (psp_addpsp(dst->psp, src->psp) < 0))
+    r = -1;                     /* sum the pattern spectra */
+  #endif
+  if (dst->file && src->file) { /* if both have an output file */
+    isr_flush(src);             /* flush the source write buffer */
+    if (fflush(src->file) != 0) r = -1;
+    rewind(src->file);          /* read output back into the buffer */
+    while ((n = fread(dst->next, sizeof(char),
+                      (size_t)(dst->end -dst->next), src->file)) > 0) {
+      dst->next += n;           /* copy the written item sets */
+      if (dst->next >= dst->end) isr_flush(dst);
+    }                           /* flush the buffer if it is full */
+    if (ferror(src->file)) r = -1;
+    dst->bcnt = 0;              /* check for a read error and */
+  }                             /* do not delta code the next record */
+  if (dst->tidfile && src->tidfile) {
+    isr_tidflush(src);          /* flush the source write buffer */
+    if (fflush(src->tidfile) != 0) r = -1;
+    rewind(src->tidfile);       /* read output back into the buffer */
+    while ((n = fread(dst->tidnxt, sizeof(char),
+                      (size_t)(dst->tidend -dst->tidnxt),
+                      src->tidfile)) > 0) {
+      dst->tidnxt += n;         /* copy the written trans. ids */
+      if (dst->tidnxt >= dst->tidend) isr_tidflush(dst);
+    }                           /* flush the buffer if it is full */
+    if (ferror(src->tidfile)) r = -1;
+  }                             /* check for a read error */
+  return r;                     /* return the error status */
+}  /* isr_merge() */
+
+/* With delta coded binary output (mode ISR_DELTA) each record only */
+/* contains the items that follow the prefix it shares with the     */
+/* preceding record. After the records of the source have been      */
+/* appended, the preceding record in the output is the last record  */
+/* of the source, not the one the destination noted in its buffer   */
+/* bprv. Therefore the length bcnt of the noted record is set to    */
+/* zero, so that the next record of the destination is written in   */
+/* full (the records of the source start in full anyway, because    */
+/* the clone starts with an empty prefix).                          */
+
+/*--------------------------------------------------------------------*/
+
 int isr_add (ISREPORT *rep, ITEM item, RSUPP supp)
 {                               /* --- add an item (only support) */
   assert(rep && (item >= 0)     /* check the function arguments */
@@ -1330,25 +2180,14 @@ static void fastout (ISREPORT *rep, ITEM n)
 
 /*--------------------------------------------------------------------*/
 
-static void output (ISREPORT *rep)
-{                               /* --- output an item set */
+static void emit (ISREPORT *rep)
+{                               /* --- write an item set */
   TID        k;                 /* loop variable */
   ITEM       min;               /* minimum number of items */
   char       *s;                /* to traverse the output buffer */
   const char *name;             /* to traverse the item names */
 
-  assert(rep                    /* check the function arguments */
-  &&    (rep->cnt >= rep->zmin)
-  &&    (rep->cnt <= rep->zmax));
-  if (rep->border               /* if there is a filtering border */
-  && (rep->cnt < rep->bdrcnt)   /* and the set size is in its range */
-  && (rep->supps[rep->cnt] < rep->border[rep->cnt]))
-    return;                     /* check the item set signature */
-  if (rep->evalfn) {            /* if an evaluation function is given */
-    rep->eval = rep->evalfn(rep, rep->evaldat);
-    if (rep->evaldir *rep->eval < rep->evalthh)
-      return;                   /* if the item set does not qualify, */
-  }                             /* abort the output function */
+  assert(rep);                  /* check the function argument */
   rep->stats[rep->cnt] += 1;    /* count the reported item set */
   rep->repcnt          += 1;    /* (for its size and overall) */
   #ifdef ISR_PATSPEC            /* if pattern spectrum functions */
@@ -1358,6 +2197,15 @@ static void output (ISREPORT *rep)
   if (rep->repofn)              /* call reporting function if given */
     rep->repofn(rep, rep->repodat);
   if (!rep->file) return;       /* check for an output file */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    isr_binrec(rep, BIN_SET |BIN_SVALS(rep->wgts[rep->cnt], rep->eval),
+               rep->items, rep->cnt);
+    isr_sinfo (rep, rep->supps[rep->cnt], rep->wgts[rep->cnt],
+               rep->eval);      /* write items and set information */
+    if (rep->tidfile && rep->tids)
+      isr_tidbin(rep);          /* write the transaction id list */
+    return;                     /* (if one is to be written) */
+  }                             /* and abort the function */
   s = rep->pos[rep->pfx];       /* get the position for appending */
   while (rep->pfx < rep->cnt) { /* traverse the additional items */
     if (rep->pfx > 0)           /* if this is not the first item */
@@ -1395,6 +2243,31 @@ static void output (ISREPORT *rep)
     }                           /* print number of contained items */
   }
   isr_tidputc(rep, '\n');       /* terminate the transaction id list */
+}  /* emit() */
+
+/*--------------------------------------------------------------------*/
+
+static void output (ISREPORT *rep)
+{                               /* --- output an item set */
+  assert(rep                    /* check the function arguments */
+  &&    (rep->cnt >= rep->zmin)
+  &&    (rep->cnt <= rep->zmax));
+  if (rep->border               /* if there is a filtering border */
+  && (rep->cnt < rep->bdrcnt)   /* and the set size is in its range */
+  && (rep->supps[rep->cnt] < rep->border[rep->cnt]))
+    return;                     /* check the item set signature */
+  if (rep->evalfn) {            /* if an evaluation function is given */
+    rep->eval = rep->evalfn(rep, rep->evaldat);
+    if (rep->evaldir *rep->eval < rep->evalthh)
+      return;                   /* if the item set does not qualify, */
+  }                             /* abort the output function */
+  if (rep->topk) {              /* if to collect the best item sets */
+    if (tk_add(rep->topk, rep->items, rep->cnt, rep->supps[rep->cnt],
+               rep->wgts[rep->cnt], rep->eval) < 0)
+      rep->topk->err = -1;      /* add the item set to the collector */
+    tk_raise(rep); return;      /* and raise the minimum support */
+  }                             /* (error is checked in isr_report()) */
+  emit(rep);                    /* write the item set */
 }  /* output() */
 
 /*--------------------------------------------------------------------*/
@@ -1525,6 +2398,8 @@ int isr_report (ISREPORT *rep)
   if (rep->psp && psp_error(rep->psp))
     return -1;                  /* check whether updating the */
   #endif                        /* pattern spectrum failed */
+  if (rep->topk && (rep->topk->err < 0))
+    return -1;                  /* check for a collector error */
   #ifndef NDEBUG                /* in debug mode */
   isr_flush(rep);               /* flush the output buffer */
   #endif                        /* after every item set */
@@ -1596,6 +2471,14 @@ int isr_reprule (ISREPORT *rep, ITEM item,
     rep->rulefn(rep, rep->ruledat, item, body, head);
   }                             /* call the reporting function */
   if (!rep->file) return 0;     /* check for an output file */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    rep->bcur[0] = item;        /* collect head and body items */
+    for (i = 0, s = 1; i < n; i++)
+      if (rep->items[i] != item) rep->bcur[s++] = rep->items[i];
+    isr_binrec(rep, BIN_RULE |BIN_RVALS(eval), rep->bcur, s);
+    isr_rinfo (rep, supp, body, head, eval);
+    return 0;                   /* write items and rule information */
+  }                             /* and abort the function */
   isr_puts(rep, rep->hdr);      /* print the record header */
   isr_puts(rep, rep->inames[item]);
   isr_puts(rep, rep->imp);      /* print rule head and impl. sign */
@@ -1639,6 +2522,11 @@ int isr_iset (ISREPORT *rep, const ITEM *items, ITEM n,
   }                             /* call the reporter function */
   if (!rep->file) return 0;     /* check for an output file */
   i = rep->cnt; rep->cnt = n;   /* note the number of items */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    isr_binrec(rep, BIN_SET  |BIN_SVALS(wgt, eval), items, n);
+    isr_sinfo (rep, supp, wgt, eval);
+    rep->cnt = i; return 0;     /* write items and set information, */
+  }                             /* restore the number of items */
   isr_puts(rep, rep->hdr);      /* print the record header */
   if (n > 0)                    /* print the first item */
     isr_puts(rep, rep->inames[*items++]);
@@ -1677,6 +2565,13 @@ int isr_isetx (ISREPORT *rep, const ITEM *items, ITEM n,
   #endif                        /* count item set in pattern spectrum */
   if (!rep->file) return 0;     /* check for an output file */
   i = rep->cnt; rep->cnt = n;   /* note the number of items */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    isr_binrec(rep, BIN_WSET |BIN_SVALS(wgt, eval), items, n);
+    while (--n >= 0)            /* write the items and */
+      isr_bindbl(rep, *iwgts++);/* the item weights */
+    isr_sinfo(rep, supp, wgt, eval);
+    rep->cnt = i; return 0;     /* write the set information, */
+  }                             /* restore the number of items */
   isr_puts(rep, rep->hdr);      /* print the record header */
   if (n > 0) {                  /* if at least one item */
     isr_puts(rep, rep->inames[*items]);
@@ -1714,6 +2609,11 @@ int isr_rule (ISREPORT *rep, const ITEM *items, ITEM n,
   }                             /* call the reporting function */
   if (!rep->file) return 0;     /* check for an output file */
   i = rep->cnt; rep->cnt = n;   /* note the number of items */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    isr_binrec(rep, BIN_RULE |BIN_RVALS(eval), items, n);
+    isr_rinfo (rep, supp, body, head, eval);
+    rep->cnt = i; return 0;     /* write items and rule information, */
+  }                             /* restore the number of items */
   isr_puts(rep, rep->hdr);      /* print the record header */
   isr_puts(rep, rep->inames[*items++]);
   isr_puts(rep, rep->imp);      /* print the rule head and imp. sign */
@@ -1770,6 +2670,13 @@ int isr_sxrule (ISREPORT *rep, const ITEM *ante, ITEM n, ITEM cons,
   }                             /* call the reporting function */
   if (!rep->file) return 0;     /* check for an output file */
   i = rep->cnt; rep->cnt = n+1; /* note the number of items */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    memcpy(rep->bcur, ante, (size_t)n *sizeof(ITEM));
+    rep->bcur[n] = cons;        /* collect body and head items */
+    isr_binrec(rep, BIN_SEQRULE |BIN_RVALS(eval), rep->bcur, n+1);
+    isr_rinfo (rep, supp, body, head, eval);
+    rep->cnt = i; return 0;     /* write items and rule information, */
+  }                             /* restore the number of items */
   isr_puts(rep, rep->hdr);      /* print the record header */
   if (--n >= 0)                 /* print the first item in body */
     isr_puts(rep, rep->inames[*ante++]);
@@ -1808,6 +2715,13 @@ int isr_extrule (ISREPORT *rep, const ITEM *items, ITEM n,
   rep->repcnt     += 1;         /* (for its size and overall) */
   if (!rep->file) return 0;     /* check for an output file */
   i = rep->cnt; rep->cnt = n+1; /* note the number of items */
+  if (rep->mode & ISR_BINARY) { /* if to write binary records */
+    memcpy(rep->bcur, items, (size_t)n *sizeof(ITEM));
+    rep->bcur[n] = a; rep->bcur[n+1] = b;
+    isr_binrec(rep, BIN_EXTRULE, rep->bcur, n+2);
+    isr_xinfo (rep, supp, body, head, salt, halt, join);
+    rep->cnt = i; return 0;     /* write items and rule information, */
+  }                             /* restore the number of items */
   isr_puts(rep, rep->hdr);      /* print the record header */
   if (--n >= 0)                 /* print the first item in body */
     isr_puts(rep, rep->inames[*items++]);
@@ -1833,15 +2747,60 @@ void isr_reset (ISREPORT *rep)
 
   assert(rep);                  /* check the function argument */
   rep->repcnt = 0;              /* reinit. number of reported sets */
+  rep->nbytes = 0;              /* and number of output bytes */
   n = ib_cnt(rep->base);        /* clear the statistics array */
   memset(rep->stats, 0, (size_t)(n+1) *sizeof(size_t));
   #ifdef ISR_PATSPEC            /* if pattern spectrum functions */
   if (rep->psp) psp_clear(rep->psp);
   #endif                        /* clear the pattern spectrum */
+  if (rep->topk) {              /* if to collect the best item sets */
+    while (rep->topk->cnt > 0) free(rep->topk->sets[--rep->topk->cnt]);
+    rep->topk->err = 0;         /* delete the collected item sets */
+  }                             /* and clear the error status */
 }  /* isr_reset() */
 
 /*--------------------------------------------------------------------*/
 
+int isr_reptopk (ISREPORT *rep)
+{                               /* --- report the best item sets */
+  size_t  i, n;                 /* loop variable, number of sets */
+  int     r;                    /* error status of the collector */
+  TOPKSET *t;                   /* to traverse the item sets */
+
+  assert(rep && (rep->cnt == 0));  /* check the function argument */
+  if (!rep->topk) return 0;     /* check for a collector */
+  for (n = rep->topk->cnt; n > 1; ) {
+    t = rep->topk->sets[--n];   /* sort the heap (heapsort), */
+    rep->topk->sets[n] = rep->topk->sets[0];
+    rep->topk->sets[0] = t;     /* which yields an order by */
+    tk_sift(rep->topk->sets, 0, n);   /* descending support */
+  }
+  for (i = 0; i < rep->topk->cnt; i++) {
+    t = rep->topk->sets[i];     /* traverse the collected sets */
+    memcpy(rep->items, t->items, (size_t)t->cnt *sizeof(ITEM));
+    rep->pfx = 0;               /* copy the items of the set, */
+    rep->cnt = t->cnt;          /* invalidate the output prefix */
+    rep->supps[t->cnt] = t->supp;   /* and set the support, */
+    rep->wgts [t->cnt] = t->wgt;    /* the weight and the */
+    rep->eval          = t->eval;   /* evaluation of the set */
+    emit(rep);                  /* write the item set (it has */
+    free(t);                    /* already passed all filters) */
+  }                             /* and delete it */
+  rep->pfx = rep->cnt = 0;      /* remove the items again */
+  rep->topk->cnt = 0;           /* clear the collector */
+  r = rep->topk->err; rep->topk->err = 0;
+  return r;                     /* return the error status */
+}  /* isr_reptopk() */
+
+/* The collected item sets are written in the order of descending */
+/* support. Since they have already passed all filters (support,  */
+/* size, border, evaluation) and are counted only when they are   */
+/* written, the statistics of the reporter (isr_repcnt() etc.)    */
+/* refer to the best item sets afterwards. This function should   */
+/* be called once after the search, with no items in the reporter.*/
+
+/*--------------------------------------------------------------------*/
+
 void isr_prstats (ISREPORT *rep, FILE *out, ITEM min)
 {                               /* --- print item set statistics */
   ITEM i, n;                    /* loop variables */
@@ -1893,6 +2852,14 @@ int isr_sinfo (ISREPORT *rep, RSUPP supp, double wgt, double eval)
   const char *s, *t;            /* to traverse the format */
 
   assert(rep);                  /* check the function arguments */
+  if (rep->file && (rep->mode & ISR_BINARY)) {
+    n = isr_binsupp(rep, supp); /* if to write binary records, */
+    if (BIN_SVALS(wgt, eval)) { /* write the raw support and */
+      n += isr_bindbl(rep, wgt);/* (if not both zero) the weight */
+      n += isr_bindbl(rep, eval);   /* and the evaluation */
+    }                           /* of the item set */
+    return n;                   /* return the number of bytes */
+  }
   if (!rep->info || !rep->file)
     return 0;                   /* check for a given format and file */
   sdbl = (double)supp;          /* get support as double prec. number */
@@ -1951,6 +2918,13 @@ int isr_rinfo (ISREPORT *rep, RSUPP supp, RSUPP body, RSUPP head,
   const char *s, *t;            /* to traverse the format */
 
   assert(rep);                  /* check the function arguments */
+  if (rep->file && (rep->mode & ISR_BINARY)) {
+    n  = isr_binsupp(rep, supp);/* if to write binary records, */
+    n += isr_binsupp(rep, body);/* write the raw support values */
+    n += isr_binsupp(rep, head);/* and the evaluation of the rule */
+    if (BIN_RVALS(eval)) n += isr_bindbl(rep, eval);
+    return n;                   /* return the number of bytes */
+  }
   if (!rep->info || !rep->file)
     return 0;                   /* check for a given format and file */
   smax = (double)rep->supps[0]; /* get the total transaction weight */
@@ -2013,6 +2987,15 @@ int isr_xinfo (ISREPORT *rep, RSUPP supp, RSUPP body, RSUPP head,
   const char *s, *t;            /* to traverse the format */
 
   assert(rep);                  /* check the function arguments */
+  if (rep->file && (rep->mode & ISR_BINARY)) {
+    n  = isr_binsupp(rep, supp);/* if to write binary records, */
+    n += isr_binsupp(rep, body);/* write the raw support values */
+    n += isr_binsupp(rep, head);
+    n += isr_binsupp(rep, salt);
+    n += isr_binsupp(rep, halt);
+    n += isr_binsupp(rep, join);
+    return n;                   /* return the number of bytes */
+  }
   if (!rep->info || !rep->file)
     return 0;                   /* check for a given format and file */
   smax = (double)rep->supps[0]; /* get the total transaction weight */
@@ -2166,3 +3149,398 @@ void isr_getinfo (ISREPORT *rep, const char *sel, double *vals)
     }                           /* store the corresponding value */
   }                             /* in the output vector */
 }  /* isr_getinfo() */
+
+/*----------------------------------------------------------------------
+  Binary Output Reader Functions
+----------------------------------------------------------------------*/
+#ifdef ISR_MAIN
+
+static void br_delete (BINREAD *br)
+{                               /* --- delete a binary output reader */
+  assert(br);                   /* check the function argument */
+  #ifdef USE_ZLIB               /* if optional decompression */
+  if (br->zlib) inflateEnd(&br->zstm);
+  if (br->zbuf) free(br->zbuf); /* clean up the decompression */
+  #endif
+  if (br->file && (br->file != stdin)) fclose(br->file);
+  if (br->buf) free(br->buf);   /* close the input file and */
+  free(br);                     /* delete the read buffer */
+}  /* br_delete() */
+
+/*--------------------------------------------------------------------*/
+
+static BINREAD* br_create (CCHAR *name)
+{                               /* --- create a binary output reader */
+  BINREAD *br;                  /* created binary output reader */
+
+  br = (BINREAD*)calloc(1, sizeof(BINREAD));
+  if (!br) return NULL;         /* create the base structure */
+  br->buf = (UCHAR*)malloc(BS_READ *sizeof(UCHAR));
+  if (!br->buf) { br_delete(br); return NULL; }
+  br->next = br->end = br->buf; /* create a read buffer */
+  if (!name || !*name) {        /* if no proper name is given, */
+    br->file = stdin; br->name = "<stdin>"; }  /* read from stdin */
+  else {                        /* if a proper name is given */
+    br->file = fopen(br->name = name, "rb");
+    if (!br->file) return br;   /* open the input file */
+  }                             /* (checked by the caller) */
+  #ifdef USE_ZLIB               /* if optional decompression */
+  br->zbuf = (UCHAR*)malloc(BS_READ *sizeof(UCHAR));
+  if (!br->zbuf) { br_delete(br); return NULL; }
+  br->zstm.avail_in = (unsigned)fread(br->zbuf, sizeof(UCHAR),
+                                      BS_READ, br->file);
+  br->zstm.next_in  = br->zbuf; /* read the first block and check */
+  if ((br->zstm.avail_in > 0)   /* for compressed output: */
+  &&  (br->zbuf[0] != 'I')) {   /* binary output starts with "ISR" */
+    br->zstm.zalloc = Z_NULL;   /* clear allocation and free functions */
+    br->zstm.zfree  = Z_NULL;
+    br->zstm.opaque = Z_NULL;   /* initialize the decompression */
+    if (inflateInit(&br->zstm) != Z_OK) { br_delete(br); return NULL; }
+    br->zlib = 1; }             /* note that input is compressed */
+  else {                        /* if the input is not compressed, */
+    memcpy(br->buf, br->zbuf, br->zstm.avail_in);   /* copy the */
+    br->end = br->buf +br->zstm.avail_in;     /* first block into */
+  }                             /* the read buffer */
+  #endif
+  return br;                    /* return created binary reader */
+}  /* br_create() */
+
+/*--------------------------------------------------------------------*/
+
+static int br_fill (BINREAD *br)
+{                               /* --- fill the read buffer */
+  size_t n;                     /* number of bytes read */
+
+  assert(br);                   /* check the function argument */
+  #ifdef USE_ZLIB               /* if optional decompression */
+  if (br->zlib) {               /* if the input is compressed */
+    int r;                      /* result of decompression */
+    br->zstm.next_out  = br->buf;
+    br->zstm.avail_out = BS_READ;
+    while (br->zstm.avail_out >= BS_READ) {
+      if (br->zstm.avail_in == 0) {
+        br->zstm.avail_in = (unsigned)fread(br->zbuf, sizeof(UCHAR),
+                                            BS_READ, br->file);
+        br->zstm.next_in  = br->zbuf;
+        if (br->zstm.avail_in == 0) break;
+      }                         /* read the next compressed block */
+      r = inflate(&br->zstm, Z_NO_FLUSH);
+      if (r == Z_STREAM_END) break;
+      if (r != Z_OK) return -1; /* decompress the next block */
+    }                           /* until there is some output */
+    n = (size_t)(BS_READ -br->zstm.avail_out);
+    br->next = br->buf; br->end = br->buf +n;
+    return (ferror(br->file)) ? -1 : (n > 0);
+  }                             /* return whether data was read */
+  #endif
+  n = fread(br->buf, sizeof(UCHAR), BS_READ, br->file);
+  br->next = br->buf; br->end = br->buf +n;
+  return (ferror(br->file)) ? -1 : (n > 0);
+}  /* br_fill() */              /* return whether data was read */
+
+/*--------------------------------------------------------------------*/
+
+static int br_byte (BINREAD *br)
+{                               /* --- read the next byte */
+  assert(br);                   /* check the function argument */
+  if ((br->next >= br->end) && (br_fill(br) <= 0))
+    return -1;                  /* fill the buffer if necessary */
+  return *br->next++;           /* return the next byte */
+}  /* br_byte() */
+
+/*--------------------------------------------------------------------*/
+
+static int br_num (BINREAD *br, size_t *num)
+{                               /* --- read a variable length number */
+  int    c, s = 0;              /* next byte, shift of 7-bit group */
+  size_t x = 0;                 /* number read */
+
+  assert(br && num);            /* check the function arguments */
+  do {                          /* read the 7-bit groups */
+    if (s >= (int)(8*sizeof(size_t))) return -1;
+    c = br_byte(br); if (c < 0) return -1;
+    x |= (size_t)(c & 0x7f) << s; s += 7;
+  } while (c & 0x80);           /* while not at the last group */
+  *num = x; return 0;           /* store the number read */
+}  /* br_num() */
+
+/*--------------------------------------------------------------------*/
+
+static int br_dbl (BINREAD *br, double *num)
+{                               /* --- read a floating point number */
+  int                i, c;      /* loop variable, next byte */
+  unsigned long long b = 0;     /* bit pattern of the number */
+
+  assert(br && num);            /* check the function arguments */
+  for (i = 0; i < 8; i++) {     /* read the bytes of the number */
+    c = br_byte(br); if (c < 0) return -1;
+    b |= (unsigned long long)c << (8*i);
+  }                             /* (little endian order) */
+  memcpy(num, &b, sizeof(b));   /* store the number read */
+  return 0;                     /* return 'ok' */
+}  /* br_dbl() */
+
+/*--------------------------------------------------------------------*/
+
+static int br_supp (BINREAD *br, int dbl, double *supp)
+{                               /* --- read a support value */
+  size_t x;                     /* buffer for an integer support */
+
+  assert(br && supp);           /* check the function arguments */
+  if (dbl) return br_dbl(br, supp);
+  if (br_num(br, &x) != 0) return -1;
+  *supp = (double)x; return 0;  /* read an integer support */
+}  /* br_supp() */
+
+#endif
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+#ifdef ISR_MAIN
+
+#ifndef NDEBUG                  /* if debug version */
+  #undef  CLEANUP               /* clean up memory and close files */
+  #define CLEANUP \
+  if (bread)  br_delete(bread); \
+  if (out && (out != stdout)) fclose(out); \
+  if (names)  free(names);  \
+  if (inames) free((void*)inames); \
+  if (items)  free(items);  \
+  if (iwgts)  free(iwgts);
+#endif
+
+GENERROR(error, exit)           /* generic error reporting function */
+
+/*--------------------------------------------------------------------*/
+
+static void putitems (ITEM beg, ITEM end, ITEM m, CCHAR *sep,
+                      const double *wgts)
+{                               /* --- print a range of items */
+  ITEM i;                       /* loop variable */
+
+  for (i = beg; i < end; i++) { /* traverse the items */
+    if (i > beg) fputs(sep, out);
+    if (items[i] < m) fputs(inames[items[i]], out);
+    else fprintf(out, "%"ITEM_FMT, items[i]);
+    if (wgts) fprintf(out, ":%g", wgts[i]);
+  }                             /* print name or identifier */
+}  /* putitems() */             /* and optionally the item weight */
+
+/*--------------------------------------------------------------------*/
+
+static void putvals (const double *vals, int n, int k, CCHAR *sfmt)
+{                               /* --- print support values etc. */
+  int i;                        /* loop variable */
+
+  fputs(" (", out);             /* start the information */
+  for (i = 0; i < n; i++) {     /* traverse the values */
+    if (i > 0) fputs(", ", out);/* print a value separator */
+    fprintf(out, (i < k) ? sfmt : "%g", vals[i]);
+  }                             /* print supports with given format */
+  fputs(")\n", out);            /* terminate the information */
+}  /* putvals() */
+
+/*--------------------------------------------------------------------*/
+
+int main (int argc, char *argv[])
+{                               /* --- main function */
+  int     i, k = 0;             /* loop variables, buffers */
+  char    *s;                   /* to traverse the options */
+  CCHAR   **optarg = NULL;      /* option argument */
+  CCHAR   *fn_inp  = NULL;      /* name of input  file */
+  CCHAR   *fn_out  = NULL;      /* name of output file */
+  CCHAR   *sep     = " ";       /* item separator */
+  CCHAR   *imp     = " <- ";    /* implication sign */
+  CCHAR   *sfmt;                /* output format for support values */
+  int     ids      = 0;         /* flag for printing item ids */
+  int     all      = 0;         /* flag for printing all values */
+  int     flags;                /* flags of the binary format */
+  int     type;                 /* type of the binary records */
+  size_t  x, h, len;            /* buffers for read numbers */
+  size_t  recs     = 0;         /* number of decoded records */
+  ITEM    m = 0;                /* number of items/names */
+  ITEM    n, p, c = 0;          /* number of items, shared prefix */
+  ITEM    size     = 0;         /* size of the item buffer */
+  char    *t;                   /* to traverse the item names */
+  double  v[6];                 /* support values and evaluation */
+  #ifndef QUIET                 /* if not quiet version */
+  clock_t tm;                   /* timer for measurements */
+
+  prgname = argv[0];            /* get program name for error msgs. */
+
+  /* --- print usage message --- */
+  if (argc > 1) {               /* if arguments are given */
+    fprintf(stderr, "%s - %s\n", argv[0], DESCRIPTION);
+    fprintf(stderr, VERSION); } /* print a startup message */
+  else {                        /* if no arguments given */
+    printf("usage: %s [options] infile [outfile]\n", argv[0]);
+    printf("%s\n", DESCRIPTION);
+    printf("%s\n", VERSION);
+    printf("-i       print item identifiers instead of names\n");
+    printf("-v       print weights and evaluations of item sets "
+                    "and rules\n");
+    printf("-k#      item separator for output                "
+                    "(default: \"%s\")\n", sep);
+    printf("-I#      implication sign for rules               "
+                    "(default: \"%s\")\n", imp);
+    printf("infile   file to read binary output from          "
+                    "[required]\n");
+    printf("         (written with option -B of apriori, eclat "
+                    "or fpgrowth)\n");
+    printf("outfile  file to write decoded output to          "
+                    "[optional]\n");
+    return 0;                   /* print a usage message */
+  }                             /* and abort the program */
+  #endif  /* #ifndef QUIET */
+
+  /* --- evaluate arguments --- */
+  for (i = 1; i < argc; i++) {  /* traverse arguments */
+    s = argv[i];                /* get option argument */
+    if (optarg) { *optarg = s; optarg = NULL; continue; }
+    if ((*s == '-') && *++s) {  /* -- if argument is an option */
+      while (*s) {              /* traverse options */
+        switch (*s++) {         /* evaluate switches */
+          case 'i': ids    = 1;                     break;
+          case 'v': all    = 1;                     break;
+          case 'k': optarg = &sep;                  break;
+          case 'I': optarg = &imp;                  break;
+          default : error(E_OPTION, *--s);          break;
+        }                       /* set option variables */
+        if (optarg && *s) { *optarg = s; optarg = NULL; break; }
+      } }                       /* get option argument */
+    else {                      /* -- if argument is no option */
+      switch (k++) {            /* evaluate non-options */
+        case  0: fn_inp = s;      break;
+        case  1: fn_out = s;      break;
+        default: error(E_ARGCNT); break;
+      }                         /* note filenames */
+    }
+  }
+  if (optarg) error(E_OPTARG);  /* check (option) arguments */
+  if (k < 1)  error(E_ARGCNT);  /* and number of arguments */
+  MSG(stderr, "\n");            /* terminate the startup message */
+
+  /* --- read the file header --- */
+  CLOCK(tm);                    /* start timer, open input file */
+  bread = br_create(fn_inp);    /* create a binary output reader */
+  if (!bread)       error(E_NOMEM);
+  if (!bread->file) error(E_FOPEN, bread->name);
+  if (!fn_out || !*fn_out) out = stdout;
+  else if (!(out = fopen(fn_out, "w"))) error(E_FOPEN, fn_out);
+  MSG(stderr, "reading %s ... ", bread->name);
+  if ((br_byte(bread) != 'I') || (br_byte(bread) != 'S')
+  ||  (br_byte(bread) != 'R'))  /* check the magic bytes */
+    error(E_FORMAT, bread->name);
+  type = br_byte(bread);        /* get the file type and version */
+  if (((type != 'B') && (type != 'T'))
+  ||  (br_byte(bread) != BIN_VERSION))
+    error(E_FORMAT, bread->name);
+  flags = br_byte(bread);       /* get the format flags */
+  if (flags < 0) error(E_FORMAT, bread->name);
+  sfmt  = (flags & BIN_DBLSUPP) ? "%g" : "%.0f";
+  if (type == 'B') {            /* if item sets or rules */
+    if (br_num(bread, &x) != 0) error(E_FORMAT, bread->name);
+    m = (ITEM)x;                /* get the number of item names */
+    inames = (CCHAR**)malloc((size_t)(m+1) *sizeof(CCHAR*));
+    if (!inames) error(E_NOMEM);/* create an item name array */
+    for (len = 0, i = 0; i < m; i++) {
+      if (br_num(bread, &x) != 0) error(E_FORMAT, bread->name);
+      t = (char*)realloc(names, (len+x+1) *sizeof(char));
+      if (!t) error(E_NOMEM);   /* enlarge the name buffer */
+      for (names = t, t += len; x > 0; x--) {
+        k = br_byte(bread); if (k < 0) error(E_FORMAT, bread->name);
+        *t++ = (char)k; len++;  /* read the characters */
+      }                         /* of the item name */
+      *t = 0; len++;            /* terminate the item name */
+    }                           /* (buffer may move while reading) */
+    for (t = names, i = 0; i < m; i++) {
+      inames[i] = t; t += strlen(t)+1; }
+    if (ids) m = 0;             /* if to print item ids, drop names */
+  }
+
+  /* --- decode the records --- */
+  while ((k = br_byte(bread)) >= 0) {
+    --bread->next;              /* check for another record */
+    if (br_num(bread, &h) != 0) error(E_FORMAT, bread->name);
+    if (type == 'T') {          /* if transaction id lists */
+      n = (ITEM)(h >> 1);       /* get the number of ids */
+      for (x = 0, i = 0; i < n; i++) {
+        if (br_num(bread, &len) != 0) error(E_FORMAT, bread->name);
+        x = (flags & BIN_DELTA) ? x +len : len;
+        if (i > 0) fputs(sep, out);
+        fprintf(out, "%"SIZE_FMT, x);
+        if (!(h & 1)) continue; /* print the transaction id */
+        if (br_num(bread, &len) != 0) error(E_FORMAT, bread->name);
+        fprintf(out, ":%"SIZE_FMT, len);
+      }                         /* print the occurrence counter */
+      fputc('\n', out); recs++; continue;
+    }                           /* terminate the id list */
+    n = (ITEM)(h >> BIN_TYPES); /* get the number of items */
+    k = (int)(h & BIN_TYPEMASK);/* get the record type */
+    if (k > BIN_EXTRULE) error(E_FORMAT, bread->name);
+    v[1] = v[2] = v[3] = 0;     /* clear weight and evaluation */
+    if (n > size) {             /* if the item buffer is too small */
+      size  = n +(n >> 1) +16;  /* compute the new buffer size */
+      items = (ITEM*)  realloc(items, (size_t)size *sizeof(ITEM));
+      iwgts = (double*)realloc(iwgts, (size_t)size *sizeof(double));
+      if (!items || !iwgts) error(E_NOMEM);
+    }                           /* enlarge the item buffers */
+    p = 0;                      /* get the shared prefix length */
+    if (flags & BIN_DELTA) {    /* if items are delta-encoded */
+      if (br_num(bread, &x) != 0) error(E_FORMAT, bread->name);
+      p = (ITEM)x; if ((p > n) || (p > c)) error(E_FORMAT, bread->name);
+    }                           /* (cannot exceed previous record) */
+    for (i = p; i < n; i++) {   /* read the (new) items */
+      if (br_num(bread, &x) != 0) error(E_FORMAT, bread->name);
+      items[i] = (ITEM)x;       /* store the item identifier */
+    }
+    c = n;                      /* note the number of items */
+    if (k == BIN_WSET)          /* if item weights are given */
+      for (i = 0; i < n; i++)   /* read the item weights */
+        if (br_dbl(bread, iwgts+i) != 0) error(E_FORMAT, bread->name);
+    if      (k <= BIN_WSET) {   /* if item set (with weights) */
+      if ((br_supp(bread, flags & BIN_DBLSUPP, v) != 0)
+      ||  ((h & BIN_VALUES)
+      &&   ((br_dbl(bread, v+1) != 0) || (br_dbl(bread, v+2) != 0))))
+        error(E_FORMAT, bread->name);
+      putitems(0, n, m, sep, (k == BIN_WSET) ? iwgts : NULL);
+      putvals(v, (all) ? 3 : 1, 1, sfmt); } /* print set info. */
+    else if (k <  BIN_EXTRULE) {/* if (sequence) rule */
+      if ((br_supp(bread, flags & BIN_DBLSUPP, v)   != 0)
+      ||  (br_supp(bread, flags & BIN_DBLSUPP, v+1) != 0)
+      ||  (br_supp(bread, flags & BIN_DBLSUPP, v+2) != 0)
+      ||  ((h & BIN_VALUES) && (br_dbl(bread, v+3) != 0)))
+        error(E_FORMAT, bread->name);
+      if (k == BIN_RULE) {      /* if association rule */
+        putitems(0, 1, m, sep, NULL); fputs(imp, out);
+        putitems(1, n, m, sep, NULL); }
+      else {                    /* if sequence rule (head at end) */
+        putitems(0, n-1, m, sep, NULL); fputs(imp, out);
+        putitems(n-1, n, m, sep, NULL);
+      }                         /* print head and body */
+      putvals(v, (all) ? 4 : 3, 3, sfmt); } /* print rule info. */
+    else {                      /* if extended sequence rule */
+      for (i = 0; i < 6; i++)   /* read the six support values */
+        if (br_supp(bread, flags & BIN_DBLSUPP, v+i) != 0)
+          error(E_FORMAT, bread->name);
+      putitems(0, n-2, m, sep, NULL); fputs(imp, out);
+      putitems(n-2, n, m, sep, NULL);
+      putvals(v, 6, 6, sfmt);   /* print items and support values */
+    }
+    recs++;                     /* count the decoded record */
+  }
+  if (bread->file && ferror(bread->file))
+    error(E_FREAD, bread->name);/* check for a read error */
+  if (ferror(out) || ((out != stdout) && (fclose(out) != 0)))
+    error(E_FWRITE, (out == stdout) ? "<stdout>" : fn_out);
+  if (out != stdout) out = NULL;/* (file is closed) */
+  MSG(stderr, "[%"SIZE_FMT" record(s)] done [%.2fs].\n",
+      recs, SEC_SINCE(tm));
+
+  /* --- clean up --- */
+  CLEANUP;                      /* clean up memory and close files */
+  SHOWMEM;                      /* show (final) memory usage */
+  return 0;                     /* return 'ok' */
+}  /* main() */
+
+#endif
@@ -44,6 +44,11 @@
             2016.09.29 function isr_sxrule() added (explicit head item)
             2016.10.14 function isr_size() added (item array size)
             2017.05.30 optional compression with zlib library added
+            2026.10.14 functions isr_clone() and isr_merge() added
+            2026.10.14 binary output mode added (ISR_BINARY/ISR_DELTA)
+            2026.10.14 asynchronous output mode added (ISR_ASYNC)
+            2026.10.14 functions isr_settopk() and isr_reptopk() added
+            2026.10.14 output byte counter added (isr_nbytes())
 ----------------------------------------------------------------------*/
 #ifndef __REPORT__
 #define __REPORT__
@@ -175,10 +180,19 @@
 #ifdef USE_ZLIB                 /* if to use optional compression */
 #define ISR_ZLIB      0x1000    /* compress output with zlib */
 #endif
+#define ISR_BINARY    0x2000    /* write binary records (no text) */
+#define ISR_DELTA     0x4000    /* delta-encode items in bin. records */
+#define ISR_ASYNC     0x8000    /* write output in a separate thread */
 
 /*----------------------------------------------------------------------
   Type Definitions
 ----------------------------------------------------------------------*/
+struct isrwriter;               /* --- an asynchronous writer --- */
+typedef struct isrwriter ISRWRITER; /* (defined in report.c) */
+
+struct isrtopk;                 /* --- a top-k item set collector --- */
+typedef struct isrtopk ISRTOPK; /* (defined in report.c) */
+
 struct isreport;                /* --- an item set eval. function --- */
 typedef double ISEVALFN (struct isreport *rep, void *data);
 typedef void   ISREPOFN (struct isreport *rep, void *data);
@@ -237,6 +251,7 @@ typedef struct isreport {       /* --- an item set reporter --- */
   size_t     nsum;              /* sum of the item name sizes */
   size_t     repcnt;            /* number of reported item sets */
   size_t     *stats;            /* reported item sets per set size */
+  size_t     nbytes;            /* number of flushed output bytes */
   #ifdef ISR_PATSPEC            /* if pattern spectrum support */
   PATSPEC    *psp;              /* an (optional) pattern spectrum */
   #else                         /* if no pattern spectrum support */
@@ -260,6 +275,9 @@ typedef struct isreport {       /* --- an item set reporter --- */
   z_stream   ztids;             /* stream for compressing trans. ids */
   UCHAR      *zbuf;             /* output buffer for compression */
   #endif
+  ISRWRITER  *wrt;              /* asynchronous writer for sets */
+  ISRWRITER  *tidwrt;           /* asynchronous writer for tids */
+  ISRTOPK    *topk;             /* collector for the best item sets */
   ITEM       *occs;             /* array  of item occurrences */
   TID        *tids;             /* array  of transaction ids */
   TID        tidcnt;            /* number of transaction ids */
@@ -268,6 +286,9 @@ typedef struct isreport {       /* --- an item set reporter --- */
   int        fast;              /* whether fast output is possible */
   int        fosize;            /* size of set info. for fastout() */
   char       foinfo[64];        /* item set info.    for fastout() */
+  ITEM       *bprv;             /* items of previous binary record */
+  ITEM       *bcur;             /* buffer for current binary record */
+  ITEM       bcnt;              /* number of items in prev. record */
   char       *out;              /* output buffer for sets/rules */
   char       *pos[1];           /* append positions in output buffer */
 } ISREPORT;                     /* (item set reporter) */
@@ -317,6 +338,7 @@ extern void      isr_setrepo  (ISREPORT *rep, ISREPOFN repofn,
                                void *data);
 extern void      isr_setrule  (ISREPORT *rep, ISRULEFN rulefn,
                                void *data);
+extern int       isr_settopk  (ISREPORT *rep, size_t k);
 extern int       isr_prefmt   (ISREPORT *rep, TID min, TID max);
 
 extern int       isr_open     (ISREPORT *rep, FILE *file, CCHAR *name);
@@ -331,6 +353,8 @@ extern FILE*     isr_tidfile  (ISREPORT *rep);
 extern CCHAR*    isr_tidname  (ISREPORT *rep);
 
 extern int       isr_setup    (ISREPORT *rep);
+extern ISREPORT* isr_clone    (ISREPORT *rep);
+extern int       isr_merge    (ISREPORT *dst, ISREPORT *src);
 
 extern int       isr_add      (ISREPORT *rep, ITEM item, RSUPP supp);
 extern int       isr_addnc    (ISREPORT *rep, ITEM item, RSUPP supp);
@@ -392,8 +416,10 @@ extern int       isr_extrule  (ISREPORT *rep, const ITEM *items, ITEM n,
                                RSUPP salt, RSUPP halt, RSUPP join);
 
 extern void      isr_reset    (ISREPORT *rep);
+extern int       isr_reptopk  (ISREPORT *rep);
 extern size_t    isr_repcnt   (ISREPORT *rep);
 extern const size_t* isr_stats(ISREPORT *rep);
+extern size_t    isr_nbytes   (ISREPORT *rep);
 extern void      isr_prstats  (ISREPORT *rep, FILE *out, ITEM min);
 #ifdef ISR_PATSPEC
 extern int       isr_addpsp   (ISREPORT *rep, PATSPEC *psp);
@@ -472,6 +498,7 @@ extern int       isr_tail     (ISREPORT *rep, const ITEM *items,ITEM n);
 
 #define isr_repcnt(r)     ((r)->repcnt)
 #define isr_stats(r)      ((const size_t*)(r)->stats)
+#define isr_nbytes(r)     ((r)->nbytes +(size_t)((r)->next -(r)->buf))
 #ifdef ISR_PATSPEC
 #define isr_getpsp(r)     ((r)->psp)
 #endif
@@ -90,9 +90,21 @@
             2014.10.17 function ib_clear() made a proper function
             2014.10.24 changed from LGPL license to MIT license
             2015.02.27 more item appearance indicator strings added
+            2026.10.14 functions tbg_save() and tbg_load() added
+            2026.10.14 vertical representation (tid bitsets) added
+            2026.10.14 radix/counting sort mode (TA_RADIX) added
+            2026.10.14 collapsing of duplicate trans. while reading
+            2026.10.14 compressed transactions (delta/varint) added
+            2026.10.14 item base mode IB_OPENADR (open addressing) added
+            2026.10.14 static buffers and lazy table sorting removed
+            2026.10.14 function tbg_reuse() added (reuse of clones)
+            2026.10.14 flat and parallel transaction tree construction
+            2026.10.14 narrow (16 bit) items in transaction tree leaves
+            2026.10.14 packed transactions unpacked by tbg_load()
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdarg.h>
 #include <limits.h>
@@ -100,6 +112,18 @@
 #include <math.h>
 #include <time.h>
 #include <assert.h>
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#include <windows.h>            /* for threads (parallel sorting) */
+#else                           /* if POSIX system */
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>           /* for memory mapping binary files */
+#include <pthread.h>            /* for threads (parallel sorting) */
+#endif
+#if defined TAVERTFN && defined __AVX2__
+#include <immintrin.h>          /* for vectorized bit counting */
+#endif
 #include "tract.h"
 #ifdef TA_MAIN
 #include "error.h"
@@ -144,6 +168,24 @@
 #define BLKSIZE      1024       /* block size for enlarging arrays */
 #define TH_INSERT       8       /* threshold for insertion sort */
 #define TS_PRIMES    (sizeof(primes)/sizeof(*primes))
+#define RS_EXTENT   65536       /* max. extent of counting sort block */
+#define RS_MINPAR   65536       /* min. trans. per thread for sorting */
+#define TT_MINPAR    4096       /* min. trans. per thread for trees */
+#define TZ_BLKSIZE    256       /* trans. per block of compressed data */
+#ifdef TA_READ
+#define MSGSIZE      (2*TRD_MAXLEN+64)  /* size of message buffer */
+#endif
+
+/* --- thread definitions --- */
+#ifdef _WIN32                   /* if Microsoft Windows system */
+#define THREAD       HANDLE     /* threads identified by handles */
+#define THREAD_OK    0          /* return value is DWORD */
+#define WORKERDEF(n,p)  DWORD WINAPI n (LPVOID p)
+#else                           /* if Linux/Unix system */
+#define THREAD       pthread_t  /* use the POSIX thread type */
+#define THREAD_OK    NULL       /* return value is void* */
+#define WORKERDEF(n,p)  void*        n (void* p)
+#endif                          /* definition of a worker function */
 
 #ifndef QUIET                   /* if not quiet version, */
 #define MSG         fprintf     /* print messages */
@@ -155,6 +197,11 @@
 
 #define SEC_SINCE(t)  ((double)(clock()-(t)) /(double)CLOCKS_PER_SEC)
 
+#define BINPAD(n)     (((n) +7) & ~(size_t)7)
+#define BINREC(o,n,s) BINPAD((o) +(size_t)((n)+1) *(s))
+/* BINPAD rounds a size up to a multiple of 8, BINREC computes the */
+/* padded size of a transaction record (including the sentinel).  */
+
 #ifndef CCHAR
 #define CCHAR const char        /* abbreviation */
 #endif
@@ -168,29 +215,82 @@ typedef struct {                /* --- item frequency --- */
   SUPP dif;                     /* difference to original */
 } ITEMFRQ;                      /* (item frequency) */
 
+typedef struct {                /* --- binary file header --- */
+  char     magic[8];            /* file type identification */
+  size_t   types;               /* signature of the data types */
+  int      mode;                /* transaction bag mode */
+  int      flags;               /* flags (TBG_SORTED, TBG_REDUCED) */
+  ITEM     icnt;                /* number of items */
+  ITEM     max;                 /* number of items in largest trans. */
+  TID      cnt;                 /* number of transactions */
+  SUPP     wgt;                 /* total weight of transactions */
+  SUPP     imax;                /* maximum support of an item */
+  size_t   extent;              /* total number of item instances */
+  size_t   names;               /* size of the item name block */
+  size_t   tsize;               /* size of the transaction block */
+} TBGHDR;                       /* (binary file header) */
+
+typedef struct {                /* --- binary item record --- */
+  double   pen;                 /* insertion penalty */
+  SUPP     frq;                 /* standard frequency (trans. weight) */
+  SUPP     xfq;                 /* extended frequency (trans. sizes) */
+  int      app;                 /* appearance indicator */
+} ITEMREC;                      /* (binary item record) */
+
+typedef struct {                /* --- sorting worker data --- */
+  TRACT    **tracts;            /* transactions to sort */
+  TID      n;                   /* number of transactions */
+  ITEM     k;                   /* number of items */
+  int      dir;                 /* direction (item sorting) */
+  int      mode;                /* sort mode (e.g. TA_HEAP) */
+  TRACT    **buf;               /* buffer for transactions */
+  TID      *cnts;               /* counters for bin sort */
+  TID      *tids;               /* transaction indices per item */
+  ITEM     *fill;               /* fill counters (item sorting) */
+} SORTWORK;                     /* (sorting worker data) */
+
+#if defined TATREEFN && !defined TATCOMPACT
+typedef struct {                /* --- tree building worker data --- */
+  TRACT    **tracts;            /* (sorted) transactions */
+  TID      *offs;               /* start offsets of the item groups */
+  size_t   *sizes;              /* sizes/offsets of the subtrees */
+  TANODE   **chn;               /* child pointers of the root node */
+  char     *mem;                /* memory block for flat layout */
+  ITEM     beg, end;            /* range of root children to build */
+  int      narrow;              /* whether to store narrow leaves */
+  int      err;                 /* error status */
+} TATWORK;                      /* (tree building worker data) */
+#endif
+
+#ifdef _WIN32                   /* if Microsoft Windows system */
+typedef DWORD WINAPI WORKERFN (LPVOID p);
+#else                           /* if Linux/Unix system */
+typedef void*        WORKERFN (void*  p);
+#endif                          /* (type of a worker function) */
+
 typedef ITEM SUBFN  (const TRACT  *t1, const TRACT  *t2, ITEM off);
 typedef ITEM SUBWFN (const WTRACT *t1, const WTRACT *t2, ITEM off);
 
 /*----------------------------------------------------------------------
   Constants
 ----------------------------------------------------------------------*/
-static WITEM  WTA_END  = {-1,0};/* sentinel for weighted items */
+static const WITEM WTA_END  = {-1,0};  /* sentinel for weighted items */
+static CCHAR  binmagic[8] = "TABAG\x1a\x01";  /* binary file id. */
 #ifdef TA_READ
-static WITEM  WTA_TERM = { 0,0};/* termination item */
-static int    sorted   = 0;     /* flag for sorted indicators */
-static CCHAR* appmap[] = {      /* item appearance indicators */
-  "0:-",  "0:n",    "0:none", "0:neither", "0:ignore",
-  "1:i",  "1:in",   "1:inp",  "1:input",
-  "1:a",  "1:ante", "1:antecedent", "1:b", "1:body",
-  "2:o",  "2:out",  "2:output",
-  "2:c",  "2:cons", "2:consequent", "2:h", "2:head",
-  "3:io", "3:i&o",  "3:inout", "3:in&out",
-  "3:ac", "3:a&c",  "3:c&a",   "3:canda",
-  "3:bh", "3:b&h",  "3:h&b",   "3:both",
-};                              /* (code:name) */
+static const WITEM WTA_TERM = { 0,0};  /* termination item */
+static CCHAR *const appmap[] = {/* item appearance indicators */
+  "0:-",    "1:a",    "3:a&c",  "3:ac",   "1:ante", "1:antecedent",
+  "1:b",    "3:b&h",  "3:bh",   "1:body", "3:both",
+  "2:c",    "3:c&a",  "3:canda","2:cons", "2:consequent",
+  "2:h",    "3:h&b",  "2:head",
+  "1:i",    "3:i&o",  "0:ignore", "1:in", "3:in&out", "3:inout",
+  "1:inp",  "1:input","3:io",
+  "0:n",    "0:neither", "0:none",
+  "2:o",    "2:out",  "2:output",
+};                              /* (code:name, sorted by name) */
 #endif
 
-static size_t primes[] = {      /* table of twin prime numbers */
+static const size_t primes[] = {/* table of twin prime numbers */
   19, 31, 61, 109, 241, 463, 1021, 2029, 4093, 8089, 16363, 32719,
   65521, 131011, 262111, 524221, 1048573, 2097133, 4193803, 8388451,
   16777141, 33554011, 67108669, 134217439, 268435009, 536870839,
@@ -249,10 +349,6 @@ static ITEMBASE *ibase = NULL;  /* item base */
 static TABAG    *tabag = NULL;  /* transaction bag/multiset */
 #endif
 
-#ifdef TA_READ                  /* if transaction reading capability */
-static char msgbuf[2*TRD_MAXLEN+64];
-#endif                          /* buffer for error messages */
-
 /*----------------------------------------------------------------------
   Auxiliary Functions
 ----------------------------------------------------------------------*/
@@ -280,10 +376,6 @@ static int appcode (CCHAR *s)
 
   assert(s);                    /* check the function argument */
   n = (int)(sizeof(appmap)/sizeof(*appmap));
-  if (!sorted) {                /* if app. indicators not sorted yet */
-    ptr_qsort((void*)appmap, (size_t)n, +1, appcmp, NULL);
-    sorted = -1;                /* sort the appearance indicators */
-  }                             /* and set the sorted flag */
   i = (int)ptr_bisect(s-2, (void*)appmap, (size_t)n, appcmp, NULL);
   if (i >= n) return -1;        /* try to find appearance indicator */
   t = appmap[i] +2;             /* check for a (prefix) match */
@@ -363,6 +455,58 @@ static int descmpx (const void *p1, const void *p2, void *data)
   return 0;                     /* return sign of frequency diff. */
 }  /* descmpx() */
 
+/*--------------------------------------------------------------------*/
+
+static int cpucnt (void)
+{                               /* --- get the number of processors */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  SYSTEM_INFO sysinfo;          /* system information structure */
+  GetSystemInfo(&sysinfo);      /* get system information */
+  return (int)sysinfo.dwNumberOfProcessors;
+  #elif defined _SC_NPROCESSORS_ONLN
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+  #else                         /* if no direct function available */
+  return 1;                     /* use only one processor */
+  #endif
+}  /* cpucnt() */
+
+/*--------------------------------------------------------------------*/
+
+static void runpar (void *w, size_t size, int c, WORKERFN *worker)
+{                               /* --- run (sorting) workers */
+  int    i, k;                  /* loop variables */
+  THREAD *threads;              /* thread handles */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  DWORD  thid;                  /* dummy for storing the thread id */
+  #endif                        /* (not really needed here) */
+
+  assert(w && (c > 0) && worker);  /* check the function arguments */
+  threads = (THREAD*)malloc((size_t)c *sizeof(THREAD));
+  for (i = 1; threads && (i < c); i++) {
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    threads[i] = CreateThread(NULL, 0, worker,
+                              (char*)w +(size_t)i *size, 0, &thid);
+    if (!threads[i]) break;     /* create a thread for each worker */
+    #else                       /* if Linux/Unix system */
+    if (pthread_create(threads+i, NULL, worker,
+                       (char*)w +(size_t)i *size) != 0)
+      break;                    /* create a thread for each worker */
+    #endif                      /* (sort in parallel) */
+  }
+  for (k = i; k < c; k++)       /* if not all threads were created, */
+    worker((char*)w +(size_t)k *size);  /* run the missing workers */
+  worker(w);                    /* run the first worker here */
+  for (k = i; --k > 0; ) {      /* wait for threads to finish */
+    #ifdef _WIN32               /* if Microsoft Windows system */
+    WaitForSingleObject(threads[k], INFINITE);
+    CloseHandle(threads[k]);    /* wait for the thread to finish */
+    #else                       /* if Linux/Unix system */
+    pthread_join(threads[k], NULL);
+    #endif                      /* (join threads with this one) */
+  }
+  if (threads) free(threads);   /* delete the thread handles */
+}  /* runpar() */
+
 /*----------------------------------------------------------------------
   Item Base Functions
 ----------------------------------------------------------------------*/
@@ -388,11 +532,14 @@ ITEMBASE* ib_create (int mode, ITEM size, ...)
     data   = va_arg(args, void*);
     delfn  = va_arg(args, OBJFN*);
     va_end(args);               /* create an item identifier map */
-    base->idmap = idm_create(8191, 0, hashfn, cmpfn, data, delfn); }
+    base->idmap = idm_create(8191, 0, hashfn, cmpfn, data, delfn,
+                             (mode & IB_OPENADR) ? ST_OPENADR : 0); }
   else                          /* if item names are strings */
-    base->idmap = idm_create(8191, 0, ST_STRFN, (OBJFN*)0);
+    base->idmap = idm_create(8191, 0, ST_STRFN, (OBJFN*)0,
+                             (mode & IB_OPENADR) ? ST_OPENADR : 0);
   if (!base->idmap) { free(base); return NULL; }
   base->mode = mode;            /* initialize the fields */
+  base->msg  = NULL;            /* no error message buffer yet */
   base->wgt  = base->max = 0;   /* there are no transactions yet */
   base->app  = APP_BOTH;        /* default: appearance in body & head */
   base->pen  = 0.0;             /* default: no item insertion allowed */
@@ -424,6 +571,7 @@ void ib_delete (ITEMBASE *base)
   assert(base);                 /* check the function argument */
   if (base->tract) free(base->tract);
   if (base->idmap) idm_delete(base->idmap);
+  if (base->msg)   free(base->msg);
   free(base);                   /* delete the components */
 }  /* ib_delete() */            /* and the item base body */
 
@@ -451,13 +599,11 @@ ITEM ib_add (ITEMBASE *base, const void *name)
 
 const char* ib_xname (ITEMBASE *base, ITEM item)
 {                               /* --- get an item name */
-  static char buf[32];          /* buffer for integer formatting */
-
   assert(base && (item >= 0));  /* check the function arguments */
   if (!(base->mode & IB_OBJNAMES))
     return ib_name(base, item); /* if possible, return name directly */
-  snprintf(buf, sizeof(buf), "%p", ib_name(base, item));
-  return buf;                   /* format the object pointer and */
+  snprintf(base->xnm, sizeof(base->xnm), "%p", ib_name(base, item));
+  return base->xnm;             /* format the object pointer and */
 }  /* ib_xname() */             /* return the formatting buffer */
 
 /*--------------------------------------------------------------------*/
@@ -819,7 +965,11 @@ const char* ib_errmsg (ITEMBASE *base, char *buf, size_t size)
 
   assert(base                   /* check the function arguments */
   &&    (!buf || (size > 0)));  /* if none given, get internal buffer */
-  if (!buf) { buf = msgbuf; size = sizeof(msgbuf); }
+  if (!buf) {                   /* if no buffer is given */
+    if (!base->msg) base->msg = (char*)malloc(MSGSIZE *sizeof(char));
+    if (!base->msg) return errmsgs[-E_NOMEM];
+    buf = base->msg; size = MSGSIZE;
+  }                             /* use the buffer of the item base */
   i = (base->err < 0) ? -base->err : 0;
   assert(i < (int)(sizeof(errmsgs)/sizeof(char*)));
   msg = errmsgs[i];             /* get the error message (format) */
@@ -1622,6 +1772,174 @@ void wta_show (WTRACT *t, ITEMBASE *base)
 }  /* wta_show() */             /* finally print the trans. weight */
 
 #endif
+/*----------------------------------------------------------------------
+  Compressed Transaction Functions
+----------------------------------------------------------------------*/
+
+static size_t putvar (unsigned char *p, size_t v)
+{                               /* --- store a variable length number */
+  size_t n = 1;                 /* number of bytes */
+
+  for ( ; v >= 0x80; v >>= 7) { /* while more than 7 bits are left */
+    if (p) *p++ = (unsigned char)(v | 0x80);
+    n++;                        /* store the lowest 7 bits */
+  }                             /* with a continuation flag */
+  if (p) *p = (unsigned char)v; /* store the remaining bits */
+  return n;                     /* return the number of bytes */
+}  /* putvar() */
+
+/*--------------------------------------------------------------------*/
+
+static size_t getvar (const unsigned char **p)
+{                               /* --- get a variable length number */
+  const unsigned char *s = *p;  /* to traverse the bytes */
+  size_t v;                     /* decoded number */
+  int    k;                     /* bit shift for next byte */
+
+  if (*s < 0x80) { *p = s+1; return (size_t)*s; }
+  for (v = 0, k = 0; *s & 0x80; k += 7)
+    v |= (size_t)(*s++ & 0x7f) << k;
+  v |= (size_t)*s++ << k;       /* collect the 7 bit groups */
+  *p = s;                       /* advance the byte pointer */
+  return v;                     /* return the decoded number */
+}  /* getvar() */
+
+/*--------------------------------------------------------------------*/
+
+static size_t tzenc (const TRACT *t, int dir, unsigned char *dst)
+{                               /* --- encode a transaction */
+  ITEM       m, q;              /* number of elements, packed index */
+  ITEM       x, y;              /* current and previous item */
+  size_t     n, v;              /* number of bytes, value to store */
+  const ITEM *s;                /* to traverse the items */
+
+  assert(t);                    /* check the function arguments */
+  for (m = 0, q = -1; t->items[m] > TA_END; m++)
+    if (t->items[m] < 0) q = m; /* count elements, find packed items */
+  n = putvar(dst, ((size_t)m << 1) | (size_t)(q >= 0));
+  if (q >= 0) {                 /* if there are packed items */
+    n += putvar((dst) ? dst+n : NULL, (size_t)(t->size-m));
+    n += putvar((dst) ? dst+n : NULL, (size_t)q);
+    n += putvar((dst) ? dst+n : NULL, (size_t)(t->items[q] & ~TA_END));
+  }                             /* store size, position and bits */
+  for (y = -1, s = t->items; *s > TA_END; s++) {
+    if ((x = *s) < 0) continue; /* traverse the unpacked items */
+    if      (y < 0)   v = (size_t)x;    /* first item: plain code */
+    else if (dir > 0) v = (size_t)(x-y-1);
+    else if (dir < 0) v = (size_t)(y-x-1);
+    else v = (x >= y) ? (size_t)(x-y) << 1 : ((size_t)(y-x) << 1) -1;
+    n += putvar((dst) ? dst+n : NULL, v);
+    y = x;                      /* store the (zigzag coded) delta */
+  }                             /* to the preceding item */
+  return n;                     /* return the number of bytes */
+}  /* tzenc() */
+
+/*--------------------------------------------------------------------*/
+
+static const unsigned char* decode (const unsigned char *p, int dir,
+                                    TRACT *t)
+{                               /* --- decode a transaction */
+  size_t h;                     /* header or delta value */
+  ITEM   m, q = -1;             /* number of items, packed index */
+  ITEM   x, b = 0;              /* current item, packed items */
+  ITEM   *d;                    /* to traverse the items */
+
+  assert(p && t);               /* check the function arguments */
+  h = getvar(&p);               /* get the transaction header */
+  t->size = m = (ITEM)(h >> 1); /* and the number of elements */
+  if (h & 1) {                  /* if there are packed items */
+    t->size += (ITEM)getvar(&p);/* get the transaction size, */
+    q = (ITEM)getvar(&p);       /* the position of the packed items */
+    b = (ITEM)getvar(&p) | TA_END;       /* and their bit rep. */
+    m -= 1;                     /* the packed items are no delta */
+  }
+  d = t->items;                 /* decode the unpacked items */
+  if (m > 0) {                  /* the first item is stored plainly */
+    *d++ = x = (ITEM)getvar(&p);
+    if      (dir > 0) while (--m > 0) *d++ = x += (ITEM)getvar(&p) +1;
+    else if (dir < 0) while (--m > 0) *d++ = x -= (ITEM)getvar(&p) +1;
+    else while (--m > 0) {      /* for an unknown direction */
+      h = getvar(&p);           /* the deltas are zigzag coded */
+      *d++ = x += (h & 1) ? -(ITEM)((h+1) >> 1) : (ITEM)(h >> 1);
+    }                           /* decode the items */
+  }
+  if (q >= 0) {                 /* insert the packed items */
+    memmove(t->items+q+1, t->items+q,
+            (size_t)(d-t->items-q) *sizeof(ITEM));
+    t->items[q] = b; d++;       /* at their original position */
+  }
+  while (d <= t->items +t->size) *d++ = TA_END;
+  t->mark = 0;                  /* store a sentinel (and padding) */
+  return p;                     /* return the next encoded trans. */
+}  /* decode() */
+
+/*----------------------------------------------------------------------
+  Transaction Iterator Functions
+----------------------------------------------------------------------*/
+
+TBGITER* tbi_create (const TABAG *bag)
+{                               /* --- create a transaction iterator */
+  TBGITER *iter;                /* created iterator */
+  size_t  z;                    /* size of the decoding buffer */
+
+  assert(bag);                  /* check the function argument */
+  z = (bag->zip) ? sizeof(TRACT) +(size_t)bag->max *sizeof(ITEM) : 0;
+  iter = (TBGITER*)malloc(sizeof(TBGITER) +z);
+  if (!iter) return NULL;       /* create the iterator and */
+  iter->bag   = bag;            /* a buffer for decoding */
+  iter->tract = (z > 0) ? (TRACT*)(iter+1) : NULL;
+  tbi_seek(iter, 0);            /* start with the first transaction */
+  return iter;                  /* return the created iterator */
+}  /* tbi_create() */
+
+/*--------------------------------------------------------------------*/
+
+void tbi_delete (TBGITER *iter)
+{ free(iter); }                 /* --- delete a transaction iterator */
+
+/*--------------------------------------------------------------------*/
+
+void tbi_seek (TBGITER *iter, TID index)
+{                               /* --- go to a given transaction */
+  TID   k;                      /* number of transactions to skip */
+  TAZIP *zip;                   /* compressed transactions */
+
+  assert(iter && (index >= 0)); /* check the function arguments */
+  if (index > iter->bag->cnt) index = iter->bag->cnt;
+  iter->idx = index;            /* note the transaction index */
+  if (!(zip = iter->bag->zip)) return;
+  if (index >= iter->bag->cnt) {/* if beyond the last transaction */
+    iter->next = zip->data +zip->size; return; }
+  iter->next = zip->data +zip->offs[index /TZ_BLKSIZE];
+  for (k = index % TZ_BLKSIZE; --k >= 0; )
+    iter->next = decode(iter->next, zip->dir, iter->tract);
+}  /* tbi_seek() */             /* skip trans. at start of block */
+
+/*--------------------------------------------------------------------*/
+
+TRACT* tbi_next (TBGITER *iter)
+{                               /* --- get the next transaction */
+  TAZIP *zip;                   /* compressed transactions */
+
+  assert(iter);                 /* check the function argument */
+  if (iter->idx >= iter->bag->cnt)
+    return NULL;                /* check for more transactions */
+  if (!(zip = iter->bag->zip))  /* if the bag is not compressed, */
+    return (TRACT*)iter->bag->tracts[iter->idx++];  /* return trans. */
+  iter->next = decode(iter->next, zip->dir, iter->tract);
+  iter->tract->wgt = (zip->wgts) ? zip->wgts[iter->idx] : 1;
+  iter->idx++;                  /* decode the next transaction */
+  return iter->tract;           /* and return the buffer */
+}  /* tbi_next() */
+
+/* A transaction iterator traverses the transactions of a bag in   */
+/* the order of their indices. For a bag that is not compressed, it  */
+/* simply returns the stored transactions. For a compressed bag, it  */
+/* decodes the next transaction into a buffer, which is overwritten  */
+/* by the next call, so that the returned transaction must be copied */
+/* if it is needed later. Several iterators may traverse a bag at    */
+/* the same time (for example, one per thread).                      */
+
 /*----------------------------------------------------------------------
   Transaction Bag/Multiset Functions
 ----------------------------------------------------------------------*/
@@ -1643,20 +1961,51 @@ TABAG* tbg_create (ITEMBASE *base)
   bag->icnts  = NULL;
   bag->ifrqs  = NULL;
   bag->buf    = NULL;
+  bag->map    = NULL;           /* there is no loaded block */
+  bag->mapsz  = 0;
+  bag->cpus   = 1;              /* sort with a single thread */
+  bag->htab   = NULL;           /* there is no hash table */
+  bag->hsize  = 0;              /* for collapsing duplicates */
+  bag->zip    = NULL;           /* transactions are not compressed */
   return bag;                   /* return the created t.a. bag */
 }  /* tbg_create() */
 
 /*--------------------------------------------------------------------*/
 
+static void tafree (TABAG *bag, void *t)
+{                               /* --- delete a transaction */
+  if (!bag->map                 /* if there is no loaded block or */
+  ||  ((size_t)((char*)t -(char*)bag->map) >= bag->mapsz))
+    free(t);                    /* the transaction is outside of it, */
+}  /* tafree() */               /* delete the transaction */
+
+/*--------------------------------------------------------------------*/
+
+static void unmap (TABAG *bag)
+{                               /* --- release loaded block */
+  if (!bag->map) return;        /* check for a loaded block */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  free(bag->map);               /* the block was read into memory */
+  #else                         /* if POSIX system */
+  munmap(bag->map, bag->mapsz); /* the block was memory mapped */
+  #endif
+  bag->map = NULL; bag->mapsz = 0;
+}  /* unmap() */
+
+/*--------------------------------------------------------------------*/
+
 void tbg_delete (TABAG *bag, int delib)
 {                               /* --- delete a transaction bag */
   assert(bag);                  /* check the function argument */
-  if (bag->buf) free(bag->buf); /* delete buffer for surrogates */
+  if (bag->buf)  free(bag->buf);  /* delete buffer for surrogates */
+  if (bag->htab) free(bag->htab); /* and the duplicate hash table */
   if (bag->tracts) {            /* if there are transactions */
     while (bag->cnt > 0)        /* traverse the transaction array */
-      free(bag->tracts[--bag->cnt]);
+      tafree(bag, bag->tracts[--bag->cnt]);
     free(bag->tracts);          /* delete all transactions */
   }                             /* and the transaction array */
+  unmap(bag);                   /* release a loaded block */
+  if (bag->zip)   free(bag->zip);   /* compressed transactions */
   if (bag->icnts) free(bag->icnts);
   if (delib) ib_delete(bag->base);
   free(bag);                    /* delete the item base and */
@@ -1666,11 +2015,12 @@ void tbg_delete (TABAG *bag, int delib)
 
 static TABAG* clone (TABAG *bag)
 {                               /* --- clone memory structure */
-  TID    i;                     /* loop variable */
-  ITEM   n;                     /* number of items */
-  TABAG  *dst;                  /* created clone of the trans. bag */
-  TRACT  *t;                    /* to traverse the transactions */
-  WTRACT *x;                    /* to traverse the transactions */
+  TID     i;                    /* loop variable */
+  ITEM    n;                    /* number of items */
+  TABAG   *dst;                 /* created clone of the trans. bag */
+  TRACT   *t;                   /* to traverse the transactions */
+  WTRACT  *x;                   /* to traverse the transactions */
+  TBGITER *iter;                /* to traverse compressed trans. */
 
   assert(bag);                  /* check the function argument */
   dst = tbg_create(bag->base);  /* create an empty transaction bag */
@@ -1690,15 +2040,18 @@ static TABAG* clone (TABAG *bag)
       dst->tracts[dst->cnt++] = x;
     } }                         /* store the created transaction */
   else {                        /* if simple transactions */
+    iter = tbi_create(bag);     /* create a transaction iterator */
+    if (!iter) { tbg_delete(dst, 0); return NULL; }
     for (i = 0; i < bag->cnt; i++) { /* traverse the transactions */
-      n = ((TRACT*)bag->tracts[i])->size;
+      n = tbi_next(iter)->size;
       t = (TRACT*)malloc(sizeof(TRACT) +(size_t)(n+1) *sizeof(ITEM));
-      if (!t) { tbg_delete(dst, 0); return NULL; }
+      if (!t) { tbi_delete(iter); tbg_delete(dst, 0); return NULL; }
       t->wgt  = 1;              /* create and init. the transaction */
       t->size = n; t->mark = 0; t->items[n] = TA_END;
       dst->tracts[dst->cnt++] = t;
     }                           /* note the transaction size and */
-  }                             /* store the created transaction */
+    tbi_delete(iter);           /* store the created transaction, */
+  }                             /* finally delete the iterator */
   return dst;                   /* return the created clone */
 }  /* clone() */
 
@@ -1715,13 +2068,20 @@ TABAG* tbg_clone (TABAG *bag)
 
 TABAG* tbg_copy (TABAG *dst, TABAG *src)
 {                               /* --- copy a transaction bag */
-  TID i;                        /* loop variable */
+  TID     i;                    /* loop variable */
+  TBGITER *iter;                /* to traverse compressed trans. */
 
   assert(dst && src             /* check the function arguments */
-  &&    (dst->size >= src->cnt));
+  &&    (dst->size >= src->cnt) && !dst->zip);
   if (src->mode & IB_WEIGHTS) { /* if trans. with weighted items */
     for (i = 0; i < src->cnt; i++)  /* copy the transactions */
       wta_copy(dst->tracts[i], src->tracts[i]); }
+  else if (src->zip) {          /* if compressed transactions */
+    iter = tbi_create(src);     /* create a transaction iterator */
+    if (!iter) return NULL;     /* and decode the transactions */
+    for (i = 0; i < src->cnt; i++)
+      ta_copy(dst->tracts[i], tbi_next(iter));
+    tbi_delete(iter); }         /* delete the iterator */
   else {                        /* if simple transactions */
     for (i = 0; i < src->cnt; i++)  /* copy the transactions */
       ta_copy(dst->tracts[i], src->tracts[i]);
@@ -1732,15 +2092,99 @@ TABAG* tbg_copy (TABAG *dst, TABAG *src)
 
 /*--------------------------------------------------------------------*/
 
+TABAG* tbg_reuse (TABAG *dst, TABAG *src, int copy)
+{                               /* --- reuse a clone of a trans. bag */
+  TID     i;                    /* loop variable for transactions */
+  ITEM    k;                    /* loop variable for sizes */
+  TID     *cnts;                /* number of transactions per size */
+  TRACT   **buf;                /* transactions sorted by size */
+  TRACT   *t;                   /* to traverse the transactions */
+  TBGITER *iter;                /* to traverse source transactions */
+
+  assert(dst && src && (dst != src)  /* check the function arguments */
+  &&    !dst->zip && !(src->mode & IB_WEIGHTS));
+  if (dst->cnt != src->cnt) return NULL;
+  cnts = (TID*)calloc((size_t)src->max+2, sizeof(TID));
+  if (!cnts) return NULL;       /* allocate size counters */
+  buf = (TRACT**)malloc((size_t)dst->cnt *sizeof(TRACT*));
+  if (!buf) { free(cnts); return NULL; }
+  iter = tbi_create(src);       /* create a transaction iterator */
+  if (!iter) { free(buf); free(cnts); return NULL; }
+  for (i = 0; i < dst->cnt; i++) {
+    k = ((TRACT*)dst->tracts[i])->size;
+    if (k > src->max) break;    /* traverse the transactions */
+    cnts[k+1] += 1;             /* and count them per size */
+  }                             /* (clones cannot be larger) */
+  if (i >= dst->cnt) {          /* if all sizes are possible, */
+    for (i = 0; i < src->cnt; i++) {
+      k = tbi_next(iter)->size; /* traverse the source transactions */
+      if (cnts[k+1] <= 0) break;/* and check that the destination */
+      cnts[k+1] -= 1;           /* has the same number of */
+    }                           /* transactions of each size */
+    if (i >= src->cnt) for (i = 0; i < dst->cnt; i++)
+      cnts[((TRACT*)dst->tracts[i])->size+1] += 1;
+  }                             /* restore the size counters */
+  if (i < dst->cnt) { tbi_delete(iter); free(buf); free(cnts);
+    return NULL; }              /* check for a clone of the source */
+  tbi_seek(iter, 0);            /* reset the source iterator */
+  for (k = 0; k <= src->max; k++)
+    cnts[k+1] += cnts[k];       /* compute the start indices */
+  for (i = 0; i < dst->cnt; i++) {
+    t = (TRACT*)dst->tracts[i]; buf[cnts[t->size]++] = t; }
+  for (k = src->max+1; k > 0; k--)
+    cnts[k] = cnts[k-1];        /* sort the transactions by size */
+  cnts[0] = 0;                  /* and restore the start indices */
+  for (i = 0; i < src->cnt; i++)/* assign transactions of equal size */
+    dst->tracts[i] = buf[cnts[tbi_next(iter)->size]++];
+  tbi_delete(iter);             /* (in the order of the source) */
+  free(buf); free(cnts);        /* delete the work buffers */
+  if (dst->buf)   { free(dst->buf);   dst->buf   = NULL; }
+  if (dst->icnts) { free(dst->icnts); dst->icnts = NULL;
+                    dst->ifrqs = NULL; }
+  dst->mode   = dst->base->mode;/* discard all derived data */
+  dst->max    = src->max;       /* and reinit. the fields */
+  dst->wgt    = src->wgt;       /* like in the function clone() */
+  dst->extent = src->extent;
+  if (copy) return tbg_copy(dst, src);
+  for (i = 0; i < dst->cnt; i++) {
+    t = (TRACT*)dst->tracts[i]; /* traverse the transactions */
+    t->wgt = 1; t->mark = 0; t->items[t->size] = TA_END;
+  }                             /* reinit. weight, mark and sentinel */
+  return dst;                   /* return the reused clone */
+}  /* tbg_reuse() */
+
+/* tbg_reuse() turns a transaction bag that was created with        */
+/* clone(), tbg_clone() or a surrogate function from the same       */
+/* source (and may have been sorted or packed since, but must not   */
+/* have been filtered or reduced) into the result of these          */
+/* functions again, without allocating the transactions anew. Since */
+/* transactions keep their size (packing only pads with sentinels), */
+/* the transactions of the clone are only reassigned by their sizes */
+/* to the positions of the source transactions. This requires that  */
+/* both bags contain the same number of transactions of each size,  */
+/* which is checked before anything is changed: if the size         */
+/* distributions differ (for example, because the clone was reduced */
+/* or filtered), the function fails and returns NULL without        */
+/* modifying the clone, so that the caller can delete it and create */
+/* a new clone instead. If copy is nonzero, the source transactions */
+/* are copied (like tbg_clone() does), otherwise only weights and   */
+/* sentinels are reset (clone()). All derived data (surrogate       */
+/* buffer, item counters) is discarded, so that a surrogate         */
+/* generated into the reused bag is identical to one generated into */
+/* a new clone with the same random numbers.                        */
+
+/*--------------------------------------------------------------------*/
+
 static int tbg_count (TABAG *bag)
 {                               /* --- count item occurrences */
-  ITEM   i;                     /* item buffer, number of items */
-  TID    n;                     /* loop variable for transactions */
-  TRACT  *t;                    /* to traverse the transactions */
-  WTRACT *x;                    /* to traverse the transactions */
-  ITEM   *s;                    /* to traverse the transaction items */
-  WITEM  *p;                    /* to traverse the transaction items */
-  TID    *z;                    /* to reallocate counter arrays */
+  ITEM    i;                    /* item buffer, number of items */
+  TID     n;                    /* loop variable for transactions */
+  TRACT   *t;                   /* to traverse the transactions */
+  WTRACT  *x;                   /* to traverse the transactions */
+  ITEM    *s;                   /* to traverse the transaction items */
+  WITEM   *p;                   /* to traverse the transaction items */
+  TID     *z;                   /* to reallocate counter arrays */
+  TBGITER *iter;                /* to traverse compressed trans. */
 
   i = ib_cnt(bag->base);        /* get the number of items */
   z = (TID*)realloc(bag->icnts, (size_t)i *(sizeof(TID)+sizeof(SUPP)));
@@ -1756,14 +2200,15 @@ static int tbg_count (TABAG *bag)
       }                         /* count the occurrences and */
     } }                         /* sum the transaction weights */
   else {                        /* if the items do not carry weights */
-    for (n = 0; n < bag->cnt; n++) {
-      t = (TRACT*)bag->tracts[n];  /* traverse the transactions */
+    if (!(iter = tbi_create(bag))) return -1;
+    while ((t = tbi_next(iter)) != NULL) {
       for (s = t->items; *s > TA_END; s++) {
         if ((i = *s) < 0) i = 0;   /* traverse the transaction items */
         bag->icnts[i] += 1;     /* count packed items in 1st element */
         bag->ifrqs[i] += t->wgt;
       }                         /* count the occurrences and */
     }                           /* sum the transaction weights */
+    tbi_delete(iter);           /* delete the transaction iterator */
   }
   return 0;                     /* return 'ok' */
 }  /* tbg_count() */
@@ -1786,13 +2231,112 @@ const SUPP* tbg_ifrqs (TABAG *bag, int recnt)
 
 /*--------------------------------------------------------------------*/
 
+static size_t tahash (const TRACT *t)
+{                               /* --- compute a transaction hash */
+  size_t     h;                 /* computed hash value */
+  const ITEM *s;                /* to traverse the items */
+
+  assert(t);                    /* check the function argument */
+  for (h = (size_t)t->size, s = t->items; *s > TA_END; s++)
+    h = h *16777619 +(size_t)*s;
+  return h;                     /* return the hash value */
+}  /* tahash() */
+
+/*--------------------------------------------------------------------*/
+
+static TID* tafind (TABAG *bag, const TRACT *t)
+{                               /* --- find a bin for a transaction */
+  size_t h, k, x;               /* hash value, bin index, step width */
+  TID    *p;                    /* to access the hash bins */
+  const ITEM  *a, *b;           /* to traverse the items */
+  const TRACT *u;               /* to traverse the transactions */
+
+  assert(bag && bag->htab && t);/* check the function arguments */
+  h = tahash(t);                /* compute the hash value */
+  k =  h %  bag->hsize;         /* compute the hash bin index */
+  x = (h % (bag->hsize-2)) +1;  /* and the probing step width */
+  for ( ; *(p = bag->htab +k) >= 0; k = (k+x) % bag->hsize) {
+    u = (const TRACT*)bag->tracts[*p];
+    if (u->size != t->size)     /* compare the sizes first */
+      continue;                 /* and the items only for same size */
+    for (a = u->items, b = t->items; *a == *b; a++, b++)
+      if (*a <= TA_END) return p;
+  }                             /* if the transactions are equal, */
+  return p;                     /* return the bin of the old one, */
+}  /* tafind() */               /* otherwise the empty bin found */
+
+/*--------------------------------------------------------------------*/
+
+static int rehash (TABAG *bag, TID n)
+{                               /* --- rebuild the hash table */
+  TID i;                        /* loop variable */
+  TID *p;                       /* new hash table */
+
+  assert(bag);                  /* check the function argument */
+  n = taa_tabsize((n > 16) ? n : 16);
+  p = (TID*)realloc(bag->htab, (size_t)n *sizeof(TID));
+  if (!p) return E_NOMEM;       /* enlarge the hash table */
+  bag->htab  = p;               /* and note the new table */
+  bag->hsize = (size_t)n;       /* and its size */
+  for (i = 0; i < n; i++) p[i] = -1;
+  for (i = 0; i < bag->cnt; i++)/* clear the hash bins and */
+    *tafind(bag, (TRACT*)bag->tracts[i]) = i;
+  return 0;                     /* insert the transactions */
+}  /* rehash() */
+
+/*--------------------------------------------------------------------*/
+
+int tbg_collapse (TABAG *bag, int on)
+{                               /* --- collapse duplicate trans. */
+  TID i;                        /* loop variable */
+
+  assert(bag);                  /* check the function argument */
+  if (!on || (bag->mode & IB_WEIGHTS)) {
+    if (bag->htab) free(bag->htab);
+    bag->htab = NULL; bag->hsize = 0;
+    return 0;                   /* delete an existing hash table */
+  }                             /* (collapsing is switched off) */
+  if (bag->htab) return 0;      /* check for an existing table */
+  for (i = 0; i < bag->cnt; i++)/* sort the items of */
+    ta_sort((TRACT*)bag->tracts[i], +1);  /* existing trans. */
+  if (bag->cnt > 1) {           /* if there are several trans., */
+    tbg_sort  (bag, +1, 0);     /* sort them and collapse */
+    tbg_reduce(bag, 1);         /* the existing duplicates */
+  }
+  return rehash(bag, bag->cnt+bag->cnt);
+}  /* tbg_collapse() */         /* build the hash table */
+
+/* While collapsing is switched on, the items of every transaction   */
+/* that is added with tbg_add() are sorted ascendingly and the bag is */
+/* searched for an equal transaction (with a hash table that maps    */
+/* transactions to their indices). If one is found, only its weight  */
+/* is increased, so the bag never holds duplicate transactions. This */
+/* reduces the memory needed for data with many duplicates, but only */
+/* tbg_add() and tbg_read() may be used to modify the bag while the  */
+/* hash table exists. It should be switched off again after reading. */
+
+/*--------------------------------------------------------------------*/
+
 int tbg_add (TABAG *bag, TRACT *t)
 {                               /* --- add a standard transaction */
   void **p;                     /* new transaction array */
   TID  n;                       /* new transaction array size */
+  TID  *h = NULL;               /* hash bin for the transaction */
+  TRACT *s;                     /* transaction to add */
 
   assert(bag                    /* check the function arguments */
   &&   !(bag->mode & IB_WEIGHTS));
+  if (bag->htab) {              /* if to collapse duplicates */
+    s = (t) ? t : ib_tract(bag->base);
+    ta_sort(s, +1);             /* sort the items of the transaction */
+    h = tafind(bag, s);         /* and search for an equal one */
+    if (*h >= 0) {              /* if an equal transaction exists */
+      ((TRACT*)bag->tracts[*h])->wgt += s->wgt;
+      bag->wgt += s->wgt;       /* add the transaction weight */
+      if (t) free(t);           /* delete the (now unneeded) trans. */
+      return 0;                 /* and return 'ok' */
+    }
+  }
   n = bag->size;                /* get the transaction array size */
   if (bag->cnt >= n) {          /* if the transaction array is full */
     n += (n > BLKSIZE) ? (n >> 1) : BLKSIZE;
@@ -1804,11 +2348,15 @@ int tbg_add (TABAG *bag, TRACT *t)
     return E_NOMEM;             /* get trans. from item base if nec. */
   if (bag->icnts) {             /* delete the item-specific counters */
     free(bag->icnts); bag->icnts = NULL; bag->ifrqs = NULL; }
+  if (h) *h = bag->cnt;         /* insert the trans. into hash table */
   bag->tracts[bag->cnt++] = t;  /* store the transaction and */
   bag->wgt += t->wgt;           /* sum the transaction weight */
   if (t->size > bag->max)       /* update maximal transaction size */
     bag->max = t->size;         /* and count the item instances */
   bag->extent += (size_t)t->size;
+  if (h && ((size_t)bag->cnt *4 > bag->hsize *3)
+  &&  (rehash(bag, bag->cnt+bag->cnt) != 0))
+    return E_NOMEM;             /* enlarge the hash table if needed */
   return 0;                     /* return 'ok' */
 }  /* tbg_add() */
 
@@ -1855,18 +2403,26 @@ int tbg_addib (TABAG *bag)
 int tbg_read (TABAG *bag, TABREAD *tread, int mode)
 {                               /* --- read transactions from a file */
   int r;                        /* result of ib_read()/tbg_add() */
+  int c = 0;                    /* whether collapsing was started */
 
   assert(bag && tread);         /* check the function arguments */
   if (bag->icnts) {             /* delete the item-specific counters */
     free(bag->icnts); bag->icnts = NULL; bag->ifrqs = NULL; }
+  if ((mode & TA_COLLAPSE) && !bag->htab
+  && !(bag->mode & IB_WEIGHTS)) { /* if to collapse duplicates, */
+    if (tbg_collapse(bag, 1) != 0)   /* create a hash table */
+      return bag->base->err = E_NOMEM;
+    c = 1;                      /* note that the table must be */
+  }                             /* deleted again after reading */
   while (1) {                   /* transaction read loop */
     r = ib_read(bag->base, tread, mode);
-    if (r < 0) return r;        /* read the next transaction and */
-    if (r > 0) return 0;        /* check for error and end of file */
+    if (r != 0) break;          /* read the next transaction and */
     r = (bag->mode & IB_WEIGHTS) ? tbg_addw(bag, NULL)
                                  : tbg_add (bag, NULL);
-    if (r) return bag->base->err = E_NOMEM;
+    if (r) { r = bag->base->err = E_NOMEM; break; }
   }                             /* add transaction to bag/multiset */
+  if (c) tbg_collapse(bag, 0);  /* delete the hash table */
+  return (r < 0) ? r : 0;       /* check for error and end of file */
 }  /* tbg_read() */
 
 #endif
@@ -1896,25 +2452,295 @@ int tbg_write (TABAG *bag, TABWRITE *twr, const char *wgtfmt, ...)
 #endif
 /*--------------------------------------------------------------------*/
 
+static size_t bintypes (void)
+{                               /* --- signature of the data types */
+  return  (size_t)sizeof(ITEM)         /* combine the sizes of */
+       | ((size_t)sizeof(TID)    <<  4)/* the basic data types */
+       | ((size_t)sizeof(SUPP)   <<  8)/* and the structures */
+       | ((size_t)sizeof(size_t) << 12)/* that are stored */
+       | ((size_t)sizeof(TRACT)  << 16)/* in a binary file */
+       | ((size_t)sizeof(WITEM)  << 24)
+       | ((size_t)(SUPP_EPS <= 0) << 31);
+}  /* bintypes() */             /* (also captures the byte order) */
+
+/*--------------------------------------------------------------------*/
+
+static int binpad (FILE *file, size_t n)
+{                               /* --- pad binary file to 8 bytes */
+  static const char nul[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  n = BINPAD(n) -n;             /* compute the number of pad bytes */
+  return (n > 0) && (fwrite(nul, 1, n, file) != n);
+}  /* binpad() */               /* write the pad bytes */
+
+/*--------------------------------------------------------------------*/
+
+int tbg_save (TABAG *bag, const char *fname, int flags)
+{                               /* --- save a bag to a binary file */
+  ITEM     i;                   /* loop variable for items */
+  TID      k;                   /* loop variable for transactions */
+  size_t   o, r, z;             /* item offset/size, record size */
+  int      e = 0;               /* write error indicator */
+  FILE     *file;               /* binary output file */
+  TBGHDR   hdr;                 /* binary file header */
+  ITEMREC  rec;                 /* binary item record */
+  ITEMDATA *itd;                /* to traverse the item data */
+  TRACT    *t;                  /* to traverse the transactions */
+  CCHAR    *name;               /* to traverse the item names */
+
+  assert(bag && fname           /* check the function arguments */
+  &&   !(bag->base->mode & IB_OBJNAMES));
+  o = (bag->mode & IB_WEIGHTS) ? offsetof(WTRACT, items)
+                               : offsetof(TRACT,  items);
+  r = (bag->mode & IB_WEIGHTS) ? sizeof(WITEM) : sizeof(ITEM);
+  memset(&hdr, 0, sizeof(hdr)); /* clear the header (incl. padding) */
+  memcpy(hdr.magic, binmagic, sizeof(hdr.magic));
+  hdr.types  = bintypes();      /* store file id. and type signature */
+  hdr.mode   = bag->mode & (IB_WEIGHTS|TA_PACKED);
+  hdr.flags  = flags;           /* note the transaction bag mode */
+  hdr.icnt   = ib_cnt(bag->base);      /* and the flags as well as */
+  hdr.max    = bag->max;        /* the transaction bag parameters */
+  hdr.cnt    = bag->cnt;
+  hdr.wgt    = bag->wgt;
+  hdr.imax   = bag->base->max;
+  hdr.extent = bag->extent;
+  for (i = 0; i < hdr.icnt; i++)/* sum the sizes of the item names */
+    hdr.names += strlen(ib_name(bag->base, i)) +1;
+  for (k = 0; k < bag->cnt; k++)/* sum the sizes of the transactions */
+    hdr.tsize += BINREC(o, ((TRACT*)bag->tracts[k])->size, r);
+  file = fopen(fname, "wb");    /* open the binary output file */
+  if (!file) return E_FOPEN;    /* and write the file header */
+  e |= (fwrite(&hdr, sizeof(hdr), 1, file) != 1);
+  e |= binpad(file, sizeof(hdr));
+  memset(&rec, 0, sizeof(rec)); /* clear the item record */
+  for (i = 0; i < hdr.icnt; i++) {
+    itd = ib_itemdata(bag->base, i);
+    rec.pen = itd->pen;         /* traverse the items and */
+    rec.frq = itd->frq;         /* copy the item data */
+    rec.xfq = itd->xfq;         /* to the item record */
+    rec.app = itd->app;         /* write the item record */
+    e |= (fwrite(&rec, sizeof(rec), 1, file) != 1);
+  }                             /* (item data without names) */
+  e |= binpad(file, (size_t)hdr.icnt *sizeof(ITEMREC));
+  for (i = 0; i < hdr.icnt; i++) {
+    name = ib_name(bag->base, i);  /* traverse the items and */
+    z    = strlen(name) +1;     /* write their names */
+    e |= (fwrite(name, 1, z, file) != z);
+  }                             /* (including terminating '\0') */
+  e |= binpad(file, hdr.names); /* pad the item name block */
+  for (k = 0; k < bag->cnt; k++) {
+    t = (TRACT*)bag->tracts[k]; /* traverse the transactions */
+    z = o +(size_t)(t->size+1) *r;
+    e |= (fwrite(t, 1, z, file) != z);
+    e |= binpad(file, z);       /* write the transaction */
+  }                             /* (including the sentinel) */
+  e |= (fclose(file) != 0);     /* close the binary output file */
+  return (e) ? E_FWRITE : 0;    /* return a write error indicator */
+}  /* tbg_save() */
+
+/*--------------------------------------------------------------------*/
+
+static int binerr (TABAG *bag, ITEM *map, int e)
+{                               /* --- clean up after load error */
+  if (map) free(map);           /* delete the item identifier map */
+  unmap(bag);                   /* release the loaded block */
+  return e;                     /* return the error code */
+}  /* binerr() */
+
+/*--------------------------------------------------------------------*/
+
+int tbg_load (TABAG *bag, const char *fname)
+{                               /* --- load a bag from a binary file */
+  ITEM     i, n;                /* loop variable, number of items */
+  TID      k;                   /* loop variable for transactions */
+  size_t   o, r, z;             /* item offset/size, record size */
+  ITEM     *map = NULL;         /* identifier map for recoding */
+  char     *p, *end;            /* to traverse the loaded block */
+  CCHAR    *name, *nend;        /* to traverse the item names */
+  TBGHDR   *hdr;                /* binary file header */
+  ITEMREC  *rec;                /* to traverse the item records */
+  ITEMDATA *itd;                /* to access the item data */
+  void     **tracts;            /* new transaction array */
+  ITEM     *s;                  /* to traverse the items */
+  WITEM    *a;                  /* to traverse the weighted items */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  FILE     *file;               /* binary input file */
+  long     size;                /* size of the input file */
+  #else                         /* if POSIX system */
+  int      fd;                  /* file descriptor of input file */
+  struct stat st;               /* file status (for the size) */
+  #endif
+
+  assert(bag && fname           /* check the function arguments */
+  &&   !bag->map && (bag->cnt <= 0)
+  &&   !(bag->base->mode & IB_OBJNAMES));
+
+  /* --- get the file contents --- */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  file = fopen(fname, "rb");    /* open the binary input file */
+  if (!file) return E_FOPEN;    /* and determine its size */
+  if ((fseek(file, 0, SEEK_END) != 0) || ((size = ftell(file)) < 0)
+  ||  (fseek(file, 0, SEEK_SET) != 0)) { fclose(file); return E_FREAD; }
+  bag->map = malloc((size_t)size +1);
+  if (!bag->map) { fclose(file); return E_NOMEM; }
+  bag->mapsz = (size_t)size;    /* read the whole file into memory */
+  if (fread(bag->map, 1, bag->mapsz, file) != bag->mapsz) {
+    fclose(file); unmap(bag); return E_FREAD; }
+  fclose(file);                 /* close the binary input file */
+  #else                         /* if POSIX system */
+  fd = open(fname, O_RDONLY);   /* open the binary input file */
+  if (fd < 0) return E_FOPEN;   /* and determine its size */
+  if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(TBGHDR))) {
+    close(fd); return E_FREAD; }
+  bag->mapsz = (size_t)st.st_size;
+  bag->map   = mmap(NULL, bag->mapsz, PROT_READ|PROT_WRITE,
+                    MAP_PRIVATE, fd, 0);
+  close(fd);                    /* map the file into memory */
+  if (bag->map == MAP_FAILED) { bag->map = NULL; bag->mapsz = 0;
+    return E_FREAD; }           /* (private mapping: the trans. */
+  #endif                        /* may be modified in memory) */
+
+  /* --- check the file header --- */
+  p   = (char*)bag->map;        /* get the loaded block */
+  end = p +bag->mapsz;          /* and its end */
+  hdr = (TBGHDR*)p;             /* check file id., type signature, */
+  if ((bag->mapsz < sizeof(TBGHDR))    /* item weight mode, and */
+  ||  (memcmp(hdr->magic, binmagic, sizeof(hdr->magic)) != 0)
+  ||  (hdr->types != bintypes())       /* the sizes of the blocks */
+  ||  ((hdr->mode ^ bag->mode) & IB_WEIGHTS)
+  ||  (hdr->icnt < 0) || (hdr->cnt < 0)
+  ||  (BINPAD(sizeof(TBGHDR)) +BINPAD((size_t)hdr->icnt*sizeof(ITEMREC))
+      +BINPAD(hdr->names) +hdr->tsize != bag->mapsz))
+    return binerr(bag, map, E_FREAD);
+  o = (bag->mode & IB_WEIGHTS) ? offsetof(WTRACT, items)
+                               : offsetof(TRACT,  items);
+  r = (bag->mode & IB_WEIGHTS) ? sizeof(WITEM) : sizeof(ITEM);
+
+  /* --- add the items to the item base --- */
+  n = ib_cnt(bag->base);        /* get the number of known items */
+  if (n > 0) {                  /* if the item base is not empty */
+    map = (ITEM*)malloc((size_t)hdr->icnt *sizeof(ITEM)+1);
+    if (!map) return binerr(bag, map, E_NOMEM);
+  }                             /* create an item identifier map */
+  rec  = (ITEMREC*)(p += BINPAD(sizeof(TBGHDR)));
+  name = p += BINPAD((size_t)hdr->icnt *sizeof(ITEMREC));
+  nend = name +hdr->names;      /* get the item records and names */
+  p   += BINPAD(hdr->names);    /* and check the last item name */
+  if ((hdr->names > 0) && (nend[-1] != 0))
+    return binerr(bag, map, E_FREAD);
+  for (i = 0; i < hdr->icnt; i++, rec++) {
+    if (name >= nend) return binerr(bag, map, E_FREAD);
+    if (map) {                  /* if to map to known items */
+      itd = (ITEMDATA*)idm_bykey(bag->base->idmap, name);
+      if (!itd) {               /* if the item is not known yet */
+        n = ib_add(bag->base, name);
+        if (n < 0) return binerr(bag, map, E_NOMEM);
+        itd = ib_itemdata(bag->base, n);
+      }                         /* add the item to the item base */
+      map[i] = itd->id;         /* note the new item identifier */
+      itd->frq += rec->frq;     /* and sum the item frequencies */
+      itd->xfq += rec->xfq; }
+    else {                      /* if the item base was empty */
+      n = ib_add(bag->base, name);
+      if (n < -1) return binerr(bag, map, E_FREAD);
+      if (n <  0) return binerr(bag, map, E_NOMEM);
+      itd = ib_itemdata(bag->base, n);
+      itd->app = rec->app;      /* add the item to the item base */
+      itd->pen = rec->pen;      /* (identifiers are preserved) */
+      itd->frq = rec->frq;      /* and copy the item data */
+      itd->xfq = rec->xfq;      /* from the item record */
+    }
+    if (itd->frq > bag->base->max) bag->base->max = itd->frq;
+    name += strlen(name) +1;    /* update maximum item support and */
+  }                             /* skip the name of the item */
+  bag->base->wgt += hdr->wgt;   /* sum the transaction weight */
+
+  /* --- collect the transactions --- */
+  if (hdr->cnt > bag->size) {   /* if the transaction array is small */
+    tracts = (void**)realloc(bag->tracts,
+                             (size_t)hdr->cnt *sizeof(TRACT*));
+    if (!tracts) return binerr(bag, map, E_NOMEM);
+    bag->tracts = tracts; bag->size = hdr->cnt;
+  }                             /* enlarge the transaction array */
+  for (k = 0; k < hdr->cnt; k++) {
+    if ((size_t)(end-p) < o+r)  /* check the transaction record */
+      return binerr(bag, map, E_FREAD);
+    n = ((TRACT*)p)->size;      /* get the transaction size */
+    if ((n < 0) || ((size_t)(end-p) < (z = BINREC(o, n, r))))
+      return binerr(bag, map, E_FREAD);
+    bag->tracts[k] = p;         /* store the transaction (no copy) */
+    p += z;                     /* and go to the next record */
+    if (hdr->mode & TA_PACKED)  /* unpack the items (in place) */
+      ta_unpack((TRACT*)bag->tracts[k], +1);
+    if (!map) continue;         /* check whether to recode the items */
+    if (bag->mode & IB_WEIGHTS) {  /* if the items carry weights */
+      for (a = ((WTRACT*)bag->tracts[k])->items; a->item >= 0; a++) {
+        if (a->item >= hdr->icnt) return binerr(bag, map, E_FREAD);
+        a->item = map[a->item];
+      } }                       /* map the items to the known ones */
+    else {                      /* if the items do not carry weights */
+      for (s = ((TRACT*)bag->tracts[k])->items; *s > TA_END; s++) {
+        if ((*s < 0) || (*s >= hdr->icnt))
+          return binerr(bag, map, E_FREAD);
+        *s = map[*s];           /* map the items to the known ones */
+      }                         /* (items have been unpacked) */
+    }
+  }
+  bag->cnt     = hdr->cnt;      /* set the number of transactions */
+  bag->wgt    += hdr->wgt;      /* and the transaction parameters */
+  bag->extent += hdr->extent;
+  if (hdr->max > bag->max) bag->max = hdr->max;
+  if (!map)                     /* return the file flags */
+    return (hdr->mode & TA_PACKED) ? hdr->flags & ~TBG_SORTED
+                                   : hdr->flags;
+  free(map);                    /* delete the item identifier map */
+  return 0;                     /* (recoded transactions are neither */
+}  /* tbg_load() */             /* sorted nor reduced in general) */
+
+/* Packed transactions (see tbg_pack()) are unpacked while loading, */
+/* because the miners and the other functions that process a loaded */
+/* bag may not be able to handle packed items. Unpacking is done in */
+/* place, since a packed transaction keeps its original size. The   */
+/* unpacked transactions are still unique, but their order may      */
+/* differ from the sorted order, so the flag TBG_SORTED is cleared. */
+
+/*--------------------------------------------------------------------*/
+
+int tbg_isbin (const char *fname)
+{                               /* --- check for a binary file */
+  FILE   *file;                 /* file to check */
+  size_t n;                     /* number of bytes read */
+  char   buf[sizeof(binmagic)]; /* buffer for file identification */
+
+  if (!fname || !*fname)        /* standard input cannot be checked */
+    return 0;                   /* (cannot read the data twice) */
+  file = fopen(fname, "rb");    /* open the file to check */
+  if (!file) return 0;          /* (errors are reported on reading) */
+  n = fread(buf, 1, sizeof(buf), file);
+  fclose(file);                 /* read the file identification */
+  return (n == sizeof(buf)) && (memcmp(buf, binmagic, n) == 0);
+}  /* tbg_isbin() */            /* compare to the binary file id. */
+
+/*--------------------------------------------------------------------*/
+
 int tbg_istab (TABAG *bag)
 {                               /* --- check for table-derived data */
   int      r = -1;              /* result of check for table */
-  ITEM     i, n, z;             /* loop variable for items */
-  TID      k;                   /* loop variable for transactions */
+  ITEM     i, n, z = -1;        /* loop variable for items */
   TRACT    *t;                  /* to traverse the transactions */
   ITEMDATA *itd;                /* to traverse the item data */
   IDMAP    *idmap;              /* item identifier map */
+  TBGITER  *iter;               /* to traverse the transactions */
 
   assert(bag                    /* check the function arguments */
   &&   ((bag->mode & TA_PACKED) == 0));
   if (bag->cnt <= 1) return 0;  /* check for at most one transaction */
+  if (!(iter = tbi_create(bag))) return 0;
   idmap = bag->base->idmap;     /* get the item identifier map */
   n     = idm_cnt(idmap);       /* get the number of items and */
   for (i = n; --i >= 0; )       /* clear the occurrence columns */
     ((ITEMDATA*)idm_byid(idmap, i))->idx = -1;
-  z = ((TRACT*)bag->tracts[0])->size;   /* get transaction size */
-  for (k = bag->cnt; --k >= 0; ) {
-    t = bag->tracts[k];         /* traverse the transactions */
+  while ((t = tbi_next(iter)) != NULL) {
+    if (z < 0) z = t->size;     /* traverse the transactions */
     if (t->size != z) {         /* check the size of the transactions */
       r = 0; break; }           /* (must all have the same size) */
     for (i = t->size; --i >= 0; ) { /* traverse the items */
@@ -1923,6 +2749,7 @@ int tbg_istab (TABAG *bag)
       else if (itd->idx != (TID)i) { r = 0; break; }
     }                           /* check whether all items always */
   }                             /* occur in the same column */
+  tbi_delete(iter);             /* delete the transaction iterator */
   bag->base->idx = 1;           /* reset the global marker/index */
   for (i = n; --i >= 0; )       /* and the item markers/indices */
     ((ITEMDATA*)idm_byid(idmap, i))->idx = 0;
@@ -2105,7 +2932,148 @@ void tbg_trim (TABAG *bag, ITEM min, const int *marks, double wgt)
 
 /*--------------------------------------------------------------------*/
 
-void tbg_itsort (TABAG *bag, int dir, int heap)
+void tbg_setcpus (TABAG *bag, int cpus)
+{                               /* --- set number of threads */
+  assert(bag);                  /* check the function argument */
+  if (cpus <= 0) cpus = cpucnt();
+  bag->cpus = (cpus > 1) ? cpus : 1;
+}  /* tbg_setcpus() */          /* (<= 0: use all processors) */
+
+/*--------------------------------------------------------------------*/
+
+static int sortcpus (TABAG *bag)
+{                               /* --- get threads for sorting */
+  TID n;                        /* maximum number of threads */
+
+  assert(bag);                  /* check the function argument */
+  n = bag->cnt /RS_MINPAR;      /* give each thread enough work */
+  return (n < (TID)bag->cpus) ? ((n > 1) ? (int)n : 1) : bag->cpus;
+}  /* sortcpus() */
+
+/*--------------------------------------------------------------------*/
+
+static void itcsort (TRACT **tracts, TID n, ITEM k, int dir, int mode,
+                     TID *cnts, TID *tids, ITEM *fill)
+{                               /* --- sort items with counting sort */
+  TID    b, e, i, m;            /* block boundaries, loop variables */
+  ITEM   x, z;                  /* item and transaction size */
+  ITEM   *p, *q;                /* to traverse the items */
+  size_t ext;                   /* extent of a block */
+  TRACT  *t;                    /* to traverse the transactions */
+  void   (*sortfn)(ITEM*, size_t, int);  /* sort function */
+
+  assert(tracts && cnts && tids && fill);  /* check the arguments */
+  sortfn = (mode & TA_HEAP) ? ia_heapsort : ia_qsort;
+  for (b = 0; b < n; b = e) {   /* traverse the blocks of trans. */
+    for (ext = 0, e = b; (e < n) && (e-b < RS_EXTENT); e++) {
+      t = tracts[e]; z = t->size; /* get the next transaction */
+      while ((z > 0) && (t->items[z-1] <= TA_END))
+        --z;                    /* skip additional end markers */
+      if ((ext +(size_t)z > RS_EXTENT) && (e > b))
+        break;                  /* if the block is full, abort */
+      fill[e-b] = z; ext += (size_t)z;
+    }                           /* note the transaction sizes */
+    if ((ext >= (size_t)k) && (ext <= RS_EXTENT)) {
+      memset(cnts, 0, (size_t)(k+1) *sizeof(TID));
+      for (i = b; i < e; i++) { /* traverse the transactions */
+        for (p = tracts[i]->items, q = p +fill[i-b]; p < q; p++) {
+          if ((*p < 0) || (*p >= k)) break;
+          cnts[*p+1] += 1;      /* count the item occurrences */
+        }                       /* (need plain item identifiers) */
+        if (p < q) break;       /* if a packed item was found, */
+      }                         /* counting sort is not possible */
+      if (i >= e) {             /* if all items could be counted */
+        for (x = 0; x < k; x++) /* compute the start offsets */
+          cnts[x+1] += cnts[x]; /* of the item sections */
+        for (i = b; i < e; i++) /* collect the transaction indices */
+          for (p = tracts[i]->items, q = p +fill[i-b]; p < q; p++)
+            tids[cnts[*p]++] = i-b;
+        for (i = b; i < e; i++) /* clear the fill counters */
+          fill[i-b] = 0;        /* (cnts[x] is now section end) */
+        if (dir < 0) {          /* if to sort descendingly */
+          for (x = k; --x >= 0; ) {
+            for (m = (x > 0) ? cnts[x-1] : 0; m < cnts[x]; m++) {
+              t = tracts[b+tids[m]];
+              t->items[fill[tids[m]]++] = x;
+            }                   /* traverse the items in descending */
+          } }                   /* order and store them in the */
+        else {                  /* transactions they occur in */
+          for (m = 0, x = 0; x < k; x++) {
+            for ( ; m < cnts[x]; m++) {
+              t = tracts[b+tids[m]];
+              t->items[fill[tids[m]]++] = x;
+            }                   /* traverse the items in ascending */
+          }                     /* order and store them in the */
+        }                       /* transactions they occur in */
+        continue;               /* the block has been sorted */
+      }
+    }
+    for (i = b; i < e; i++)     /* if counting sort is not possible */
+      if (fill[i-b] > 1)        /* or not favorable, sort the items */
+        sortfn(tracts[i]->items, (size_t)fill[i-b], dir);
+  }                             /* in each transaction individually */
+}  /* itcsort() */
+
+/* Counting sort needs a counter for each item, which have to be     */
+/* cleared and traversed for each block of transactions. Hence it is */
+/* used only if the number of item instances in a block is at least  */
+/* as large as the number of items. The blocks are limited in size   */
+/* (RS_EXTENT item instances), so that the transactions of a block   */
+/* stay in the cache while the items are written back.               */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(itwork, p)
+{                               /* --- sort items (worker) */
+  SORTWORK *w = (SORTWORK*)p;   /* type the argument pointer */
+  itcsort(w->tracts, w->n, w->k, w->dir, w->mode,
+          w->cnts, w->tids, w->fill);
+  return THREAD_OK;             /* sort the items in the trans. */
+}  /* itwork() */               /* of the worker's range */
+
+/*--------------------------------------------------------------------*/
+
+static int itradix (TABAG *bag, int dir, int mode)
+{                               /* --- sort items with radix sort */
+  int      i, c;                /* loop variable, number of threads */
+  ITEM     k;                   /* number of items */
+  TID      n;                   /* number of transactions */
+  size_t   z;                   /* number of TIDs per worker */
+  SORTWORK *w;                  /* data for the workers */
+  TID      *buf;                /* buffer for counters etc. */
+
+  assert(bag);                  /* check the function argument */
+  k = ib_cnt(bag->base);        /* get the number of items */
+  n = bag->cnt;                 /* and the number of transactions */
+  c = sortcpus(bag);            /* and the number of threads */
+  z = (size_t)k+1 +RS_EXTENT;   /* compute the buffer size */
+  w = (SORTWORK*)malloc((size_t)c *sizeof(SORTWORK));
+  if (!w) return -1;            /* create the worker data */
+  buf = (TID*)malloc((size_t)c *(z *sizeof(TID)
+                                +RS_EXTENT *sizeof(ITEM)));
+  if (!buf) { free(w); return -1; }
+  for (i = 0; i < c; i++) {     /* traverse the workers */
+    w[i].tracts = (TRACT**)bag->tracts
+                + (TID)(((double)n *(double) i)    /(double)c);
+    w[i].n      = (TID)(((double)n *(double)(i+1)) /(double)c)
+                - (TID)(((double)n *(double) i)    /(double)c);
+    w[i].k      = k;            /* compute the transaction range */
+    w[i].dir    = dir;          /* and note the parameters */
+    w[i].mode   = mode;
+    w[i].buf    = NULL;         /* set the buffers of the worker */
+    w[i].cnts   = buf +(size_t)i *z;
+    w[i].tids   = w[i].cnts +(size_t)k+1;
+    w[i].fill   = (ITEM*)(buf +(size_t)c *z) +(size_t)i *RS_EXTENT;
+  }
+  if (c > 1) runpar(w, sizeof(SORTWORK), c, itwork);
+  else       itwork(w);         /* sort the items in the trans. */
+  free(buf); free(w);           /* delete the buffers */
+  return 0;                     /* return 'ok' */
+}  /* itradix() */
+
+/*--------------------------------------------------------------------*/
+
+void tbg_itsort (TABAG *bag, int dir, int mode)
 {                               /* --- sort items in transactions */
   ITEM   k;                     /* number of items */
   TID    n;                     /* loop variable */
@@ -2119,8 +3087,9 @@ void tbg_itsort (TABAG *bag, int dir, int heap)
       x = (WTRACT*)bag->tracts[n]; /* traverse the transactions */
       wi_sort(x->items, x->size, dir);
     } }                         /* sort the items in each transaction */
-  else {                        /* if the items do not carry weights */
-    sortfn = (heap) ? ia_heapsort : ia_qsort;
+  else if (!(mode & TA_RADIX)   /* if not to use counting sort */
+  ||       (bag->mode & TA_PACKED) || (itradix(bag, dir, mode) != 0)) {
+    sortfn = (mode & TA_HEAP) ? ia_heapsort : ia_qsort;
     for (n = 0; n < bag->cnt; n++) {
       t = (TRACT*)bag->tracts[n];  /* traverse the transactions */
       k = t->size;              /* get transaction and its size */
@@ -2253,6 +3222,75 @@ static void sort (TRACT **tracts, TID n, ITEM o,
 
 /*--------------------------------------------------------------------*/
 
+static WORKERDEF(srtwork, p)
+{                               /* --- sort transactions (worker) */
+  SORTWORK *w = (SORTWORK*)p;   /* type the argument pointer */
+  TRACT    **t, **s, **e;       /* to traverse the transactions */
+  ITEM     x;                   /* first item of a section */
+
+  for (s = t = w->tracts, e = t +w->n; t < e; s = t) {
+    x = (*t)->items[0];         /* traverse the sections with */
+    while ((++t < e) && ((*t)->items[0] == x))
+      ;                         /* the same first item */
+    if ((x > TA_END) && (t-s > 1))
+      sort(s, (TID)(t-s), 1, w->buf +(s-w->tracts), w->cnts, w->k, -1);
+  }                             /* sort the sections recursively */
+  return THREAD_OK;             /* return a dummy result */
+}  /* srtwork() */
+
+/*--------------------------------------------------------------------*/
+
+static int parsort (TRACT **tracts, TID n, TRACT **buf, ITEM k, int c)
+{                               /* --- sort trans. with threads */
+  int      i;                   /* loop variable */
+  ITEM     x;                   /* item at the first position */
+  TID      b, e;                /* range of a worker */
+  TRACT    **t;                 /* to traverse the transactions */
+  SORTWORK *w;                  /* data for the workers */
+  TID      *cnts;               /* counters for bin sort */
+
+  assert(tracts && buf && (c > 1)); /* check the function arguments */
+  w = (SORTWORK*)malloc((size_t)c *sizeof(SORTWORK));
+  if (!w) return -1;            /* create the worker data */
+  cnts = (TID*)malloc((size_t)c *((size_t)k+2) *sizeof(TID));
+  if (!cnts) { free(w); return -1; }
+  memset(cnts, 0, ((size_t)k+1) *sizeof(TID));
+  for (t = tracts+n; --t >= tracts; ) {
+    x = (*t)->items[0];         /* traverse the transactions and */
+    cnts[(x < 0) ? 0 : x+1]++;  /* count them per first item */
+  }                             /* (0 for empty transactions) */
+  for (x = 0; x < k; x++)       /* compute the offsets */
+    cnts[x+1] += cnts[x];       /* for storing the transactions */
+  memcpy(buf, tracts, (size_t)n *sizeof(TRACT*));
+  for (t = buf+n; --t >= buf; ) {
+    x = (*t)->items[0];         /* sort the transactions w.r.t. */
+    tracts[--cnts[(x < 0) ? 0 : x+1]] = *t;
+  }                             /* the item at the first position */
+  for (b = 0, i = 0; i < c; i++) {
+    e = (i+1 >= c) ? n : (TID)(((double)n *(double)(i+1)) /(double)c);
+    if (e < b) e = b;           /* compute the end of the range */
+    while ((e > 0) && (e < n)   /* and move it to a section start */
+    &&     (tracts[e]->items[0] == tracts[e-1]->items[0])) e++;
+    w[i].tracts = tracts +b;    /* note the transaction range */
+    w[i].n      = e -b;         /* and the sorting parameters */
+    w[i].k      = k;  w[i].dir = +1; w[i].mode = 0;
+    w[i].buf    = buf +b;       /* set the buffers of the worker */
+    w[i].cnts   = cnts +(size_t)i *((size_t)k+2) +1;
+    w[i].tids   = NULL; w[i].fill = NULL;
+    b = e;                      /* start the next range */
+  }                             /* at the end of the current one */
+  runpar(w, sizeof(SORTWORK), c, srtwork);  /* sort in parallel */
+  free(cnts); free(w);          /* delete the buffers */
+  return 0;                     /* return 'ok' */
+}  /* parsort() */
+
+/* The transactions are distributed w.r.t. their first item (one   */
+/* pass of a bin sort) and the ranges of the threads are aligned    */
+/* with the sections formed by this, so that the threads can sort   */
+/* the sections recursively without ever touching the same element. */
+
+/*--------------------------------------------------------------------*/
+
 void tbg_sort (TABAG *bag, int dir, int mode)
 {                               /* --- sort a transaction bag */
   ITEM  k;                      /* number of items */
@@ -2276,7 +3314,10 @@ void tbg_sort (TABAG *bag, int dir, int mode)
     if ((size_t)k < (size_t)n){ /* if bin sort is possible/favorable, */
       cnts = (TID*)(buf+n)+1;   /* use bin sort to sort transactions */
       mask = (mode & TA_EQPACK) ? ITEM_MIN : -1;
-      sort((TRACT**)bag->tracts, n, 0, buf, cnts, k, mask);
+      if (!(mode & TA_RADIX)    /* if not to sort in parallel */
+      ||   (bag->mode & TA_PACKED) || (sortcpus(bag) <= 1)
+      ||   (parsort((TRACT**)bag->tracts, n, buf, k, sortcpus(bag)) != 0))
+        sort((TRACT**)bag->tracts, n, 0, buf, cnts, k, mask);
       if (dir < 0)              /* if necessary, reverse the order */
         ptr_reverse(bag->tracts, (size_t)n); }
     else {                      /* if more items than transactions */
@@ -2335,17 +3376,17 @@ TID tbg_reduce (TABAG *bag, int keep0)
                                    :  ta_cmp(*s, *d, NULL);
     if (c == 0) {               /* if the transactions are equal */
       (*d)->wgt += (*s)->wgt;   /* combine the transactions */
-      free(*s); }               /* by summing their weights */
+      tafree(bag, *s); }        /* by summing their weights */
     else {                      /* if transactions are not equal */
       if (keep0 || ((*d)->wgt != 0))
         bag->extent += (size_t)(*d++)->size;
-      else free(*d);            /* check weight of old transaction */
+      else tafree(bag, *d);     /* check weight of old transaction */
       *d = *s;                  /* copy the new transaction */
     }                           /* to close a possible gap */
   }                             /* (collect unique transactions) */
   if (keep0 || ((*d)->wgt != 0))
     bag->extent += (size_t)(*d++)->size;
-  else free(*d);                /* check weight of last transaction */
+  else tafree(bag, *d);         /* check weight of last transaction */
   return bag->cnt = (TID)(d -(TRACT**)bag->tracts);
 }  /* tbg_reduce() */           /* return new number of transactions */
 
@@ -2567,6 +3608,106 @@ int tbg_ipwgt (TABAG *bag, int mode)
   return 0;                     /* return 'ok' */
 }  /* tbg_ipwgt() */
 
+/*--------------------------------------------------------------------*/
+
+int tbg_compress (TABAG *bag)
+{                               /* --- compress the transactions */
+  int    dir;                   /* direction of the item order */
+  int    asc, dsc, w;           /* flags for item orders and weights */
+  TID    i, b;                  /* loop variable, number of blocks */
+  ITEM   y;                     /* previous (unpacked) item */
+  size_t z, n;                  /* size of the encoded data */
+  TRACT  *t;                    /* to traverse the transactions */
+  const ITEM *s;                /* to traverse the items */
+  TAZIP  *zip;                  /* compressed transactions */
+
+  assert(bag);                  /* check the function argument */
+  if (bag->zip) return 0;       /* check for compressed trans. */
+  if (bag->mode & IB_WEIGHTS) return 1;
+  asc = dsc = 1; w = 0;         /* weighted items are not supported */
+  for (i = 0; i < bag->cnt; i++) {
+    t = (TRACT*)bag->tracts[i]; /* traverse the transactions */
+    if (t->wgt != 1) w = 1;     /* check for non-unit weights */
+    for (y = -1, s = t->items; *s > TA_END; s++) {
+      if (*s < 0) continue;     /* traverse the unpacked items */
+      if (y >= 0) { if (*s <= y) asc = 0; if (*s >= y) dsc = 0; }
+      y = *s;                   /* check whether the items are */
+    }                           /* in ascending or descending order */
+  }
+  dir = (asc) ? +1 : (dsc) ? -1 : 0;
+  for (z = 0, i = 0; i < bag->cnt; i++)
+    z += tzenc((TRACT*)bag->tracts[i], dir, NULL);
+  b = (bag->cnt +TZ_BLKSIZE-1) /TZ_BLKSIZE;
+  n = sizeof(TAZIP) +(size_t)b *sizeof(size_t)
+    + ((w) ? (size_t)bag->cnt *sizeof(SUPP) : 0);
+  zip = (TAZIP*)malloc(n +z);   /* allocate all memory in one block */
+  if (!zip) return -1;          /* and organize it */
+  zip->dir  = dir;
+  zip->size = z;
+  zip->offs = (size_t*)(zip+1);
+  zip->wgts = (w) ? (SUPP*)(zip->offs +b) : NULL;
+  zip->data = (unsigned char*)zip +n;
+  for (z = 0, i = 0; i < bag->cnt; i++) {
+    t = (TRACT*)bag->tracts[i]; /* traverse the transactions */
+    if (i % TZ_BLKSIZE == 0) zip->offs[i /TZ_BLKSIZE] = z;
+    if (zip->wgts) zip->wgts[i] = t->wgt;
+    z += tzenc(t, dir, zip->data +z);
+    tafree(bag, t);             /* encode the transaction */
+  }                             /* and delete the original */
+  free(bag->tracts);            /* delete the transaction array */
+  bag->tracts = NULL; bag->size = 0;
+  unmap(bag);                   /* release a loaded block */
+  if (bag->htab) { free(bag->htab); bag->htab = NULL; }
+  bag->hsize = 0;               /* delete the duplicate hash table */
+  bag->zip   = zip;             /* note the compressed transactions */
+  return 0;                     /* return 'ok' */
+}  /* tbg_compress() */
+
+/*--------------------------------------------------------------------*/
+
+int tbg_expand (TABAG *bag)
+{                               /* --- expand compressed trans. */
+  TID     i;                    /* loop variable */
+  size_t  z;                    /* size of a transaction */
+  TRACT   *t, *d;               /* decoded and copied transaction */
+  TBGITER *iter;                /* to traverse the transactions */
+
+  assert(bag);                  /* check the function argument */
+  if (!bag->zip) return 0;      /* check for compressed trans. */
+  bag->tracts = (void**)malloc((size_t)bag->cnt *sizeof(TRACT*));
+  if (!bag->tracts) return -1;  /* create a transaction array */
+  iter = tbi_create(bag);       /* and a transaction iterator */
+  if (!iter) { free(bag->tracts); bag->tracts = NULL; return -1; }
+  for (i = 0; i < bag->cnt; i++) {
+    t = tbi_next(iter);         /* traverse the transactions */
+    z = sizeof(TRACT) +(size_t)t->size *sizeof(ITEM);
+    d = (TRACT*)malloc(z);      /* allocate a new transaction */
+    if (!d) break;              /* and copy the decoded one */
+    bag->tracts[i] = memcpy(d, t, z);
+  }
+  tbi_delete(iter);             /* delete the transaction iterator */
+  if (i < bag->cnt) {           /* if an allocation failed */
+    while (--i >= 0) free(bag->tracts[i]);
+    free(bag->tracts); bag->tracts = NULL; return -1;
+  }                             /* delete the decoded transactions */
+  free(bag->zip); bag->zip = NULL;
+  bag->size = bag->cnt;         /* delete the compressed trans. */
+  return 0;                     /* return 'ok' */
+}  /* tbg_expand() */
+
+/* A compressed transaction bag stores the transactions in one block */
+/* of memory: the number of elements (with a flag for packed items), */
+/* the first item code and the differences of consecutive item codes */
+/* (minus one for an ascending or descending order, zigzag coded for */
+/* any other order), each as a variable length number (7 bits per    */
+/* byte). Unit transaction weights are not stored, and an offset is  */
+/* recorded for every TZ_BLKSIZE-th transaction, so that an iterator */
+/* can start anywhere. Transaction marks are not kept. Apart from    */
+/* the size and weight information, a compressed bag supports only  */
+/* iteration (tbi_...()), counting items (tbg_icnts(), tbg_ifrqs()), */
+/* cloning, copying (into an expanded bag) and deletion. All other   */
+/* functions require the bag to be expanded with tbg_expand() first. */
+
 /*--------------------------------------------------------------------*/
 #ifndef NDEBUG
 
@@ -2650,6 +3791,7 @@ TABAG* tbg_random (TABAG *src, RNG *rng, TABAG *dst)
   TRACT   *t;                   /* to traverse transactions */
   ITEM    *s, *d;               /* to traverse transaction items */
   ITEMFRQ *ifrq, f;             /* item frequencies, swap buffer */
+  TBGITER *iter;                /* to traverse source transactions */
 
   assert(src && rng             /* check the function arguments */
   &&   !(src->mode & (TA_PACKED|IB_WEIGHTS)));
@@ -2660,10 +3802,12 @@ TABAG* tbg_random (TABAG *src, RNG *rng, TABAG *dst)
     if (!ifrq) return NULL;     /* create an item frequency buffer */
     for (i = 0; i < n; i++) {   /* initialize the item frequencies */
       ifrq[i].item = i; ifrq[i].frq = 0; }
-    for (k = src->cnt; --k >= 0; ) {
-      for (s = ((TRACT*)src->tracts[k])->items; *s > TA_END; s++)
+    if (!(iter = tbi_create(src))) return NULL;
+    while ((t = tbi_next(iter)) != NULL) {
+      for (s = t->items; *s > TA_END; s++)
         ifrq[*s].frq += 1;      /* traverse the transactions and */
     }                           /* count the item occurrences */
+    tbi_delete(iter);           /* delete the iterator */
     for (z = 0, i = 0; i < n; i++)
       z += (size_t)ifrq[i].frq; /* sum the item frequencies */
     assert(z == src->extent);   /* and check against extent */
@@ -2692,10 +3836,12 @@ TABAG* tbg_random (TABAG *src, RNG *rng, TABAG *dst)
     for (s = ((TRACT*)dst->tracts[k])->items; *s > TA_END; s++)
       ifrq[*s].dif += 1;        /* traverse the transactions and */
   }                             /* count the item occurrences */
-  for (k = src->cnt; --k >= 0; ) {
-    for (s = ((TRACT*)src->tracts[k])->items; *s > TA_END; s++)
+  if (!(iter = tbi_create(src))) return NULL;
+  while ((t = tbi_next(iter)) != NULL) {
+    for (s = t->items; *s > TA_END; s++)
       ifrq[*s].dif -= 1;        /* traverse the transactions and */
   }                             /* count the item occurrences */
+  tbi_delete(iter);             /* delete the iterator */
   for (z = 0, i = 0; i < n; i++)/* det. amount of over-representation */
     if (ifrq[i].dif > 0) z += (size_t)ifrq[i].dif;
   for (k = dst->cnt; (--k >= 0) && (z > 0); ) {
@@ -3010,7 +4156,7 @@ static int create (TANODE *node, TRACT **tracts, TID cnt, ITEM index)
 
 /*--------------------------------------------------------------------*/
 
-TATREE* tat_create (TABAG *bag)
+TATREE* tat_createx (TABAG *bag, int mode)
 {                               /* --- create a transactions tree */
   TATREE *tree;                 /* created transaction tree */
 
@@ -3018,6 +4164,7 @@ TATREE* tat_create (TABAG *bag)
   tree = (TATREE*)malloc(sizeof(TATREE));
   if (!tree) return NULL;       /* create the transaction tree body */
   tree->bag = bag;              /* note the underlying item set */
+  (void)mode;                   /* (flat layout is not supported) */
   if (bag->cnt <= 0) {          /* if the transaction bag is empty */
     tree->root.max  = 0; tree->root.wgt = 0;
     tree->root.data = tree->suffix; }  /* store empty trans. suffix */
@@ -3028,7 +4175,7 @@ TATREE* tat_create (TABAG *bag)
   tree->root.item = (ITEM)-1;   /* root node represents no item */
   tree->suffix[0] = TA_END;     /* init. the empty trans. suffix */
   return tree;                  /* return the created tree */
-}  /* tat_create() */
+}  /* tat_createx() */
 
 /*--------------------------------------------------------------------*/
 
@@ -3140,6 +4287,27 @@ TANODE* tan_child (const TANODE *node, ITEM index)
 
 /*--------------------------------------------------------------------*/
 
+const ITEM* tan_widen (const TANODE *node, ITEM *buf)
+{                               /* --- get the items of a leaf */
+  ITEM         i;               /* loop variable */
+  const ITEM16 *s;              /* to traverse the narrow items */
+
+  assert(node && buf && (node->size < 0));
+  s = (const ITEM16*)node->items;
+  for (i = -node->size; --i >= 0; )
+    buf[i] = (ITEM)s[i];        /* widen the items of the suffix */
+  return buf;                   /* and return the item buffer */
+}  /* tan_widen() */
+
+/* In a narrow tree (see tat_narrow()) the transaction suffixes in  */
+/* the leaves are stored as 16 bit items, which halves the memory   */
+/* that is needed for them. They have to be retrieved with this     */
+/* function, which copies them into a buffer that must be able to   */
+/* hold tan_max(tat_root(tree)) items. The items of inner nodes are */
+/* always stored with full width.                                   */
+
+/*--------------------------------------------------------------------*/
+
 void delete (TANODE *root)
 {                               /* --- delete a transaction (sub)tree */
   ITEM   i;                     /* loop variable */
@@ -3155,24 +4323,53 @@ void delete (TANODE *root)
 
 /*--------------------------------------------------------------------*/
 
-TANODE* create (TRACT **tracts, TID cnt, ITEM index)
+#define LEAFSIZE(n)  (sizeof(TANODE) \
+                     +(size_t)(((n) > 1) ? (n)-1 : 0) *sizeof(ITEM))
+#define NODESIZE(n)  (LEAFSIZE(n) +PAD(LEAFSIZE(n)) \
+                     +(size_t)(n) *sizeof(TANODE*))
+#define NLEAFSIZE(n) (sizeof(TANODE) \
+                     +(size_t)(((n) > 2) ? (n)-2 : 0) *sizeof(ITEM16))
+
+/*--------------------------------------------------------------------*/
+
+static TANODE* newnode (size_t size, char **mem)
+{                               /* --- allocate a tree node */
+  TANODE *node;                 /* created tree node */
+
+  if (!mem) return (TANODE*)malloc(size);
+  node = (TANODE*)*mem;         /* take the node from the block */
+  *mem += BINPAD(size);         /* and advance the block pointer */
+  return node;                  /* return the allocated node */
+}  /* newnode() */
+
+/*--------------------------------------------------------------------*/
+
+static TANODE* create (TRACT **tracts, TID cnt, ITEM index,
+                       char **mem, int narrow)
 {                               /* --- recursive part of tat_create() */
   TID    i;                     /* loop variable */
   ITEM   item, k, n;            /* item identifier and counter */
   SUPP   w;                     /* item weight */
-  size_t z;                     /* size of the node with item array */
   TANODE *node;                 /* node of created transaction tree */
   TANODE **chn;                 /* array of child nodes */
+  ITEM16 *s;                    /* to store a narrow suffix */
 
   assert(tracts                 /* check the function arguments */
   &&    (cnt > 0) && (index >= 0));
   if (cnt <= 1) {               /* if only one transaction left */
     n    = (*tracts)->size -index;
-    node = (TANODE*)malloc(sizeof(TANODE) +(size_t)(n-1) *sizeof(ITEM));
+    node = newnode((narrow) ? NLEAFSIZE(n) : LEAFSIZE(n), mem);
     if (!node) return NULL;     /* create a transaction tree node */
     node->wgt  = (*tracts)->wgt;/* and initialize the fields */
     node->size = -(node->max = n);
-    if (n > 0)                  /* copy the transaction suffix */
+    if (narrow) {               /* if to store narrow items */
+      s = (ITEM16*)node->items; /* copy the transaction suffix */
+      for (k = 0; k < n; k++) { /* with 16 bit items */
+        assert(((*tracts)->items[index+k] >= 0)
+        &&     ((*tracts)->items[index+k] <= USHRT_MAX));
+        s[k] = (ITEM16)(*tracts)->items[index+k];
+      } }
+    else if (n > 0)             /* copy the transaction suffix */
       memcpy(node->items, (*tracts)->items +index,
                           (size_t)n *sizeof(ITEM));
     return node;                /* copy the remaining items and */
@@ -3185,8 +4382,7 @@ TANODE* create (TRACT **tracts, TID cnt, ITEM index)
     k  = tracts[i]->items[index];
     if (k != item) { item = k; n++; }
   }                             /* count the different items */
-  z = sizeof(TANODE) +(size_t)(n-1) *sizeof(ITEM);
-  node = (TANODE*)malloc(z +PAD(z) +(size_t)n *sizeof(TANODE*));
+  node = newnode(NODESIZE(n), mem);
   if (!node) return NULL;       /* create a transaction tree node */
   node->wgt  = w;               /* and initialize its fields */
   node->max  = 0;
@@ -3198,7 +4394,7 @@ TANODE* create (TRACT **tracts, TID cnt, ITEM index)
     node->items[n] = item = tracts[cnt]->items[index];
     for (i = cnt; --i >= 0; )   /* find trans. with the current item */
       if (tracts[i]->items[index] != item) break;
-    chn[n] = create(tracts+i+1, cnt-i, index+1);
+    chn[n] = create(tracts+i+1, cnt-i, index+1, mem, narrow);
     if (!chn[n]) break;         /* recursively create a subtree */
     if ((k = chn[n]->max +1) > node->max) node->max = k;
   }                             /* adapt the maximal remaining size */
@@ -3209,32 +4405,235 @@ TANODE* create (TRACT **tracts, TID cnt, ITEM index)
   return NULL;                  /* return 'failure' */
 }  /* create() */
 
+/* If a memory block is given (flat layout), the nodes are taken    */
+/* from it in the order in which they are created, that is, in      */
+/* preorder with the children of a node in descending index order,  */
+/* which is the order in which ist_countx() traverses the tree. In  */
+/* this case the function cannot fail.                              */
+
+/*--------------------------------------------------------------------*/
+
+static size_t tatsize (TRACT **tracts, TID cnt, ITEM index,
+                       int narrow)
+{                               /* --- compute size of a (sub)tree */
+  TID    i;                     /* loop variable */
+  ITEM   item, n;               /* item identifier and counter */
+  size_t z;                     /* size of the (sub)tree */
+
+  assert(tracts                 /* check the function arguments */
+  &&    (cnt > 0) && (index >= 0));
+  if (cnt <= 1) {               /* if only one transaction left, */
+    n = (*tracts)->size -index; /* it is a leaf */
+    return BINPAD((narrow) ? NLEAFSIZE(n) : LEAFSIZE(n));
+  }
+  while ((cnt > 0) && ((*tracts)->size <= index)) {
+    tracts++; cnt--; }          /* skip trans. that are too short */
+  for (z = 0, n = 0; cnt > 0; cnt -= i, tracts += i, n++) {
+    item = (*tracts)->items[index];
+    for (i = 1; (i < cnt) && (tracts[i]->items[index] == item); i++);
+    z += tatsize(tracts, i, index+1, narrow);
+  }                             /* sum the sizes of the subtrees */
+  return z +BINPAD(NODESIZE(n));/* return the size of the tree */
+}  /* tatsize() */              /* (must be consistent w. create()) */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(tszwork, p)
+{                               /* --- compute subtree sizes (worker) */
+  TATWORK *w = (TATWORK*)p;     /* type the argument pointer */
+  ITEM    i;                    /* loop variable */
+
+  for (i = w->beg; i < w->end; i++)
+    w->sizes[i] = tatsize(w->tracts +w->offs[i],
+                          w->offs[i+1] -w->offs[i], 1, w->narrow);
+  return THREAD_OK;             /* compute the sizes of the subtrees */
+}  /* tszwork() */              /* of the worker's root children */
+
+/*--------------------------------------------------------------------*/
+
+static WORKERDEF(tatwork, p)
+{                               /* --- build subtrees (worker) */
+  TATWORK *w = (TATWORK*)p;     /* type the argument pointer */
+  ITEM    i;                    /* loop variable */
+  char    *m;                   /* memory for a subtree */
+
+  for (i = w->beg; i < w->end; i++) {
+    m = (w->mem) ? w->mem +w->sizes[i] : NULL;
+    w->chn[i] = create(w->tracts +w->offs[i],
+                       w->offs[i+1] -w->offs[i], 1, (m) ? &m : NULL,
+                       w->narrow);
+    if (!w->chn[i]) w->err = -1;
+  }                             /* build the subtrees */
+  return THREAD_OK;             /* of the worker's root children */
+}  /* tatwork() */
+
 /*--------------------------------------------------------------------*/
 
-TATREE* tat_create (TABAG *bag)
+static TANODE* build (TABAG *bag, int mode)
+{                               /* --- build a transaction tree */
+  int     i, c;                 /* loop variable, number of threads */
+  int     nrw;                  /* whether to store narrow leaves */
+  ITEM    k, n;                 /* loop variable, number of children */
+  TID     b, e, cnt;            /* transaction indices and counter */
+  SUPP    w;                    /* weight of the root node */
+  size_t  z, x;                 /* size of the tree, buffer */
+  TRACT   **tracts;             /* (sorted) transactions */
+  TID     *offs;                /* start offsets of the item groups */
+  size_t  *sizes;               /* sizes/offsets of the subtrees */
+  char    *mem;                 /* memory block for flat layout */
+  TANODE  *root, **chn;         /* root node and its child pointers */
+  TATWORK *work;                /* data for the worker threads */
+
+  assert(bag && (bag->cnt > 0));/* check the function argument */
+  tracts = (TRACT**)bag->tracts;/* get the transactions */
+  cnt    = bag->cnt;            /* and their number */
+  nrw    = (mode & TAT_NARROW) ? 1 : 0;
+  for (w = 0, b = 0; (b < cnt) && (tracts[b]->size <= 0); b++)
+    w += tracts[b]->wgt;        /* skip empty transactions */
+  for (n = 0, e = b; e < cnt; n++) {
+    k = tracts[e]->items[0];    /* traverse the transactions */
+    do w += tracts[e++]->wgt;   /* and sum their weights */
+    while ((e < cnt) && (tracts[e]->items[0] == k));
+  }                             /* count the different first items */
+  c = ((cnt-b) /TT_MINPAR < (TID)bag->cpus)
+    ? (int)((cnt-b) /TT_MINPAR) : bag->cpus;
+  if (c > (int)n) c = (int)n;   /* get the number of threads */
+  if (c <= 1) {                 /* if to use a single thread */
+    if (!(mode & TAT_FLAT))     /* if to allocate nodes individually */
+      return create(tracts, cnt, 0, NULL, nrw);
+    mem = (char*)malloc(tatsize(tracts, cnt, 0, nrw));
+    if (!mem) return NULL;      /* allocate one block for all nodes */
+    return create(tracts, cnt, 0, &mem, nrw);
+  }                             /* build the tree in this block */
+
+  sizes = (size_t*)malloc((size_t)n     *sizeof(size_t)
+                         +(size_t)c     *sizeof(TATWORK)
+                         +(size_t)(n+1) *sizeof(TID));
+  if (!sizes) return NULL;      /* allocate buffers for the workers */
+  work = (TATWORK*)(sizes +n);  /* and organize the buffers */
+  offs = (TID*)(work +c);       /* (subtree sizes, worker data, */
+  for (k = 0, e = b; k < n; k++) {   /* item group offsets) */
+    offs[k] = e; e++;           /* note the start of each group */
+    while ((e < cnt) && (tracts[e]->items[0] == tracts[e-1]->items[0]))
+      e++;                      /* find the start of the next group */
+  }                             /* of transactions (same first item) */
+  offs[n] = cnt;                /* store the end of the last group */
+  for (k = 0, i = 0; i < c; i++) {
+    e = b +(TID)(((double)(cnt-b) *(double)(i+1)) /(double)c);
+    work[i].tracts = tracts;    /* compute the end of the range */
+    work[i].offs   = offs;      /* and note the worker parameters */
+    work[i].sizes  = sizes;
+    work[i].mem    = NULL;
+    work[i].narrow = nrw;
+    work[i].err    = 0;
+    work[i].beg    = k;         /* assign groups of transactions */
+    while ((k < n) && ((offs[k] < e) || (i >= c-1))) k++;
+    work[i].end    = k;         /* with a similar number of trans. */
+  }                             /* to each of the workers */
+  z = BINPAD(NODESIZE(n));      /* get the size of the root node */
+  if (mode & TAT_FLAT) {        /* if to use a flat layout */
+    runpar(work, sizeof(TATWORK), c, tszwork);
+    for (k = n; --k >= 0; ) {   /* compute the subtree sizes */
+      x = sizes[k]; sizes[k] = z; z += x; }
+    mem  = (char*)malloc(z);    /* compute the subtree offsets */
+    root = (TANODE*)mem;        /* and allocate one memory block */
+    for (i = 0; i < c; i++) work[i].mem = mem; }
+  else                          /* if to allocate individually, */
+    root = (TANODE*)malloc(z);  /* allocate only the root node */
+  if (!root) { free(sizes); return NULL; }
+  root->wgt  = w;               /* initialize the root node */
+  root->max  = 0;
+  root->size = n;
+  chn = (TANODE**)(root->items +n);
+  ALIGN(chn);                   /* get the child pointer array */
+  for (k = 0; k < n; k++) {     /* note the items of the children */
+    root->items[k] = tracts[offs[k]]->items[0]; chn[k] = NULL; }
+  for (i = 0; i < c; i++)       /* set the child pointer array */
+    work[i].chn = chn;          /* in the worker data */
+  runpar(work, sizeof(TATWORK), c, tatwork);
+  for (i = 0; i < c; i++)       /* build the subtrees in parallel */
+    if (work[i].err) break;     /* and check for an error */
+  free(sizes);                  /* delete the worker buffers */
+  if (i < c) {                  /* if a subtree could not be built */
+    for (k = 0; k < n; k++) if (chn[k]) delete(chn[k]);
+    free(root); return NULL;    /* delete the created subtrees */
+  }                             /* and the root node */
+  for (k = 0; k < n; k++)       /* compute the maximal suffix length */
+    if (chn[k]->max +1 > root->max) root->max = chn[k]->max +1;
+  return root;                  /* return the created tree */
+}  /* build() */
+
+/* If the transaction bag was given a number of threads (see        */
+/* tbg_setcpus()) and contains enough transactions, the subtrees of */
+/* the root node, that is, the groups of transactions that start    */
+/* with the same item, are distributed over the threads in ranges   */
+/* with a similar number of transactions and are built in parallel. */
+/* For a flat layout the sizes of the subtrees are computed first   */
+/* (also in parallel), so that the offsets of the subtrees in the   */
+/* common memory block are known before any node is created. The    */
+/* resulting tree (including its layout) is the same as the one     */
+/* built with a single thread. Note that delete() may only be used  */
+/* on trees whose nodes were allocated individually.                */
+
+/*--------------------------------------------------------------------*/
+
+static void setempty (TATREE *tree)
+{                               /* --- set an empty root node */
+  tree->root = &tree->empty;    /* (used for an empty bag) */
+  tree->root->wgt = 0; tree->root->size = tree->root->max = 0;
+}  /* setempty() */
+
+/*--------------------------------------------------------------------*/
+
+static void deltree (TATREE *tree)
+{                               /* --- delete the nodes of a tree */
+  if (!tree->root || (tree->root == &tree->empty))
+    return;                     /* check for an empty tree */
+  if (tree->mode & TAT_FLAT) free(tree->root);
+  else                       delete(tree->root);
+}  /* deltree() */              /* delete the memory block or nodes */
+
+/*--------------------------------------------------------------------*/
+
+TATREE* tat_createx (TABAG *bag, int mode)
 {                               /* --- create a transactions tree */
   TATREE *tree;                 /* created transaction tree */
 
   assert(bag);                  /* check the function argument */
   tree = (TATREE*)malloc(sizeof(TATREE));
   if (!tree) return NULL;       /* create the transaction tree body */
+  mode &= ~TAT_NARROW;          /* choose the width of leaf items */
+  #ifndef TAT_NONARROW          /* if narrow leaves are possible */
+  if (ib_cnt(bag->base) <= (ITEM)USHRT_MAX+1) mode |= TAT_NARROW;
+  #endif                        /* (all items fit into 16 bits) */
   tree->bag  = bag;             /* note the underlying trans. bag */
-  if (bag->cnt <= 0) {          /* if the transaction bag is empty, */
-    tree->root = &tree->empty;  /* set an empty root node */
-    tree->root->wgt = 0; tree->root->size = tree->root->max = 0; }
+  tree->mode = mode;            /* and the tree mode */
+  if (bag->cnt <= 0)            /* if the transaction bag is empty, */
+    setempty(tree);             /* set an empty root node */
   else {                        /* if the bag contains transactions */
-    tree->root = create((TRACT**)bag->tracts, bag->cnt, 0);
+    tree->root = build(bag, mode);
     if (!tree->root) { free(tree); return NULL; }
-  }                             /* recursively build the tree */
+  }                             /* build the transaction tree */
   return tree;                  /* return the created trans. tree */
-}  /* tat_create() */
+}  /* tat_createx() */
+
+/* With the mode TAT_FLAT all nodes of the tree are placed into one */
+/* memory block in the order in which they are visited by           */
+/* ist_countx(), which avoids the allocation overhead for each node */
+/* and improves the memory locality of the counting. The layout is  */
+/* kept if the tree is rebuilt by tat_filter(). The mode TAT_NARROW */
+/* is not taken from the caller, but chosen here: if all item       */
+/* identifiers of the (recoded) item base fit into 16 bits, the     */
+/* transaction suffixes in the leaves, which hold most of the items */
+/* of a tree for sparse data, are stored as 16 bit items (see       */
+/* tan_widen()). Packed items are not supported.                    */
 
 /*--------------------------------------------------------------------*/
 
 void tat_delete (TATREE *tree, int del)
 {                               /* --- delete a transaction tree */
   assert(tree);                 /* check the function argument */
-  delete(tree->root);           /* delete the nodes of the tree */
+  deltree(tree);                /* delete the nodes of the tree */
   if (tree->bag && del) tbg_delete(tree->bag, (del > 1));
   free(tree);                   /* delete the item base and */
 }  /* tat_delete() */           /* the transaction tree body */
@@ -3269,21 +4668,21 @@ int tat_filter (TATREE *tree, ITEM min, const int *marks, int heap)
   TABAG *bag;                   /* underlying transaction bag */
 
   assert(tree);                 /* check the function argument */
-  delete(tree->root);           /* delete the nodes of the tree */
+  deltree(tree);                /* delete the nodes of the tree */
   tbg_filter(bag = tree->bag, min, marks, 0);
   tbg_sort  (bag, 0, heap);     /* remove unnec. items and trans. */
   tbg_reduce(bag, 0);           /* and reduce trans. to unique ones */
-  tree->root = create((TRACT**)bag->tracts, bag->cnt, 0);
+  if (bag->cnt <= 0) { setempty(tree); return 0; }
+  tree->root = build(bag, tree->mode);
   if (tree->root) return 0;     /* recreate the transaction tree */
-  delete(tree->root);           /* on failure delete the nodes */
-  tree->root = NULL;            /* and clear the root pointer */
+  setempty(tree);               /* on failure set an empty root */
   return -1;                    /* return an error indicator */
 }  /* tat_filter() */
 
 /*--------------------------------------------------------------------*/
 #ifndef NDEBUG
 
-static void show (TANODE *node, ITEMBASE *base, int ind)
+static void show (TANODE *node, ITEMBASE *base, int ind, int narrow)
 {                               /* --- rekursive part of tat_show() */
   ITEM   i, k;                  /* loop variables */
   TANODE **chn;                 /* array of child nodes */
@@ -3291,7 +4690,8 @@ static void show (TANODE *node, ITEMBASE *base, int ind)
   assert(node && (ind >= 0));   /* check the function arguments */
   if (node->size <= 0) {        /* if this is a leaf node */
     for (i = 0; i < node->max; i++)
-      printf("%s ", ib_xname(base, node->items[i]));
+      printf("%s ", ib_xname(base, (narrow)
+             ? (ITEM)((ITEM16*)node->items)[i] : node->items[i]));
     printf("[%"SUPP_FMT"]\n", node->wgt);
     return;                     /* print the items in the */
   }                             /* (rest of) the transaction */
@@ -3300,7 +4700,7 @@ static void show (TANODE *node, ITEMBASE *base, int ind)
   for (i = 0; i < node->size; i++) {
     if (i > 0) for (k = 0; k < ind; k++) printf("  ");
     printf("%s ", ib_xname(base, node->items[i]));
-    show(chn[i], base, ind+1);  /* traverse the items, print them, */
+    show(chn[i], base, ind+1, narrow); /* print the items */
   }                             /* and show the children recursively */
 }  /* show() */
 
@@ -3309,10 +4709,276 @@ static void show (TANODE *node, ITEMBASE *base, int ind)
 void tat_show (TATREE *tree)
 {                               /* --- show a transaction tree */
   assert(tree);                 /* check the function argument */
-  show(tree->root, tbg_base(tree->bag), 0);
+  show(tree->root, tbg_base(tree->bag), 0, tat_narrow(tree));
 }  /* tat_show() */             /* call the recursive function */
 
 #endif
+#endif
+#endif
+/*----------------------------------------------------------------------
+  Vertical Representation Functions
+----------------------------------------------------------------------*/
+#ifdef TAVERTFN
+
+#define BLKBITS     ((size_t)(8*sizeof(TIDBLK)))
+
+#if defined __GNUC__ || defined __clang__
+#define popcnt(x)   ((TID)__builtin_popcountll(x))
+#define lowbit(x)   ((TID)__builtin_ctzll(x))
+#else                           /* if no builtin functions available */
+
+static TID popcnt (TIDBLK x)
+{                               /* --- count the set bits in a block */
+  x =  x -((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) +((x >> 2) & 0x3333333333333333ULL);
+  x = (x +(x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return (TID)((x *0x0101010101010101ULL) >> 56);
+}  /* popcnt() */               /* (parallel summation of bits) */
+
+/*--------------------------------------------------------------------*/
+
+static TID lowbit (TIDBLK x)
+{                               /* --- get index of lowest set bit */
+  return popcnt((x & (~x+1)) -1);
+}  /* lowbit() */
+
+#endif
+/*--------------------------------------------------------------------*/
+
+static TID andcnt (TIDBLK *dst, const TIDBLK *a, const TIDBLK *b,
+                   size_t n)
+{                               /* --- intersect and count bits */
+  size_t i = 0;                 /* loop variable */
+  TID    c = 0;                 /* number of set bits */
+  TIDBLK x;                     /* intersection of two blocks */
+  #ifdef __AVX2__               /* if AVX2 instructions available */
+  __m256i m, lut, v, s, z;      /* mask, nibble table, buffers */
+
+  lut = _mm256_setr_epi8(0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4,
+                         0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4);
+  m   = _mm256_set1_epi8(0x0f); /* table of bit counts of nibbles */
+  s   = z = _mm256_setzero_si256();
+  for ( ; i+4 <= n; i += 4) {   /* traverse groups of four blocks */
+    v = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(a+i)),
+                         _mm256_loadu_si256((const __m256i*)(b+i)));
+    if (dst) _mm256_storeu_si256((__m256i*)(dst+i), v);
+    v = _mm256_add_epi8(        /* count bits with table lookups */
+          _mm256_shuffle_epi8(lut, _mm256_and_si256(v, m)),
+          _mm256_shuffle_epi8(lut, _mm256_and_si256(
+                                   _mm256_srli_epi16(v, 4), m)));
+    s = _mm256_add_epi64(s, _mm256_sad_epu8(v, z));
+  }                             /* sum the byte counts per block */
+  c = (TID)(_mm256_extract_epi64(s, 0) +_mm256_extract_epi64(s, 1)
+          + _mm256_extract_epi64(s, 2) +_mm256_extract_epi64(s, 3));
+  #endif                        /* (W. Mula's vectorized counting) */
+  for ( ; i < n; i++) {         /* traverse the (remaining) blocks */
+    x = a[i] & b[i];            /* intersect the tid bitsets, */
+    if (dst) dst[i] = x;        /* store the intersection and */
+    c += popcnt(x);             /* count the remaining transactions */
+  }
+  return c;                     /* return the number of set bits */
+}  /* andcnt() */
+
+/*--------------------------------------------------------------------*/
+
+static SUPP andwgt (TIDBLK *dst, const TIDBLK *a, const TIDBLK *b,
+                    size_t n, const SUPP *wgts)
+{                               /* --- intersect and sum weights */
+  size_t i;                     /* loop variable */
+  SUPP   s = 0;                 /* sum of transaction weights */
+  TIDBLK x;                     /* intersection of two blocks */
+
+  for (i = 0; i < n; i++) {     /* traverse the blocks */
+    x = a[i] & b[i];            /* intersect the tid bitsets */
+    if (dst) dst[i] = x;        /* and store the intersection */
+    for ( ; x; x &= x-1)        /* traverse the set bits and */
+      s += wgts[i*BLKBITS +(size_t)lowbit(x)];
+  }                             /* sum the transaction weights */
+  return s;                     /* return the weight of the set */
+}  /* andwgt() */
+
+/*--------------------------------------------------------------------*/
+
+TAVERT* tav_create (TABAG *bag)
+{                               /* --- create a vert. representation */
+  ITEM         k;               /* number of items */
+  TID          t;               /* loop variable for transactions */
+  size_t       n;               /* number of blocks per bitset */
+  SUPP         w;               /* weight of current transaction */
+  TAVERT       *vert;           /* created vertical representation */
+  const ITEM   *s;              /* to traverse the items */
+  const WITEM  *x;              /* to traverse the weighted items */
+  TIDBLK       b;               /* bit of the current transaction */
+
+  assert(bag && !tbg_packcnt(bag)); /* check the function argument */
+  vert = (TAVERT*)malloc(sizeof(TAVERT));
+  if (!vert) return NULL;       /* allocate the base structure */
+  vert->bag    = bag;           /* note the transaction bag */
+  vert->cnt    = k = tbg_itemcnt(bag);
+  vert->tracnt = tbg_cnt(bag);  /* get the database parameters */
+  vert->blkcnt = n = ((size_t)vert->tracnt +BLKBITS-1) /BLKBITS;
+  vert->wgts   = NULL;          /* compute the bitset size */
+  vert->supps  = (SUPP*)  calloc((size_t)k+1,     sizeof(SUPP));
+  vert->bits   = (TIDBLK*)calloc((size_t)k*n +1, sizeof(TIDBLK));
+  if (!vert->supps || !vert->bits) { tav_delete(vert, 0); return NULL; }
+  for (t = 0; t < vert->tracnt; t++) {
+    w = (bag->mode & IB_WEIGHTS) ? wta_wgt(tbg_wtract(bag, t))
+                                 : ta_wgt (tbg_tract (bag, t));
+    if (w == 1) continue;       /* check for non-unit weights */
+    vert->wgts = (SUPP*)malloc((n*BLKBITS+1) *sizeof(SUPP));
+    if (!vert->wgts) { tav_delete(vert, 0); return NULL; }
+    memset(vert->wgts, 0, n*BLKBITS *sizeof(SUPP));
+    break;                      /* if there is a non-unit weight, */
+  }                             /* create a transaction weight array */
+  for (t = 0; t < vert->tracnt; t++) {
+    b = (TIDBLK)1 << ((size_t)t % BLKBITS);
+    if (bag->mode & IB_WEIGHTS){/* if the items carry weights */
+      w = wta_wgt(tbg_wtract(bag, t));
+      for (x = wta_items(tbg_wtract(bag, t)); x->item >= 0; x++) {
+        vert->bits[(size_t)x->item*n +(size_t)t/BLKBITS] |= b;
+        vert->supps[x->item] += w;
+      } }                       /* set bit and sum item support */
+    else {                      /* if the items carry no weights */
+      w = ta_wgt(tbg_tract(bag, t));
+      for (s = ta_items(tbg_tract(bag, t)); *s > TA_END; s++) {
+        vert->bits[(size_t)*s*n +(size_t)t/BLKBITS] |= b;
+        vert->supps[*s] += w;   /* set the transaction bit and */
+      }                         /* sum the support of the item */
+    }
+    if (vert->wgts) vert->wgts[t] = w;
+  }                             /* note the transaction weight */
+  return vert;                  /* return the created representation */
+}  /* tav_create() */
+
+/*--------------------------------------------------------------------*/
+
+void tav_delete (TAVERT *vert, int del)
+{                               /* --- delete a vert. representation */
+  assert(vert);                 /* check the function argument */
+  if (vert->bits)  free(vert->bits);
+  if (vert->supps) free(vert->supps);
+  if (vert->wgts)  free(vert->wgts);
+  if (del && vert->bag) tbg_delete(vert->bag, 0);
+  free(vert);                   /* delete the bitsets, the support */
+}  /* tav_delete() */           /* and weight arrays and the base */
+
+/*--------------------------------------------------------------------*/
+
+TID tav_cnt (const TAVERT *vert, const TIDBLK *a)
+{                               /* --- count transactions in bitset */
+  size_t i;                     /* loop variable */
+  TID    c = 0;                 /* number of transactions */
+
+  assert(vert && a);            /* check the function arguments */
+  for (i = 0; i < vert->blkcnt; i++)
+    c += popcnt(a[i]);          /* sum the bit counts of the blocks */
+  return c;                     /* return the number of transactions */
+}  /* tav_cnt() */
+
+/*--------------------------------------------------------------------*/
+
+SUPP tav_wgt (const TAVERT *vert, const TIDBLK *a)
+{                               /* --- get weight of a tid bitset */
+  assert(vert && a);            /* check the function arguments */
+  if (!vert->wgts) return (SUPP)tav_cnt(vert, a);
+  return andwgt(NULL, a, a, vert->blkcnt, vert->wgts);
+}  /* tav_wgt() */              /* (sum of transaction weights) */
+
+/*--------------------------------------------------------------------*/
+
+SUPP tav_and (const TAVERT *vert, TIDBLK *dst,
+              const TIDBLK *a, const TIDBLK *b)
+{                               /* --- intersect two tid bitsets */
+  assert(vert && dst && a && b);/* check the function arguments */
+  if (!vert->wgts) return (SUPP)andcnt(dst, a, b, vert->blkcnt);
+  return andwgt(dst, a, b, vert->blkcnt, vert->wgts);
+}  /* tav_and() */              /* return the support of the result */
+
+/*--------------------------------------------------------------------*/
+
+SUPP tav_andwgt (const TAVERT *vert, const TIDBLK *a, const TIDBLK *b)
+{                               /* --- support of an intersection */
+  assert(vert && a && b);       /* check the function arguments */
+  if (!vert->wgts) return (SUPP)andcnt(NULL, a, b, vert->blkcnt);
+  return andwgt(NULL, a, b, vert->blkcnt, vert->wgts);
+}  /* tav_andwgt() */           /* (intersection is not stored) */
+
+/*--------------------------------------------------------------------*/
+
+int tav_subset (const TAVERT *vert, const TIDBLK *a, const TIDBLK *b)
+{                               /* --- check for a tid subset */
+  size_t i;                     /* loop variable */
+
+  assert(vert && a && b);       /* check the function arguments */
+  for (i = 0; i < vert->blkcnt; i++)
+    if (a[i] & ~b[i]) return 0; /* check for a transaction in a */
+  return 1;                     /* that is missing in b */
+}  /* tav_subset() */
+
+/*--------------------------------------------------------------------*/
+
+TID tav_diff (const TAVERT *vert, TID *dst,
+              const TIDBLK *a, const TIDBLK *b, SUPP *wgt)
+{                               /* --- compute a difference tid list */
+  size_t i;                     /* loop variable */
+  TID    *d;                    /* to traverse the destination */
+  SUPP   s = 0;                 /* sum of transaction weights */
+  TIDBLK x;                     /* difference of two blocks */
+
+  assert(vert && dst && a && b);/* check the function arguments */
+  for (d = dst, i = 0; i < vert->blkcnt; i++) {
+    for (x = a[i] & ~b[i]; x; x &= x-1)
+      *d++ = (TID)(i*BLKBITS) +lowbit(x);
+  }                             /* collect the identifiers of the */
+  if (wgt) {                    /* transactions in a but not in b */
+    if (!vert->wgts) s = (SUPP)(d-dst);
+    else s = tav_tidwgt(vert, dst, (TID)(d-dst));
+    *wgt = s;                   /* compute the weight of */
+  }                             /* the difference tid list */
+  return (TID)(d-dst);          /* return the number of tids */
+}  /* tav_diff() */
+
+/*--------------------------------------------------------------------*/
+
+SUPP tav_tidwgt (const TAVERT *vert, const TID *tids, TID n)
+{                               /* --- get weight of a tid list */
+  SUPP s = 0;                   /* sum of transaction weights */
+
+  assert(vert && (tids || (n <= 0))); /* check function arguments */
+  if (!vert->wgts) return (SUPP)n;
+  while (--n >= 0) s += vert->wgts[*tids++];
+  return s;                     /* sum the transaction weights */
+}  /* tav_tidwgt() */
+
+/*--------------------------------------------------------------------*/
+
+void tav_clear (const TAVERT *vert, TIDBLK *dst, const TID *tids, TID n)
+{                               /* --- remove tids from a bitset */
+  assert(vert && dst && (tids || (n <= 0)));
+  for ( ; --n >= 0; tids++)     /* clear the bits of the tids */
+    dst[(size_t)*tids/BLKBITS] &= ~((TIDBLK)1 << ((size_t)*tids%BLKBITS));
+}  /* tav_clear() */
+
+/*--------------------------------------------------------------------*/
+#ifndef NDEBUG
+
+void tav_show (TAVERT *vert)
+{                               /* --- show a vert. representation */
+  ITEM   i;                     /* loop variable for items */
+  TID    t;                     /* loop variable for transactions */
+  const TIDBLK *b;              /* tid bitset of current item */
+
+  assert(vert);                 /* check the function argument */
+  for (i = 0; i < vert->cnt; i++) {
+    printf("%s:", ib_xname(tbg_base(vert->bag), i));
+    b = tav_bits(vert, i);      /* traverse the items */
+    for (t = 0; t < vert->tracnt; t++)
+      if (b[(size_t)t/BLKBITS] & ((TIDBLK)1 << ((size_t)t%BLKBITS)))
+        printf(" %"TID_FMT, t); /* print the transaction identifiers */
+    printf(" [%"SUPP_FMT"]\n", vert->supps[i]);
+  }                             /* print the item support */
+}  /* tav_show() */
+
 #endif
 #endif
 /*----------------------------------------------------------------------
@@ -3338,6 +5004,7 @@ int main (int argc, char *argv[])
   char    *s;                   /* to traverse the options */
   CCHAR   **optarg = NULL;      /* option argument */
   CCHAR   *fn_inp  = NULL;      /* name of input  file */
+  CCHAR   *fn_out  = NULL;      /* name of output file (binary) */
   CCHAR   *recseps = NULL;      /* record  separators */
   CCHAR   *fldseps = NULL;      /* field   separators */
   CCHAR   *blanks  = NULL;      /* blank   characters */
@@ -3346,6 +5013,8 @@ int main (int argc, char *argv[])
   int     sort     = -2;        /* flag for item sorting and recoding */
   int     pack     =  0;        /* flag for packing 16 items */
   long    repeat   =  1;        /* number of repetitions */
+  int     radix    =  0;        /* flag for radix/counting sort */
+  int     cpus     =  1;        /* number of threads for sorting */
   int     mtar     =  0;        /* mode for transaction reading */
   TRACT   **tracts = NULL;      /* array of transactions */
   ITEM    m;                    /* number of items */
@@ -3361,7 +5030,7 @@ int main (int argc, char *argv[])
     fprintf(stderr, "%s - %s\n", argv[0], DESCRIPTION);
     fprintf(stderr, VERSION); } /* print a startup message */
   else {                        /* if no arguments given */
-    printf("usage: %s [options] infile\n", argv[0]);
+    printf("usage: %s [options] infile [outfile]\n", argv[0]);
     printf("%s\n", DESCRIPTION);
     printf("%s\n", VERSION);
     printf("-s#      minimum support of an item set           "
@@ -3376,6 +5045,10 @@ int main (int argc, char *argv[])
     printf("-p       pack the 16 items with the lowest codes\n");
     printf("-x#      number of repetitions (for benchmarking) "
                     "(default: 1)\n");
+    printf("-a       use radix/counting sort (if possible)\n");
+    printf("-T#      number of threads for radix sort         "
+                    "(default: %d)\n", cpus);
+    printf("         (<= 0: use all processors)\n");
     printf("-w       transaction weight in last field         "
                     "(default: only items)\n");
     printf("-r#      record/transaction separators            "
@@ -3388,6 +5061,10 @@ int main (int argc, char *argv[])
                     "(default: \"#\")\n");
     printf("infile   file to read transactions from           "
                     "[required]\n");
+    printf("outfile  file to write prepared transactions to   "
+                    "[optional]\n");
+    printf("         (binary format, can replace the input file\n"
+           "          of apriori, fpgrowth, sequoia and fpgpsp)\n");
     return 0;                   /* print a usage message */
   }                             /* and abort the program */
   #endif  /* #ifndef QUIET */
@@ -3403,6 +5080,8 @@ int main (int argc, char *argv[])
           case 'q': sort   = (int)strtol(s, &s, 0); break;
           case 'p': pack   = -1;                    break;
           case 'x': repeat =      strtol(s, &s, 0); break;
+          case 'a': radix  = TA_RADIX;              break;
+          case 'T': cpus   = (int)strtol(s, &s, 0); break;
           case 'w': mtar  |= TA_WEIGHT;             break;
           case 'r': optarg = &recseps;              break;
           case 'f': optarg = &fldseps;              break;
@@ -3415,6 +5094,7 @@ int main (int argc, char *argv[])
     else {                      /* -- if argument is no option */
       switch (k++) {            /* evaluate non-options */
         case  0: fn_inp = s;      break;
+        case  1: fn_out = s;      break;
         default: error(E_ARGCNT); break;
       }                         /* note filenames */
     }
@@ -3431,6 +5111,7 @@ int main (int argc, char *argv[])
   trd_allchs(tread, recseps, fldseps, blanks, "", comment);
   tabag = tbg_create(ibase);    /* create a transaction bag */
   if (!tabag) error(E_NOMEM);   /* to store the transactions */
+  tbg_setcpus(tabag, cpus);     /* set the number of threads */
   CLOCK(t);                     /* start timer, open input file */
   if (trd_open(tread, NULL, fn_inp) != 0)
     error(E_FOPEN, trd_name(tread));
@@ -3464,14 +5145,14 @@ int main (int argc, char *argv[])
   CLOCK(t);                     /* start timer, print log message */
   MSG(stderr, "sorting and reducing transactions ... ");
   tbg_filter(tabag, 0,NULL,0);  /* remove items of short transactions */
-  tbg_itsort(tabag, +1, 0);     /* sort items in transactions */
+  tbg_itsort(tabag, +1, radix); /* sort items in transactions */
   tracts = (TRACT**)malloc((size_t)n *sizeof(TRACT*));
   if (!tracts) error(E_NOMEM);  /* copy transactions to a buffer */
   memcpy(tracts, tabag->tracts, (size_t)n *sizeof(TRACT*));
   if (pack) tbg_pack(tabag,16); /* pack 16 items with lowest codes */
   for (i = 0; i < repeat; i++){ /* repeated sorting loop */
     memcpy(tabag->tracts, tracts, (size_t)n *sizeof(TRACT*));
-    tbg_sort(tabag, +1, 0);     /* copy back the transactions */
+    tbg_sort(tabag, +1, radix); /* copy back the transactions */
   }                             /* and sort the transactions */
   n = tbg_reduce(tabag, 0);     /* reduce transactions to unique ones */
   free(tracts);                 /* delete the transaction buffer */
@@ -3479,6 +5160,15 @@ int main (int argc, char *argv[])
   if (w != (SUPP)n) { MSG(stderr, "/%"SUPP_FMT, w); }
   MSG(stderr, " transaction(s)] done [%.2fs].\n", SEC_SINCE(t));
 
+  /* --- write binary transaction bag --- */
+  if (fn_out) {                 /* if an output file is given */
+    CLOCK(t);                   /* start timer, print log message */
+    MSG(stderr, "writing %s ... ", fn_out);
+    k = tbg_save(tabag, fn_out, TBG_SORTED|TBG_REDUCED);
+    if (k < 0) error(k, fn_out);/* save the prepared trans. bag */
+    MSG(stderr, "done [%.2fs].\n", SEC_SINCE(t));
+  }                             /* print a log message */
+
   /* --- clean up --- */
   CLEANUP;                      /* clean up memory and close files */
   SHOWMEM;                      /* show (final) memory usage */
@@ -53,6 +53,16 @@
             2014.09.08 transaction marker functions added (ta_..mark())
             2014.09.09 function ib_frqcnt() added (num. of freq. items)
             2014.10.17 function ib_clear() made a proper function
+            2026.10.14 functions tbg_save() and tbg_load() added
+            2026.10.14 vertical representation (tid bitsets) added
+            2026.10.14 radix sort mode TA_RADIX, tbg_setcpus() added
+            2026.10.14 read mode TA_COLLAPSE and tbg_collapse() added
+            2026.10.14 compressed transactions and iterator added
+            2026.10.14 item base mode IB_OPENADR (open addressing) added
+            2026.10.14 message and name buffers moved into item base
+            2026.10.14 function tbg_reuse() added (reuse of clones)
+            2026.10.14 function tat_createx() added (flat/parallel)
+            2026.10.14 narrow (16 bit) items in transaction tree leaves
 ----------------------------------------------------------------------*/
 #ifndef __TRACT__
 #define __TRACT__
@@ -425,6 +435,7 @@
 /* --- item base/transaction bag modes --- */
 #define IB_WEIGHTS  0x20        /* items have t.a.-specific weights */
 #define IB_OBJNAMES 0x40        /* item names are arbitrary objects */
+#define IB_OPENADR  0x80        /* open addressing for the item map */
 
 /* --- transaction sentinel --- */
 #define TA_END      ITEM_MIN    /* sentinel for item instance arrays */
@@ -433,11 +444,13 @@
 #define TA_PACKED   0x1f        /* transactions have been packed */
 #define TA_EQPACK   0x20        /* treat packed items all the same */
 #define TA_HEAP     0x40        /* prefer heap sort to quicksort */
+#define TA_RADIX    0x80        /* use radix/counting sort if poss. */
 
 /* --- transaction read/write modes --- */
 #define TA_WEIGHT   0x01        /* integer weight in last field */
 #define TA_DUPLICS  0x02        /* allow duplicates of items */
 #define TA_DUPERR   0x04        /* consider duplicates as errors */
+#define TA_COLLAPSE 0x08        /* collapse duplicate transactions */
 #define TA_TERM     0x10        /* terminate all trans. with item 0 */
 #define TA_WGTSEP   TRD_OTHER   /* item weight separator */
 #define TA_PAREN    0x02        /* print parentheses around weight */
@@ -446,6 +459,14 @@
 #define TA_NOGAPS   0x40        /* do not allow gaps in matching */
 #define TA_ALLOCC   0x80        /* consider all occurrences */
 
+/* --- binary file flags --- */
+#define TBG_SORTED  0x01        /* transactions have been sorted */
+#define TBG_REDUCED 0x02        /* transactions have been reduced */
+
+/* --- transaction tree modes --- */
+#define TAT_FLAT    0x01        /* flat layout (one memory block) */
+#define TAT_NARROW  0x02        /* 16 bit leaf items (set automatically) */
+
 /* --- error codes --- */
 #define E_NONE         0        /* no error */
 #define E_NOMEM      (-1)       /* not enough memory */
@@ -497,6 +518,8 @@ typedef struct {                /* --- item base --- */
   #else                         /* if no transaction reading */
   void     *trd;                /* placeholder (for fixed size) */
   #endif
+  char     *msg;                /* buffer for error messages */
+  char     xnm[32];             /* buffer for formatted item names */
 } ITEMBASE;                     /* (item base) */
 
 typedef struct {                /* --- transaction --- */
@@ -518,6 +541,14 @@ typedef struct {                /* --- trans. with weighted items --- */
   WITEM    items[1];            /* items in the transaction */
 } WTRACT;                       /* (transaction with weighted items) */
 
+typedef struct {                /* --- compressed transactions --- */
+  int      dir;                 /* direction of the item order */
+  size_t   size;                /* size of the encoded data (bytes) */
+  size_t   *offs;               /* offsets of transaction blocks */
+  SUPP     *wgts;               /* transaction weights (or NULL) */
+  unsigned char *data;          /* encoded transactions */
+} TAZIP;                        /* (compressed transactions) */
+
 typedef struct {                /* --- transaction bag/multiset --- */
   ITEMBASE *base;               /* underlying item base */
   int      mode;                /* mode (IB_OBJNAMES, IB_WEIGHT) */
@@ -530,8 +561,21 @@ typedef struct {                /* --- transaction bag/multiset --- */
   TID      *icnts;              /* number of transactions per item */
   SUPP     *ifrqs;              /* frequency of the items (weight) */
   void     *buf;                /* buffer for surrogate generation */
+  void     *map;                /* block of loaded transactions */
+  size_t   mapsz;               /* size of the loaded block */
+  int      cpus;                /* number of threads for sorting */
+  TID      *htab;               /* hash table for duplicate trans. */
+  size_t   hsize;               /* size of the hash table */
+  TAZIP    *zip;                /* compressed transactions (or NULL) */
 } TABAG;                        /* (transaction bag/multiset) */
 
+typedef struct {                /* --- transaction iterator --- */
+  const TABAG *bag;             /* underlying transaction bag */
+  TID      idx;                 /* index of the next transaction */
+  const unsigned char *next;    /* next encoded transaction */
+  TRACT    *tract;              /* buffer for a decoded transaction */
+} TBGITER;                      /* (transaction iterator) */
+
 #ifdef TATREEFN
 #ifdef TATCOMPACT
 
@@ -550,6 +594,8 @@ typedef struct {                /* --- transaction tree --- */
 
 #else
 
+typedef unsigned short ITEM16;  /* narrow item (in tree leaves) */
+
 typedef struct {                /* --- transaction tree node --- */
   SUPP     wgt;                 /* weight (number of transactions) */
   ITEM     max;                 /* number of items in largest trans. */
@@ -559,6 +605,7 @@ typedef struct {                /* --- transaction tree node --- */
 
 typedef struct {                /* --- transaction tree --- */
   TABAG    *bag;                /* underlying transaction bag */
+  int      mode;                /* tree mode (e.g. TAT_FLAT) */
   TANODE   *root;               /* root of the transaction tree */
   TANODE   empty;               /* empty transaction node */
 } TATREE;                       /* (transaction tree) */
@@ -566,6 +613,20 @@ typedef struct {                /* --- transaction tree --- */
 #endif
 #endif
 
+#ifdef TAVERTFN
+typedef unsigned long long TIDBLK; /* block of a tid bitset */
+
+typedef struct {                /* --- vertical transaction database */
+  TABAG    *bag;                /* underlying transaction bag */
+  ITEM     cnt;                 /* number of items */
+  TID      tracnt;              /* number of transactions */
+  size_t   blkcnt;              /* number of blocks per tid bitset */
+  SUPP     *wgts;               /* transaction weights (or NULL) */
+  SUPP     *supps;              /* support of the items */
+  TIDBLK   *bits;               /* tid bitsets (one per item) */
+} TAVERT;                       /* (vertical transaction database) */
+#endif
+
 #ifdef TA_SURR
 typedef TABAG* TBGSURRFN (TABAG *src, RNG *rng, TABAG *dst);
 #endif
@@ -725,6 +786,7 @@ extern void         tbg_delete  (TABAG *bag, int delib);
 extern ITEMBASE*    tbg_base    (TABAG *bag);
 extern TABAG*       tbg_clone   (TABAG *bag);
 extern TABAG*       tbg_copy    (TABAG *dst, TABAG *src);
+extern TABAG*       tbg_reuse   (TABAG *dst, TABAG *src, int copy);
 
 extern int          tbg_mode    (const TABAG *bag);
 extern ITEM         tbg_itemcnt (const TABAG *bag);
@@ -735,6 +797,7 @@ extern size_t       tbg_extent  (const TABAG *bag);
 extern const TID*   tbg_icnts   (TABAG *bag, int recnt);
 extern const SUPP*  tbg_ifrqs   (TABAG *bag, int recnt);
 
+extern int          tbg_collapse(TABAG *bag, int on);
 extern int          tbg_add     (TABAG *bag,  TRACT *t);
 extern int          tbg_addw    (TABAG *bag, WTRACT *t);
 extern int          tbg_addib   (TABAG *bag);
@@ -748,6 +811,10 @@ extern const char*  tbg_errmsg  (TABAG *bag, char *buf, size_t size);
 extern int          tbg_write   (TABAG *bag, TABWRITE *twr,
                                  const char *wgtfmt, ...);
 #endif
+extern int          tbg_save    (TABAG *bag, const char *fname,
+                                 int flags);
+extern int          tbg_load    (TABAG *bag, const char *fname);
+extern int          tbg_isbin   (const char *fname);
 
 extern int          tbg_istab   (TABAG *bag);
 extern ITEM         tbg_recode  (TABAG *bag, SUPP min, SUPP max,
@@ -756,9 +823,10 @@ extern void         tbg_filter  (TABAG *bag, ITEM min,
                                  const int *marks, double wgt);
 extern void         tbg_trim    (TABAG *bag, ITEM min,
                                  const int *marks, double wgt);
-extern void         tbg_itsort  (TABAG *bag, int dir, int heap);
+extern void         tbg_setcpus (TABAG *bag, int cpus);
+extern void         tbg_itsort  (TABAG *bag, int dir, int mode);
 extern void         tbg_mirror  (TABAG *bag);
-extern void         tbg_sort    (TABAG *bag, int dir, int heap);
+extern void         tbg_sort    (TABAG *bag, int dir, int mode);
 extern void         tbg_sortsz  (TABAG *bag, int dir, int heap);
 extern void         tbg_reverse (TABAG *bag);
 extern TID          tbg_reduce  (TABAG *bag, int keep0);
@@ -769,11 +837,24 @@ extern void         tbg_unpack  (TABAG *bag, int dir);
 extern int          tbg_packcnt (TABAG *bag);
 extern SUPP         tbg_occur   (TABAG *bag, const ITEM *items, ITEM n);
 extern int          tbg_ipwgt   (TABAG *bag, int mode);
+extern int          tbg_compress(TABAG *bag);
+extern int          tbg_expand  (TABAG *bag);
+extern int          tbg_iszip   (const TABAG *bag);
+extern size_t       tbg_zipsize (const TABAG *bag);
 
 #ifndef NDEBUG
 extern void         tbg_show    (TABAG *bag);
 #endif
 
+/*----------------------------------------------------------------------
+  Transaction Iterator Functions
+----------------------------------------------------------------------*/
+extern TBGITER*     tbi_create  (const TABAG *bag);
+extern void         tbi_delete  (TBGITER *iter);
+extern void         tbi_seek    (TBGITER *iter, TID index);
+extern TRACT*       tbi_next    (TBGITER *iter);
+extern TID          tbi_index   (const TBGITER *iter);
+
 /*----------------------------------------------------------------------
   Surrogate Generation Functions
 ----------------------------------------------------------------------*/
@@ -815,6 +896,7 @@ extern ITEM         tan_size    (const TANODE *node);
 extern ITEM*        tan_items   (TANODE *node);
 extern ITEM         tan_item    (const TANODE *node, ITEM index);
 extern TANODE*      tan_child   (const TANODE *node, ITEM index);
+extern const ITEM*  tan_widen   (const TANODE *node, ITEM *buf);
 #endif
 #endif
 /*----------------------------------------------------------------------
@@ -823,16 +905,19 @@ extern TANODE*      tan_child   (const TANODE *node, ITEM index);
 #ifdef TATREEFN
 #ifdef TATCOMPACT
 extern TATREE*      tat_create  (TABAG *bag);
+extern TATREE*      tat_createx (TABAG *bag, int mode);
 extern void         tat_delete  (TATREE *tree, int del);
 extern TABAG*       tat_tabag   (const TATREE *tree);
 extern TANODE*      tat_root    (const TATREE *tree);
 extern size_t       tat_size    (const TATREE *tree);
 #else
 extern TATREE*      tat_create  (TABAG *bag);
+extern TATREE*      tat_createx (TABAG *bag, int mode);
 extern void         tat_delete  (TATREE *tree, int del);
 extern TABAG*       tat_tabag   (const TATREE *tree);
 extern TANODE*      tat_root    (const TATREE *tree);
 extern size_t       tat_size    (const TATREE *tree);
+extern int          tat_narrow  (const TATREE *tree);
 #endif
 extern int          tat_filter  (TATREE *tree, ITEM min,
                                  const int *marks, int heap);
@@ -841,6 +926,38 @@ extern void         tat_show    (TATREE *tree);
 #endif
 #endif
 
+/*----------------------------------------------------------------------
+  Vertical Representation Functions
+----------------------------------------------------------------------*/
+#ifdef TAVERTFN
+extern TAVERT*      tav_create  (TABAG *bag);
+extern void         tav_delete  (TAVERT *vert, int del);
+extern TABAG*       tav_tabag   (const TAVERT *vert);
+extern ITEM         tav_itemcnt (const TAVERT *vert);
+extern TID          tav_tracnt  (const TAVERT *vert);
+extern size_t       tav_blkcnt  (const TAVERT *vert);
+extern SUPP         tav_supp    (const TAVERT *vert, ITEM item);
+extern const TIDBLK*tav_bits    (const TAVERT *vert, ITEM item);
+extern TID          tav_cnt     (const TAVERT *vert, const TIDBLK *a);
+extern SUPP         tav_wgt     (const TAVERT *vert, const TIDBLK *a);
+extern SUPP         tav_and     (const TAVERT *vert, TIDBLK *dst,
+                                 const TIDBLK *a, const TIDBLK *b);
+extern SUPP         tav_andwgt  (const TAVERT *vert,
+                                 const TIDBLK *a, const TIDBLK *b);
+extern int          tav_subset  (const TAVERT *vert,
+                                 const TIDBLK *a, const TIDBLK *b);
+extern TID          tav_diff    (const TAVERT *vert, TID *dst,
+                                 const TIDBLK *a, const TIDBLK *b,
+                                 SUPP *wgt);
+extern SUPP         tav_tidwgt  (const TAVERT *vert,
+                                 const TID *tids, TID n);
+extern void         tav_clear   (const TAVERT *vert, TIDBLK *dst,
+                                 const TID *tids, TID n);
+#ifndef NDEBUG
+extern void         tav_show    (TAVERT *vert);
+#endif
+#endif
+
 /*----------------------------------------------------------------------
   Preprocessor Definitions
 ----------------------------------------------------------------------*/
@@ -898,6 +1015,11 @@ extern void         tat_show    (TATREE *tree);
 #define tbg_errmsg(b,s,n) ib_errmsg((b)->base, s, n)
 #define tbg_reverse(b)    ptr_reverse((b)->tracts, (b)->cnt)
 #define tbg_packcnt(b)    ((b)->mode & TA_PACKED)
+#define tbg_iszip(b)      ((b)->zip != NULL)
+#define tbg_zipsize(b)    ((b)->zip ? (b)->zip->size : 0)
+
+/*--------------------------------------------------------------------*/
+#define tbi_index(i)      ((i)->idx)
 
 /*--------------------------------------------------------------------*/
 
@@ -914,6 +1036,7 @@ extern void         tat_show    (TATREE *tree);
 #define tan_children(n)   ((TANODE*)(n)->data)
 #define tan_suffix(n)     ((const ITEM*)(n)->data)
 
+#define tat_create(b)     tat_createx(b,0)
 #define tat_tabag(t)      ((t)->bag)
 #define tat_root(t)       (&(t)->root)
 
@@ -925,10 +1048,24 @@ extern void         tat_show    (TATREE *tree);
 #define tan_item(n,i)     ((n)->items[i])
 #define tan_items(n)      ((n)->items)
 
+#define tat_create(b)     tat_createx(b,0)
 #define tat_tabag(t)      ((t)->bag)
 #define tat_root(t)       ((t)->root)
+#define tat_narrow(t)     ((t)->mode & TAT_NARROW)
 
 #endif
 #endif
 
+/*--------------------------------------------------------------------*/
+#ifdef TAVERTFN
+
+#define tav_tabag(v)      ((v)->bag)
+#define tav_itemcnt(v)    ((v)->cnt)
+#define tav_tracnt(v)     ((v)->tracnt)
+#define tav_blkcnt(v)     ((v)->blkcnt)
+#define tav_supp(v,i)     ((v)->supps[i])
+#define tav_bits(v,i)     ((v)->bits +(size_t)(i) *(v)->blkcnt)
+
+#endif
+
 #endif
@@ -9,6 +9,10 @@
 #           2013.04.04 added external modules and tract/train main prgs.
 #           2016.04.20 completed dependencies on header files
 #           2016.10.21 modules cm4seqs and cmfilter added (from coconad)
+#           2026.10.14 module tavert added (vertical representation)
+#           2026.10.14 module fim64 added (32/64 items machine)
+#           2026.10.14 main program isrdec added (binary output decoder)
+#           2026.10.14 module isridx and main program isridx added
 #-----------------------------------------------------------------------
 THISDIR  = ..\..\tract\src
 UTILDIR  = ..\..\util\src
@@ -53,7 +57,12 @@ RGTOBJS  = $(UTILDIR)\arrays.obj   $(UTILDIR)\escape.obj   \
            $(MATHDIR)\ruleval.obj  $(MATHDIR)\gamma.obj    \
            $(MATHDIR)\chi2.obj     taread.obj report.obj patspec.obj
 
-PRGS     = fim16.exe tract.exe train.exe psp.exe rgt.exe
+ISROBJS  = $(UTILDIR)\arrays.obj   $(UTILDIR)\escape.obj   \
+           $(UTILDIR)\idmap.obj    $(UTILDIR)\tabread.obj  \
+           $(UTILDIR)\scform.obj   taread.obj
+
+PRGS     = fim16.exe tract.exe train.exe psp.exe rgt.exe isrdec.exe \
+           isridx.exe
 
 #-----------------------------------------------------------------------
 # Build Programs
@@ -76,6 +85,12 @@ psp.exe:      $(PSPOBJS) pspmain.obj tract.mak
 rgt.exe:      $(RGTOBJS) rgmain.obj makefile
 	$(LD) $(LDFLAGS) $(RGTOBJS) rgmain.obj $(LIBS) /Fo$@
 
+isrdec.exe:   $(ISROBJS) isrmain.obj tract.mak
+	$(LD) $(LDFLAGS) $(ISROBJS) isrmain.obj $(LIBS) /out:$@
+
+isridx.exe:   $(ISROBJS) isxmain.obj tract.mak
+	$(LD) $(LDFLAGS) $(ISROBJS) isxmain.obj $(LIBS) /out:$@
+
 #-----------------------------------------------------------------------
 # Main Programs
 #-----------------------------------------------------------------------
@@ -103,6 +118,14 @@ rgmain.obj:   $(HDRS) $(UTILDIR)\memsys.h $(MATHDIR)\ruleval.h report.h
 rgmain.obj:   rulegen.c makefile
 	$(CC) $(CFLAGS) $(INCS) /D RG_MAIN rulegen.c /Fo$@
 
+isrmain.obj:  $(HDRS_S) $(UTILDIR)\error.h tract.h
+isrmain.obj:  report.h report.c tract.mak
+	$(CC) $(CFLAGS) $(INCS) /D ISR_MAIN report.c /Fo$@
+
+isxmain.obj:  $(HDRS_1) $(UTILDIR)\error.h tract.h report.h
+isxmain.obj:  isridx.h isridx.c tract.mak
+	$(CC) $(CFLAGS) $(INCS) /D ISX_MAIN isridx.c /Fo$@
+
 #-----------------------------------------------------------------------
 # Item and Transaction Management
 #-----------------------------------------------------------------------
@@ -134,6 +157,10 @@ tatree.obj:   $(HDRS_R)
 tatree.obj:   tract.h tract.c tract.mak
 	$(CC) $(CFLAGS) $(INCS) /D TA_READ /D TATREEFN tract.c /Fo$@
 
+tavert.obj:   $(HDRS_R)
+tavert.obj:   tract.h tract.c tract.mak
+	$(CC) $(CFLAGS) $(INCS) /D TA_READ /D TAVERTFN tract.c /Fo$@
+
 #-----------------------------------------------------------------------
 # Train Management
 #-----------------------------------------------------------------------
@@ -169,6 +196,13 @@ fim16.obj:    $(HDRS)
 fim16.obj:    fim16.c tract.mak
 	$(CC) $(CFLAGS) $(INCS) fim16.c /Fo$@
 
+#-----------------------------------------------------------------------
+# Frequent Item Set Mining (with at most 32/64 items)
+#-----------------------------------------------------------------------
+fim64.obj:    $(HDRS_1) tract.h report.h
+fim64.obj:    fim64.h fim64.c tract.mak
+	$(CC) $(CFLAGS) $(INCS) fim64.c /Fo$@
+
 #-----------------------------------------------------------------------
 # Pattern Statistics Management
 #-----------------------------------------------------------------------
@@ -242,6 +276,13 @@ repcmd.obj:   report.h report.c tract.mak
 	$(CC) $(CFLAGS) $(INCS) /D RSUPP=double /D ISR_PATSPEC \
               /D ISR_CLOMAX report.c /Fo$@
 
+#-----------------------------------------------------------------------
+# Item Set Index Management
+#-----------------------------------------------------------------------
+isridx.obj:   $(HDRS_1) tract.h report.h
+isridx.obj:   isridx.h isridx.c tract.mak
+	$(CC) $(CFLAGS) $(INCS) isridx.c /Fo$@
+
 #-----------------------------------------------------------------------
 # Rule Generation Tree Management
 #-----------------------------------------------------------------------
@@ -0,0 +1,239 @@
+/*----------------------------------------------------------------------
+  File    : bench.c
+  Contents: benchmark records (per phase timing, machine-readable output)
+  History : 2026.10.14 file created
+            2026.10.14 function bnr_wall() added
+----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+#include "bench.h"
+#ifdef STORAGE
+#include "storage.h"
+#endif
+
+/*----------------------------------------------------------------------
+  Auxiliary Functions
+----------------------------------------------------------------------*/
+
+static double walltime (void)
+{                               /* --- get the wall clock time */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  LARGE_INTEGER c, f;           /* counter value and frequency */
+  QueryPerformanceCounter(&c);  /* get the performance counter */
+  QueryPerformanceFrequency(&f);
+  return (double)c.QuadPart /(double)f.QuadPart;
+  #else                         /* if POSIX system */
+  struct timeval tv;            /* current time of day */
+  gettimeofday(&tv, NULL);      /* get the current time */
+  return (double)tv.tv_sec +1e-6 *(double)tv.tv_usec;
+  #endif                        /* (in seconds) */
+}  /* walltime() */
+
+/*--------------------------------------------------------------------*/
+
+static BNRVALUE* value (BENCHREC *bnr, const char *key)
+{                               /* --- find or add a value */
+  int i;                        /* loop variable */
+
+  for (i = 0; i < bnr->valcnt; i++)
+    if (strcmp(bnr->vals[i].key, key) == 0)
+      return bnr->vals +i;      /* find an existing value */
+  if (bnr->valcnt >= BNR_MAXVALS)
+    return NULL;                /* check for space for a new value */
+  bnr->vals[i].key = key;       /* note the name of the value */
+  bnr->valcnt += 1;             /* and count the new value */
+  return bnr->vals +i;          /* return the new value */
+}  /* value() */
+
+/*--------------------------------------------------------------------*/
+
+static void jsonstr (FILE *file, const char *s)
+{                               /* --- write a JSON string */
+  fputc('"', file);             /* start the string */
+  for ( ; *s; s++) {            /* traverse the characters */
+    if      ((*s == '"') || (*s == '\\')) fprintf(file, "\\%c", *s);
+    else if ((unsigned char)*s < 0x20)
+      fprintf(file, "\\u%04x", (unsigned)(unsigned char)*s);
+    else fputc(*s, file);       /* escape quotes, backslashes and */
+  }                             /* control characters */
+  fputc('"', file);             /* terminate the string */
+}  /* jsonstr() */
+
+/*----------------------------------------------------------------------
+  Main Functions
+----------------------------------------------------------------------*/
+
+BENCHREC* bnr_create (void)
+{                               /* --- create a benchmark record */
+  BENCHREC *bnr;                /* created benchmark record */
+
+  bnr = (BENCHREC*)malloc(sizeof(BENCHREC));
+  if (!bnr) return NULL;        /* allocate the base structure */
+  bnr->cur    = -1;             /* there is no current phase */
+  bnr->wall   = 0;              /* and thus no start time */
+  bnr->cpu    = 0;
+  bnr->phcnt  = 0;              /* there are no phases */
+  bnr->valcnt = 0;              /* and no values yet */
+  return bnr;                   /* return the created record */
+}  /* bnr_create() */
+
+/*--------------------------------------------------------------------*/
+
+void bnr_delete (BENCHREC *bnr)
+{ if (bnr) free(bnr); }         /* --- delete a benchmark record */
+
+/*--------------------------------------------------------------------*/
+
+void bnr_begin (BENCHREC *bnr, const char *phase)
+{                               /* --- begin a phase */
+  int i;                        /* loop variable */
+
+  if (!bnr) return;             /* check for a benchmark record */
+  bnr_end(bnr);                 /* end the current phase */
+  for (i = 0; i < bnr->phcnt; i++)
+    if (strcmp(bnr->phs[i].name, phase) == 0)
+      break;                    /* find an existing phase */
+  if (i >= bnr->phcnt) {        /* if the phase is new */
+    if (i >= BNR_MAXPHS) return;/* check for space for the phase */
+    bnr->phs[i].name = phase;   /* note the name of the phase */
+    bnr->phs[i].wall = bnr->phs[i].cpu = 0;
+    bnr->phcnt += 1;            /* clear the times of the phase */
+  }                             /* and count the new phase */
+  bnr->cur  = i;                /* note the current phase */
+  bnr->cpu  = clock();          /* and its start times */
+  bnr->wall = walltime();       /* (times of repeated phases */
+}  /* bnr_begin() */            /* are summed) */
+
+/*--------------------------------------------------------------------*/
+
+void bnr_end (BENCHREC *bnr)
+{                               /* --- end the current phase */
+  BNRPHASE *p;                  /* current phase */
+
+  if (!bnr || (bnr->cur < 0)) return;
+  p = bnr->phs +bnr->cur;       /* get the current phase and */
+  p->wall += walltime() -bnr->wall; /* add the elapsed times */
+  p->cpu  += (double)(clock()-bnr->cpu) /(double)CLOCKS_PER_SEC;
+  bnr->cur = -1;                /* there is no current phase */
+}  /* bnr_end() */
+
+/*--------------------------------------------------------------------*/
+
+void bnr_int (BENCHREC *bnr, const char *key, double val)
+{                               /* --- set an integer value */
+  BNRVALUE *v;                  /* value to set */
+
+  if (!bnr || !(v = value(bnr, key))) return;
+  v->str = 0;                   /* format the value as an integer */
+  snprintf(v->val, BNR_VALLEN, "%.0f", val);
+}  /* bnr_int() */
+
+/*--------------------------------------------------------------------*/
+
+void bnr_dbl (BENCHREC *bnr, const char *key, double val)
+{                               /* --- set a real-valued value */
+  BNRVALUE *v;                  /* value to set */
+
+  if (!bnr || !(v = value(bnr, key))) return;
+  v->str = 0;                   /* format the value as a number */
+  snprintf(v->val, BNR_VALLEN, "%.10g", val);
+}  /* bnr_dbl() */
+
+/*--------------------------------------------------------------------*/
+
+void bnr_str (BENCHREC *bnr, const char *key, const char *val)
+{                               /* --- set a string value */
+  BNRVALUE *v;                  /* value to set */
+
+  if (!bnr || !(v = value(bnr, key))) return;
+  v->str = 1;                   /* copy the string (truncated) */
+  snprintf(v->val, BNR_VALLEN, "%s", val);
+}  /* bnr_str() */
+
+/*--------------------------------------------------------------------*/
+
+size_t bnr_peak (void)
+{                               /* --- get peak memory usage */
+  #ifdef _WIN32                 /* if Microsoft Windows system */
+  return 0;                     /* (would need the psapi library) */
+  #else                         /* if POSIX system */
+  struct rusage ru;             /* resource usage of the process */
+  if (getrusage(RUSAGE_SELF, &ru) != 0) return 0;
+  #ifdef __APPLE__              /* maximum resident set size */
+  return (size_t)ru.ru_maxrss;  /* is given in bytes on macOS */
+  #else                         /* and in kilobytes on Linux */
+  return (size_t)ru.ru_maxrss *1024;
+  #endif
+  #endif
+}  /* bnr_peak() */
+
+/*--------------------------------------------------------------------*/
+
+double bnr_wall (void)
+{                               /* --- get the wall clock time */
+  return walltime();            /* (in seconds, e.g. for timing */
+}  /* bnr_wall() */             /* parts of a search) */
+
+/*--------------------------------------------------------------------*/
+
+int bnr_write (BENCHREC *bnr, FILE *file)
+{                               /* --- write a benchmark record */
+  int      i;                   /* loop variable */
+  double   wall = 0, cpu = 0;   /* total times */
+  BNRPHASE *p;                  /* to traverse the phases */
+
+  assert(bnr && file);          /* check the function arguments */
+  bnr_end(bnr);                 /* end the current phase */
+  fputc('{', file);             /* start the JSON object */
+  for (i = 0; i < bnr->valcnt; i++) {
+    jsonstr(file, bnr->vals[i].key); fputs(": ", file);
+    if (bnr->vals[i].str) jsonstr(file, bnr->vals[i].val);
+    else                  fputs(bnr->vals[i].val, file);
+    fputs(", ", file);          /* write the additional values */
+  }                             /* (strings or numbers) */
+  fputs("\"phases\": {", file); /* start the phase object */
+  for (i = 0; i < bnr->phcnt; i++) {
+    p = bnr->phs +i;            /* traverse the phases */
+    if (i > 0) fputs(", ", file);
+    jsonstr(file, p->name);     /* write name and times of phase */
+    fprintf(file, ": {\"wall\": %.6f, \"cpu\": %.6f}", p->wall, p->cpu);
+    wall += p->wall; cpu += p->cpu;
+  }                             /* sum the times of the phases */
+  fprintf(file, "}, \"wall\": %.6f, \"cpu\": %.6f", wall, cpu);
+  fprintf(file, ", \"peakmem\": %.0f}\n", (double)bnr_peak());
+  return ferror(file) ? -1 : 0; /* write totals and peak memory */
+}  /* bnr_write() */
+
+/*--------------------------------------------------------------------*/
+
+int bnr_append (BENCHREC *bnr, const char *fname)
+{                               /* --- append record to a file */
+  FILE *file;                   /* output file */
+  int  r;                       /* result of bnr_write() */
+
+  assert(bnr);                  /* check the function arguments */
+  if (!fname || !*fname || (strcmp(fname, "-") == 0))
+    return bnr_write(bnr, stdout);
+  file = fopen(fname, "a");     /* open the output file */
+  if (!file) return -1;         /* for appending */
+  r = bnr_write(bnr, file);     /* write the benchmark record */
+  if (fclose(file) != 0) r = -1;
+  return r;                     /* return the error status */
+}  /* bnr_append() */
+
+/* A benchmark record collects the elapsed wall clock and processor  */
+/* times of named phases (a phase ends when the next one begins; the */
+/* times of a phase that is begun repeatedly are summed) and a set   */
+/* of named values. It is written as a single JSON object per line,  */
+/* so that results of several runs can be appended to the same file. */
+/* All functions except bnr_write() accept a null record and do      */
+/* nothing in this case, so that programs can call them without      */
+/* checking whether benchmarking was requested.                      */
@@ -0,0 +1,61 @@
+/*----------------------------------------------------------------------
+  File    : bench.h
+  Contents: benchmark records (per phase timing, machine-readable output)
+  History : 2026.10.14 file created
+            2026.10.14 function bnr_wall() added
+----------------------------------------------------------------------*/
+#ifndef __BENCHREC__
+#define __BENCHREC__
+#include <stdio.h>
+#include <stddef.h>
+#include <time.h>
+
+/*----------------------------------------------------------------------
+  Preprocessor Definitions
+----------------------------------------------------------------------*/
+#define BNR_MAXPHS  16          /* maximum number of phases */
+#define BNR_MAXVALS 32          /* maximum number of values */
+#define BNR_VALLEN  64          /* maximum length of a value */
+
+/*----------------------------------------------------------------------
+  Type Definitions
+----------------------------------------------------------------------*/
+typedef struct {                /* --- benchmark phase --- */
+  const char *name;             /* name of the phase */
+  double     wall;              /* elapsed (wall clock) time */
+  double     cpu;               /* processor time (all threads) */
+} BNRPHASE;                     /* (benchmark phase) */
+
+typedef struct {                /* --- benchmark value --- */
+  const char *key;              /* name of the value */
+  int        str;               /* whether the value is a string */
+  char       val[BNR_VALLEN];   /* formatted value */
+} BNRVALUE;                     /* (benchmark value) */
+
+typedef struct {                /* --- benchmark record --- */
+  int        cur;               /* index of the current phase */
+  double     wall;              /* start of current phase (wall) */
+  clock_t    cpu;               /* start of current phase (cpu) */
+  int        phcnt;             /* number of phases */
+  int        valcnt;            /* number of values */
+  BNRPHASE   phs[BNR_MAXPHS];   /* timed phases */
+  BNRVALUE   vals[BNR_MAXVALS]; /* additional values */
+} BENCHREC;                     /* (benchmark record) */
+
+/*----------------------------------------------------------------------
+  Functions
+----------------------------------------------------------------------*/
+extern BENCHREC* bnr_create (void);
+extern void      bnr_delete (BENCHREC *bnr);
+extern void      bnr_begin  (BENCHREC *bnr, const char *phase);
+extern void      bnr_end    (BENCHREC *bnr);
+extern void      bnr_int    (BENCHREC *bnr, const char *key, double val);
+extern void      bnr_dbl    (BENCHREC *bnr, const char *key, double val);
+extern void      bnr_str    (BENCHREC *bnr, const char *key,
+                             const char *val);
+extern size_t    bnr_peak   (void);
+extern double    bnr_wall   (void);
+extern int       bnr_write  (BENCHREC *bnr, FILE *file);
+extern int       bnr_append (BENCHREC *bnr, const char *fname);
+
+#endif
@@ -28,6 +28,7 @@
             2011.07.27 function scn_first() added (cond. scn_next())
             2013.03.20 sizes and lengths changed to type size_t
             2013.08.29 error code not set in scn_eof() if reperr == 0
+            2026.10.14 error message buffer moved into scanner
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -218,13 +219,6 @@ static const char *msgs[] = {   /* error messages */
 };
 #endif  /* #ifdef SCN_SCAN */
 
-/*----------------------------------------------------------------------
-  Global Variables
-----------------------------------------------------------------------*/
-#ifdef SCN_SCAN
-static char msgbuf[2*SCN_MAXLEN+64];  /* buffer for error messages */
-#endif
-
 /*----------------------------------------------------------------------
   Main Functions
 ----------------------------------------------------------------------*/
@@ -754,7 +748,7 @@ const char* scn_errmsg (SCANNER *scan, char *buf, size_t size)
 
   assert(scan                   /* check the function arguments */
   &&    (!buf || (size > 0)));  /* if none given, get internal buffer */
-  if (!buf) { buf = msgbuf; size = sizeof(msgbuf); }
+  if (!buf) { buf = scan->msg; size = sizeof(scan->msg); }
   i = (scan->token < 0) ? -scan->token : 0;
   assert(i < (int)(sizeof(msgs)/sizeof(*msgs)));
   msg = msgs[i];                /* get the error message format */
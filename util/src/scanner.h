@@ -19,6 +19,7 @@
             2011.07.28 macros SCN_NUMID() and SCN_ERRVAL() added
             2011.12.16 "do {  } while (0)" added to many macros
             2013.03.20 sizes and lengths changed to type size_t
+            2026.10.14 error message buffer moved into scanner
 ----------------------------------------------------------------------*/
 #ifndef __SCANNER__
 #define __SCANNER__
@@ -89,6 +90,7 @@ typedef struct {                /* --- scanner --- */
   CCHAR  *errname;              /* name of the error output file */
   char   tvs[2][SCN_MAXLEN+4];  /* buffers for token values */
   char   buf[SCN_BUFSIZE];      /* read buffer */
+  char   msg[2*SCN_MAXLEN+64];  /* buffer for error messages */
 } SCANNER;                      /* (scanner) */
 #endif
 
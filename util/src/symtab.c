@@ -30,6 +30,9 @@
             2013.02.11 general pointers added as possible keys
             2013.03.07 adapted to direction param. of sorting functions
             2013.11.21 functions for integer key types added
+            2026.10.14 open addressing mode for identifier maps added
+            2026.10.14 st_setmode(), st_insertx(), st_lookupx() added
+            2026.10.14 function st_prefetch() added (prefetch bin/slot)
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -47,6 +50,8 @@
 #define DFLT_INIT    32767      /* default initial hash table size */
 #define DFLT_MAX   4194303      /* default maximal hash table size */
 #define BLKSIZE       4096      /* block size for identifier array */
+#define ELMBLKSIZE   65536      /* block size for symbol elements */
+#define ELMALIGN         8      /* alignment of symbol elements */
 
 #ifdef ALIGN8
 #define ALIGN            8      /* alignment to addresses that are */
@@ -208,6 +213,19 @@ static void delsym (SYMTAB *tab)
   STE    *e, *t;                /* to traverse the symbol list */
 
   assert(tab);                  /* check the function argument */
+  if (tab->slots) {             /* if open addressing */
+    for (i = 0; i < tab->size; i++) {
+      if (!(e = tab->slots[i].ste)) continue;
+      if (tab->delfn) tab->delfn(e+1);
+      tab->slots[i].ste = NULL; /* traverse the used slots, */
+    }                           /* call the deletion function */
+    while (tab->blks) {         /* and clear the slots, */
+      e = (STE*)tab->blks;      /* then delete the blocks */
+      tab->blks = tab->blks->succ;  /* of symbol elements */
+      free(e);                  /* (symbol elements are not */
+    }                           /* allocated individually) */
+    return;                     /* abort the function */
+  }
   for (i = 0; i < tab->size; i++) {
     e = tab->bins[i];           /* traverse the bin array */
     tab->bins[i] = NULL;        /* clear the current bin */
@@ -274,6 +292,97 @@ static void rehash (SYMTAB *tab)
       p[i] = sort(p[i]);        /* to the visibility level */
 }  /* rehash() */
 
+/*--------------------------------------------------------------------*/
+
+static size_t mix (size_t h)
+{                               /* --- mix the bits of a hash value */
+  h ^= h >> 15; h *= (size_t)0x2c1b3c6dUL;
+  h ^= h >> 12; h *= (size_t)0x297a2d39UL;
+  return h ^ (h >> 15);         /* compute and return mixed value */
+}  /* mix() */
+
+/* The key hash functions (st_strhash() etc.) are designed for a    */
+/* modulus with an odd number of hash bins. Open addressing uses a  */
+/* power of 2 as the number of slots and thus only the lowest bits  */
+/* of a hash value, which need to depend on all bits of the key.    */
+
+/*--------------------------------------------------------------------*/
+
+static void put (STSLOT *slots, size_t mask, size_t h, STE *e)
+{                               /* --- put an element into a slot */
+  size_t i, d, x;               /* slot index, probe distances */
+  STSLOT t;                     /* exchange buffer */
+
+  for (i = h & mask, d = 0; slots[i].ste; i = (i+1) & mask, d++) {
+    x = (i -(slots[i].hash & mask)) & mask;
+    if (x >= d) continue;       /* if the resident element is closer */
+    t = slots[i];               /* to its home slot, take its slot */
+    slots[i].hash = h; slots[i].ste = e;
+    h = t.hash; e = t.ste; d = x;
+  }                             /* and continue with the displaced */
+  slots[i].hash = h;            /* element (Robin Hood hashing) */
+  slots[i].ste  = e;            /* store the element */
+}  /* put() */                  /* in the empty slot found */
+
+/*--------------------------------------------------------------------*/
+
+static size_t find (SYMTAB *tab, const void *key, int type, size_t h)
+{                               /* --- find the slot of a symbol */
+  size_t i, d, mask;            /* slot index, probe distance */
+  STE    *e;                    /* to access the symbol element */
+
+  mask = tab->size -1;          /* get the slot index mask */
+  for (i = h & mask, d = 0; (e = tab->slots[i].ste) != NULL;
+       i = (i+1) & mask, d++) {  /* traverse the probe sequence */
+    if (((i -(tab->slots[i].hash & mask)) & mask) < d)
+      break;                    /* no element farther from home */
+    if ((tab->slots[i].hash == h) && (e->type == type)
+    &&  (tab->cmpfn(key, e->key, tab->data) == 0))
+      return i;                 /* compare the stored hash values */
+  }                             /* before comparing the keys */
+  return tab->size;             /* return 'not found' */
+}  /* find() */
+
+/*--------------------------------------------------------------------*/
+
+static int grow (SYMTAB *tab)
+{                               /* --- enlarge the slot array */
+  size_t i, size;               /* loop variable, new number of slots */
+  STSLOT *p;                    /* new slot array */
+
+  assert(tab && tab->slots);    /* check the function argument */
+  size = tab->size << 1;        /* double the number of slots */
+  p = (STSLOT*)calloc(size, sizeof(STSLOT));
+  if (!p) return -1;            /* allocate an enlarged slot array */
+  for (i = 0; i < tab->size; i++)
+    if (tab->slots[i].ste)      /* reinsert the elements with */
+      put(p, size-1, tab->slots[i].hash, tab->slots[i].ste);
+  free(tab->slots);             /* the stored hash values, */
+  tab->slots = p;               /* delete the old slot array */
+  tab->size  = size;            /* and set the new array */
+  return 0;                     /* return 'ok' */
+}  /* grow() */
+
+/*--------------------------------------------------------------------*/
+
+static STE* elmalloc (SYMTAB *tab, size_t size)
+{                               /* --- allocate a symbol element */
+  STBLK  *b = tab->blks;        /* current block of elements */
+  size_t h, z;                  /* size of block header and data */
+
+  h    = (sizeof(STBLK) +ELMALIGN-1) & ~(size_t)(ELMALIGN-1);
+  size = (size          +ELMALIGN-1) & ~(size_t)(ELMALIGN-1);
+  if (!b || (b->used +size > b->size)) {
+    z = (size > ELMBLKSIZE) ? size : ELMBLKSIZE;
+    b = (STBLK*)malloc(h +z);   /* if the current block is full, */
+    if (!b) return NULL;        /* allocate a new block */
+    b->size = z; b->used = 0;   /* and add it to the block list */
+    b->succ = tab->blks; tab->blks = b;
+  }                             /* return the next free element */
+  b->used += size;              /* of the current block */
+  return (STE*)((char*)b +h +b->used -size);
+}  /* elmalloc() */
+
 /*----------------------------------------------------------------------
   Symbol Table Functions
 ----------------------------------------------------------------------*/
@@ -296,6 +405,9 @@ SYMTAB* st_create (size_t init, size_t max, HASHFN hashfn,
   tab->cmpfn  = (cmpfn)  ? cmpfn  : st_strcmp;
   tab->data   = data;
   tab->delfn  = delfn;
+  tab->mode   = ST_CHAINED;     /* hash bins with element lists */
+  tab->slots  = NULL;
+  tab->blks   = NULL;
   tab->idsize = (size_t)-1;
   tab->ids    = NULL;
   return tab;                   /* return created symbol table */
@@ -303,36 +415,75 @@ SYMTAB* st_create (size_t init, size_t max, HASHFN hashfn,
 
 /*--------------------------------------------------------------------*/
 
+int st_setmode (SYMTAB *tab, int mode)
+{                               /* --- set the table mode */
+  size_t size;                  /* number of slots */
+
+  assert(tab && (tab->cnt <= 0));  /* check the function arguments */
+  if (!(mode & ST_OPENADR) || tab->slots)
+    return 0;                   /* check whether to convert the table */
+  for (size = 16; size < tab->size; size <<= 1);
+  tab->slots = (STSLOT*)calloc(size, sizeof(STSLOT));
+  if (!tab->slots) return -1;   /* allocate a slot array */
+  free(tab->bins);              /* replace the hash bin array */
+  tab->bins = NULL;             /* with a slot array, the size */
+  tab->size = size;             /* of which is a power of 2 */
+  tab->mode = ST_OPENADR;       /* (probe sequences are traversed */
+  return 0;                     /* with an index mask) */
+}  /* st_setmode() */
+
+/* With open addressing the elements are stored directly in a slot */
+/* array together with their (mixed) hash values, so that lookups   */
+/* follow a contiguous probe sequence instead of a list, compare    */
+/* keys only if the hash values agree, and the table can be grown   */
+/* without calling the hash function again. The symbol elements     */
+/* (including their keys) are allocated in large blocks, which are  */
+/* released only when the table is deleted (removed symbols do not  */
+/* release memory, which suits tables that mostly grow). Visibility */
+/* levels are not supported and the maximal table size is ignored.  */
+
+/*--------------------------------------------------------------------*/
+
 void st_delete (SYMTAB *tab)
 {                               /* --- delete a symbol table */
-  assert(tab && tab->bins);     /* check argument */
+  assert(tab && (tab->bins || tab->slots));   /* check argument */
   delsym(tab);                  /* delete all symbols, */
-  free(tab->bins);              /* the hash bin array, */
+  if (tab->bins)  free(tab->bins);   /* the hash bin array */
+  if (tab->slots) free(tab->slots);  /* or the slot array, */
   if (tab->ids) free(tab->ids); /* the identifier array, */
   free(tab);                    /* and the symbol table body */
 }  /* st_delete() */
 
 /*--------------------------------------------------------------------*/
 
-void* st_insert (SYMTAB *tab, const void *key, int type,
-                 size_t keysize, size_t datasize)
+void* st_insertx (SYMTAB *tab, const void *key, int type,
+                  size_t keysize, size_t datasize, size_t hash)
 {                               /* --- insert a symbol (name/key) */
   size_t h;                     /* hash value */
-  size_t i;                     /* index of hash bin, buffer */
+  size_t i = 0;                 /* index of hash bin, buffer */
   STE    *e, *n;                /* to traverse a bin list */
 
   assert(tab && key             /* check the function arguments */
   &&    ((datasize >= sizeof(int)) || (tab->idsize == (size_t)-1)));
-  if ((tab->cnt  > tab->size)   /* if the bins are rather full and */
-  &&  (tab->size < tab->max))   /* table does not have maximal size, */
-    rehash(tab);                /* reorganize the hash table */
-  h = tab->hashfn(key, type);   /* compute the hash value and */
-  i = h % tab->size;            /* the index of the hash bin */
-  for (e = tab->bins[i]; e; e = e->succ)
-    if ((type == e->type) && (tab->cmpfn(key, e->key, tab->data) == 0))
-      break;                    /* check whether symbol exists */
-  if (e && (e->level == tab->level))
-    return EXISTS;              /* if symbol found on current level */
+  if (tab->slots) {             /* if open addressing */
+    assert(tab->level <= 0);    /* (no visibility levels supported) */
+    if (((tab->cnt +1) << 2) > tab->size *3) {
+      if (grow(tab) != 0) return NULL; }
+    h = mix(hash);              /* mix the given hash value */
+    if (find(tab, key, type, h) < tab->size)
+      return EXISTS; }          /* check whether symbol exists */
+  else {                        /* if hash bins with element lists */
+    if ((tab->cnt  > tab->size) /* if the bins are rather full and */
+    &&  (tab->size < tab->max)) /* table does not have maximal size, */
+      rehash(tab);              /* reorganize the hash table */
+    h = hash;                   /* get the hash value and compute */
+    i = h % tab->size;          /* the index of the hash bin */
+    for (e = tab->bins[i]; e; e = e->succ)
+      if ((type == e->type) && (tab->cmpfn(key, e->key, tab->data) == 0))
+        break;                  /* check whether symbol exists */
+    if (e && (e->level == tab->level))
+      return EXISTS;            /* if symbol found on current level */
+  }
 
   #ifdef IDMAPFN                /* if key/identifier map management */
   if (tab->cnt >= tab->idsize){ /* if the identifier array is full */
@@ -345,13 +496,19 @@ void* st_insert (SYMTAB *tab, const void *key, int type,
   }                             /* (no resizing for symbol tables */
   #endif                        /* since then tab->idsize = MAX_INT) */
   datasize = ((datasize +ALIGN-1) /ALIGN) *ALIGN;
-  n = (STE*)malloc(sizeof(STE) +datasize +keysize);
+  n = (tab->slots) ? elmalloc(tab, sizeof(STE) +datasize +keysize)
+                   : (STE*)malloc(sizeof(STE) +datasize +keysize);
   if (!n) return NULL;          /* allocate memory for new symbol */
   memcpy(n->key = (char*)(n+1) +datasize, key, keysize);
   n->type  = type;              /* note the symbol name/key, type, */
   n->level = tab->level;        /* and the current visibility level */
-  n->succ  = tab->bins[i];      /* insert new symbol at the head */
-  tab->bins[i] = n++;           /* of the hash bin list */
+  if (tab->slots) {             /* if open addressing, */
+    n->succ = NULL;             /* store the new symbol in a slot */
+    put(tab->slots, tab->size-1, h, n++); }
+  else {                        /* if hash bins with element lists, */
+    n->succ = tab->bins[i];     /* insert new symbol at the head */
+    tab->bins[i] = n++;         /* of the hash bin list */
+  }
   #ifdef IDMAPFN                /* if key/identifier maps are */
   if (tab->ids) {               /* supported and this is such a map */
     tab->ids[tab->cnt] = (IDENT*)n;
@@ -360,13 +517,23 @@ void* st_insert (SYMTAB *tab, const void *key, int type,
   #endif                        /* and set the symbol identifier */
   tab->cnt++;                   /* increment the symbol counter */
   return n;                     /* return pointer to data field */
+}  /* st_insertx() */
+
+/*--------------------------------------------------------------------*/
+
+void* st_insert (SYMTAB *tab, const void *key, int type,
+                 size_t keysize, size_t datasize)
+{                               /* --- insert a symbol (name/key) */
+  assert(tab && key);           /* check the function arguments */
+  return st_insertx(tab, key, type, keysize, datasize,
+                    tab->hashfn(key, type));
 }  /* st_insert() */
 
 /*--------------------------------------------------------------------*/
 
 int st_remove (SYMTAB *tab, const void *key, int type)
 {                               /* --- remove a symbol/all symbols */
-  size_t i;                     /* index of hash bin */
+  size_t i, k, mask;            /* index of hash bin/slot */
   STE    **p, *e;               /* to traverse a hash bin list */
 
   assert(tab);                  /* check the function arguments */
@@ -375,6 +542,22 @@ int st_remove (SYMTAB *tab, const void *key, int type)
     tab->cnt = tab->level = 0;  /* reset visibility level */
     return 0;                   /* and symbol counter */
   }                             /* and return 'ok' */
+  if (tab->slots) {             /* if open addressing */
+    i = find(tab, key, type, mix(tab->hashfn(key, type)));
+    if (i >= tab->size) return -1;  /* find the symbol's slot */
+    e = tab->slots[i].ste;      /* note the symbol element */
+    for (mask = tab->size-1; 1; i = k) {
+      k = (i+1) & mask;         /* traverse the following slots */
+      if (!tab->slots[k].ste    /* up to an empty slot or an */
+      ||  (((k -tab->slots[k].hash) & mask) == 0))
+        break;                  /* element in its home slot */
+      tab->slots[i] = tab->slots[k];
+    }                           /* shift the elements backward */
+    tab->slots[i].ste = NULL;   /* and clear the last slot */
+    if (tab->delfn) tab->delfn(e+1);
+    tab->cnt--;                 /* delete user data (the element */
+    return 0;                   /* is kept in its block) and */
+  }                             /* decrement the symbol counter */
   i = tab->hashfn(key, type) % tab->size;
   p = tab->bins +i;             /* compute index of hash bin */
   while (*p) {                  /* and traverse the bin list */
@@ -394,20 +577,54 @@ int st_remove (SYMTAB *tab, const void *key, int type)
 
 /*--------------------------------------------------------------------*/
 
-void* st_lookup (SYMTAB *tab, const void *key, int type)
+void* st_lookupx (SYMTAB *tab, const void *key, int type, size_t hash)
 {                               /* --- look up a symbol */
   size_t i;                     /* index of hash bin */
   STE    *e;                    /* to traverse a hash bin list */
 
   assert(tab && key);           /* check the function arguments */
-  i = tab->hashfn(key, type) % tab->size;
-  e = tab->bins[i];             /* compute index of hash bin */
+  if (tab->slots) {             /* if open addressing */
+    i = find(tab, key, type, mix(hash));
+    return (i < tab->size) ? tab->slots[i].ste +1 : NULL;
+  }                             /* return the symbol's data */
+  e = tab->bins[hash % tab->size];  /* get the hash bin */
   while (e) {                   /* and traverse the bin list */
     if ((e->type == type) && (tab->cmpfn(key, e->key, tab->data) == 0))
       return e +1;              /* if symbol found, return its data */
     e = e->succ;                /* otherwise get the successor */
   }                             /* in the hash bin */
   return NULL;                  /* return 'not found' */
+}  /* st_lookupx() */
+
+/*--------------------------------------------------------------------*/
+
+void st_prefetch (SYMTAB *tab, size_t hash)
+{                               /* --- prefetch a hash bin/slot */
+  assert(tab);                  /* check the function argument */
+  #if defined __GNUC__          /* prefetching is only supported */
+  if (tab->slots)               /* by GNU C (and compatible) */
+    __builtin_prefetch(tab->slots +(mix(hash) & (tab->size-1)));
+  else                          /* prefetch the home slot */
+    __builtin_prefetch(tab->bins +(hash % tab->size));
+  #endif                        /* or the hash bin of a key */
+}  /* st_prefetch() */
+
+/* The functions st_insertx() and st_lookupx() take the hash value  */
+/* of the key as an argument, so that callers that can compute it   */
+/* more cheaply (for example, incrementally for similar keys) can   */
+/* avoid calling the hash function. The given value must be equal   */
+/* to what the hash function of the table yields for the key,       */
+/* because the hash function is still used to reorganize the bins.  */
+/* With st_prefetch() the slots or bins of several keys can be      */
+/* requested before they are looked up, so that the memory accesses */
+/* overlap, which helps if the table is much larger than the cache. */
+
+/*--------------------------------------------------------------------*/
+
+void* st_lookup (SYMTAB *tab, const void *key, int type)
+{                               /* --- look up a symbol */
+  assert(tab && key);           /* check the function arguments */
+  return st_lookupx(tab, key, type, tab->hashfn(key, type));
 }  /* st_lookup() */
 
 /*--------------------------------------------------------------------*/
@@ -417,7 +634,7 @@ void st_endblk (SYMTAB *tab)
   size_t i;                     /* loop variable */
   STE    *e, *t;                /* to traverse bin lists */
 
-  assert(tab);                  /* check for a valid symbol table */
+  assert(tab && !tab->slots);   /* check for a valid symbol table */
   if (tab->level <= 0) return;  /* if on level 0, abort */
   for (i = 0; i < tab->size; i++) { /* traverse the bin array */
     e = tab->bins[i];           /* remove all symbols of higher level */
@@ -443,10 +660,33 @@ void st_stats (const SYMTAB *tab)
   size_t len;                   /* length of current bin list */
   size_t min, max;              /* min. and max. bin list length */
   size_t cnts[10];              /* counter for bin list lengths */
+  size_t sum;                   /* sum of probe distances */
 
   assert(tab);                  /* check for a valid symbol table */
   min = (size_t)-1; max = used = 0; /* initialize variables */
   memset(cnts, 0, 10*sizeof(size_t));
+  if (tab->slots) {             /* if open addressing */
+    for (sum = i = 0; i < tab->size; i++) {
+      if (!tab->slots[i].ste) continue;
+      len = (i -tab->slots[i].hash) & (tab->size-1);
+      if (len > max) max = len; /* traverse the used slots and */
+      sum += len;               /* determine the probe distances */
+      cnts[(len >= 9) ? 9 : len]++;
+    }                           /* count the probe distances */
+    printf("number of symbols  : %"SIZE_FMT"\n", tab->cnt);
+    printf("number of slots    : %"SIZE_FMT"\n", tab->size);
+    printf("load factor        : %g\n",
+           (double)tab->cnt/(double)tab->size);
+    printf("maximal distance   : %"SIZE_FMT"\n", max);
+    printf("average distance   : %g\n",
+           (tab->cnt > 0) ? (double)sum/(double)tab->cnt : 0.0);
+    printf("distance distribution:\n");
+    for (i = 0; i < 9; i++) printf("%6"SIZE_FMT" ", i);
+    printf("    >8\n");
+    for (i = 0; i < 9; i++) printf("%6"SIZE_FMT" ", cnts[i]);
+    printf("%6"SIZE_FMT"\n", cnts[9]);
+    return;                     /* print the statistics */
+  }                             /* and abort the function */
   for (i = 0; i < tab->size; i++){ /* traverse the bin array */
     for (len = 0, e = tab->bins[i]; e; e = e->succ)
       len++;                    /* determine bin list length */
@@ -478,13 +718,14 @@ void st_stats (const SYMTAB *tab)
 #ifdef IDMAPFN
 
 IDMAP* idm_create (size_t init, size_t max, HASHFN hashfn,
-                   CMPFN cmpfn, void *data, OBJFN delfn)
+                   CMPFN cmpfn, void *data, OBJFN delfn, int mode)
 {                               /* --- create a name/identifier map */
-  IDMAP *idm;                   /* created name/identifier map */
+  IDMAP  *idm;                  /* created name/identifier map */
 
   idm = st_create(init, max, hashfn, cmpfn, data, delfn);
   if (!idm) return NULL;        /* create a name/identifier map */
   idm->idsize = 0;              /* and clear the id. array size */
+  if (st_setmode(idm, mode) != 0) { st_delete(idm); return NULL; }
   return idm;                   /* return created name/id map */
 }  /* idm_create() */
 
@@ -22,6 +22,9 @@
             2013.02.03 argument of idm_getid() changed to const void*
             2013.02.11 general pointers added as possible keys
             2013.03.07 size-related data types changed to size_t
+            2026.10.14 open addressing mode for identifier maps added
+            2026.10.14 st_setmode(), st_insertx(), st_lookupx() added
+            2026.10.14 function st_prefetch() added (prefetch bin/slot)
 ----------------------------------------------------------------------*/
 #ifndef __SYMTAB__
 #define __SYMTAB__
@@ -97,6 +100,10 @@
 #define EXISTS    ((void*)-1)   /* symbol exists already */
 #define IDMAP     SYMTAB        /* id maps are special symbol tables */
 
+/* --- symbol table modes --- */
+#define ST_CHAINED   0x00       /* hash bins with element lists */
+#define ST_OPENADR   0x01       /* open addressing (Robin Hood) */
+
 /* --- abbreviations for standard function sets --- */
 #define ST_STRFN  st_strhash, st_strcmp, NULL
 #define ST_INTFN  st_inthash, st_intcmp, NULL
@@ -117,6 +124,17 @@ typedef struct ste {            /* --- symbol table element --- */
   size_t     level;             /* visibility level */
 } STE;                          /* (symbol table element) */
 
+typedef struct {                /* --- open addressing slot --- */
+  size_t     hash;              /* (mixed) hash value of the key */
+  STE        *ste;              /* symbol table element */
+} STSLOT;                       /* (open addressing slot) */
+
+typedef struct stblk {          /* --- block of symbol elements --- */
+  struct stblk *succ;           /* successor in block list */
+  size_t     size;              /* size of the block (in bytes) */
+  size_t     used;              /* number of used bytes */
+} STBLK;                        /* (block of symbol elements) */
+
 typedef struct {                /* --- symbol table --- */
   size_t     cnt;               /* current number of symbols */
   size_t     level;             /* current visibility level */
@@ -127,6 +145,9 @@ typedef struct {                /* --- symbol table --- */
   void       *data;             /* comparison data */
   OBJFN      *delfn;            /* symbol deletion function */
   STE        **bins;            /* array of hash bins */
+  int        mode;              /* table mode (e.g. ST_OPENADR) */
+  STSLOT     *slots;            /* slot array (open addressing) */
+  STBLK      *blks;             /* blocks of symbol elements */
   size_t     idsize;            /* size of identifier array */
   IDENT      **ids;             /* identifier array */
 } SYMTAB;                       /* (symbol table) */
@@ -160,10 +181,17 @@ extern size_t      st_ptrsize (const void *p);
 extern SYMTAB*     st_create  (size_t init, size_t max, HASHFN hashfn,
                                CMPFN cmpfn, void *data, OBJFN delfn);
 extern void        st_delete  (SYMTAB *tab);
+extern int         st_setmode (SYMTAB *tab, int mode);
 extern void*       st_insert  (SYMTAB *tab, const void *key, int type,
                                size_t keysize, size_t datasize);
+extern void*       st_insertx (SYMTAB *tab, const void *key, int type,
+                               size_t keysize, size_t datasize,
+                               size_t hash);
 extern int         st_remove  (SYMTAB *tab, const void *key, int type);
 extern void*       st_lookup  (SYMTAB *tab, const void *key, int type);
+extern void*       st_lookupx (SYMTAB *tab, const void *key, int type,
+                               size_t hash);
+extern void        st_prefetch(SYMTAB *tab, size_t hash);
 extern void        st_begblk  (SYMTAB *tab);
 extern void        st_endblk  (SYMTAB *tab);
 extern size_t      st_symcnt  (const SYMTAB *tab);
@@ -179,7 +207,8 @@ extern void        st_stats   (const SYMTAB *tab);
 ----------------------------------------------------------------------*/
 #ifdef IDMAPFN
 extern IDMAP*      idm_create (size_t init, size_t max, HASHFN hashfn,
-                               CMPFN cmpfn, void *data, OBJFN delfn);
+                               CMPFN cmpfn, void *data, OBJFN delfn,
+                               int mode);
 extern void        idm_delete (IDMAP* idm);
 extern void*       idm_add    (IDMAP* idm, const void *key,
                                size_t keysize, size_t datasize);
@@ -27,10 +27,14 @@
             2011.03.20 order of arguments of trd_istype() changed
             2013.03.20 record and position type changed to size_t
             2013.10.15 check of ferror() added to trd_close()
+            2026.10.14 bulk scanning of fields in the read buffer
 ----------------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#ifdef __SSE2__                 /* if SSE2 instructions available */
+#include <emmintrin.h>          /* use them for separator scanning */
+#endif
 #include "tabread.h"
 #include "escape.h"
 #ifdef STORAGE
@@ -77,6 +81,8 @@ TABREAD* trd_create (void)
   trd->rec   = 1;               /* current record is the first */
   trd->pos   = 0;               /* position is before first field */
   trd->field[trd->len = 0] = 0; /* current field is empty */
+  trd->fld   = trd->field;      /* (field is not in read buffer) */
+  trd->nsep  = -1;              /* separators are not collected yet */
   memset(trd->flags, 0, sizeof(trd->flags));
   trd->flags['\n'] = TRD_RECSEP;
   trd->flags['\t'] = trd->flags[' '] = TRD_BLANK|TRD_FLDSEP;
@@ -120,6 +126,7 @@ int trd_open (TABREAD *trd, FILE *file, const char *name)
   trd->rec   = 1;               /* current record is the first */
   trd->pos   = 0;               /* position is before first field */
   trd->field[trd->len = 0] = 0; /* current field is empty */
+  trd->fld   = trd->field;      /* (field is not in read buffer) */
   return 0;                     /* return 'ok' */
 }  /* trd_open() */
 
@@ -152,6 +159,7 @@ void trd_chars (TABREAD *trd, int type, const char *chars)
   type &= ~TRD_ADD;             /* remove the flag for adding */
   for (s = (char*)chars; *s; )  /* set the character flags */
     trd->flags[esc_decode(s, &s)] |= type;
+  trd->nsep = -1;               /* separators must be recollected */
 }  /* trd_chars() */
 
 /*--------------------------------------------------------------------*/
@@ -192,15 +200,64 @@ int trd_ungetc (TABREAD *trd, int c)
 
 /*--------------------------------------------------------------------*/
 
+static void sepset (TABREAD *trd)
+{                               /* --- collect separator characters */
+  int c;                        /* loop variable for characters */
+
+  for (trd->nsep = 0, c = 0; c < 256; c++) {
+    if (!issep(c)) continue;    /* traverse the separators and */
+    if (trd->nsep < TRD_MAXSEP) /* store them for bulk scanning */
+      trd->seps[trd->nsep] = (char)c;
+    trd->nsep++;                /* count the separators (bulk scan */
+  }                             /* is possible only for few of them) */
+}  /* sepset() */
+
+/*--------------------------------------------------------------------*/
+
+static char* sepscan (TABREAD *trd, char *s, char *e)
+{                               /* --- find the next separator */
+  #ifdef __SSE2__               /* if SSE2 instructions available */
+  int     i, n, b;              /* loop variable, number of seps. */
+  __m128i v[TRD_MAXSEP];        /* separator characters (broadcast) */
+  __m128i x, m;                 /* loaded characters, match mask */
+
+  n = trd->nsep;                /* get the number of separators */
+  if ((n > 0) && (n <= TRD_MAXSEP) && (e-s >= 16)) {
+    for (i = 0; i < n; i++)     /* broadcast the separators */
+      v[i] = _mm_set1_epi8(trd->seps[i]);
+    for ( ; e-s >= 16; s += 16){/* traverse blocks of 16 characters */
+      x = _mm_loadu_si128((const __m128i*)s);
+      m = _mm_cmpeq_epi8(x, v[0]);
+      for (i = 1; i < n; i++)   /* compare to all separators */
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(x, v[i]));
+      b = _mm_movemask_epi8(m); /* get the bit mask of matches */
+      if (b == 0) continue;     /* if there is no separator, skip */
+      #ifdef __GNUC__           /* if GNU C compiler (or compatible) */
+      return s +__builtin_ctz((unsigned int)b);
+      #else                     /* if other compiler */
+      while (!(b & 1)) { b >>= 1; s++; }
+      return s;                 /* return the position of */
+      #endif                    /* the first separator */
+    }
+  }                             /* scan the rest character-wise */
+  #endif
+  while ((s < e) && !issep(*s)) s++;
+  return s;                     /* find the next separator */
+}  /* sepscan() */
+
+/*--------------------------------------------------------------------*/
+
 int trd_read (TABREAD *trd)
 {                               /* --- read the next table field */
   int  c, d;                    /* character read, delimiter type */
   char *p, *e;                  /* to traverse the field */
+  char *f;                      /* start of the field in the buffer */
 
   /* --- initialize --- */
   assert(trd && trd->file);     /* check the function arguments */
   trd->pos = (trd->delim == TRD_FLD) ? trd->pos+1 : 1;
   trd->field[trd->len = 0] = 0; /* clear the current field */
+  trd->fld = trd->field;        /* (field is not in read buffer) */
   GETC(trd, c, TRD_EOF);        /* get the first character */
 
   /* --- skip comment records --- */
@@ -226,26 +283,43 @@ int trd_read (TABREAD *trd)
   /* record separator. EOF is returned only if no character could */
   /* be read before the end of file/input is encountered.         */
 
+  /* --- scan the field in the buffer --- */
+  if (trd->nsep < 0) sepset(trd); /* collect the separators */
+  f = trd->next -1;             /* get the first field character */
+  e = (trd->end -f > TRD_MAXLEN) ? f +TRD_MAXLEN+1 : trd->end;
+  p = sepscan(trd, trd->next, e);
+  if (p < e) {                  /* if separator found in the buffer */
+    trd->next = p+1;            /* consume the separator, */
+    c = (unsigned char)*p;      /* get and classify it, and */
+    d = (isfldsep(c)) ? TRD_FLD : TRD_REC;
+    trd->fld = f; }             /* use the buffer as the field */
+  /* If the field is contained in the buffer and does not exceed */
+  /* the maximum field length, it is not copied. The terminating */
+  /* '\0' is written over the separator or a trailing blank,     */
+  /* both of which have already been consumed at this point.     */
+
   /* --- read the field --- */
-  p = trd->field; e = p +TRD_MAXLEN;
-  while (1) {                   /* field read loop */
-    if (p < e) *p++ = (char)c;  /* append the last character */
-    c = trd_getc(trd);          /* and get the next character */
-    if (c < 0)    { d = (c <= TRD_ERR) ? TRD_ERR : TRD_REC; break; }
-    if (issep(c)) { d = (isfldsep(c))  ? TRD_FLD : TRD_REC; break; }
-  }                             /* while character is no separator */
+  else {                        /* if the field crosses the buffer */
+    p = trd->field; e = p +TRD_MAXLEN;
+    while (1) {                 /* field read loop */
+      if (p < e) *p++ = (char)c;/* append the last character */
+      c = trd_getc(trd);        /* and get the next character */
+      if (c < 0)    { d = (c <= TRD_ERR) ? TRD_ERR : TRD_REC; break; }
+      if (issep(c)) { d = (isfldsep(c))  ? TRD_FLD : TRD_REC; break; }
+    }                           /* while character is no separator */
+  }
   trd->last = c;                /* store the last character read */
 
   /* --- remove trailing blanks --- */
   while (isblank(*--p));        /* skip blank characters at the end */
   *++p = '\0';                  /* and terminate the current field */
-  trd->len = (size_t)(p -trd->field); /* store number of characters */
+  trd->len = (size_t)(p -trd->fld); /* store number of characters */
 
   /* --- check for a null value --- */
-  while (--p >= trd->field)     /* check for only null value chars. */
+  while (--p >= trd->fld)       /* check for only null value chars. */
     if (!isnull((unsigned char)*p)) break;
-  if (p < trd->field)           /* clear field if null value */
-    trd->field[trd->len = 0] = 0;
+  if (p < trd->fld) {           /* clear field if null value */
+    trd->fld = trd->field; trd->field[trd->len = 0] = 0; }
 
   /* --- check for end of line --- */
   if (d != TRD_FLD) {           /* if not at a field separator */
@@ -256,6 +330,10 @@ int trd_read (TABREAD *trd)
   /* --- skip trailing blanks --- */
   while (isblank(c)) {          /* while character is blank, */
     trd->last = c;              /* note the last character */
+    if ((trd->next >= trd->end) && (trd->fld != trd->field)) {
+      memcpy(trd->field, trd->fld, trd->len+1);
+      trd->fld = trd->field;    /* copy the field out of the buffer */
+    }                           /* before the buffer is refilled */
     GETC(trd, c, TRD_REC);      /* and get the next character */
   }
   if (isrecsep(c)) {            /* check for a record separator */
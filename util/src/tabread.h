@@ -21,6 +21,7 @@
             2010.10.13 name of input file added, error info. simplified
             2011.03.20 order of arguments of trd_istype() changed
             2013.03.20 record and position type changed to size_t
+            2026.10.14 fields returned as slices of the read buffer
 ----------------------------------------------------------------------*/
 #ifndef __TABREAD__
 #define __TABREAD__
@@ -51,6 +52,8 @@
 /* --- buffer size --- */
 #define TRD_BUFSIZE  65536      /* size of internal read buffer */
 #define TRD_MAXLEN    1024      /* maximum length of a field */
+#define TRD_MAXSEP       8      /* maximum number of separators */
+                                /* for bulk (vectorized) scanning */
 
 #define TRD_FPOS(r)  trd_name(r), trd_rec(r), trd_pos(r)
 #define TRD_INFO(r)  trd_name(r), trd_rec(r), trd_pos(r), trd_field(r)
@@ -66,6 +69,9 @@ typedef struct {                /* --- table reader --- */
   size_t len;                   /* number of characters read */
   size_t rec;                   /* number of current record */
   size_t pos;                   /* number of current field */
+  char   *fld;                  /* current field (buffer or copy) */
+  int    nsep;                  /* number of separator characters */
+  char   seps [TRD_MAXSEP];     /* separator characters */
   char   *next;                 /* next character to read */
   char   *end;                  /* current end of the buffer */
   int    flags[256];            /* character flags */
@@ -108,12 +114,13 @@ extern size_t   trd_pos    (TABREAD *trd);
 #define trd_file(r)        ((r)->file)
 #define trd_name(r)        ((r)->name)
 
-#define trd_copy(d,s)      memcpy((d)->flags, (s)->flags, \
-                                       sizeof((s)->flags))
+#define trd_copy(d,s)      (memcpy((d)->flags, (s)->flags, \
+                                       sizeof((s)->flags)), \
+                            (void)((d)->nsep = -1))
 #define trd_istype(r,c,t)  ((r)->flags[(unsigned char)(c)] & (t))
 #define trd_type(r,c)      ((r)->flags[(unsigned char)(c)])
 
-#define trd_field(r)       ((r)->field)
+#define trd_field(r)       ((r)->fld)
 #define trd_len(r)         ((r)->len)
 #define trd_last(r)        ((r)->last)
 #define trd_delim(r)       ((r)->delim)
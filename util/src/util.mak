@@ -11,6 +11,7 @@
 #           2008.08.18 adapted to main functions of arrays and lists
 #           2008.08.22 module escape added, test program tsctest added
 #           2016.04.20 completed dependencies on header files
+#           2026.10.14 module bench added (benchmark records)
 #-----------------------------------------------------------------------
 THISDIR = ../../util/src
 
@@ -128,6 +129,12 @@ params.obj:   params.h params.c util.mak
 sigint.obj:   sigint.h sigint.c util.mak
 	$(CC) $(CFLAGS) sigint.c /Fo$@
 
+#-----------------------------------------------------------------------
+# Benchmark Records
+#-----------------------------------------------------------------------
+bench.obj:    bench.h bench.c util.mak
+	$(CC) $(CFLAGS) bench.c /Fo$@
+
 #-----------------------------------------------------------------------
 # Clean up
 #-----------------------------------------------------------------------